@@ -64,6 +64,7 @@ int main(int argc, char *argv[]) {
     optionsVisible.add_options()
         ("config", opt::value<std::vector<std::string> >(),
             "server configuration filename (can also pass without a flag as a positional option)")
+        ("watch,w", "reload the config file when it changes, applying what can be applied without a restart")
         ("help,h", "display this help message")
         ("verbose,v", "enable verbose logging")
         ("debug,d", "enable debug logging");
@@ -116,7 +117,12 @@ int main(int argc, char *argv[]) {
         configPaths = osvr::server::getDefaultConfigFilePaths();
     }
 
-    server = osvr::server::configureServerFromFirstFileInList(configPaths);
+    if (values.count("watch")) {
+        server = osvr::server::configureServerFromFirstFileInListAndWatch(
+            configPaths);
+    } else {
+        server = osvr::server::configureServerFromFirstFileInList(configPaths);
+    }
     if (!server) {
         // only attempt to load the empty config if no arguments are passed.
         if (!values.count("config")) {
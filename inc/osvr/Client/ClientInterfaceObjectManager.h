@@ -27,18 +27,23 @@
 
 // Internal Includes
 #include <osvr/Client/Export.h>
+#include <osvr/Common/ClientInterestFilter.h>
 #include <osvr/Common/ClientInterfacePtr.h>
 #include <osvr/Common/PathTreeObserverPtr.h>
+#include <osvr/Common/ResolveTreeNode.h>
 #include <osvr/Util/Logger.h>
 #include <osvr/Common/PathTree_fwd.h>
 #include <osvr/Common/ClientContext_fwd.h>
 #include <osvr/Client/InterfaceTree.h>
+#include <osvr/Util/TimeValue.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
+#include <functional>
 #include <string>
+#include <unordered_map>
 
 namespace osvr {
 namespace common {
@@ -78,6 +83,18 @@ namespace client {
         /// @brief run update on all remote handlers
         OSVR_CLIENT_EXPORT void updateHandlers();
 
+        /// @brief Function passed this client's ID and the sources (devices)
+        /// its interfaces currently resolve to, so it can advertise them to
+        /// the server.
+        typedef std::function<void(
+            std::string const &,
+            common::ClientInterestFilter::Interest const &)> InterestCallback;
+
+        /// @brief Set the function advertising our interest: called from
+        /// updateHandlers() whenever the set of sources changes, and
+        /// periodically even if it doesn't.
+        OSVR_CLIENT_EXPORT void setInterestCallback(InterestCallback cb);
+
       private:
         /// @brief Given a path, remove any existing handler for that path, then
         /// attempt to fully resolve the path to its source and construct a
@@ -95,6 +112,10 @@ namespace client {
         /// or more interface objects but no remote handler.
         void m_connectNeededCallbacks();
 
+        /// @brief Collects the sources our interfaces resolve to, with their
+        /// requested maximum rates, and passes them to the interest callback.
+        void m_advertiseInterest(util::time::TimeValue const &now);
+
         /// @brief Access the client context's logger.
         util::log::LoggerPtr const &logger() const;
 
@@ -106,6 +127,10 @@ namespace client {
         /// common::PathTreeOwner passed into constructor.
         common::PathTree &m_pathTree;
 
+        /// @brief Resolved sources for paths (and alias targets) in
+        /// m_pathTree, shared by all interfaces.
+        common::PathResolutionCache m_resolutionCache;
+
         /// @brief Path tree "observer" through which we register callbacks on
         /// common::PathTreeOwner events.
         common::PathTreeObserverPtr m_treeObserver;
@@ -115,6 +140,19 @@ namespace client {
 
         /// @brief The client context that owns us.
         common::ClientContext *m_ctx;
+
+        /// @brief Device name each path with a handler resolved to.
+        std::unordered_map<std::string, std::string> m_pathSources;
+
+        /// @brief Identifies this client in interest advertisements.
+        std::string m_clientId;
+
+        InterestCallback m_interestCallback;
+
+        /// @brief Whether m_pathSources has changed since we last advertised.
+        bool m_interestDirty = true;
+
+        util::time::TimeValue m_lastAdvertised;
     };
 } // namespace client
 } // namespace osvr
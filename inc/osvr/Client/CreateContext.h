@@ -28,6 +28,7 @@
 // Internal Includes
 #include <osvr/Client/Export.h>
 #include <osvr/Common/ClientContext_fwd.h>
+#include <osvr/Common/InProcessTrackerTransport_fwd.h>
 
 // Library/third-party includes
 // - none
@@ -43,9 +44,12 @@ namespace client {
     OSVR_CLIENT_EXPORT common::ClientContext *
     createContext(const char appId[], const char host[] = "localhost");
 
-    OSVR_CLIENT_EXPORT common::ClientContext *
-    createAnalysisClientContext(const char appId[], const char host[],
-                                vrpn_ConnectionPtr const& conn);
+    /// @param trackerTransport If the server's connection delivers tracker
+    /// reports in-process, the transport it uses.
+    OSVR_CLIENT_EXPORT common::ClientContext *createAnalysisClientContext(
+        const char appId[], const char host[], vrpn_ConnectionPtr const &conn,
+        common::InProcessTrackerTransportPtr const &trackerTransport =
+            common::InProcessTrackerTransportPtr());
 } // namespace client
 } // namespace osvr
 
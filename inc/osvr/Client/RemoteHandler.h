@@ -41,6 +41,12 @@ namespace client {
       public:
         virtual ~RemoteHandler();
         virtual void update() = 0;
+
+        /// @brief Whether reports only reach this handler while the client
+        /// advertises interest in its device. Handlers fed some other way
+        /// (such as by multicast) can say no, so the server can skip sending
+        /// this client VRPN copies of them.
+        virtual bool needsConnectionReports() const { return true; }
     };
     typedef shared_ptr<RemoteHandler> RemoteHandlerPtr;
 } // namespace client
@@ -32,6 +32,7 @@
 #include <osvr/Client/ViewerEye.h>
 #include <osvr/Client/InternalInterfaceOwner.h>
 #include <osvr/Util/ContainerWrapper.h>
+#include <osvr/Util/TimeValueC.h>
 
 // Library/third-party includes
 // - none
@@ -58,6 +59,11 @@ namespace client {
         }
 
         OSVR_CLIENT_EXPORT OSVR_Pose3 getPose() const;
+        /// @overload
+        ///
+        /// Also retrieves the timestamp of the tracker report the pose is
+        /// from.
+        OSVR_CLIENT_EXPORT OSVR_Pose3 getPose(OSVR_TimeValue &timestamp) const;
         OSVR_CLIENT_EXPORT bool hasPose() const;
 
       private:
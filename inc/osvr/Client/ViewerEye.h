@@ -89,6 +89,17 @@ namespace client {
 
         OSVR_CLIENT_EXPORT Eigen::Matrix4d getView() const;
 
+        /// @name Computing from a given viewer pose
+        /// @brief Eyes follow the same tracker as their viewer: these apply
+        /// this eye's offsets to an already-retrieved viewer pose, so all eyes
+        /// of a frame can share one, instead of each retrieving its own.
+        /// @{
+        OSVR_CLIENT_EXPORT OSVR_Pose3
+        getPose(OSVR_Pose3 const &viewerPose) const;
+        OSVR_CLIENT_EXPORT Eigen::Matrix4d
+        getView(OSVR_Pose3 const &viewerPose) const;
+        /// @}
+
         bool wantDistortion() const {
             return m_radDistortParams.is_initialized();
         }
@@ -132,6 +143,8 @@ namespace client {
             util::Angle opticalAxisOffsetY = 0. * util::radians);
         util::Rectd m_getRect(double near, double far) const;
         Eigen::Isometry3d getPoseIsometry() const;
+        Eigen::Isometry3d
+        getPoseIsometry(OSVR_Pose3 const &viewerPose) const;
         InternalInterfaceOwner m_pose;
         Eigen::Vector3d m_offset;
 #if 0
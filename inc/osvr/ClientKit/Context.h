@@ -117,6 +117,11 @@ namespace clientkit {
         return osvrClientCheckStatus(m_context) == OSVR_RETURN_SUCCESS;
     }
 
+    inline bool ClientContext::getServerClockOffset(double &offset) const {
+        return osvrClientGetServerClockOffset(m_context, &offset, NULL,
+                                              NULL) == OSVR_RETURN_SUCCESS;
+    }
+
     inline void ClientContext::log(OSVR_LogLevel severity, const char* message) {
         osvrClientLog(m_context, severity, message);
     }
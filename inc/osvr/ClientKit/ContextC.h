@@ -100,6 +100,28 @@ OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode osvrClientUpdate(OSVR_ClientContext ctx);
 OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
 osvrClientCheckStatus(OSVR_ClientContext ctx);
 
+/** @brief Gets the estimated offset between the server clock (which stamps
+    reports) and the client clock, kept up to date while connected.
+
+    The estimate comes from timestamped request/response exchanges with the
+    server, so is only as precise as the shortest recent round trip allows.
+
+    @param ctx Client context
+    @param[out] offset Server clock minus client clock now, in seconds.
+    @param[out] drift Rate of the server clock relative to the client clock,
+    minus one: positive if the server clock runs fast. Reported as 0 until
+    there has been time to measure it. May be null.
+    @param[out] roundTrip Round trip, in seconds, of the exchange the estimate
+    is based on: twice the worst-case error of the offset. May be null.
+
+    @return OSVR_RETURN_FAILURE if invalid parameters were passed or there is
+    no estimate (not yet, or because the context shares the server's clock),
+    in which case the output arguments are unmodified.
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientGetServerClockOffset(OSVR_ClientContext ctx, double *offset,
+                               double *drift, double *roundTrip);
+
 /** @brief Shutdown the library.
     @param ctx Client context
 */
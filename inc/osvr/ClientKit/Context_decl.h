@@ -103,6 +103,14 @@ namespace clientkit {
         /// from false to true without calling update() - consider a loop.
         bool checkStatus() const;
 
+        /// @brief Gets the estimated offset, in seconds, between the server
+        /// clock and ours (server minus client): see
+        /// osvrClientGetServerClockOffset().
+        ///
+        /// @return false if there is no estimate, in which case the arguments
+        /// are unmodified.
+        bool getServerClockOffset(double &offset) const;
+
         /// @brief Gets the bare OSVR_ClientContext.
         OSVR_ClientContext get();
 
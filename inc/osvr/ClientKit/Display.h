@@ -35,7 +35,7 @@
 // - none
 
 // Standard includes
-// - none
+#include <vector>
 
 /// @name Overloads taking output parameters by reference
 /// @{
@@ -487,6 +487,38 @@ namespace clientkit {
             return dimensions;
         }
 
+        /// @brief Attempt to get the poses and matrices for all surfaces at
+        /// once, consistently computed from a single tracker report, resizing
+        /// @p snapshots to fit.
+        ///
+        /// Reusing the same vector from frame to frame avoids allocation.
+        ///
+        /// @sa osvrClientGetDisplayFrameSnapshot()
+        /// @return false if there was an error in the input parameters or if
+        /// no pose is yet available.
+        bool
+        getFrameSnapshot(double near, double far, OSVR_MatrixConventions flags,
+                         std::vector<OSVR_DisplaySurfaceSnapshot> &snapshots) {
+            ensureValid();
+            size_t count = 0;
+            OSVR_ReturnCode ret = osvrClientGetDisplayFrameSnapshot(
+                m_disp, near, far, flags,
+                snapshots.empty() ? NULL : &snapshots[0], snapshots.size(),
+                &count);
+            if (ret != OSVR_RETURN_SUCCESS && count > snapshots.size()) {
+                /// Just needed more room.
+                snapshots.resize(count);
+                ret = osvrClientGetDisplayFrameSnapshot(
+                    m_disp, near, far, flags, &snapshots[0], snapshots.size(),
+                    &count);
+            }
+            if (ret != OSVR_RETURN_SUCCESS) {
+                return false;
+            }
+            snapshots.resize(count);
+            return true;
+        }
+
         /// @name Child-related methods
         /// @{
         OSVR_ViewerCount getNumViewers() const {
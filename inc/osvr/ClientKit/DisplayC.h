@@ -39,12 +39,13 @@
 #include <osvr/Util/Pose3C.h>
 #include <osvr/Util/BoolC.h>
 #include <osvr/Util/RadialDistortionParametersC.h>
+#include <osvr/Util/TimeValueC.h>
 
 /* Library/third-party includes */
 /* none */
 
 /* Standard includes */
-/* none */
+#include <stddef.h>
 
 OSVR_EXTERN_C_BEGIN
 /** @addtogroup ClientKit
@@ -497,6 +498,59 @@ osvrClientGetViewerEyeSurfaceRadialDistortion(
     OSVR_DisplayConfig disp, OSVR_ViewerCount viewer, OSVR_EyeCount eye,
     OSVR_SurfaceCount surface, OSVR_RadialDistortionParameters *params);
 
+/** @brief The pose-dependent rendering data for one surface seen by an eye of
+    a viewer, as captured by osvrClientGetDisplayFrameSnapshot().
+*/
+typedef struct OSVR_DisplaySurfaceSnapshot {
+    OSVR_ViewerCount viewer;
+    OSVR_EyeCount eye;
+    OSVR_SurfaceCount surface;
+    /** @brief Timestamp of the tracker report the poses were computed from. */
+    OSVR_TimeValue timestamp;
+    /** @brief As from osvrClientGetViewerPose() */
+    OSVR_Pose3 viewerPose;
+    /** @brief As from osvrClientGetViewerEyePose() */
+    OSVR_Pose3 eyePose;
+    /** @brief As from osvrClientGetViewerEyeViewMatrixd() */
+    double viewMatrix[OSVR_MATRIX_SIZE];
+    /** @brief As from osvrClientGetViewerEyeSurfaceProjectionMatrixd() */
+    double projectionMatrix[OSVR_MATRIX_SIZE];
+} OSVR_DisplaySurfaceSnapshot;
+
+/** @brief Get the viewer pose, eye poses, view matrices, and projection
+    matrices for every surface in a display config, in a single call.
+
+    Each viewer's pose is retrieved only once, and its eyes computed from it,
+    so all the data is consistent (all from the same tracker report) - unlike
+    making the individual calls, between which a new report may arrive. It is
+    also cheaper than the dozen or so calls a stereo renderer would otherwise
+    make each frame.
+
+    Will only succeed if osvrClientCheckDisplayStartup() succeeds.
+
+    @param disp Display config object
+    @param near Distance from viewpoint to near clipping plane - must be
+    positive.
+    @param far Distance from viewpoint to far clipping plane - must be positive
+    and not equal to near, typically greater than near.
+    @param flags Bitwise OR of matrix convention flags (see @ref MatrixFlags),
+    applied to both view and projection matrices.
+    @param[out] snapshots Array to fill, one entry per surface, in viewer, eye,
+    surface order. May be null if @p capacity is 0.
+    @param capacity Number of entries in @p snapshots.
+    @param[out] count Number of entries required (and written, on success).
+
+    @return OSVR_RETURN_FAILURE if invalid parameters were passed, if no pose
+    was yet available, or if @p capacity was too small (in which case @p count
+    still reports the number required), in which case @p snapshots is
+    unmodified.
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientGetDisplayFrameSnapshot(OSVR_DisplayConfig disp, double near,
+                                  double far, OSVR_MatrixConventions flags,
+                                  OSVR_DisplaySurfaceSnapshot *snapshots,
+                                  size_t capacity, size_t *count);
+
 /** @}
     @}
 */
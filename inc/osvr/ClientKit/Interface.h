@@ -37,7 +37,7 @@
 #include <boost/function.hpp>
 
 // Standard includes
-// - none
+#include <stdexcept>
 
 namespace osvr {
 
@@ -63,6 +63,25 @@ namespace clientkit {
         m_interface = NULL;
     }
 
+    inline void Interface::setMaxReportRate(double maxRate) {
+        osvrClientSetInterfaceMaxReportRate(m_interface, maxRate);
+    }
+
+    inline OSVR_ReportAgeStatistics Interface::getReportAge() const {
+        OSVR_ReportAgeStatistics stats;
+        OSVR_ReturnCode ret =
+            osvrClientGetInterfaceReportAge(m_interface, &stats);
+        if (OSVR_RETURN_SUCCESS != ret) {
+            throw std::logic_error(
+                "Could not get report age statistics: null interface!");
+        }
+        return stats;
+    }
+
+    inline void Interface::resetReportAge() {
+        osvrClientResetInterfaceReportAge(m_interface);
+    }
+
     inline void
     Interface::takeOwnership(util::boost_util::DeletablePtr const &obj) {
         m_deletables.push_back(obj);
@@ -35,6 +35,7 @@
 #include <osvr/Util/ReturnCodesC.h>
 #include <osvr/Util/AnnotationMacrosC.h>
 #include <osvr/Util/ClientOpaqueTypesC.h>
+#include <osvr/Util/StdInt.h>
 
 /* Library/third-party includes */
 /* none */
@@ -69,6 +70,70 @@ osvrClientGetInterface(OSVR_ClientContext ctx, const char path[],
 OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
 osvrClientFreeInterface(OSVR_ClientContext ctx, OSVR_ClientInterface iface);
 
+/** @brief Set the maximum rate at which this client would like to receive
+    continuous reports (e.g. tracker poses) from the source of an interface.
+
+    This is a hint to the server, which may ignore it (and does unless
+    configured to filter reports by client interest). If more than one
+    interface (or client) wants the same source, the highest rate applies.
+
+    @param iface The interface object
+    @param maxRate Maximum rate in Hz, or 0 (the default) for no limit.
+
+    @returns OSVR_RETURN_SUCCESS unless a null interface or a negative rate
+   was passed.
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientSetInterfaceMaxReportRate(OSVR_ClientInterface iface,
+                                    double maxRate);
+
+/** @brief Statistics of the age of reports from an interface when they were
+    delivered to the client: the time between the server-clock timestamp of
+    each report and its delivery, on the server clock according to
+    osvrClientGetServerClockOffset(). So this is the whole latency from the
+    device (or plugin) stamping a report through the server and transport to
+    the client, not counting any delay before the report was stamped.
+*/
+typedef struct OSVR_ReportAgeStatistics {
+    /** @brief Number of reports measured. */
+    uint64_t count;
+    /** @brief Age of the most recent report, in seconds. */
+    double last;
+    /** @brief Mean age, in seconds. */
+    double mean;
+    /** @brief Least age, in seconds. */
+    double min;
+    /** @brief Greatest age, in seconds. */
+    double max;
+} OSVR_ReportAgeStatistics;
+
+/** @brief Gets the age statistics of the reports delivered through an
+    interface since it was created or its statistics were reset.
+
+    Reports delivered before the context had an estimate of the server clock
+    (see osvrClientGetServerClockOffset()) are not measured: if it never has
+    one, the count stays zero.
+
+    @param iface The interface object
+    @param[out] stats The statistics.
+
+    @returns OSVR_RETURN_SUCCESS unless a null interface or output pointer was
+   passed.
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientGetInterfaceReportAge(OSVR_ClientInterface iface,
+                                OSVR_ReportAgeStatistics *stats);
+
+/** @brief Resets the report age statistics of an interface, e.g. to measure
+    over a particular period.
+
+    @param iface The interface object
+
+    @returns OSVR_RETURN_SUCCESS unless a null interface was passed.
+*/
+OSVR_CLIENTKIT_EXPORT OSVR_ReturnCode
+osvrClientResetInterfaceReportAge(OSVR_ClientInterface iface);
+
 /** @} */
 OSVR_EXTERN_C_END
 
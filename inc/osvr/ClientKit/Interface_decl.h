@@ -27,6 +27,7 @@
 #define INCLUDED_Interface_decl_h_GUID_8A07B1E7_4F57_4CA7_6BA8_3A262F486AB5
 
 // Internal Includes
+#include <osvr/ClientKit/InterfaceC.h>
 #include <osvr/Util/ClientCallbackTypesC.h>
 #include <osvr/Util/ClientOpaqueTypesC.h>
 #include <osvr/Util/BoostDeletable.h>
@@ -92,6 +93,21 @@ namespace clientkit {
         /// @throws std::logic_error if the interface is null or already freed.
         void free();
 
+        /// @brief Set the maximum rate, in Hz, at which this client would like
+        /// to receive continuous reports from this interface's source (0 for
+        /// no limit). A hint that the server may ignore.
+        void setMaxReportRate(double maxRate);
+
+        /// @brief Gets the age statistics of the reports delivered through
+        /// this interface (see osvrClientGetInterfaceReportAge()).
+        ///
+        /// @throws std::logic_error if the interface is null.
+        OSVR_ReportAgeStatistics getReportAge() const;
+
+        /// @brief Resets the age statistics of the reports delivered through
+        /// this interface.
+        void resetReportAge();
+
         /// @brief Take (shared) ownership of some Deletable object.
         void takeOwnership(util::boost_util::DeletablePtr const &obj);
 
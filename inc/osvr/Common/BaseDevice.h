@@ -116,6 +116,13 @@ namespace common {
         /// server_mainloop() in it!)
         virtual void m_update() = 0;
 
+        /// @brief Called with each message after it's packed, for derived
+        /// classes that need to see what's sent. Does nothing by default.
+        OSVR_COMMON_EXPORT virtual void
+        m_messagePacked(RawMessageType const &msgType,
+                        util::time::TimeValue const &timestamp,
+                        const char *buf, size_t len);
+
       private:
         /// @brief Call with a string identifying a message type, and get back
         /// an identifier.
@@ -42,6 +42,7 @@
 #include <vector>
 #include <stdexcept>
 #include <algorithm>
+#include <type_traits>
 
 namespace osvr {
 namespace common {
@@ -109,6 +110,71 @@ namespace common {
                       "Container must have byte-sized elements");
     };
 
+    /// @brief A byte container with a fixed capacity, stored inline (on the
+    /// stack, for a local Buffer), with just enough of the vector interface to
+    /// be used as the container of a Buffer.
+    ///
+    /// Appends are bounded copies into the storage: no allocation is ever
+    /// performed, and appending past the capacity throws rather than growing.
+    /// Usually sized at compile time for a fixed-layout message: see
+    /// FixedMessageBuffer.
+    template <size_t Capacity> class FixedCapacityByteArray {
+      public:
+        typedef BufferElement value_type;
+        typedef BufferElement *iterator;
+        typedef BufferElement const *const_iterator;
+
+        FixedCapacityByteArray() : m_size(0) {}
+
+        static size_t capacity() { return Capacity; }
+        size_t size() const { return m_size; }
+
+        BufferElement *data() {
+            return reinterpret_cast<BufferElement *>(&m_storage);
+        }
+        BufferElement const *data() const {
+            return reinterpret_cast<BufferElement const *>(&m_storage);
+        }
+
+        iterator begin() { return data(); }
+        iterator end() { return data() + m_size; }
+        const_iterator begin() const { return data(); }
+        const_iterator end() const { return data() + m_size; }
+
+        /// @brief Appends a range of bytes: only insertion at the end is
+        /// supported.
+        void insert(const_iterator pos, BufferElement const *first,
+                    BufferElement const *last) {
+            size_t n = last - first;
+            m_checkInsert(pos, n);
+            std::copy(first, last, end());
+            m_size += n;
+        }
+
+        /// @brief Appends n copies of a byte: only insertion at the end is
+        /// supported.
+        void insert(const_iterator pos, size_t n, BufferElement val) {
+            m_checkInsert(pos, n);
+            std::fill_n(end(), n, val);
+            m_size += n;
+        }
+
+      private:
+        void m_checkInsert(const_iterator pos, size_t n) const {
+            if (pos != end()) {
+                throw std::logic_error("Can only append to a fixed-capacity "
+                                       "byte array!");
+            }
+            if (Capacity - m_size < n) {
+                throw std::runtime_error(
+                    "Not enough room in the fixed-capacity byte array!");
+            }
+        }
+        typename std::aligned_storage<
+            Capacity, DesiredBufferAlignment::value>::type m_storage;
+        size_t m_size;
+    };
+
     /// @brief Provides for a single reading pass over a buffer. It is
     /// important that the buffer not change while a Reader obtained from it
     /// is still in scope.
@@ -29,6 +29,7 @@
 #include <osvr/Common/Export.h>
 #include <osvr/Common/ClientContext_fwd.h>
 #include <osvr/Common/ClientInterfacePtr.h>
+#include <osvr/Common/ClockSync_fwd.h>
 #include <osvr/Common/PathTree_fwd.h>
 #include <osvr/Common/Transform_fwd.h>
 #include <osvr/Common/ClientInterfaceFactory.h>
@@ -116,6 +117,11 @@ struct OSVR_ClientContextObject : boost::noncopyable {
     /// received, etc.)
     OSVR_COMMON_EXPORT bool getStatus() const;
 
+    /// @brief Gets the estimate of the server clock relative to ours, if
+    /// there is one: nullptr if the context has no separate server.
+    OSVR_COMMON_EXPORT osvr::common::ClockOffsetEstimator const *
+    getServerClock() const;
+
     /// @brief Logs a message from the client.
     OSVR_COMMON_EXPORT void log(osvr::util::log::LogLevel severity,
                                 const char *message);
@@ -139,6 +145,10 @@ struct OSVR_ClientContextObject : boost::noncopyable {
     virtual void m_update() = 0;
     virtual void m_sendRoute(std::string const &route) = 0;
     OSVR_COMMON_EXPORT virtual bool m_getStatus() const;
+    /// @brief Optional implementation of accessor for the server clock
+    /// estimate: the default has none.
+    OSVR_COMMON_EXPORT virtual osvr::common::ClockOffsetEstimator const *
+    m_getServerClock() const;
     /// @brief Optional implementation-specific handling of interface retrieval,
     /// before the interface is returned to the client.
     OSVR_COMMON_EXPORT virtual void
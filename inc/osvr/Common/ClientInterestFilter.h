@@ -0,0 +1,173 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_ClientInterestFilter_h_GUID_2EEAABA6_B4E3_4879_AD1B_32C3F152CC9E
+#define INCLUDED_ClientInterestFilter_h_GUID_2EEAABA6_B4E3_4879_AD1B_32C3F152CC9E
+
+// Internal Includes
+#include <osvr/Common/ClientInterestFilter_fwd.h>
+#include <osvr/Common/Export.h>
+#include <osvr/Util/SharedPtr.h>
+#include <osvr/Util/StdInt.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+namespace osvr {
+namespace common {
+    /// @brief Decides, on the server, which device reports are worth sending
+    /// at all, based on the sources that clients have advertised an interest
+    /// in (and the maximum report rates they've asked for).
+    ///
+    /// Clients advertise their interest periodically through the system
+    /// component; a client not heard from in a while is forgotten. The
+    /// underlying connection broadcasts every message to every endpoint, so
+    /// filtering is by the union of all clients' interests: a device's
+    /// reports are sent if any client wants them, at the highest rate any of
+    /// those clients asked for.
+    ///
+    /// Consulted for tracker, analog, and button reports and raw device
+    /// token messages. Messages from device components are always sent, since
+    /// some of them (e.g. pings) are protocol traffic rather than reports.
+    ///
+    /// Disabled by default, in which case everything is sent: once enabled,
+    /// clients that don't advertise their interest (older versions) will
+    /// only get the devices that some other client asked for.
+    ///
+    /// Not thread-safe: interest is updated, and devices consult their
+    /// entries, from the thread servicing the connection.
+    class ClientInterestFilter : boost::noncopyable {
+      public:
+        /// @brief Device names (fully-qualified, without any "@host" suffix)
+        /// a client wants reports from, each with the maximum rate in Hz it
+        /// wants them at, or 0 for no limit.
+        typedef std::map<std::string, double> Interest;
+
+        /// @brief How often, in milliseconds, clients should re-advertise
+        /// their interest even if it hasn't changed.
+        static const int REFRESH_INTERVAL_MS = 1000;
+
+        /// @brief How long, in milliseconds, the server keeps a client's
+        /// interest without hearing from it again.
+        static const int EXPIRY_MS = 3000;
+
+        /// @brief Combines two maximum rates (0 meaning no limit) into the
+        /// one that satisfies both.
+        static double combineMaxRates(double a, double b) {
+            if (a <= 0 || b <= 0) {
+                return 0;
+            }
+            return (std::max)(a, b);
+        }
+
+        /// @brief The filter's decision for a single device, consulted by the
+        /// device's server before each report.
+        class Device : boost::noncopyable {
+          public:
+            /// @brief Whether any client wants reports from this device. For
+            /// event-like reports (buttons, analogs, generic messages) that
+            /// must not be thinned out.
+            bool isWanted() const { return m_wanted; }
+
+            /// @brief Whether a report on a continuous stream (e.g. a
+            /// tracker sensor's pose) from this device should be sent now,
+            /// considering both interest and rate limits. Records the report
+            /// as sent if so.
+            ///
+            /// @param stream Identifies the stream within the device:
+            /// reports on one stream are decimated independently of others.
+            bool shouldSend(uint32_t stream, util::time::TimeValue const &tv) {
+                if (!m_wanted) {
+                    return false;
+                }
+                if (m_minInterval <= 0) {
+                    return true;
+                }
+                return m_checkRate(stream, tv);
+            }
+
+          private:
+            friend class ClientInterestFilter;
+            OSVR_COMMON_EXPORT bool
+            m_checkRate(uint32_t stream, util::time::TimeValue const &tv);
+
+            bool m_wanted = true;
+            /// @brief Minimum time between reports on a stream, in seconds,
+            /// or 0 for no limit.
+            double m_minInterval = 0;
+            std::unordered_map<uint32_t, util::time::TimeValue> m_lastSent;
+        };
+        typedef shared_ptr<Device> DevicePtr;
+
+        OSVR_COMMON_EXPORT ClientInterestFilter();
+
+        /// @brief Gets the entry for a device, by its fully-qualified name
+        /// (without any "@host" suffix), creating it if required.
+        OSVR_COMMON_EXPORT DevicePtr getDevice(std::string const &deviceName);
+
+        /// @brief Turn filtering on or off.
+        OSVR_COMMON_EXPORT void setEnabled(bool enabled);
+
+        bool isEnabled() const { return m_enabled; }
+
+        /// @brief Record (replacing any previous) the interest advertised by
+        /// a client.
+        OSVR_COMMON_EXPORT void
+        setClientInterest(std::string const &clientId,
+                          Interest const &interest,
+                          util::time::TimeValue const &now);
+
+        /// @brief Forget clients not heard from in EXPIRY_MS.
+        OSVR_COMMON_EXPORT void expireClients(util::time::TimeValue const &now);
+
+        /// @brief Number of clients whose interest is currently on record.
+        std::size_t getNumClients() const { return m_clients.size(); }
+
+      private:
+        /// @brief Applies the current set of interests to every device entry.
+        void m_update();
+        /// @brief Applies the current set of interests to one device entry.
+        void m_update(std::string const &deviceName, Device &dev) const;
+
+        struct ClientRecord {
+            Interest interest;
+            util::time::TimeValue lastHeard;
+        };
+        bool m_enabled = false;
+        std::unordered_map<std::string, ClientRecord> m_clients;
+        std::unordered_map<std::string, DevicePtr> m_devices;
+    };
+
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ClientInterestFilter_h_GUID_2EEAABA6_B4E3_4879_AD1B_32C3F152CC9E
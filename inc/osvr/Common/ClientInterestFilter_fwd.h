@@ -0,0 +1,45 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_ClientInterestFilter_fwd_h_GUID_0EAD54C0_AC2C_4CA0_99BD_140874482CEA
+#define INCLUDED_ClientInterestFilter_fwd_h_GUID_0EAD54C0_AC2C_4CA0_99BD_140874482CEA
+
+// Internal Includes
+#include <osvr/Util/SharedPtr.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+    class ClientInterestFilter;
+    typedef shared_ptr<ClientInterestFilter> ClientInterestFilterPtr;
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ClientInterestFilter_fwd_h_GUID_0EAD54C0_AC2C_4CA0_99BD_140874482CEA
@@ -29,6 +29,7 @@
 #include <osvr/Common/Export.h>
 #include <osvr/Common/ClientContext_fwd.h>
 #include <osvr/Common/ClientInterfacePtr.h>
+#include <osvr/Common/ClockSync.h>
 #include <osvr/Common/InterfaceState.h>
 #include <osvr/Common/InterfaceCallbacks.h>
 #include <osvr/Common/StateType.h>
@@ -125,6 +126,26 @@ struct OSVR_ClientInterfaceObject : boost::noncopyable {
 
     osvr::common::ClientContext &getContext() const { return m_ctx; }
 
+    /// @brief Set the maximum rate (Hz, 0 for no limit) at which the client
+    /// would like continuous reports from this interface's source: advertised
+    /// to the server along with the source.
+    void setMaxReportRate(double maxRate) { m_maxReportRate = maxRate; }
+
+    double getMaxReportRate() const { return m_maxReportRate; }
+
+    /// @brief Record how old a report with the given (server clock) timestamp
+    /// is as it is delivered. Does nothing until the context has an estimate
+    /// of the server clock.
+    OSVR_COMMON_EXPORT void recordReportAge(const OSVR_TimeValue &timestamp);
+
+    /// @brief Ages of the reports delivered since creation or the last
+    /// resetReportAge().
+    osvr::common::ReportAgeStatistics const &getReportAge() const {
+        return m_reportAge;
+    }
+
+    void resetReportAge() { m_reportAge.reset(); }
+
     /// @brief Access the type-erased data for this interface.
     boost::any &data() { return m_data; }
 
@@ -134,6 +155,8 @@ struct OSVR_ClientInterfaceObject : boost::noncopyable {
     osvr::common::InterfaceCallbacks m_callbacks;
     osvr::common::InterfaceState m_state;
     boost::any m_data;
+    double m_maxReportRate;
+    osvr::common::ReportAgeStatistics m_reportAge;
 };
 
 #endif // INCLUDED_ClientInterface_h_GUID_A3A55368_DE2F_4980_BAE9_1C398B0D40A1
@@ -0,0 +1,240 @@
+/** @file
+    @brief Header for estimating the offset between the server clock and a
+    client clock from timestamped request/response exchanges, and for
+    keeping statistics of how old reports are when delivered.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ClockSync_h_GUID_96EDA456_20FF_4AFF_B9E6_F5E26617D13E
+#define INCLUDED_ClockSync_h_GUID_96EDA456_20FF_4AFF_B9E6_F5E26617D13E
+
+// Internal Includes
+#include <osvr/Common/ClockSync_fwd.h>
+#include <osvr/Common/Export.h>
+#include <osvr/Util/StdInt.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <cstddef>
+#include <deque>
+
+namespace osvr {
+namespace common {
+    /// @brief Converts a time value to a count of microseconds.
+    inline int64_t timeToMicroseconds(util::time::TimeValue const &tv) {
+        return int64_t(tv.seconds) * 1000000 + tv.microseconds;
+    }
+
+    /// @brief Converts a (positive) count of microseconds to a time value.
+    inline util::time::TimeValue microsecondsToTime(int64_t us) {
+        util::time::TimeValue ret;
+        ret.seconds = us / 1000000;
+        ret.microseconds =
+            static_cast<OSVR_TimeValue_Microseconds>(us % 1000000);
+        return ret;
+    }
+
+    /// @brief Clock synchronization request from a client, stamped with the
+    /// client clock as it is sent.
+    struct ClockSyncRequest {
+        ClockSyncRequest() : client(0), sequence(0), clientSent(0) {}
+        /// @brief Random identifier of the requesting client: responses go
+        /// to every client on the connection.
+        uint64_t client;
+        uint32_t sequence;
+        /// @brief Client time the request was sent, in microseconds.
+        int64_t clientSent;
+
+        template <typename T> void processMessage(T &p) {
+            p(client);
+            p(sequence);
+            p(clientSent);
+        }
+    };
+
+    /// @brief Server response to a ClockSyncRequest, adding the server clock
+    /// times it was received and answered.
+    struct ClockSyncResponse {
+        ClockSyncResponse()
+            : client(0), sequence(0), clientSent(0), serverReceived(0),
+              serverSent(0) {}
+        explicit ClockSyncResponse(ClockSyncRequest const &request)
+            : client(request.client), sequence(request.sequence),
+              clientSent(request.clientSent), serverReceived(0),
+              serverSent(0) {}
+        uint64_t client;
+        uint32_t sequence;
+        int64_t clientSent;
+        /// @brief Server time the request was received, in microseconds.
+        int64_t serverReceived;
+        /// @brief Server time the response was sent, in microseconds.
+        int64_t serverSent;
+
+        template <typename T> void processMessage(T &p) {
+            p(client);
+            p(sequence);
+            p(clientSent);
+            p(serverReceived);
+            p(serverSent);
+        }
+    };
+
+    /// @brief The four times of a completed exchange, in microseconds: two
+    /// on each clock.
+    struct ClockSyncSample {
+        ClockSyncSample()
+            : clientSent(0), serverReceived(0), serverSent(0),
+              clientReceived(0) {}
+        ClockSyncSample(ClockSyncResponse const &response,
+                        int64_t clientReceivedTime)
+            : clientSent(response.clientSent),
+              serverReceived(response.serverReceived),
+              serverSent(response.serverSent),
+              clientReceived(clientReceivedTime) {}
+        int64_t clientSent;
+        int64_t serverReceived;
+        int64_t serverSent;
+        int64_t clientReceived;
+
+        /// @brief Server clock minus client clock, assuming the request and
+        /// the response took equally long in transit: off by at most half
+        /// the round trip if they didn't.
+        int64_t getOffset() const {
+            return ((serverReceived - clientSent) +
+                    (serverSent - clientReceived)) /
+                   2;
+        }
+
+        /// @brief Time spent in transit, not counting the time the server
+        /// took to respond.
+        int64_t getRoundTrip() const {
+            return (clientReceived - clientSent) -
+                   (serverSent - serverReceived);
+        }
+
+        /// @brief Client time half way through the exchange.
+        int64_t getMidpoint() const {
+            return clientSent + (clientReceived - clientSent) / 2;
+        }
+    };
+
+    /// @brief Estimates the offset and drift of the server clock relative to
+    /// a client clock, from request/response exchanges.
+    ///
+    /// Transit delays are rarely symmetric, so a single exchange is only
+    /// as good as its round trip is short. The offset is therefore taken
+    /// from the exchange with the shortest round trip among the most recent
+    /// few, and the drift is fit (by least squares) to the offsets of the
+    /// exchanges in a longer history whose round trips are close to the
+    /// shortest.
+    class ClockOffsetEstimator {
+      public:
+        /// @brief Number of most recent exchanges the offset is chosen from.
+        static const std::size_t WINDOW_SIZE = 8;
+        /// @brief Number of most recent exchanges drift is fit to.
+        static const std::size_t HISTORY_SIZE = 64;
+        /// @brief Shortest span of client time (microseconds) drift is fit
+        /// over: over less, jitter swamps any real drift.
+        static const int64_t MIN_DRIFT_SPAN = 5000000;
+        /// @brief Largest drift believed, in either direction: clocks are
+        /// rarely out by more than a few hundred parts per million.
+        OSVR_COMMON_EXPORT static const double MAX_DRIFT;
+
+        OSVR_COMMON_EXPORT ClockOffsetEstimator();
+
+        /// @brief Adds a completed exchange and updates the estimate.
+        ///
+        /// @return false if the exchange was rejected as impossible (a
+        /// negative round trip).
+        OSVR_COMMON_EXPORT bool addSample(ClockSyncSample const &sample);
+
+        /// @brief Forgets all exchanges, e.g. on reconnecting.
+        OSVR_COMMON_EXPORT void reset();
+
+        bool hasEstimate() const { return !m_history.empty(); }
+
+        /// @brief Server clock minus client clock, in seconds, as of the
+        /// exchange the estimate is based on.
+        double getOffset() const { return m_best.getOffset() / 1e6; }
+
+        /// @brief Server clock minus client clock, in seconds, at the given
+        /// client time, accounting for drift since the exchange the estimate
+        /// is based on.
+        OSVR_COMMON_EXPORT double
+        getOffsetAt(util::time::TimeValue const &clientTime) const;
+
+        /// @brief Rate of the server clock relative to the client clock,
+        /// minus one: positive if the server clock runs fast.
+        double getDrift() const { return m_drift; }
+
+        /// @brief Round trip, in seconds, of the exchange the estimate is
+        /// based on: twice the worst-case error of the offset.
+        double getRoundTrip() const { return m_best.getRoundTrip() / 1e6; }
+
+        /// @brief Number of exchanges accepted since construction or reset.
+        std::size_t getSampleCount() const { return m_sampleCount; }
+
+        /// @brief Converts a client time to the corresponding server time,
+        /// or returns it unchanged if there's no estimate yet.
+        OSVR_COMMON_EXPORT util::time::TimeValue
+        toServerTime(util::time::TimeValue const &clientTime) const;
+
+      private:
+        int64_t m_getOffsetAt(int64_t clientTime) const;
+        void m_estimateDrift();
+        std::deque<ClockSyncSample> m_history;
+        std::size_t m_sampleCount;
+        /// @brief The exchange the offset is taken from.
+        ClockSyncSample m_best;
+        double m_drift;
+    };
+
+    /// @brief Running statistics of the age of reports when delivered: how
+    /// long after the time they were stamped with, in seconds.
+    class ReportAgeStatistics {
+      public:
+        ReportAgeStatistics() { reset(); }
+
+        OSVR_COMMON_EXPORT void addSample(double age);
+        OSVR_COMMON_EXPORT void reset();
+
+        std::size_t getCount() const { return m_count; }
+        /// @brief Age of the most recent report.
+        double getLast() const { return m_last; }
+        double getMean() const { return m_mean; }
+        double getMin() const { return m_min; }
+        double getMax() const { return m_max; }
+
+      private:
+        std::size_t m_count;
+        double m_last;
+        double m_mean;
+        double m_min;
+        double m_max;
+    };
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ClockSync_h_GUID_96EDA456_20FF_4AFF_B9E6_F5E26617D13E
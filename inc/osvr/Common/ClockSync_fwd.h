@@ -0,0 +1,47 @@
+/** @file
+    @brief Header forward-declaring the clock synchronization types.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ClockSync_fwd_h_GUID_7D82447A_9CB4_49FA_AB33_3A22B5EDB0FB
+#define INCLUDED_ClockSync_fwd_h_GUID_7D82447A_9CB4_49FA_AB33_3A22B5EDB0FB
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+    struct ClockSyncRequest;
+    struct ClockSyncResponse;
+    struct ClockSyncSample;
+    class ClockOffsetEstimator;
+    class ReportAgeStatistics;
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ClockSync_fwd_h_GUID_7D82447A_9CB4_49FA_AB33_3A22B5EDB0FB
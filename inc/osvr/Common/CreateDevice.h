@@ -41,6 +41,12 @@ namespace common {
     /// components/interfaces registered by default
     OSVR_COMMON_EXPORT BaseDevicePtr
     createClientDevice(std::string const &name, vrpn_ConnectionPtr const &conn);
+    /// @brief Factory function for a bare client device that does not service
+    /// its connection when updated, for use when the owner of the connection
+    /// (such as a client context) drains it once per update instead.
+    OSVR_COMMON_EXPORT BaseDevicePtr
+    createSharedConnectionClientDevice(std::string const &name,
+                                       vrpn_ConnectionPtr const &conn);
     /// @brief Factory function for a bare server device with no
     /// components/interfaces registered by default
     OSVR_COMMON_EXPORT BaseDevicePtr
@@ -0,0 +1,201 @@
+/** @file
+    @brief Header providing compile-time size and layout computation, and
+    allocation-free buffers and zero-copy reading views, for messages and
+    structs whose serialized form has a fixed layout.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_FixedLayoutSerialization_h_GUID_C242A12E_0A46_4864_BF94_0B4CA9462D48
+#define INCLUDED_FixedLayoutSerialization_h_GUID_C242A12E_0A46_4864_BF94_0B4CA9462D48
+
+// Internal Includes
+#include <osvr/Common/Buffer.h>
+#include <osvr/Common/SerializationTags.h>
+#include <osvr/Common/SerializationTraits.h>
+#include <osvr/Util/BoolC.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace osvr {
+namespace common {
+
+    namespace serialization {
+        namespace detail {
+            template <typename T> struct AlwaysVoid { typedef void type; };
+        } // namespace detail
+
+        /// @brief Type trait: the buffer size after serializing a value of
+        /// type `T` (with the default tag) into a buffer that already contains
+        /// `Offset` bytes, including any alignment padding.
+        ///
+        /// Only defined for types whose serialized form has a fixed size and
+        /// layout: arithmetic types, bool, FixedLayout lists, and
+        /// SimpleStructSerialization types providing a `fixed_layout` typedef.
+        ///
+        /// The dummy template parameter exists for usage of `enable_if`.
+        template <typename T, std::size_t Offset, typename Dummy = void>
+        struct FixedSerializedEnd;
+
+        /// @brief Arithmetic types: aligned to their size, matching
+        /// ArithmeticSerializationTraits.
+        template <typename T, std::size_t Offset>
+        struct FixedSerializedEnd<
+            T, Offset,
+            typename std::enable_if<std::is_arithmetic<T>::value &&
+                                    !std::is_same<bool, T>::value>::type>
+            : std::integral_constant<std::size_t,
+                                     Offset +
+                                         (sizeof(T) - Offset % sizeof(T)) %
+                                             sizeof(T) +
+                                         sizeof(T)> {};
+
+        /// @brief bool: serialized as an OSVR_CBool.
+        template <std::size_t Offset>
+        struct FixedSerializedEnd<bool, Offset, void>
+            : FixedSerializedEnd<OSVR_CBool, Offset> {};
+
+        /// @brief Empty list: the base case.
+        template <std::size_t Offset>
+        struct FixedSerializedEnd<FixedLayout<>, Offset, void>
+            : std::integral_constant<std::size_t, Offset> {};
+
+        /// @brief Non-empty list: each field, in order.
+        template <std::size_t Offset, typename First, typename... Rest>
+        struct FixedSerializedEnd<FixedLayout<First, Rest...>, Offset, void>
+            : FixedSerializedEnd<FixedLayout<Rest...>,
+                                 FixedSerializedEnd<First, Offset>::value> {};
+
+        /// @brief SimpleStructSerialization types that declare their fixed
+        /// layout.
+        template <typename T, std::size_t Offset>
+        struct FixedSerializedEnd<
+            T, Offset,
+            typename detail::AlwaysVoid<
+                typename SimpleStructSerialization<T>::fixed_layout>::type>
+            : FixedSerializedEnd<
+                  typename SimpleStructSerialization<T>::fixed_layout, Offset> {
+        };
+
+        /// @brief Type trait: the serialized size of a fixed layout, when
+        /// serialized at the start of a buffer.
+        template <typename Layout>
+        struct FixedLayoutSize : FixedSerializedEnd<Layout, 0> {};
+
+        /// @brief Type trait: the type, and the offset at which serialization
+        /// of it begins (before any alignment padding), of the field with the
+        /// given index in a fixed layout serialized at the start of a buffer.
+        template <typename Layout, std::size_t Index, std::size_t Offset = 0>
+        struct FixedLayoutField;
+
+        template <std::size_t Offset, typename First, typename... Rest>
+        struct FixedLayoutField<FixedLayout<First, Rest...>, 0, Offset> {
+            typedef First type;
+            static const std::size_t offset = Offset;
+        };
+        template <std::size_t Offset, typename First, typename... Rest>
+        const std::size_t
+            FixedLayoutField<FixedLayout<First, Rest...>, 0, Offset>::offset;
+
+        template <std::size_t Index, std::size_t Offset, typename First,
+                  typename... Rest>
+        struct FixedLayoutField<FixedLayout<First, Rest...>, Index, Offset>
+            : FixedLayoutField<FixedLayout<Rest...>, Index - 1,
+                               FixedSerializedEnd<First, Offset>::value> {};
+
+    } // namespace serialization
+
+    /// @brief Type trait: the serialized size of a message class providing a
+    /// `fixed_layout` typedef, computed at compile time.
+    ///
+    /// The `fixed_layout` typedef must list the types passed to `process()`
+    /// by the message's `processMessage()` method, in the same order.
+    template <typename MessageClass>
+    struct FixedMessageSize
+        : serialization::FixedLayoutSize<typename MessageClass::fixed_layout> {
+    };
+
+    /// @brief A buffer for serializing a message with a fixed layout into,
+    /// sized at compile time and stored inline, so it can be a stack variable
+    /// and requires no allocation.
+    template <typename MessageClass>
+    using FixedMessageBuffer =
+        Buffer<FixedCapacityByteArray<FixedMessageSize<MessageClass>::value>>;
+
+    /// @brief A read-only view of a serialized fixed layout in an external
+    /// buffer, providing access to individual fields without copying or
+    /// deserializing the rest of the buffer.
+    ///
+    /// The buffer length is checked once, on construction: the field accessors
+    /// then read from offsets computed at compile time.
+    template <typename Layout> class FixedLayoutView {
+      public:
+        /// @brief Serialized size of the layout.
+        static const std::size_t size =
+            serialization::FixedLayoutSize<Layout>::value;
+
+        /// @brief Constructor - throws if the buffer is too short.
+        FixedLayoutView(BufferElement const *buf, std::size_t len)
+            : m_buf(buf) {
+            if (len < size) {
+                throw std::runtime_error("Not enough data in the buffer for "
+                                         "this fixed-layout message!");
+            }
+        }
+
+        /// @brief Deserializes and returns the field with the given index.
+        template <std::size_t Index>
+        typename serialization::FixedLayoutField<Layout, Index>::type
+        get() const {
+            typedef serialization::FixedLayoutField<Layout, Index> Field;
+            typename Field::type ret;
+            /// Read relative to the start of the message, so alignment padding
+            /// is computed as it was when serializing.
+            auto reader = readExternalBuffer(m_buf, size);
+            reader.skipPadding(Field::offset);
+            serialization::deserializeRaw(reader, ret);
+            return ret;
+        }
+
+      private:
+        BufferElement const *m_buf;
+    };
+    template <typename Layout>
+    const std::size_t FixedLayoutView<Layout>::size;
+
+    /// @brief Returns a view of a message with a fixed layout in an external
+    /// buffer (such as a received message payload).
+    template <typename MessageClass>
+    inline FixedLayoutView<typename MessageClass::fixed_layout>
+    viewFixedMessage(BufferElement const *buf, std::size_t len) {
+        return FixedLayoutView<typename MessageClass::fixed_layout>(buf, len);
+    }
+
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_FixedLayoutSerialization_h_GUID_C242A12E_0A46_4864_BF94_0B4CA9462D48
@@ -77,6 +77,11 @@ namespace common {
         /// transform.
         OSVR_COMMON_EXPORT void nest(Json::Value const &transform);
 
+        /// @overload
+        ///
+        /// Appends the levels of another generalized transform.
+        OSVR_COMMON_EXPORT void nest(GeneralizedTransform const &transform);
+
         /// @brief Wrap a single new layer of transform around the existing
         /// ones, if any.
         OSVR_COMMON_EXPORT void wrap(Json::Value const &transform);
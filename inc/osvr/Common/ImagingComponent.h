@@ -33,12 +33,13 @@
 #include <osvr/Common/SerializationTags.h>
 #include <osvr/Util/ChannelCountC.h>
 #include <osvr/Util/ImagingReportTypesC.h>
+#include <osvr/Util/UniquePtr.h>
 
 // Library/third-party includes
 #include <vrpn_BaseClass.h>
 
 // Standard includes
-// - none
+#include <vector>
 
 namespace osvr {
 namespace common {
@@ -69,8 +70,20 @@ namespace common {
             class MessageSerialization;
             static const char *identifier();
         };
+        class ImageFragment : public MessageRegistration<ImageFragment> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
+        class ImageFragmentsRequested
+            : public MessageRegistration<ImageFragmentsRequested> {
+          public:
+            static const char *identifier();
+        };
     } // namespace messages
 
+    class ImageFragmentReassembler;
+
     /// @brief BaseDevice component
     class ImagingComponent : public DeviceComponent {
       public:
@@ -93,6 +106,16 @@ namespace common {
         /// shared memory ring buffer.
         messages::ImagePlacedInSharedMemory imagePlacedInSharedMemory;
 
+        /// @brief Message from server to client, containing one sequenced
+        /// chunk of a (possibly compressed) image too large for, or with a
+        /// depth not handled by, the single imageRegion message.
+        messages::ImageFragment imageFragment;
+
+        /// @brief Message from client to server, asking for frames to be sent
+        /// in fragments because it can't get them from shared memory. Until
+        /// some client sends this, the server doesn't send fragments at all.
+        messages::ImageFragmentsRequested fragmentsRequested;
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         /// @brief Message from server to client, notifying of image data in
         /// process memory (assumes joint client kit)
@@ -124,6 +147,12 @@ namespace common {
                                       OSVR_ChannelCount sensor,
                                       OSVR_TimeValue const &timestamp);
 
+        /// @return true if we could send it.
+        bool m_sendImageDataInFragments(OSVR_ImagingMetadata metadata,
+                                        OSVR_ImageBufferElement *imageData,
+                                        OSVR_ChannelCount sensor,
+                                        OSVR_TimeValue const &timestamp);
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         /// @return true if we could send it.
         bool m_sendImageDataViaInProcessMemory(
@@ -137,11 +166,26 @@ namespace common {
         static int VRPN_CALLBACK
         m_handleImagePlacedInSharedMemory(void *userdata, vrpn_HANDLERPARAM p);
 
+        static int VRPN_CALLBACK m_handleImageFragment(void *userdata,
+                                                       vrpn_HANDLERPARAM p);
+
+        static int VRPN_CALLBACK
+        m_handleFragmentsRequested(void *userdata, vrpn_HANDLERPARAM p);
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         static int VRPN_CALLBACK
         m_handleImagePlacedInProcessMemory(void *userdata, vrpn_HANDLERPARAM p);
 #endif
 
+        /// @brief Asks the server to send frames in fragments, if we haven't
+        /// already.
+        void m_requestFragments();
+
+        /// @brief Calls the image handlers, unless this frame was already
+        /// delivered.
+        void m_deliver(ImageData const &data,
+                       util::time::TimeValue const &timestamp);
+
         void m_checkFirst(OSVR_ImagingMetadata const &metadata);
         void m_growShmVecIfRequired(OSVR_ChannelCount sensor);
 
@@ -149,6 +193,21 @@ namespace common {
         bool m_gotOne;
         /// @brief One for each sensor
         std::vector<IPCRingBufferPtr> m_shmBuf;
+
+        /// @brief Whether a client has asked for frames in fragments.
+        bool m_sendFragments;
+        /// @brief Sequence number for the next frame sent in fragments.
+        uint32_t m_fragmentedFrameSequence;
+        /// @brief Scratch space for encoding frames to send in fragments.
+        std::vector<char> m_encodeBuf;
+
+        /// @brief Reassembles frames received in fragments, and keeps track
+        /// of the frames delivered: the same frame may arrive by more than one
+        /// message.
+        unique_ptr<ImageFragmentReassembler> m_reassembler;
+
+        /// @brief Whether we've asked the server to send fragments.
+        bool m_fragmentsRequested;
     };
 } // namespace common
 } // namespace osvr
@@ -0,0 +1,354 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_InProcessTrackerTransport_h_GUID_476E4ABF_C8D0_4795_848F_DA0E8C4CE9D8
+#define INCLUDED_InProcessTrackerTransport_h_GUID_476E4ABF_C8D0_4795_848F_DA0E8C4CE9D8
+
+// Internal Includes
+#include <osvr/Common/InProcessTrackerTransport_fwd.h>
+#include <osvr/Util/SharedPtr.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+#include <vrpn_Tracker.h>
+
+// Standard includes
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace osvr {
+namespace common {
+    /// @brief A list of VRPN-style change handlers for one kind of tracker
+    /// callback data, with the same sensor filtering as vrpn_Tracker_Remote.
+    template <typename CallbackType> class InProcessTrackerHandlerList {
+      public:
+        typedef void(VRPN_CALLBACK *HandlerType)(void *userdata,
+                                                 const CallbackType info);
+
+        /// @param sensor Sensor to receive reports for, or -1 for all.
+        void add(void *userdata, HandlerType handler, int sensor) {
+            m_handlers.push_back(Registration{userdata, handler, sensor});
+        }
+
+        void remove(void *userdata, HandlerType handler, int sensor) {
+            auto it = std::find_if(
+                begin(m_handlers), end(m_handlers),
+                [&](Registration const &reg) {
+                    return reg.userdata == userdata &&
+                           reg.handler == handler && reg.sensor == sensor;
+                });
+            if (it != end(m_handlers)) {
+                m_handlers.erase(it);
+            }
+        }
+
+        void call(CallbackType const &info) const {
+            // Indexed loop since a handler may unregister itself (or others)
+            // while we're dispatching.
+            for (std::size_t i = 0; i < m_handlers.size(); ++i) {
+                auto const &reg = m_handlers[i];
+                if (reg.sensor == -1 || reg.sensor == info.sensor) {
+                    reg.handler(reg.userdata, info);
+                }
+            }
+        }
+
+      private:
+        struct Registration {
+            void *userdata;
+            HandlerType handler;
+            int sensor;
+        };
+        std::vector<Registration> m_handlers;
+    };
+
+    /// @brief A tracker report in decoded form, as queued for delivery.
+    struct InProcessTrackerReport {
+        enum class Kind { Pose, Velocity, Acceleration };
+        Kind kind;
+        union {
+            vrpn_TRACKERCB pose;
+            vrpn_TRACKERVELCB velocity;
+            vrpn_TRACKERACCCB acceleration;
+        };
+    };
+
+    class InProcessTrackerDevice;
+    typedef shared_ptr<InProcessTrackerDevice> InProcessTrackerDevicePtr;
+
+    /// @brief One client context's subscription to a device's tracker
+    /// reports: the handlers that context registered, and the reports queued
+    /// for them.
+    class InProcessTrackerSubscription : boost::noncopyable {
+      public:
+        /// @brief Most reports queued before the oldest are dropped.
+        static const std::size_t MAX_QUEUED = 1024;
+
+        explicit InProcessTrackerSubscription(
+            InProcessTrackerDevicePtr const &device);
+        ~InProcessTrackerSubscription();
+
+        /// @name Handler registration (client thread)
+        /// @brief Same signatures as vrpn_Tracker_Remote.
+        /// @{
+        void registerHandler(void *userdata, vrpn_TRACKERCHANGEHANDLER handler,
+                             int sensor = -1) {
+            m_pose.add(userdata, handler, sensor);
+        }
+        void registerHandler(void *userdata,
+                             vrpn_TRACKERVELCHANGEHANDLER handler,
+                             int sensor = -1) {
+            m_velocity.add(userdata, handler, sensor);
+        }
+        void registerHandler(void *userdata,
+                             vrpn_TRACKERACCCHANGEHANDLER handler,
+                             int sensor = -1) {
+            m_acceleration.add(userdata, handler, sensor);
+        }
+        void unregisterHandler(void *userdata,
+                               vrpn_TRACKERCHANGEHANDLER handler,
+                               int sensor = -1) {
+            m_pose.remove(userdata, handler, sensor);
+        }
+        void unregisterHandler(void *userdata,
+                               vrpn_TRACKERVELCHANGEHANDLER handler,
+                               int sensor = -1) {
+            m_velocity.remove(userdata, handler, sensor);
+        }
+        void unregisterHandler(void *userdata,
+                               vrpn_TRACKERACCCHANGEHANDLER handler,
+                               int sensor = -1) {
+            m_acceleration.remove(userdata, handler, sensor);
+        }
+        /// @}
+
+        /// @brief Queues a report (any thread), dropping the oldest queued
+        /// if there are already MAX_QUEUED.
+        void push(InProcessTrackerReport const &report) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_queue.size() >= MAX_QUEUED) {
+                m_queue.pop_front();
+                ++m_dropped;
+            }
+            m_queue.push_back(report);
+        }
+
+        /// @brief Calls the handlers for each report queued so far, in the
+        /// order they were sent (client thread).
+        void deliverQueued() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_delivering.swap(m_queue);
+            }
+            for (auto const &report : m_delivering) {
+                switch (report.kind) {
+                case InProcessTrackerReport::Kind::Pose:
+                    m_pose.call(report.pose);
+                    break;
+                case InProcessTrackerReport::Kind::Velocity:
+                    m_velocity.call(report.velocity);
+                    break;
+                case InProcessTrackerReport::Kind::Acceleration:
+                    m_acceleration.call(report.acceleration);
+                    break;
+                }
+            }
+            m_delivering.clear();
+        }
+
+        /// @brief Number of reports dropped because the queue was full.
+        uint64_t getDroppedCount() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_dropped;
+        }
+
+      private:
+        InProcessTrackerDevicePtr m_device;
+        mutable std::mutex m_mutex;
+        std::deque<InProcessTrackerReport> m_queue;
+        uint64_t m_dropped = 0;
+        /// Only touched by the thread delivering reports.
+        std::deque<InProcessTrackerReport> m_delivering;
+        InProcessTrackerHandlerList<vrpn_TRACKERCB> m_pose;
+        InProcessTrackerHandlerList<vrpn_TRACKERVELCB> m_velocity;
+        InProcessTrackerHandlerList<vrpn_TRACKERACCCB> m_acceleration;
+    };
+    typedef shared_ptr<InProcessTrackerSubscription>
+        InProcessTrackerSubscriptionPtr;
+
+    /// @brief The server side of a single device: copies each report sent
+    /// into the queue of every client context subscribed to the device.
+    class InProcessTrackerDevice : boost::noncopyable {
+      public:
+        /// @name Report queueing (server side, any thread)
+        /// @{
+        void send(vrpn_TRACKERCB const &info) {
+            InProcessTrackerReport report;
+            report.kind = InProcessTrackerReport::Kind::Pose;
+            report.pose = info;
+            m_send(report);
+        }
+        void send(vrpn_TRACKERVELCB const &info) {
+            InProcessTrackerReport report;
+            report.kind = InProcessTrackerReport::Kind::Velocity;
+            report.velocity = info;
+            m_send(report);
+        }
+        void send(vrpn_TRACKERACCCB const &info) {
+            InProcessTrackerReport report;
+            report.kind = InProcessTrackerReport::Kind::Acceleration;
+            report.acceleration = info;
+            m_send(report);
+        }
+        /// @}
+
+      private:
+        friend class InProcessTrackerSubscription;
+        void m_add(InProcessTrackerSubscription *subscription) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_subscriptions.push_back(subscription);
+        }
+        void m_remove(InProcessTrackerSubscription *subscription) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_subscriptions.erase(std::remove(begin(m_subscriptions),
+                                              end(m_subscriptions),
+                                              subscription),
+                                  end(m_subscriptions));
+        }
+        void m_send(InProcessTrackerReport const &report) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto subscription : m_subscriptions) {
+                subscription->push(report);
+            }
+        }
+        std::mutex m_mutex;
+        std::vector<InProcessTrackerSubscription *> m_subscriptions;
+    };
+
+    inline InProcessTrackerSubscription::InProcessTrackerSubscription(
+        InProcessTrackerDevicePtr const &device)
+        : m_device(device) {
+        m_device->m_add(this);
+    }
+
+    inline InProcessTrackerSubscription::~InProcessTrackerSubscription() {
+        m_device->m_remove(this);
+    }
+
+    /// @brief Delivers tracker reports from devices to client handlers in the
+    /// same process directly, in already-decoded form, instead of encoding
+    /// them into VRPN messages on one side and decoding them on the other.
+    ///
+    /// Shared by a connection (whose tracker servers send reports to its
+    /// devices) and the client contexts using that connection in the same
+    /// process (each of which subscribes through its own
+    /// InProcessTrackerSubscriber). Only used where every consumer of the
+    /// connection is in-process, such as the joint client kit's loopback
+    /// connection: trackers on that connection no longer send VRPN messages.
+    ///
+    /// Reports may be sent from any thread (such as an async device's), but
+    /// are only queued, separately for each subscribed client context: they
+    /// reach that context's handlers when it calls deliverQueued() on its
+    /// subscriber from its own update, just as VRPN messages would be
+    /// handled, so application callbacks keep running on the client's thread.
+    class InProcessTrackerTransport : boost::noncopyable {
+      public:
+        typedef InProcessTrackerDevice Device;
+        typedef InProcessTrackerDevicePtr DevicePtr;
+
+        /// @brief Gets the entry for a device, by its fully-qualified name
+        /// (without any "@host" suffix), creating it if required.
+        DevicePtr getDevice(std::string const &deviceName) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto &ret = m_devices[deviceName];
+            if (!ret) {
+                ret = make_shared<Device>();
+            }
+            return ret;
+        }
+
+      private:
+        std::mutex m_mutex;
+        std::unordered_map<std::string, DevicePtr> m_devices;
+    };
+
+    /// @brief A single client context's subscriptions to the devices on an
+    /// in-process tracker transport.
+    ///
+    /// Use from the thread updating the client context.
+    class InProcessTrackerSubscriber : boost::noncopyable {
+      public:
+        explicit InProcessTrackerSubscriber(
+            InProcessTrackerTransportPtr const &transport)
+            : m_transport(transport) {}
+
+        /// @brief Subscribes to a device's reports, by its fully-qualified
+        /// name, or gets the existing subscription.
+        InProcessTrackerSubscriptionPtr
+        subscribe(std::string const &deviceName) {
+            auto &ret = m_subscriptions[deviceName];
+            if (!ret) {
+                ret = make_shared<InProcessTrackerSubscription>(
+                    m_transport->getDevice(deviceName));
+            }
+            return ret;
+        }
+
+        /// @brief Calls this context's handlers for every report queued for
+        /// it: call from the client context's update.
+        void deliverQueued() {
+            for (auto const &subscription : m_subscriptions) {
+                subscription.second->deliverQueued();
+            }
+        }
+
+        /// @brief Reports dropped, over all devices, because this context
+        /// wasn't delivering them fast enough.
+        uint64_t getDroppedCount() const {
+            uint64_t ret = 0;
+            for (auto const &subscription : m_subscriptions) {
+                ret += subscription.second->getDroppedCount();
+            }
+            return ret;
+        }
+
+        InProcessTrackerTransportPtr const &getTransport() const {
+            return m_transport;
+        }
+
+      private:
+        InProcessTrackerTransportPtr m_transport;
+        std::unordered_map<std::string, InProcessTrackerSubscriptionPtr>
+            m_subscriptions;
+    };
+
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_InProcessTrackerTransport_h_GUID_476E4ABF_C8D0_4795_848F_DA0E8C4CE9D8
@@ -0,0 +1,47 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_InProcessTrackerTransport_fwd_h_GUID_58EB52E6_8107_49BE_8738_84FB82162C5E
+#define INCLUDED_InProcessTrackerTransport_fwd_h_GUID_58EB52E6_8107_49BE_8738_84FB82162C5E
+
+// Internal Includes
+#include <osvr/Util/SharedPtr.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+    class InProcessTrackerTransport;
+    typedef shared_ptr<InProcessTrackerTransport> InProcessTrackerTransportPtr;
+    class InProcessTrackerSubscriber;
+    typedef shared_ptr<InProcessTrackerSubscriber>
+        InProcessTrackerSubscriberPtr;
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_InProcessTrackerTransport_fwd_h_GUID_58EB52E6_8107_49BE_8738_84FB82162C5E
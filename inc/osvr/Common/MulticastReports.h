@@ -0,0 +1,279 @@
+/** @file
+    @brief Header for an optional UDP multicast channel carrying tracker,
+    analog, and button reports to clients elsewhere on the LAN.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MulticastReports_h_GUID_4C7F697B_1F76_449D_9916_CFDF127C02EE
+#define INCLUDED_MulticastReports_h_GUID_4C7F697B_1F76_449D_9916_CFDF127C02EE
+
+// Internal Includes
+#include <osvr/Common/MulticastReports_fwd.h>
+#include <osvr/Common/Export.h>
+#include <osvr/Common/SerializationTags.h>
+#include <osvr/Common/SharedMemoryReportRing.h>
+#include <osvr/Util/SharedPtr.h>
+#include <osvr/Util/StdInt.h>
+#include <osvr/Util/UniquePtr.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace osvr {
+namespace common {
+    /// @brief What a client needs to receive a server's multicast reports:
+    /// announced by the server alongside its path tree.
+    struct MulticastReportDirectory {
+        MulticastReportDirectory() : port(0), sender(0) {}
+        /// @brief Multicast group address, dotted-quad.
+        std::string group;
+        uint16_t port;
+        /// @brief Random identifier of the publisher, so datagrams from some
+        /// other (or a restarted) server on the same group are ignored.
+        uint64_t sender;
+        /// @brief Maps fully-qualified device names to stream IDs.
+        std::unordered_map<std::string, uint32_t> streams;
+    };
+
+    /// @brief A single report datagram.
+    struct MulticastReportPacket {
+        /// @brief "OSVM"
+        static const uint32_t MAGIC = 0x4f53564d;
+        static const uint32_t VERSION = 1;
+
+        MulticastReportPacket()
+            : magic(MAGIC), version(VERSION), sender(0), stream(0),
+              sequence(0), report() {}
+
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sender;
+        uint32_t stream;
+        /// @brief Starts at 1 for each stream, and increases by one per
+        /// datagram sent, so receivers can count gaps.
+        uint32_t sequence;
+        SharedMemoryReport report;
+
+        typedef serialization::FixedLayout<
+            uint32_t, uint32_t, uint64_t, uint32_t, uint32_t, uint32_t,
+            int32_t, int64_t, int32_t, double, double, double, double, double,
+            double, double, double>
+            fixed_layout;
+
+        template <typename T> void processMessage(T &p) {
+            p(magic);
+            p(version);
+            p(sender);
+            p(stream);
+            p(sequence);
+            auto type = static_cast<uint32_t>(report.type);
+            p(type);
+            report.type = static_cast<SharedMemoryReportType>(type);
+            p(report.sensor);
+            p(report.seconds);
+            p(report.microseconds);
+            for (auto &val : report.data) {
+                p(val);
+            }
+        }
+    };
+
+    /// @brief Server-side owner of the multicast socket and the report
+    /// streams for the devices on a connection, so each report is sent once
+    /// for all LAN clients instead of once per client connection.
+    ///
+    /// Only reports go this way: clients keep their VRPN connection for the
+    /// path tree and everything else.
+    class MulticastReportPublisher : boost::noncopyable {
+      public:
+        /// @brief Default group: in the organization-local scope, so it won't
+        /// leave the site.
+        OSVR_COMMON_EXPORT static const char DEFAULT_GROUP[];
+        static const uint16_t DEFAULT_PORT = 3884;
+
+        /// @brief Opens a socket for sending to the given group.
+        ///
+        /// @param ttl Multicast time-to-live: the default of 1 keeps
+        /// datagrams on the local subnet.
+        /// @param iface Dotted-quad address of the interface to send from, or
+        /// empty to let the system choose.
+        ///
+        /// @throws std::runtime_error if the socket can't be set up.
+        OSVR_COMMON_EXPORT static MulticastReportPublisherPtr
+        create(std::string const &group = DEFAULT_GROUP,
+               uint16_t port = DEFAULT_PORT, int ttl = 1,
+               std::string const &iface = std::string());
+
+        OSVR_COMMON_EXPORT ~MulticastReportPublisher();
+
+        /// @brief Gets the stream for a device, by its fully-qualified name
+        /// (without any "@host" suffix), creating it if required.
+        OSVR_COMMON_EXPORT MulticastReportStreamPtr
+        getStream(std::string const &deviceName);
+
+        /// @brief The group, sender, and device-to-stream mapping to announce
+        /// to clients.
+        MulticastReportDirectory const &getDirectory() const {
+            return m_directory;
+        }
+
+        /// @brief Number of datagrams the system refused to send.
+        OSVR_COMMON_EXPORT uint64_t getSendFailures() const;
+
+        /// @brief Implementation detail: the socket, shared with the streams
+        /// so they stay usable if the publisher goes away first.
+        class Sender;
+
+      private:
+        explicit MulticastReportPublisher(shared_ptr<Sender> const &sender);
+        shared_ptr<Sender> m_sender;
+        std::unordered_map<std::string, MulticastReportStreamPtr> m_streams;
+        MulticastReportDirectory m_directory;
+    };
+
+    /// @brief The multicast reports of a single device.
+    ///
+    /// Use from one thread at a time.
+    class MulticastReportStream : boost::noncopyable {
+      public:
+        MulticastReportStream(
+            shared_ptr<MulticastReportPublisher::Sender> const &sender,
+            uint32_t id);
+
+        /// @brief Sends a report to the group, with the next sequence number.
+        OSVR_COMMON_EXPORT void send(SharedMemoryReport const &report);
+
+        uint32_t getId() const { return m_id; }
+
+      private:
+        shared_ptr<MulticastReportPublisher::Sender> m_sender;
+        uint32_t m_id;
+        uint32_t m_sequence = 0;
+    };
+
+    /// @brief Counts of datagrams received on a stream (or all streams).
+    struct MulticastReportStats {
+        /// @brief Datagrams accepted, in order.
+        uint64_t received = 0;
+        /// @brief Gaps in the sequence numbers: datagrams never seen (so
+        /// far).
+        uint64_t lost = 0;
+        /// @brief Datagrams that arrived after a later one, and so were
+        /// dropped (having already been counted as lost).
+        uint64_t late = 0;
+        /// @brief Reports discarded because a subscriber wasn't reading them
+        /// fast enough.
+        uint64_t overflowed = 0;
+    };
+
+    /// @brief Client-side receiver for one server's multicast reports.
+    ///
+    /// Not thread-safe: use from the thread updating the client context.
+    class MulticastReportReceiver
+        : boost::noncopyable,
+          public enable_shared_from_this<MulticastReportReceiver> {
+      public:
+        /// @brief Most reports queued for a subscriber before the oldest are
+        /// discarded.
+        static const std::size_t MAX_QUEUED = 1024;
+
+        /// @brief Joins the group in the directory.
+        ///
+        /// @param iface Dotted-quad address of the interface to join on, or
+        /// empty to let the system choose.
+        ///
+        /// @return Null (after logging why) if the socket can't be set up:
+        /// clients should just use VRPN.
+        OSVR_COMMON_EXPORT static MulticastReportReceiverPtr
+        create(MulticastReportDirectory const &directory,
+               std::string const &iface = std::string());
+
+        OSVR_COMMON_EXPORT ~MulticastReportReceiver();
+
+        /// @brief Subscribes to a device's reports, by its fully-qualified
+        /// name.
+        ///
+        /// @return Null if the server didn't list the device. The source
+        /// delivers records regardless of advertised interest, and keeps the
+        /// receiver alive.
+        OSVR_COMMON_EXPORT ReportSourcePtr
+        subscribe(std::string const &deviceName);
+
+        /// @brief Reads all pending datagrams from the socket, queueing their
+        /// reports for subscribers. Called by subscriptions as needed.
+        OSVR_COMMON_EXPORT void poll();
+
+        /// @brief Processes a single datagram as if received from the socket
+        /// - exposed for testing.
+        OSVR_COMMON_EXPORT void handleDatagram(void const *data,
+                                               std::size_t len);
+
+        MulticastReportDirectory const &getDirectory() const {
+            return m_directory;
+        }
+
+        /// @brief Takes on a newer directory from the same publisher, as sent
+        /// when devices have been added. (Stream IDs don't change, so
+        /// existing subscriptions carry on.)
+        ///
+        /// @return false, changing nothing, if the directory is from some
+        /// other publisher or for some other group.
+        OSVR_COMMON_EXPORT bool
+        updateDirectory(MulticastReportDirectory const &directory);
+
+        /// @brief Counts for all streams together.
+        OSVR_COMMON_EXPORT MulticastReportStats getStats() const;
+
+        /// @brief Counts for a single device's stream.
+        OSVR_COMMON_EXPORT MulticastReportStats
+        getStats(std::string const &deviceName) const;
+
+        /// @brief Number of datagrams that weren't for us, or weren't valid.
+        uint64_t getIgnoredCount() const { return m_ignored; }
+
+      private:
+        class Subscription;
+        class Socket;
+        struct StreamState {
+            bool started = false;
+            uint32_t next = 0;
+            MulticastReportStats stats;
+            std::vector<Subscription *> subscriptions;
+        };
+        MulticastReportReceiver(MulticastReportDirectory const &directory,
+                                unique_ptr<Socket> &&socket);
+        void m_remove(Subscription *subscription);
+        MulticastReportDirectory m_directory;
+        unique_ptr<Socket> m_socket;
+        std::unordered_map<uint32_t, StreamState> m_streams;
+        uint64_t m_ignored = 0;
+    };
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_MulticastReports_h_GUID_4C7F697B_1F76_449D_9916_CFDF127C02EE
@@ -0,0 +1,52 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_MulticastReports_fwd_h_GUID_AA69F2E7_14E6_4D0E_849A_DD607BD9A100
+#define INCLUDED_MulticastReports_fwd_h_GUID_AA69F2E7_14E6_4D0E_849A_DD607BD9A100
+
+// Internal Includes
+#include <osvr/Util/SharedPtr.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+    struct MulticastReportDirectory;
+
+    class MulticastReportPublisher;
+    typedef shared_ptr<MulticastReportPublisher> MulticastReportPublisherPtr;
+
+    class MulticastReportStream;
+    typedef shared_ptr<MulticastReportStream> MulticastReportStreamPtr;
+
+    class MulticastReportReceiver;
+    typedef shared_ptr<MulticastReportReceiver> MulticastReportReceiverPtr;
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_MulticastReports_fwd_h_GUID_AA69F2E7_14E6_4D0E_849A_DD607BD9A100
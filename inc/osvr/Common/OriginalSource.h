@@ -62,6 +62,11 @@ namespace common {
 
         void nestTransform(Json::Value const &transform);
 
+        /// @brief Complete this source with an already-resolved one (the
+        /// target of an alias): takes on its device, interface, and sensor,
+        /// and nests its transform inside any we already have.
+        void nestResolvedSource(OriginalSource const &inner);
+
         PathNode *getDevice() const;
 
         /// @brief Gets the full path of the device node
@@ -29,6 +29,7 @@
 #include <osvr/Common/Export.h>
 #include <osvr/Common/PathNode_fwd.h>
 #include <osvr/Common/PathTree_fwd.h> // IWYU pragma: export
+#include <osvr/Util/StdInt.h>
 
 // Library/third-party includes
 #include <boost/noncopyable.hpp>
@@ -82,6 +83,14 @@ namespace common {
         /// @brief Reset the path tree to a new, empty root node.
         OSVR_COMMON_EXPORT void reset();
 
+        /// @brief Identifies this tree's current set of nodes: changes on
+        /// reset(), and is never shared with another tree, so caches of
+        /// results that refer to nodes can tell when they're stale.
+        ///
+        /// Node values can still be changed in place without changing the
+        /// version.
+        uint64_t getVersion() const { return m_version; }
+
         PathNode &getRoot() { return *m_root; }
 
         PathNode const &getRoot() const { return *m_root; }
@@ -89,6 +98,8 @@ namespace common {
       private:
         /// @brief Root node of the tree.
         PathNodePtr m_root;
+
+        uint64_t m_version;
     };
 
     /// @brief Make node an alias pointing to source, with the given priority,
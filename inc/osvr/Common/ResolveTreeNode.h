@@ -27,14 +27,16 @@
 
 // Internal Includes
 #include <osvr/Common/Export.h>
-#include <osvr/Common/PathTree_fwd.h>
+#include <osvr/Common/PathTree.h>
 #include <osvr/Common/OriginalSource.h>
+#include <osvr/Util/StdInt.h>
 
 // Library/third-party includes
 #include <boost/optional.hpp>
 
 // Standard includes
 #include <string>
+#include <unordered_map>
 
 namespace osvr {
 namespace common {
@@ -42,6 +44,62 @@ namespace common {
     OSVR_COMMON_EXPORT boost::optional<OriginalSource>
     resolveTreeNode(PathTree &pathTree, std::string const &path);
 
+    /// @brief Memoized results of resolving paths in a path tree, including
+    /// the targets of aliases encountered along the way, so that a chain of
+    /// aliases shared by many paths is only walked once.
+    ///
+    /// Tied to one version of one tree (see PathTree::getVersion()): used
+    /// with any other, it empties itself first. Changes to node values
+    /// made in place, without a reset of the tree, require a call to clear().
+    class PathResolutionCache {
+      public:
+        typedef boost::optional<OriginalSource> Result;
+        PathResolutionCache() : m_version(0) {}
+
+        /// @brief Forget all results.
+        void clear() {
+            m_results.clear();
+            m_version = 0;
+        }
+
+        std::size_t size() const { return m_results.size(); }
+
+        /// @brief Get the stored result for a path in the given tree, or
+        /// nullptr if there isn't one.
+        Result const *find(PathTree const &pathTree, std::string const &path) {
+            m_checkVersion(pathTree);
+            auto it = m_results.find(path);
+            if (it == m_results.end()) {
+                return nullptr;
+            }
+            return &(it->second);
+        }
+
+        /// @brief Store the result for a path in the given tree.
+        void insert(PathTree const &pathTree, std::string const &path,
+                    Result const &result) {
+            m_checkVersion(pathTree);
+            m_results[path] = result;
+        }
+
+      private:
+        void m_checkVersion(PathTree const &pathTree) {
+            if (pathTree.getVersion() != m_version) {
+                m_results.clear();
+                m_version = pathTree.getVersion();
+            }
+        }
+        uint64_t m_version;
+        std::unordered_map<std::string, Result> m_results;
+    };
+
+    /// @overload
+    ///
+    /// Consults and updates the given cache.
+    OSVR_COMMON_EXPORT boost::optional<OriginalSource>
+    resolveTreeNode(PathTree &pathTree, std::string const &path,
+                    PathResolutionCache &cache);
+
 } // namespace common
 } // namespace osvr
 
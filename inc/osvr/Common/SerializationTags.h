@@ -74,6 +74,15 @@ namespace common {
         /// the length prefix is unnecessary
         struct StringOnlyMessageTag {};
 
+        /// @brief A type-level list of the fields, in order, of a struct or
+        /// message whose serialized form has a fixed size and layout, so that
+        /// the size and field offsets can be computed at compile time.
+        ///
+        /// A SimpleStructSerialization specialization or a message class opts
+        /// in by providing a `fixed_layout` typedef naming one of these: see
+        /// FixedLayoutSerialization.h
+        template <typename... Fields> struct FixedLayout {};
+
     } // namespace serialization
 
 } // namespace common
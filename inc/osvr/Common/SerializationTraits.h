@@ -146,6 +146,11 @@ namespace common {
         /// that just calls `f` with each member of your type (which will come
         /// in as `val`), optionally with a serialization tag.
         ///
+        /// If every member has a fixed serialized size (no strings, vectors,
+        /// or tags), also add a `typedef FixedLayout<...> fixed_layout;`
+        /// listing the member types in the same order, to allow the
+        /// fixed-layout fast paths in FixedLayoutSerialization.h to be used.
+        ///
         /// Explicitly specializing this template as instructed produces the
         /// more complex serialization code automatically.
         ///
@@ -542,6 +547,7 @@ namespace common {
         template <>
         struct SimpleStructSerialization<OSVR_Vec2>
             : SimpleStructSerializationBase {
+            typedef FixedLayout<double, double> fixed_layout;
             template <typename F, typename T> static void apply(F &f, T &val) {
                 f(val.data[0]);
                 f(val.data[1]);
@@ -551,6 +557,7 @@ namespace common {
         template <>
         struct SimpleStructSerialization<OSVR_Vec3>
             : SimpleStructSerializationBase {
+            typedef FixedLayout<double, double, double> fixed_layout;
             template <typename F, typename T> static void apply(F &f, T &val) {
                 f(val.data[0]);
                 f(val.data[1]);
@@ -561,6 +568,8 @@ namespace common {
         template <typename Tag>
         struct SimpleStructSerialization<util::TypeSafeId<Tag>>
             : SimpleStructSerializationBase {
+            typedef FixedLayout<typename util::TypeSafeId<Tag>::wrapped_type>
+                fixed_layout;
             template <typename F, typename T> static void apply(F &f, T &val) {
                 f(val.value());
             }
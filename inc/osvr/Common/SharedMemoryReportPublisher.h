@@ -0,0 +1,76 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_SharedMemoryReportPublisher_h_GUID_FAE4FD2D_436F_471D_9781_56B2D8FD1B45
+#define INCLUDED_SharedMemoryReportPublisher_h_GUID_FAE4FD2D_436F_471D_9781_56B2D8FD1B45
+
+// Internal Includes
+#include <osvr/Common/SharedMemoryReportPublisher_fwd.h>
+#include <osvr/Common/SharedMemoryReportRing.h>
+#include <osvr/Common/Export.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <string>
+#include <unordered_map>
+
+namespace osvr {
+namespace common {
+    /// @brief Server-side owner of the shared memory report rings for the
+    /// devices on a connection, so that clients on the same machine can read
+    /// reports directly instead of decoding them from VRPN messages.
+    ///
+    /// Ring names are unique to this object (not just this server), so a
+    /// client can't mistake a stale ring, or one from some other server, for
+    /// one it was told about.
+    ///
+    /// Not thread-safe: use from the thread servicing the connection.
+    class SharedMemoryReportPublisher : boost::noncopyable {
+      public:
+        OSVR_COMMON_EXPORT SharedMemoryReportPublisher();
+
+        /// @brief Gets the ring for a device, by its fully-qualified name
+        /// (without any "@host" suffix), creating it if required.
+        ///
+        /// @return Null if the ring couldn't be created: the device should
+        /// just keep using VRPN alone.
+        OSVR_COMMON_EXPORT SharedMemoryReportRingPtr
+        getRing(std::string const &deviceName);
+
+        /// @brief The device-to-ring mapping to announce to clients.
+        SharedMemoryReportDirectory const &getDirectory() const {
+            return m_directory;
+        }
+
+      private:
+        std::string m_prefix;
+        std::unordered_map<std::string, SharedMemoryReportRingPtr> m_rings;
+        SharedMemoryReportDirectory m_directory;
+    };
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_SharedMemoryReportPublisher_h_GUID_FAE4FD2D_436F_471D_9781_56B2D8FD1B45
@@ -0,0 +1,51 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_SharedMemoryReportPublisher_fwd_h_GUID_4EF83A54_D729_4ADC_BE61_D67F38BB66DF
+#define INCLUDED_SharedMemoryReportPublisher_fwd_h_GUID_4EF83A54_D729_4ADC_BE61_D67F38BB66DF
+
+// Internal Includes
+#include <osvr/Util/SharedPtr.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <string>
+#include <unordered_map>
+
+namespace osvr {
+namespace common {
+    class SharedMemoryReportPublisher;
+    typedef shared_ptr<SharedMemoryReportPublisher>
+        SharedMemoryReportPublisherPtr;
+
+    /// @brief Maps fully-qualified device names to the names of their shared
+    /// memory report rings.
+    typedef std::unordered_map<std::string, std::string>
+        SharedMemoryReportDirectory;
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_SharedMemoryReportPublisher_fwd_h_GUID_4EF83A54_D729_4ADC_BE61_D67F38BB66DF
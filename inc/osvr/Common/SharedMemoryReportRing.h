@@ -0,0 +1,182 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_SharedMemoryReportRing_h_GUID_33A364C7_59A0_48BD_BC10_81C297BD4A53
+#define INCLUDED_SharedMemoryReportRing_h_GUID_33A364C7_59A0_48BD_BC10_81C297BD4A53
+
+// Internal Includes
+#include <osvr/Common/Export.h>
+#include <osvr/Util/SharedPtr.h>
+#include <osvr/Util/StdInt.h>
+#include <osvr/Util/TimeValueC.h>
+#include <osvr/Util/UniquePtr.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <string>
+
+namespace osvr {
+namespace common {
+    /// @brief The kinds of report carried by a SharedMemoryReportRing.
+    enum class SharedMemoryReportType : uint32_t {
+        Pose = 1,
+        Velocity,
+        Acceleration,
+        Analog,
+        Button
+    };
+
+    /// @brief A single fixed-size report record, with the same layout in 32
+    /// and 64-bit processes.
+    ///
+    /// Contents of `data`, by type:
+    ///
+    /// - Pose: position (x, y, z), then orientation quaternion in VRPN
+    ///   (x, y, z, w) order.
+    /// - Velocity and Acceleration: linear (x, y, z), then the incremental
+    ///   rotation quaternion in VRPN order, then its dt.
+    /// - Analog: the channel value in data[0].
+    /// - Button: the button state in data[0].
+    struct SharedMemoryReport {
+        SharedMemoryReportType type;
+        /// @brief Sensor, or channel for analogs and buttons.
+        int32_t sensor;
+        int64_t seconds;
+        int32_t microseconds;
+        int32_t reserved;
+        double data[8];
+    };
+
+    /// @brief Makes a report record with the given header fields and zeroed
+    /// data.
+    inline SharedMemoryReport
+    makeSharedMemoryReport(SharedMemoryReportType type, int32_t sensor,
+                           OSVR_TimeValue const &timestamp) {
+        SharedMemoryReport ret = {};
+        ret.type = type;
+        ret.sensor = sensor;
+        ret.seconds = timestamp.seconds;
+        ret.microseconds = timestamp.microseconds;
+        return ret;
+    }
+
+    /// @brief Something a client can poll for report records, in place of
+    /// VRPN messages: a shared memory ring, or a multicast subscription.
+    class ReportSource {
+      public:
+        OSVR_COMMON_EXPORT virtual ~ReportSource();
+
+        /// @brief Copies out the next record, if there is one.
+        virtual bool read(SharedMemoryReport &report) = 0;
+
+        /// @brief Whether records only arrive while the client advertises an
+        /// interest in the device, like VRPN messages.
+        virtual bool requiresInterest() const { return true; }
+    };
+    typedef unique_ptr<ReportSource> ReportSourcePtr;
+
+    class SharedMemoryReportRing;
+    typedef shared_ptr<SharedMemoryReportRing> SharedMemoryReportRingPtr;
+
+    /// @brief A named shared memory segment holding a ring of fixed-size
+    /// report records, written by one process (the server, for one device)
+    /// and read without locking by any number of others.
+    ///
+    /// Each slot carries a sequence number, set to an odd value while the
+    /// writer is filling it in and to an even value, derived from the
+    /// record's position in the stream, once it is complete. Readers copy a
+    /// record out and check the sequence number before and after: if the
+    /// writer has lapped them, they skip ahead and count what they missed,
+    /// rather than ever blocking the writer.
+    class SharedMemoryReportRing : boost::noncopyable {
+      public:
+        /// @brief Default number of records held.
+        static const uint32_t DEFAULT_CAPACITY = 256;
+
+        /// @brief Creates (replacing any stale segment of the same name) a
+        /// ring to write to. Returns a null pointer on failure.
+        OSVR_COMMON_EXPORT static SharedMemoryReportRingPtr
+        create(std::string const &name, uint32_t capacity = DEFAULT_CAPACITY);
+
+        /// @brief Opens an existing ring to read from. Returns a null pointer
+        /// if there is no such ring (as when the writer is on another
+        /// machine) or it was made by an incompatible version.
+        OSVR_COMMON_EXPORT static SharedMemoryReportRingPtr
+        open(std::string const &name);
+
+        /// @brief Destructor - the creating side removes the segment, though
+        /// rings already opened by readers stay valid.
+        OSVR_COMMON_EXPORT ~SharedMemoryReportRing();
+
+        std::string const &getName() const { return m_name; }
+        OSVR_COMMON_EXPORT uint32_t getCapacity() const;
+
+        /// @brief Total number of records ever written.
+        OSVR_COMMON_EXPORT uint64_t getWriteCount() const;
+
+        /// @brief Appends a record, overwriting the oldest if full. Only valid
+        /// on a ring from create(), and from a single thread at a time.
+        OSVR_COMMON_EXPORT void put(SharedMemoryReport const &report);
+
+        /// @brief A read position in a ring: each reader of a ring needs its
+        /// own.
+        class Reader : public ReportSource {
+          public:
+            /// @brief Starts reading at the next record written.
+            OSVR_COMMON_EXPORT explicit Reader(
+                SharedMemoryReportRingPtr const &ring);
+
+            /// @brief Copies out the next record, if there is one.
+            OSVR_COMMON_EXPORT bool read(SharedMemoryReport &report) override;
+
+            /// @brief Number of records overwritten before this reader could
+            /// get to them.
+            uint64_t getDroppedCount() const { return m_dropped; }
+
+            SharedMemoryReportRingPtr const &getRing() const { return m_ring; }
+
+          private:
+            SharedMemoryReportRingPtr m_ring;
+            uint64_t m_next;
+            uint64_t m_dropped = 0;
+        };
+
+      private:
+        struct Impl;
+        struct Slot;
+        struct RingHeader;
+        SharedMemoryReportRing(std::string const &name, unique_ptr<Impl> &&impl,
+                               bool owner);
+        std::string m_name;
+        unique_ptr<Impl> m_impl;
+        bool m_owner;
+        RingHeader *m_header;
+        Slot *m_slots;
+    };
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_SharedMemoryReportRing_h_GUID_33A364C7_59A0_48BD_BC10_81C297BD4A53
@@ -27,6 +27,11 @@
 
 // Internal Includes
 #include <osvr/Common/SystemComponent_fwd.h>
+#include <osvr/Common/ClientInterestFilter.h>
+#include <osvr/Common/SharedMemoryReportPublisher_fwd.h>
+#include <osvr/Common/MulticastReports_fwd.h>
+#include <osvr/Common/ClockSync_fwd.h>
+#include <osvr/Util/StdInt.h>
 #include <osvr/Common/Export.h>
 #include <osvr/Common/DeviceComponent.h>
 #include <osvr/Common/SerializationTags.h>
@@ -69,6 +74,41 @@ namespace common {
             class MessageSerialization;
             static const char *identifier();
         };
+
+        class ClientInterestToServer
+            : public MessageRegistration<ClientInterestToServer> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
+
+        class SharedMemoryReportsFromServer
+            : public MessageRegistration<SharedMemoryReportsFromServer> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
+
+        class MulticastReportsFromServer
+            : public MessageRegistration<MulticastReportsFromServer> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
+
+        class ClockSyncRequestToServer
+            : public MessageRegistration<ClockSyncRequestToServer> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
+
+        class ClockSyncResponseFromServer
+            : public MessageRegistration<ClockSyncResponseFromServer> {
+          public:
+            class MessageSerialization;
+            static const char *identifier();
+        };
     } // namespace messages
 
     /// @brief BaseDevice component, to be used only with the "OSVR" special
@@ -118,13 +158,106 @@ namespace common {
 
         OSVR_COMMON_EXPORT void sendReplacementTree(PathTree &tree);
 
+        /// @brief Message from client, advertising the sources it wants
+        /// reports from.
+        messages::ClientInterestToServer interestIn;
+
+        OSVR_COMMON_EXPORT void
+        sendClientInterest(std::string const &clientId,
+                           ClientInterestFilter::Interest const &interest);
+
+        typedef std::function<void(std::string const &,
+                                   ClientInterestFilter::Interest const &,
+                                   util::time::TimeValue const &)>
+            ClientInterestHandler;
+        OSVR_COMMON_EXPORT void
+        registerClientInterestHandler(ClientInterestHandler cb);
+
+        /// @brief Message from server, listing the shared memory report rings
+        /// that clients on the same machine may read instead of VRPN reports.
+        messages::SharedMemoryReportsFromServer sharedMemoryReportsOut;
+
+        OSVR_COMMON_EXPORT void sendSharedMemoryReports(
+            SharedMemoryReportDirectory const &directory);
+
+        typedef std::function<void(SharedMemoryReportDirectory const &)>
+            SharedMemoryReportsHandler;
+        OSVR_COMMON_EXPORT void
+        registerSharedMemoryReportsHandler(SharedMemoryReportsHandler cb);
+
+        /// @brief Message from server, giving the multicast group and streams
+        /// that clients may receive reports from instead of VRPN reports.
+        messages::MulticastReportsFromServer multicastReportsOut;
+
+        OSVR_COMMON_EXPORT void
+        sendMulticastReports(MulticastReportDirectory const &directory);
+
+        typedef std::function<void(MulticastReportDirectory const &)>
+            MulticastReportsHandler;
+        OSVR_COMMON_EXPORT void
+        registerMulticastReportsHandler(MulticastReportsHandler cb);
+
+        /// @brief Message from client, asking for the server clock so the
+        /// client can estimate the offset between the two.
+        messages::ClockSyncRequestToServer clockSyncIn;
+
+        /// @brief Sends a request, stamped with the current time just before
+        /// sending.
+        OSVR_COMMON_EXPORT void sendClockSyncRequest(uint64_t client,
+                                                     uint32_t sequence);
+
+        /// @brief Handler for requests, also passed the time the request was
+        /// received.
+        typedef std::function<void(ClockSyncRequest const &,
+                                   util::time::TimeValue const &)>
+            ClockSyncRequestHandler;
+        OSVR_COMMON_EXPORT void
+        registerClockSyncRequestHandler(ClockSyncRequestHandler cb);
+
+        /// @brief Message from server, answering a clock sync request.
+        messages::ClockSyncResponseFromServer clockSyncOut;
+
+        /// @brief Answers a request, given the time it was received: the time
+        /// the answer is sent is stamped just before sending.
+        OSVR_COMMON_EXPORT void
+        sendClockSyncResponse(ClockSyncRequest const &request,
+                              util::time::TimeValue const &received);
+
+        /// @brief Handler for responses (to every client on the connection),
+        /// also passed the time the response was received.
+        typedef std::function<void(ClockSyncResponse const &,
+                                   util::time::TimeValue const &)>
+            ClockSyncResponseHandler;
+        OSVR_COMMON_EXPORT void
+        registerClockSyncResponseHandler(ClockSyncResponseHandler cb);
+
       private:
         SystemComponent();
         virtual void m_parentSet();
         static int VRPN_CALLBACK
         m_handleReplaceTree(void *userdata, vrpn_HANDLERPARAM p);
 
+        static int VRPN_CALLBACK
+        m_handleClientInterest(void *userdata, vrpn_HANDLERPARAM p);
+
+        static int VRPN_CALLBACK
+        m_handleSharedMemoryReports(void *userdata, vrpn_HANDLERPARAM p);
+
+        static int VRPN_CALLBACK
+        m_handleMulticastReports(void *userdata, vrpn_HANDLERPARAM p);
+
+        static int VRPN_CALLBACK
+        m_handleClockSyncRequest(void *userdata, vrpn_HANDLERPARAM p);
+
+        static int VRPN_CALLBACK
+        m_handleClockSyncResponse(void *userdata, vrpn_HANDLERPARAM p);
+
         std::vector<JsonHandler> m_replaceTreeHandlers;
+        std::vector<ClientInterestHandler> m_clientInterestHandlers;
+        std::vector<SharedMemoryReportsHandler> m_sharedMemoryReportsHandlers;
+        std::vector<MulticastReportsHandler> m_multicastReportsHandlers;
+        std::vector<ClockSyncRequestHandler> m_clockSyncRequestHandlers;
+        std::vector<ClockSyncResponseHandler> m_clockSyncResponseHandlers;
     };
 } // namespace common
 } // namespace osvr
@@ -31,6 +31,12 @@
 #include <osvr/Connection/ConnectionDevicePtr.h>
 #include <osvr/Connection/ConnectionPtr.h>
 #include <osvr/Connection/DeviceInitObject.h>
+#include <osvr/Connection/DeviceUpdateSchedulerPtr.h>
+#include <osvr/Connection/ReportRecordingPtr.h>
+#include <osvr/Common/ClientInterestFilter_fwd.h>
+#include <osvr/Common/InProcessTrackerTransport_fwd.h>
+#include <osvr/Common/SharedMemoryReportPublisher_fwd.h>
+#include <osvr/Common/MulticastReports_fwd.h>
 #include <osvr/Util/DeviceCallbackTypesC.h>
 #include <osvr/PluginHost/RegistrationContext_fwd.h>
 #include <osvr/Util/Log.h>
@@ -125,6 +131,80 @@ namespace connection {
         /// handlers.
         OSVR_CONNECTION_EXPORT void triggerDescriptorHandlers();
 
+        /// @brief Have tracker reports from devices created after this call
+        /// delivered to in-process subscribers through the given transport,
+        /// instead of being sent as messages over the connection.
+        ///
+        /// Only appropriate if every consumer of tracker reports from this
+        /// connection is in the same process (e.g. a loopback connection).
+        OSVR_CONNECTION_EXPORT void setInProcessTrackerTransport(
+            common::InProcessTrackerTransportPtr const &transport);
+
+        /// @brief Get the in-process tracker transport, if any.
+        common::InProcessTrackerTransportPtr const &
+        getInProcessTrackerTransport() const {
+            return m_trackerTransport;
+        }
+
+        /// @brief Have devices created after this call consult the given
+        /// filter before sending reports, so that reports no client wants
+        /// (or more frequent than any client wants) aren't sent at all.
+        OSVR_CONNECTION_EXPORT void setClientInterestFilter(
+            common::ClientInterestFilterPtr const &filter);
+
+        /// @brief Get the client interest filter, if any.
+        common::ClientInterestFilterPtr const &getClientInterestFilter() const {
+            return m_interestFilter;
+        }
+
+        /// @brief Have tracker, analog, and button reports from devices
+        /// created after this call also written to shared memory rings owned
+        /// by the given publisher, for clients on the same machine.
+        OSVR_CONNECTION_EXPORT void setSharedMemoryReportPublisher(
+            common::SharedMemoryReportPublisherPtr const &publisher);
+
+        /// @brief Get the shared memory report publisher, if any.
+        common::SharedMemoryReportPublisherPtr const &
+        getSharedMemoryReportPublisher() const {
+            return m_reportPublisher;
+        }
+
+        /// @brief Have tracker, analog, and button reports from devices
+        /// created after this call also sent, once each, to the multicast
+        /// group of the given publisher, for clients elsewhere on the LAN.
+        OSVR_CONNECTION_EXPORT void setMulticastReportPublisher(
+            common::MulticastReportPublisherPtr const &publisher);
+
+        /// @brief Get the multicast report publisher, if any.
+        common::MulticastReportPublisherPtr const &
+        getMulticastReportPublisher() const {
+            return m_multicastPublisher;
+        }
+
+        /// @brief Set the scheduler that runs the update callbacks of sync
+        /// devices, and keeps timing statistics on them. Devices pick up the
+        /// scheduler at their first update.
+        ///
+        /// By default, an inline scheduler: updates run in process().
+        OSVR_CONNECTION_EXPORT void
+        setDeviceUpdateScheduler(DeviceUpdateSchedulerPtr const &scheduler);
+
+        /// @brief Get the sync device update scheduler.
+        DeviceUpdateSchedulerPtr const &getDeviceUpdateScheduler() const {
+            return m_updateScheduler;
+        }
+
+        /// @brief Have the messages sent and descriptors set by all devices
+        /// on this connection, existing and future, written to the given
+        /// recorder. Pass null to stop recording.
+        OSVR_CONNECTION_EXPORT void
+        setReportRecorder(ReportRecorderPtr const &recorder);
+
+        /// @brief Get the report recorder, if any.
+        ReportRecorderPtr const &getReportRecorder() const {
+            return m_recorder;
+        }
+
         /// @brief Destructor
         OSVR_CONNECTION_EXPORT virtual ~Connection();
 
@@ -204,6 +284,12 @@ namespace connection {
         DeviceList m_devices;
         std::vector<std::function<void()> > m_descriptorHandlers;
         util::log::LoggerPtr m_log;
+        common::InProcessTrackerTransportPtr m_trackerTransport;
+        common::ClientInterestFilterPtr m_interestFilter;
+        common::SharedMemoryReportPublisherPtr m_reportPublisher;
+        common::MulticastReportPublisherPtr m_multicastPublisher;
+        DeviceUpdateSchedulerPtr m_updateScheduler;
+        ReportRecorderPtr m_recorder;
     };
 } // namespace connection
 } // namespace osvr
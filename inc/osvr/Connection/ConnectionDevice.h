@@ -30,6 +30,7 @@
 #include <osvr/Connection/ConnectionDevicePtr.h>
 #include <osvr/Connection/MessageTypePtr.h>
 #include <osvr/Connection/DeviceTokenPtr.h>
+#include <osvr/Connection/ReportRecordingPtr.h>
 #include <osvr/Util/TimeValue.h>
 
 // Library/third-party includes
@@ -68,6 +69,10 @@ namespace connection {
         /// @brief For use only by DeviceToken
         void setDeviceToken(DeviceToken &token);
 
+        /// @brief Have messages sent and descriptors set from now on
+        /// recorded, or stop if passed null: for use by Connection.
+        void setReportRecorder(ReportRecorderPtr const &recorder);
+
         /// @brief Send new/updated JSON device descriptor.
         ///
         /// Note: does not trigger the descriptor handlers in connection - those
@@ -93,6 +98,10 @@ namespace connection {
                                 MessageType *type, const char *bytestream,
                                 size_t len) = 0;
 
+        /// @brief (Subclass implementation) Record messages as they're sent
+        /// from now on, or stop if passed null. Does nothing by default.
+        virtual void m_setReportRecorder(ReportRecorderPtr const &recorder);
+
         /// @brief Constructor for use by derived classes only.
         OSVR_CONNECTION_EXPORT ConnectionDevice(std::string const &name);
 
@@ -103,6 +112,7 @@ namespace connection {
         NameList m_names;
         DeviceToken *m_token;
         std::string m_descriptor;
+        ReportRecorderPtr m_recorder;
     };
 } // namespace connection
 } // namespace osvr
@@ -0,0 +1,199 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_DeviceUpdateScheduler_h_GUID_B047625A_A8F4_49AD_B54F_6AEB909C85B0
+#define INCLUDED_DeviceUpdateScheduler_h_GUID_B047625A_A8F4_49AD_B54F_6AEB909C85B0
+
+// Internal Includes
+#include <osvr/Connection/Export.h>
+#include <osvr/Connection/DeviceUpdateSchedulerPtr.h>
+#include <osvr/Util/SharedPtr.h>
+#include <osvr/Util/StdInt.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace osvr {
+namespace connection {
+    /// @brief Timing statistics for the update callback of a single device.
+    struct DeviceUpdateStats {
+        DeviceUpdateStats()
+            : updates(0), skipped(0), lastMicroseconds(0), maxMicroseconds(0),
+              meanMicroseconds(0) {}
+        /// @brief Device name
+        std::string name;
+        /// @brief Number of update calls completed.
+        uint64_t updates;
+        /// @brief Number of times an update was due but the previous one was
+        /// still running on a worker thread.
+        uint64_t skipped;
+        /// @brief Duration of the most recent update call.
+        uint64_t lastMicroseconds;
+        /// @brief Duration of the longest update call.
+        uint64_t maxMicroseconds;
+        /// @brief Mean duration of the update calls.
+        double meanMicroseconds;
+    };
+
+    /// @brief Runs the update callbacks of sync devices, keeping timing
+    /// statistics for each.
+    ///
+    /// An inline scheduler (the default) runs each update on the thread that
+    /// requests it - the server mainloop - just as if there were no scheduler.
+    /// A threaded scheduler instead hands the update to a fixed pool of worker
+    /// threads, or to a thread dedicated to the device, and returns at once,
+    /// so a slow driver no longer delays every other device. Either way, a
+    /// device never has two updates running at once: a request made while the
+    /// previous update is still running is dropped and counted as skipped.
+    class DeviceUpdateScheduler : boost::noncopyable {
+      public:
+        typedef std::function<void()> UpdateFunction;
+
+        /// @name Factory methods
+        /// @{
+        /// @brief Creates a scheduler running updates on the requesting
+        /// thread.
+        OSVR_CONNECTION_EXPORT static DeviceUpdateSchedulerPtr createInline();
+        /// @brief Creates a scheduler running updates on a pool of the given
+        /// number of worker threads (at least one).
+        OSVR_CONNECTION_EXPORT static DeviceUpdateSchedulerPtr
+        createPool(std::size_t threads);
+        /// @brief Creates a scheduler running the updates of each device on
+        /// a thread of its own.
+        OSVR_CONNECTION_EXPORT static DeviceUpdateSchedulerPtr
+        createPerDevice();
+        /// @}
+
+        /// @brief Destructor: stops and joins all worker threads, after any
+        /// updates in progress finish.
+        OSVR_CONNECTION_EXPORT ~DeviceUpdateScheduler();
+
+        /// @brief Whether updates run on threads other than the requesting
+        /// one.
+        bool isThreaded() const { return m_mode != Mode::Inline; }
+
+        /// @brief Adds a device, returning the task through which its updates
+        /// are requested.
+        OSVR_CONNECTION_EXPORT DeviceUpdateTaskPtr
+        addDevice(std::string const &name, UpdateFunction const &update);
+
+        /// @brief Gets the statistics of all devices whose tasks are still
+        /// alive. Safe to call from any thread.
+        OSVR_CONNECTION_EXPORT std::vector<DeviceUpdateStats> getStats() const;
+
+      private:
+        enum class Mode { Inline, Pool, PerDevice };
+        class WorkQueue;
+        typedef shared_ptr<WorkQueue> WorkQueuePtr;
+        DeviceUpdateScheduler(Mode mode, std::size_t threads);
+        void m_startThread(WorkQueuePtr const &queue);
+        static void m_work(WorkQueuePtr queue);
+        static void m_stopQueue(WorkQueue &queue);
+        friend class DeviceUpdateTask;
+
+        Mode const m_mode;
+        WorkQueuePtr m_poolQueue;
+        mutable std::mutex m_mutex;
+        /// @name Protected by m_mutex
+        /// @{
+        std::vector<WorkQueuePtr> m_queues;
+        std::vector<std::thread> m_threads;
+        std::vector<weak_ptr<DeviceUpdateTask> > m_tasks;
+        /// @}
+    };
+
+    /// @brief A single device's handle on a DeviceUpdateScheduler.
+    ///
+    /// Updates stop being run once the scheduler is destroyed, so keep a
+    /// reference to the scheduler for as long as the task is in use.
+    class DeviceUpdateTask
+        : boost::noncopyable,
+          public enable_shared_from_this<DeviceUpdateTask> {
+      public:
+        /// @brief Runs the device's update, or has it run on a worker thread.
+        /// Called from the mainloop once per pass.
+        ///
+        /// @returns false if the update was skipped because the previous one
+        /// is still running (or the task was cancelled).
+        OSVR_CONNECTION_EXPORT bool requestUpdate();
+
+        /// @brief Stops any further updates, blocking until one in progress
+        /// has finished.
+        OSVR_CONNECTION_EXPORT void cancel();
+
+        /// @brief Whether updates run on threads other than the requesting
+        /// one.
+        bool isThreaded() const { return m_queue != nullptr; }
+
+        OSVR_CONNECTION_EXPORT DeviceUpdateStats getStats() const;
+
+      private:
+        typedef DeviceUpdateScheduler::WorkQueue WorkQueue;
+        typedef DeviceUpdateScheduler::WorkQueuePtr WorkQueuePtr;
+        DeviceUpdateTask(std::string const &name,
+                         DeviceUpdateScheduler::UpdateFunction const &update,
+                         WorkQueuePtr const &queue, bool ownsQueue);
+        friend class DeviceUpdateScheduler;
+        /// @brief Runs the update and records its duration.
+        void m_run();
+        /// @brief Called on a worker thread for a queued update.
+        void m_runQueued();
+        /// @brief Marks a queued update finished (or abandoned).
+        void m_finish();
+
+        std::string const m_name;
+        DeviceUpdateScheduler::UpdateFunction const m_update;
+        WorkQueuePtr const m_queue;
+        bool const m_ownsQueue;
+
+        /// @brief Set from when an update is queued until it finishes.
+        std::atomic<bool> m_busy;
+        std::atomic<bool> m_cancelled;
+        std::mutex m_mutex;
+        std::condition_variable m_idle;
+
+        /// @name Written only by the thread running the update, except
+        /// m_skipped, written only by the requesting thread.
+        /// @{
+        std::atomic<uint64_t> m_updates;
+        std::atomic<uint64_t> m_skipped;
+        std::atomic<uint64_t> m_totalMicroseconds;
+        std::atomic<uint64_t> m_lastMicroseconds;
+        std::atomic<uint64_t> m_maxMicroseconds;
+        /// @}
+    };
+} // namespace connection
+} // namespace osvr
+
+#endif // INCLUDED_DeviceUpdateScheduler_h_GUID_B047625A_A8F4_49AD_B54F_6AEB909C85B0
@@ -0,0 +1,48 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_DeviceUpdateSchedulerPtr_h_GUID_889671FC_93C1_4C0A_B004_FD7016E4C37D
+#define INCLUDED_DeviceUpdateSchedulerPtr_h_GUID_889671FC_93C1_4C0A_B004_FD7016E4C37D
+
+// Internal Includes
+#include <osvr/Util/SharedPtr.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace connection {
+    class DeviceUpdateScheduler;
+    /// @brief How one must hold a DeviceUpdateScheduler.
+    typedef shared_ptr<DeviceUpdateScheduler> DeviceUpdateSchedulerPtr;
+    class DeviceUpdateTask;
+    /// @brief How one must hold a DeviceUpdateTask.
+    typedef shared_ptr<DeviceUpdateTask> DeviceUpdateTaskPtr;
+} // namespace connection
+} // namespace osvr
+
+#endif // INCLUDED_DeviceUpdateSchedulerPtr_h_GUID_889671FC_93C1_4C0A_B004_FD7016E4C37D
@@ -26,6 +26,7 @@
 #define INCLUDED_MessageType_h_GUID_61B56482_02E5_47B5_8CFA_EAF4286F309F
 
 // Internal Includes
+#include <osvr/Connection/Export.h>
 #include <osvr/Connection/MessageTypePtr.h>
 
 // Library/third-party includes
@@ -38,14 +39,14 @@
 struct OSVR_MessageTypeObject : boost::noncopyable {
   public:
     /// @brief destructor
-    virtual ~OSVR_MessageTypeObject();
+    OSVR_CONNECTION_EXPORT virtual ~OSVR_MessageTypeObject();
 
     /// @brief accessor for message name
-    std::string const &getName() const;
+    OSVR_CONNECTION_EXPORT std::string const &getName() const;
 
   protected:
     /// @brief Constructor for use by derived classes only.
-    OSVR_MessageTypeObject(std::string const &name);
+    OSVR_CONNECTION_EXPORT OSVR_MessageTypeObject(std::string const &name);
 
   private:
     std::string const m_name;
@@ -0,0 +1,178 @@
+/** @file
+    @brief Header for recording the messages a server's devices send, to a
+    file that can be read back and replayed.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ReportRecording_h_GUID_007E0124_D152_4B67_9CB5_63C70714FD19
+#define INCLUDED_ReportRecording_h_GUID_007E0124_D152_4B67_9CB5_63C70714FD19
+
+// Internal Includes
+#include <osvr/Connection/Export.h>
+#include <osvr/Connection/ReportRecordingPtr.h>
+#include <osvr/Util/StdInt.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <cstddef>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace osvr {
+namespace connection {
+    /// @brief A single entry read from a report recording.
+    struct RecordedEntry {
+        enum class Kind {
+            /// @brief Introduces a stream: `stream`, `device`, and
+            /// `messageType` are set. Always precedes the first message of
+            /// the stream.
+            Stream,
+            /// @brief A new or updated device descriptor: `sent`, `device`,
+            /// and `data` (the JSON) are set.
+            Descriptor,
+            /// @brief A message: `stream`, `sent`, `timestamp`, and `data`
+            /// (the raw bytes) are set.
+            Message
+        };
+
+        RecordedEntry()
+            : kind(Kind::Message), stream(0), sent(), timestamp() {}
+
+        Kind kind;
+        /// @brief Identifies a device name and message type pair.
+        uint32_t stream;
+        std::string device;
+        std::string messageType;
+        /// @brief When the message reached the connection, by the server's
+        /// clock.
+        util::time::TimeValue sent;
+        /// @brief The timestamp the device gave the message.
+        util::time::TimeValue timestamp;
+        std::string data;
+    };
+
+    /// @brief Writes every message a connection's devices send, with both its
+    /// timestamp and the time it was sent, along with the device descriptors,
+    /// to a file.
+    ///
+    /// Messages are recorded as each device's server interfaces pack them,
+    /// whether raw device data, tracker, analog, or button reports, or
+    /// messages from device components such as imaging. Streams are keyed by
+    /// device and message type name, so a recording can be replayed on any
+    /// connection.
+    ///
+    /// Thread-safe, though messages normally arrive from the server mainloop
+    /// alone.
+    class ReportRecorder : boost::noncopyable {
+      public:
+        /// @brief "OSVR"
+        static const uint32_t MAGIC = 0x4f535652;
+        static const uint32_t VERSION = 1;
+
+        /// @brief Creates (or truncates) a recording file.
+        ///
+        /// @throws std::runtime_error if the file can't be opened.
+        OSVR_CONNECTION_EXPORT static ReportRecorderPtr
+        create(std::string const &filename);
+
+        /// @brief Destructor: flushes the file.
+        OSVR_CONNECTION_EXPORT ~ReportRecorder();
+
+        /// @brief Records a message, as sent by the named device.
+        OSVR_CONNECTION_EXPORT void
+        recordMessage(std::string const &device,
+                      std::string const &messageType,
+                      util::time::TimeValue const &timestamp,
+                      const char *bytestream, std::size_t len);
+
+        /// @brief Records a device descriptor.
+        OSVR_CONNECTION_EXPORT void
+        recordDescriptor(std::string const &device,
+                         std::string const &descriptor);
+
+        /// @brief Writes anything buffered out to the file.
+        OSVR_CONNECTION_EXPORT void flush();
+
+        /// @brief Number of messages recorded so far.
+        OSVR_CONNECTION_EXPORT uint64_t getMessageCount() const;
+
+        /// @brief Whether a write has failed, after which nothing more is
+        /// recorded.
+        OSVR_CONNECTION_EXPORT bool hasFailed() const;
+
+      private:
+        explicit ReportRecorder(std::string const &filename);
+        template <typename Body>
+        void m_write(RecordedEntry::Kind kind, Body &body,
+                     const char *extra = nullptr, std::size_t extraLen = 0);
+        /// @brief Device name and message type name.
+        typedef std::pair<std::string, std::string> StreamKey;
+
+        std::string const m_filename;
+        mutable std::mutex m_mutex;
+        /// @name Protected by m_mutex
+        /// @{
+        std::ofstream m_file;
+        std::map<StreamKey, uint32_t> m_streams;
+        uint64_t m_messages;
+        bool m_failed;
+        /// @}
+    };
+
+    /// @brief Reads a recording written by a ReportRecorder, entry by entry.
+    class ReportRecordingReader : boost::noncopyable {
+      public:
+        /// @brief Opens a recording.
+        ///
+        /// @throws std::runtime_error if the file can't be opened or is not
+        /// a report recording of a version this code can read.
+        OSVR_CONNECTION_EXPORT explicit ReportRecordingReader(
+            std::string const &filename);
+
+        OSVR_CONNECTION_EXPORT ~ReportRecordingReader();
+
+        /// @brief Reads the next entry.
+        ///
+        /// @return false at the end of the recording. A truncated final
+        /// entry, as left by a server that didn't shut down cleanly, counts
+        /// as the end.
+        /// @throws std::runtime_error if an entry is corrupt.
+        OSVR_CONNECTION_EXPORT bool read(RecordedEntry &entry);
+
+        /// @brief Starts reading again from the first entry.
+        OSVR_CONNECTION_EXPORT void rewind();
+
+      private:
+        std::ifstream m_file;
+        std::streampos m_firstEntry;
+        std::string m_body;
+    };
+} // namespace connection
+} // namespace osvr
+
+#endif // INCLUDED_ReportRecording_h_GUID_007E0124_D152_4B67_9CB5_63C70714FD19
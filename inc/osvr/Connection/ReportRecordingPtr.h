@@ -0,0 +1,48 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ReportRecordingPtr_h_GUID_6CF5E3AB_F509_4F23_93CD_2C50BF922143
+#define INCLUDED_ReportRecordingPtr_h_GUID_6CF5E3AB_F509_4F23_93CD_2C50BF922143
+
+// Internal Includes
+#include <osvr/Util/SharedPtr.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace connection {
+    class ReportRecorder;
+    /// @brief How one must hold a ReportRecorder.
+    typedef shared_ptr<ReportRecorder> ReportRecorderPtr;
+    class ReportReplayer;
+    /// @brief How one must hold a ReportReplayer.
+    typedef shared_ptr<ReportReplayer> ReportReplayerPtr;
+} // namespace connection
+} // namespace osvr
+
+#endif // INCLUDED_ReportRecordingPtr_h_GUID_6CF5E3AB_F509_4F23_93CD_2C50BF922143
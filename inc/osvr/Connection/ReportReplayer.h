@@ -0,0 +1,161 @@
+/** @file
+    @brief Header for replaying a report recording into a connection, for
+    reproducible load tests of the server-to-client path.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ReportReplayer_h_GUID_438933BB_4946_497B_B8E4_B7FF5A4D52F0
+#define INCLUDED_ReportReplayer_h_GUID_438933BB_4946_497B_B8E4_B7FF5A4D52F0
+
+// Internal Includes
+#include <osvr/Connection/Export.h>
+#include <osvr/Connection/ConnectionPtr.h>
+#include <osvr/Connection/ReportRecording.h>
+#include <osvr/Connection/ReportRecordingPtr.h>
+#include <osvr/Util/StdInt.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace osvr {
+namespace connection {
+    /// @brief Progress of a ReportReplayer.
+    struct ReportReplayStats {
+        ReportReplayStats()
+            : messages(0), bytes(0), passes(0), maxLagMicroseconds(0),
+              finished(false) {}
+        /// @brief Messages replayed so far.
+        uint64_t messages;
+        /// @brief Bytes of message data replayed so far.
+        uint64_t bytes;
+        /// @brief Complete passes through the recording.
+        uint64_t passes;
+        /// @brief Furthest behind schedule a message has been replayed, when
+        /// pacing: if this grows, the server can't keep up at this speed.
+        int64_t maxLagMicroseconds;
+        /// @brief Whether the end of the recording has been reached (and
+        /// not looped).
+        bool finished;
+    };
+
+    /// @brief Replays a report recording, paced by the times the messages
+    /// were originally sent: at their original rate, some multiple of it, or
+    /// as fast as possible.
+    ///
+    /// Replayed messages keep the offset between their timestamp and the
+    /// time they were sent, relative to the time they are replayed, so
+    /// client-side latency measurements stay meaningful.
+    ///
+    /// Does nothing on its own: call update() frequently, e.g. from the
+    /// server mainloop.
+    class ReportReplayer : boost::noncopyable {
+      public:
+        /// @brief Value of `speed` meaning "don't pace the messages".
+        static const double AS_FAST_AS_POSSIBLE;
+        /// @brief Most messages replayed in one update() call when not
+        /// pacing, so the server still gets to service its connections.
+        static const std::size_t UNPACED_BATCH_SIZE = 256;
+
+        /// @brief Called for each entry as it comes due (including stream and
+        /// descriptor entries), with the timestamp a message should be sent
+        /// with.
+        typedef std::function<void(RecordedEntry const &entry,
+                                   util::time::TimeValue const &timestamp)>
+            Handler;
+
+        /// @brief Creates a replayer sending the messages through virtual
+        /// devices, with the original device names and descriptors, on the
+        /// given connection.
+        ///
+        /// @param speed 1 for the original rate, 2 for twice as fast, and so
+        /// on, or AS_FAST_AS_POSSIBLE.
+        /// @param loop Whether to start again from the beginning once the
+        /// recording ends.
+        ///
+        /// As with any other device token, keep the replayer (which owns the
+        /// device tokens) for as long as the connection is processed.
+        ///
+        /// @throws std::runtime_error if the recording can't be opened.
+        OSVR_CONNECTION_EXPORT static ReportReplayerPtr
+        create(ConnectionPtr const &conn, std::string const &filename,
+               double speed = 1., bool loop = false);
+
+        /// @brief Creates a replayer passing the entries to an arbitrary
+        /// handler instead.
+        ///
+        /// @throws std::runtime_error if the recording can't be opened.
+        OSVR_CONNECTION_EXPORT static ReportReplayerPtr
+        create(Handler const &handler, std::string const &filename,
+               double speed = 1., bool loop = false);
+
+        OSVR_CONNECTION_EXPORT ~ReportReplayer();
+
+        /// @brief Replays everything now due.
+        ///
+        /// When looping, each pass after the first starts at the next call
+        /// after the previous pass ends.
+        ///
+        /// @return false once the recording has finished.
+        OSVR_CONNECTION_EXPORT bool update();
+
+        /// @overload
+        ///
+        /// Takes the current time as a parameter, for deterministic testing.
+        OSVR_CONNECTION_EXPORT bool update(util::time::TimeValue const &now);
+
+        /// @brief Gets progress so far.
+        ReportReplayStats const &getStats() const { return m_stats; }
+
+      private:
+        ReportReplayer(Handler const &handler, std::string const &filename,
+                       double speed, bool loop);
+        /// @brief Goes back to the start of the recording for another pass.
+        /// @return false if there's nothing to replay.
+        bool m_rewind();
+
+        Handler m_handler;
+        ReportRecordingReader m_reader;
+        double const m_speed;
+        bool const m_loop;
+        /// @brief The next entry to replay.
+        RecordedEntry m_next;
+        /// @brief Whether the current pass has started replaying.
+        bool m_started;
+        /// @brief When the current pass started replaying, in microseconds.
+        int64_t m_passStart;
+        /// @brief Whether m_recordingStart has been set for this pass.
+        bool m_haveRecordingStart;
+        /// @brief When the first message or descriptor of the current pass
+        /// was originally sent, in microseconds.
+        int64_t m_recordingStart;
+        ReportReplayStats m_stats;
+    };
+} // namespace connection
+} // namespace osvr
+
+#endif // INCLUDED_ReportReplayer_h_GUID_438933BB_4946_497B_B8E4_B7FF5A4D52F0
@@ -158,7 +158,50 @@ namespace server {
         /// @brief Loads all plugins not marked for manual load.
         OSVR_SERVER_EXPORT void loadAutoPlugins();
 
+        /// @brief Uses an existing server instead of constructing one, e.g.
+        /// to reloadConfig() on a server configured earlier with the same
+        /// configuration as passed to loadConfig().
+        OSVR_SERVER_EXPORT void setServer(ServerPtr const &server);
+
+        /// @brief Applies the differences between new JSON configuration and
+        /// the configuration loaded so far to the server, without restarting
+        /// it.
+        ///
+        /// Added plugins are loaded and added drivers instantiated; new or
+        /// changed routes, aliases, external devices, display, and
+        /// RenderManager config replace the old ones. Drivers that are
+        /// unchanged are left alone, so their devices keep streaming. Entries
+        /// are compared as written, so a change only within a file referred
+        /// to (e.g. a display descriptor) isn't noticed.
+        ///
+        /// Anything else changed (the `server` section, or any removed or
+        /// changed driver, and any removed plugin, route, alias, or external
+        /// device) is left as it was: see getRestartRequired(). Only what
+        /// took effect becomes current, so such changes are reported again by
+        /// later reloads, and plugins or drivers that failed to load are
+        /// retried.
+        ///
+        /// Results of loading the added plugins and drivers replace those of
+        /// loadPlugins() and instantiateDrivers(). Safe to call from any
+        /// thread, even when the server is running.
+        ///
+        /// @throws std::runtime_error if parsing errors occur, in which case
+        /// nothing is changed.
+        ///
+        /// @returns true if and only if the new configuration is now fully in
+        /// effect.
+        OSVR_SERVER_EXPORT bool reloadConfig(std::string const &json);
+        /// @overload
+        OSVR_SERVER_EXPORT bool reloadConfig(std::istream &json);
+
+        /// @brief Get a reference to the list of changes the last
+        /// reloadConfig() left for a restart to apply: `.first` is what
+        /// changed, `.second` why it wasn't applied.
+        OSVR_SERVER_EXPORT ErrorList const &getRestartRequired() const;
+
       private:
+        bool m_reload(unique_ptr<ConfigureServerData> newData);
+
         /// @brief Private implementation data structure.
         unique_ptr<ConfigureServerData> m_data;
 
@@ -177,6 +220,9 @@ namespace server {
         SuccessList m_successfulInstances;
         ErrorList m_failedInstances;
         /// @}
+
+        /// @brief Results data of reloadConfig()
+        ErrorList m_restartRequired;
     };
 } // namespace server
 } // namespace osvr
@@ -61,6 +61,14 @@ namespace server {
     OSVR_SERVER_EXPORT ServerPtr configureServerFromFirstFileInList(
         std::vector<std::string> const &configNames);
 
+    /// @brief Like configureServerFromFirstFileInList(), but then watches the
+    /// config file used, applying the differences to the running server
+    /// (in its mainloop) each time the file changes - see
+    /// ConfigureServer::reloadConfig() for what can change without a
+    /// restart.
+    OSVR_SERVER_EXPORT ServerPtr configureServerFromFirstFileInListAndWatch(
+        std::vector<std::string> const &configNames);
+
 } // namespace server
 } // namespace osvr
 
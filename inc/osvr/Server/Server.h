@@ -29,6 +29,7 @@
 #include <osvr/Server/Export.h>
 #include <osvr/Server/ServerPtr.h>
 #include <osvr/Connection/ConnectionPtr.h>
+#include <osvr/Connection/DeviceUpdateScheduler.h>
 #include <osvr/Common/PathElementTypes_fwd.h>
 #include <osvr/Util/UniquePtr.h>
 
@@ -40,6 +41,7 @@
 #include <string>
 #include <functional>
 #include <stdexcept>
+#include <vector>
 
 namespace Json {
 class Value;
@@ -169,7 +171,7 @@ namespace server {
         /// @param params A string containing parameters. Format is between you
         /// and the plugin, but JSON is recommended.
         ///
-        /// Call only before starting the server or from within server thread.
+        /// Safe to call from any thread, even when server is running.
         OSVR_SERVER_EXPORT void
         instantiateDriver(std::string const &plugin, std::string const &driver,
                           std::string const &params = std::string());
@@ -242,6 +244,71 @@ namespace server {
         /// Call only before starting the server or from within server thread.
         OSVR_SERVER_EXPORT void setSleepTime(int microseconds);
 
+        /// @brief Sets whether device reports are sent only if some client has
+        /// advertised an interest in them (and no more often than the highest
+        /// maximum rate such clients asked for). Off by default: only turn
+        /// this on if all clients are recent enough to advertise their
+        /// interest.
+        ///
+        /// Safe to call from any thread, even when server is running.
+        OSVR_SERVER_EXPORT void setClientInterestFiltering(bool enabled);
+
+        /// @brief Sets whether tracker, analog, and button reports are also
+        /// written to shared memory, for clients on the same machine to read
+        /// directly instead of from VRPN messages. Off by default.
+        ///
+        /// Only affects devices created after the call, so call before loading
+        /// plugins. Safe to call from any thread.
+        OSVR_SERVER_EXPORT void setSharedMemoryReports(bool enabled);
+
+        /// @brief Sets a UDP multicast group to which tracker, analog, and
+        /// button reports are also sent, once each, for clients elsewhere on
+        /// the LAN to receive instead of a VRPN message per connection. Off
+        /// (an empty group) by default.
+        ///
+        /// @param port UDP port, or 0 for the default.
+        /// @param ttl Multicast time-to-live: 1 keeps reports on the local
+        /// subnet.
+        /// @param iface Address of the interface to send from, or empty to
+        /// let the system choose.
+        ///
+        /// Only affects devices created after the call, so call before loading
+        /// plugins. If the socket can't be set up, the problem is logged and
+        /// reports go by VRPN alone. Safe to call from any thread.
+        OSVR_SERVER_EXPORT void
+        setMulticastReports(std::string const &group, int port = 0,
+                            int ttl = 1,
+                            std::string const &iface = std::string());
+
+        /// @brief Value for setDeviceUpdateThreads() to give each device a
+        /// thread of its own.
+        static const int DEVICE_UPDATE_THREAD_PER_DEVICE = -1;
+
+        /// @brief Sets how the update callbacks of sync devices are run: in
+        /// the server mainloop (0, the default), spread across a pool of this
+        /// many worker threads, or each on a dedicated thread
+        /// (DEVICE_UPDATE_THREAD_PER_DEVICE). Reports are still sent from the
+        /// server thread, so off the mainloop, a slow device no longer delays
+        /// the others.
+        ///
+        /// Devices keep the setting in effect at their first update, so call
+        /// before starting the server. Safe to call from any thread.
+        OSVR_SERVER_EXPORT void setDeviceUpdateThreads(int threads);
+
+        /// @brief Gets timing statistics for the update callback of each
+        /// sync device. Safe to call from any thread.
+        OSVR_SERVER_EXPORT std::vector<connection::DeviceUpdateStats>
+        getDeviceUpdateStats() const;
+
+        /// @brief Sets a file to which the messages sent by all devices, and
+        /// their descriptors, are recorded, with their timestamps, for later
+        /// replay (see connection::ReportReplayer). Off (an empty filename) by
+        /// default; an empty filename stops recording.
+        ///
+        /// If the file can't be opened, the problem is logged. Safe to call
+        /// from any thread.
+        OSVR_SERVER_EXPORT void setReportRecording(std::string const &filename);
+
 #if 0
         /// @brief Returns the amount of time (in microseconds) that the server
         /// loop sleeps each loop.
@@ -0,0 +1,164 @@
+/** @file
+    @brief Header defining a pool of aligned memory buffers, for reusing
+    large, frequently-allocated buffers such as image data.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_AlignedMemoryPool_h_GUID_15F7E0FD_31EF_4B8E_B852_5843BE257337
+#define INCLUDED_AlignedMemoryPool_h_GUID_15F7E0FD_31EF_4B8E_B852_5843BE257337
+
+// Internal Includes
+#include <osvr/Util/AlignedMemory.h>
+#include <osvr/Util/Export.h>
+#include <osvr/Util/ImagingReportTypesC.h>
+#include <osvr/Util/SharedPtr.h>
+#include <osvr/Util/StdInt.h>
+#include <osvr/Util/UniquePtr.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace osvr {
+namespace util {
+    /// @brief Usage statistics for an AlignedMemoryPool.
+    struct AlignedMemoryPoolStats {
+        /// @brief Requests satisfied with a buffer from the pool.
+        uint64_t hits;
+        /// @brief Requests that required a new allocation.
+        uint64_t misses;
+        /// @brief Buffers freed on return rather than retained, because the
+        /// pool was at its retention limit.
+        uint64_t discards;
+        /// @brief Bytes currently held by the pool, ready for reuse.
+        std::size_t bytesRetained;
+    };
+
+    /// @brief A thread-safe pool of aligned memory buffers, grouped into size
+    /// classes, that keeps buffers returned to it for reuse instead of freeing
+    /// them.
+    ///
+    /// Intended for large buffers allocated at a high rate in a few recurring
+    /// sizes (like image frames), where going to the allocator every time
+    /// means page faults and latency spikes. Size classes are spaced four per
+    /// doubling, so a request is rounded up by less than 25%.
+    ///
+    /// Create with create(): buffers handed out with a PooledAlignedDeleter
+    /// keep the pool alive until they are returned.
+    class AlignedMemoryPool {
+      public:
+        /// @brief Default limit on bytes held by the pool for reuse.
+        static const std::size_t DEFAULT_MAX_BYTES_RETAINED =
+            128 * 1024 * 1024;
+
+        /// @brief Factory function
+        ///
+        /// @param maxBytesRetained Buffers returned when the pool already
+        /// holds this much are freed instead.
+        /// @param alignment Alignment of all buffers from this pool.
+        OSVR_UTIL_EXPORT static shared_ptr<AlignedMemoryPool>
+        create(std::size_t maxBytesRetained = DEFAULT_MAX_BYTES_RETAINED,
+               std::size_t alignment = OSVR_DEFAULT_ALIGN_SIZE);
+
+        /// @brief The process-wide pool for image buffers.
+        OSVR_UTIL_EXPORT static shared_ptr<AlignedMemoryPool> const &
+        getImageBufferPool();
+
+        OSVR_UTIL_EXPORT ~AlignedMemoryPool();
+
+        AlignedMemoryPool(AlignedMemoryPool const &) = delete;
+        AlignedMemoryPool &operator=(AlignedMemoryPool const &) = delete;
+
+        /// @brief Gets a buffer of at least the given size, from the pool if
+        /// possible. Return it with release(), passing the same size.
+        OSVR_UTIL_EXPORT void *acquire(std::size_t bytes);
+
+        /// @brief Returns a buffer obtained from acquire() to the pool.
+        OSVR_UTIL_EXPORT void release(void *p, std::size_t bytes);
+
+        /// @brief Frees all buffers currently held for reuse.
+        OSVR_UTIL_EXPORT void trim();
+
+        OSVR_UTIL_EXPORT AlignedMemoryPoolStats getStats() const;
+
+        std::size_t getAlignment() const { return m_alignment; }
+
+        /// @brief The size actually allocated to satisfy a request for the
+        /// given number of bytes.
+        OSVR_UTIL_EXPORT static std::size_t getSizeClass(std::size_t bytes);
+
+      private:
+        AlignedMemoryPool(std::size_t maxBytesRetained, std::size_t alignment);
+        const std::size_t m_maxBytesRetained;
+        const std::size_t m_alignment;
+        mutable std::mutex m_mutex;
+        /// @brief Free buffers, keyed by size class.
+        std::map<std::size_t, std::vector<void *>> m_free;
+        AlignedMemoryPoolStats m_stats;
+    };
+
+    /// @brief Deleter returning a buffer to the AlignedMemoryPool it came
+    /// from. A default-constructed one just frees it (with alignedFree).
+    class PooledAlignedDeleter {
+      public:
+        PooledAlignedDeleter() : m_bytes(0) {}
+        PooledAlignedDeleter(shared_ptr<AlignedMemoryPool> pool,
+                             std::size_t bytes)
+            : m_pool(std::move(pool)), m_bytes(bytes) {}
+
+        void operator()(void *p) const {
+            if (!p) {
+                return;
+            }
+            if (m_pool) {
+                m_pool->release(p, m_bytes);
+            } else {
+                alignedFree(p);
+            }
+        }
+
+      private:
+        shared_ptr<AlignedMemoryPool> m_pool;
+        std::size_t m_bytes;
+    };
+
+    using PooledImageBufferPtr =
+        unique_ptr<OSVR_ImageBufferElement, PooledAlignedDeleter>;
+
+    /// @brief Gets an image buffer from a pool (by default, the process-wide
+    /// image buffer pool) that will be returned there when freed.
+    inline PooledImageBufferPtr makePooledImageBuffer(
+        std::size_t bytes, shared_ptr<AlignedMemoryPool> const &pool =
+                               AlignedMemoryPool::getImageBufferPool()) {
+        return PooledImageBufferPtr(
+            static_cast<OSVR_ImageBufferElement *>(pool->acquire(bytes)),
+            PooledAlignedDeleter(pool, bytes));
+    }
+} // namespace util
+} // namespace osvr
+
+#endif // INCLUDED_AlignedMemoryPool_h_GUID_15F7E0FD_31EF_4B8E_B852_5843BE257337
@@ -0,0 +1,320 @@
+/** @file
+    @brief Header for a logger that defers formatting and output of messages
+    to a background thread, for use on latency-sensitive threads.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_DeferredLogger_h_GUID_E0FA99B7_2308_4BB1_A3A2_611C4DE4D825
+#define INCLUDED_DeferredLogger_h_GUID_E0FA99B7_2308_4BB1_A3A2_611C4DE4D825
+
+// Internal Includes
+#include <osvr/Util/Export.h>
+#include <osvr/Util/Log.h> // for LoggerPtr
+#include <osvr/Util/LogLevel.h>
+#include <osvr/Util/SharedPtr.h>
+#include <osvr/Util/StdInt.h>
+#include <osvr/Util/UniquePtr.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <type_traits>
+
+namespace osvr {
+namespace util {
+    namespace log {
+        /// @brief A single argument to a deferred log message, captured by
+        /// value (or, for strings, by pointer) at the call site.
+        class DeferredLogArg {
+          public:
+            enum class Type : uint8_t {
+                Signed,
+                Unsigned,
+                Floating,
+                Boolean,
+                String,
+                Pointer
+            };
+
+            DeferredLogArg() : m_unsigned(0), m_type(Type::Unsigned) {}
+
+            static DeferredLogArg makeSigned(int64_t v) {
+                DeferredLogArg ret(Type::Signed);
+                ret.m_signed = v;
+                return ret;
+            }
+            static DeferredLogArg makeUnsigned(uint64_t v) {
+                DeferredLogArg ret(Type::Unsigned);
+                ret.m_unsigned = v;
+                return ret;
+            }
+            static DeferredLogArg makeFloating(double v) {
+                DeferredLogArg ret(Type::Floating);
+                ret.m_floating = v;
+                return ret;
+            }
+            static DeferredLogArg makeBoolean(bool v) {
+                DeferredLogArg ret(Type::Boolean);
+                ret.m_unsigned = v ? 1 : 0;
+                return ret;
+            }
+            static DeferredLogArg makeString(const char *v) {
+                DeferredLogArg ret(Type::String);
+                ret.m_string = v;
+                return ret;
+            }
+            static DeferredLogArg makePointer(const void *v) {
+                DeferredLogArg ret(Type::Pointer);
+                ret.m_pointer = v;
+                return ret;
+            }
+
+            Type getType() const { return m_type; }
+
+            /// @brief Writes the argument's value to a stream.
+            OSVR_UTIL_EXPORT void write(std::ostream &os) const;
+
+          private:
+            explicit DeferredLogArg(Type type) : m_type(type) {}
+            union {
+                int64_t m_signed;
+                uint64_t m_unsigned;
+                double m_floating;
+                const char *m_string;
+                const void *m_pointer;
+            };
+            Type m_type;
+        };
+
+        namespace detail {
+            template <typename T>
+            using EnableIfSigned =
+                typename std::enable_if<std::is_integral<T>::value &&
+                                            std::is_signed<T>::value,
+                                        DeferredLogArg>::type;
+            template <typename T>
+            using EnableIfUnsigned =
+                typename std::enable_if<std::is_integral<T>::value &&
+                                            std::is_unsigned<T>::value &&
+                                            !std::is_same<T, bool>::value,
+                                        DeferredLogArg>::type;
+            template <typename T>
+            using EnableIfFloating =
+                typename std::enable_if<std::is_floating_point<T>::value,
+                                        DeferredLogArg>::type;
+            template <typename T>
+            using EnableIfEnum = typename std::enable_if<std::is_enum<T>::value,
+                                                         DeferredLogArg>::type;
+
+            /// @name Conversions of supported argument types
+            /// @{
+            template <typename T>
+            inline EnableIfSigned<T> makeDeferredLogArg(T v) {
+                return DeferredLogArg::makeSigned(v);
+            }
+            template <typename T>
+            inline EnableIfUnsigned<T> makeDeferredLogArg(T v) {
+                return DeferredLogArg::makeUnsigned(v);
+            }
+            template <typename T>
+            inline EnableIfFloating<T> makeDeferredLogArg(T v) {
+                return DeferredLogArg::makeFloating(v);
+            }
+            template <typename T>
+            inline EnableIfEnum<T> makeDeferredLogArg(T v) {
+                return DeferredLogArg::makeSigned(static_cast<int64_t>(v));
+            }
+            inline DeferredLogArg makeDeferredLogArg(bool v) {
+                return DeferredLogArg::makeBoolean(v);
+            }
+            inline DeferredLogArg makeDeferredLogArg(const char *v) {
+                return DeferredLogArg::makeString(v);
+            }
+            template <typename T>
+            inline DeferredLogArg makeDeferredLogArg(T const *v) {
+                return DeferredLogArg::makePointer(v);
+            }
+            /// @}
+        } // namespace detail
+
+        class DeferredLogger;
+        typedef shared_ptr<DeferredLogger> DeferredLoggerPtr;
+
+        /**
+         * @brief A logger for hot paths (server loop, tracker threads, shared
+         * memory transport) that does no formatting or I/O on the calling
+         * thread.
+         *
+         * A call copies the log level, a pointer to the format string, a
+         * timestamp, and up to MAX_ARGS raw arguments into a fixed-size
+         * record in a lock-free single-producer queue belonging to the calling
+         * thread. A background thread drains all queues, formats the messages
+         * in timestamp order, and hands them on to a Logger (or other handler).
+         * If a thread's queue is full, the message is dropped and counted;
+         * the count is available from getDroppedCount() and reported through
+         * the handler as a warning.
+         *
+         * Format strings use `{}` for each argument, in order, and must be
+         * string literals. So must any string arguments, since only the
+         * pointer is captured - messages are formatted later, on another
+         * thread.
+         *
+         * Each distinct thread that logs claims one of MAX_PRODUCER_THREADS
+         * queues, for the life of the DeferredLogger (a thread ID reused by a
+         * new thread reuses the queue). Messages from threads beyond that limit
+         * are dropped.
+         */
+        class DeferredLogger {
+          public:
+            /// @brief Most arguments that can be passed to a single message.
+            static const std::size_t MAX_ARGS = 6;
+            /// @brief Most distinct threads that can log through one instance.
+            static const std::size_t MAX_PRODUCER_THREADS = 32;
+            /// @brief Default per-thread queue capacity, in messages.
+            static const std::size_t DEFAULT_QUEUE_SIZE = 1024;
+
+            /// @brief Receives formatted messages on the background thread.
+            typedef std::function<void(LogLevel, std::string const &)>
+                Handler;
+
+            /// @brief Factory function for a deferred logger writing to an
+            /// existing logger, initially with the same log level.
+            ///
+            /// @param queueSize Per-thread queue capacity, in messages:
+            /// rounded up to a power of two.
+            OSVR_UTIL_EXPORT static DeferredLoggerPtr
+            make(LoggerPtr target, std::size_t queueSize = DEFAULT_QUEUE_SIZE);
+
+            /// @brief Factory function for a deferred logger passing formatted
+            /// messages to an arbitrary handler, initially logging all levels.
+            OSVR_UTIL_EXPORT static DeferredLoggerPtr
+            make(Handler handler, std::size_t queueSize = DEFAULT_QUEUE_SIZE);
+
+            /// @brief Destructor: writes out all pending messages before
+            /// stopping the background thread.
+            OSVR_UTIL_EXPORT ~DeferredLogger();
+
+            DeferredLogger(DeferredLogger const &) = delete;
+            DeferredLogger &operator=(DeferredLogger const &) = delete;
+
+            /// @brief Whether a message at this level would be recorded: a
+            /// single relaxed atomic load.
+            bool shouldLog(LogLevel level) const {
+                return static_cast<int>(level) >=
+                       m_level.load(std::memory_order_relaxed);
+            }
+
+            LogLevel getLogLevel() const {
+                return static_cast<LogLevel>(
+                    m_level.load(std::memory_order_relaxed));
+            }
+
+            /// @brief Set the minimum level at which messages are recorded.
+            /// (A target logger's own level still applies once they are
+            /// formatted.)
+            void setLogLevel(LogLevel level) {
+                m_level.store(static_cast<int>(level),
+                              std::memory_order_relaxed);
+            }
+
+            /// @brief Records a message, if its level is enabled.
+            template <std::size_t N, typename... Args>
+            void log(LogLevel level, char const (&format)[N],
+                     Args const &... args) {
+                static_assert(sizeof...(Args) <= MAX_ARGS,
+                              "Too many arguments for a deferred log message");
+                if (!shouldLog(level)) {
+                    return;
+                }
+                DeferredLogArg captured[sizeof...(Args) + 1] = {
+                    detail::makeDeferredLogArg(args)...,
+                    DeferredLogArg::makeBoolean(false)};
+                m_submit(level, format, captured, sizeof...(Args));
+            }
+
+            /// @name logger->debug("format {}", arg) call style
+            /// @{
+            template <std::size_t N, typename... Args>
+            void trace(char const (&format)[N], Args const &... args) {
+                log(LogLevel::trace, format, args...);
+            }
+            template <std::size_t N, typename... Args>
+            void debug(char const (&format)[N], Args const &... args) {
+                log(LogLevel::debug, format, args...);
+            }
+            template <std::size_t N, typename... Args>
+            void info(char const (&format)[N], Args const &... args) {
+                log(LogLevel::info, format, args...);
+            }
+            template <std::size_t N, typename... Args>
+            void notice(char const (&format)[N], Args const &... args) {
+                log(LogLevel::notice, format, args...);
+            }
+            template <std::size_t N, typename... Args>
+            void warn(char const (&format)[N], Args const &... args) {
+                log(LogLevel::warn, format, args...);
+            }
+            template <std::size_t N, typename... Args>
+            void error(char const (&format)[N], Args const &... args) {
+                log(LogLevel::error, format, args...);
+            }
+            template <std::size_t N, typename... Args>
+            void critical(char const (&format)[N], Args const &... args) {
+                log(LogLevel::critical, format, args...);
+            }
+            /// @}
+
+            /// @brief Number of messages dropped so far because the calling
+            /// thread's queue was full (or no queue was available).
+            OSVR_UTIL_EXPORT uint64_t getDroppedCount() const;
+
+            /// @brief Blocks until all messages recorded before the call have
+            /// been passed to the handler.
+            OSVR_UTIL_EXPORT void flush();
+
+            /// @brief Formats a message the way the background thread does -
+            /// exposed for testing.
+            OSVR_UTIL_EXPORT static std::string
+            format(const char *format, DeferredLogArg const *args,
+                   std::size_t argCount);
+
+          private:
+            class Impl;
+            DeferredLogger(Handler &&handler, std::size_t queueSize,
+                           LogLevel level);
+            OSVR_UTIL_EXPORT void m_submit(LogLevel level, const char *format,
+                                           DeferredLogArg const *args,
+                                           std::size_t argCount);
+            std::atomic<int> m_level;
+            unique_ptr<Impl> m_impl;
+        };
+    } // namespace log
+} // namespace util
+} // namespace osvr
+
+#endif // INCLUDED_DeferredLogger_h_GUID_E0FA99B7_2308_4BB1_A3A2_611C4DE4D825
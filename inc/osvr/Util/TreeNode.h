@@ -36,6 +36,7 @@
 // Standard includes
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <algorithm>
 #include <stdexcept>
 
@@ -58,7 +59,8 @@ namespace util {
         ///
         /// - All non-root nodes are named, and children may only be created
         /// attached to a parent.
-        /// - All children of a given node are uniquely named.
+        /// - All children of a given node are uniquely named, and can be
+        /// looked up by name in constant time.
         /// - Node names are immutable.
         /// - Contained values are mutable.
         /// - Traversal is provided for by templated visit methods that accept a
@@ -194,9 +196,12 @@ namespace util {
             value_type m_value;
 
             typedef std::vector<ptr_type> ChildList;
-            /// @brief Ownership of children
+            /// @brief Ownership of children, in order of creation.
             ChildList m_children;
 
+            /// @brief Index of children by name.
+            std::unordered_map<std::string, weak_ptr_type> m_childrenByName;
+
             /// @brief Name
             std::string const m_name;
 
@@ -302,14 +307,10 @@ namespace util {
         template <typename ValueType>
         inline typename TreeNode<ValueType>::weak_ptr_type
         TreeNode<ValueType>::m_getChildByName(std::string const &name) const {
-            /// @todo Don't use a linear search here - use an unordered map or
-            /// something.
-            auto it = std::find_if(
-                begin(m_children), end(m_children),
-                [&](ptr_type const &n) { return n->getName() == name; });
+            auto it = m_childrenByName.find(name);
             weak_ptr_type ret = nullptr;
-            if (it != end(m_children)) {
-                ret = (*it).get();
+            if (it != end(m_childrenByName)) {
+                ret = it->second;
             }
             return ret;
         }
@@ -318,12 +319,14 @@ namespace util {
         inline void TreeNode<ValueType>::m_addChild(
             typename TreeNode<ValueType>::ptr_type const &child) {
             m_children.push_back(child);
+            m_childrenByName.emplace(child->getName(), child.get());
         }
 
         template <typename ValueType>
         inline TreeNode<ValueType>::TreeNode(TreeNode<ValueType> &parent,
                                              std::string const &name)
-            : m_value(), m_children(), m_name(name), m_parent(&parent) {
+            : m_value(), m_children(), m_childrenByName(), m_name(name),
+              m_parent(&parent) {
             if (m_name.empty()) {
                 throw std::logic_error(
                     "Can't create a named tree node with an empty name!");
@@ -334,7 +337,8 @@ namespace util {
         inline TreeNode<ValueType>::TreeNode(TreeNode<ValueType> &parent,
                                              std::string const &name,
                                              ValueType const &val)
-            : m_value(val), m_children(), m_name(name), m_parent(&parent) {
+            : m_value(val), m_children(), m_childrenByName(), m_name(name),
+              m_parent(&parent) {
             if (m_name.empty()) {
                 throw std::logic_error(
                     "Can't create a named tree node with an empty name!");
@@ -343,13 +347,15 @@ namespace util {
 
         template <typename ValueType>
         inline TreeNode<ValueType>::TreeNode()
-            : m_value(), m_children(), m_name(), m_parent(nullptr) {
+            : m_value(), m_children(), m_childrenByName(), m_name(),
+              m_parent(nullptr) {
             /// Special root constructor
         }
 
         template <typename ValueType>
         inline TreeNode<ValueType>::TreeNode(ValueType const &val)
-            : m_value(val), m_children(), m_name(), m_parent(nullptr) {
+            : m_value(val), m_children(), m_childrenByName(), m_name(),
+              m_parent(nullptr) {
             /// Special root constructor
         }
 
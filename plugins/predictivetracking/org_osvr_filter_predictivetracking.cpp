@@ -0,0 +1,328 @@
+/** @file
+    @brief Analysis plugin that performs full 6-DOF predictive tracking of a
+    tracker, using its velocity reports, publishing one sensor per configured
+    prediction interval.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/AnalysisPluginKit/AnalysisPluginKitC.h>
+#include <osvr/ClientKit/InterfaceC.h>
+#include <osvr/ClientKit/InterfaceCallbackC.h>
+#include <osvr/Kalman/PoseConstantVelocity.h>
+#include <osvr/Kalman/PoseDampedConstantVelocity.h>
+#include <osvr/Kalman/PoseState.h>
+#include <osvr/PluginKit/PluginKit.h>
+#include <osvr/PluginKit/TrackerInterfaceC.h>
+#include <osvr/Util/EigenInterop.h>
+#include <osvr/Util/EigenQuatExponentialMap.h>
+#include <osvr/Util/StringLiteralFileToString.h>
+#include <osvr/Util/TimeValue.h>
+
+// Generated JSON header file
+#include "org_osvr_filter_predictivetracking_json.h"
+
+// Library/third-party includes
+#include <json/reader.h>
+#include <json/value.h>
+
+// Standard includes
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+// Anonymous namespace to avoid symbol collision
+namespace {
+
+static const auto DRIVER_NAME = "PredictiveTracker";
+
+namespace kalman = osvr::kalman;
+using PoseState = kalman::pose_externalized_rotation::State;
+
+/// @brief Converts an incremental-quaternion angular velocity into the
+/// rotation-vector-per-second form used by the Kalman pose state.
+inline Eigen::Vector3d
+toAngularVelocityVector(OSVR_AngularVelocityState const &state) {
+    if (state.dt <= 0) {
+        return Eigen::Vector3d::Zero();
+    }
+    Eigen::Quaterniond q =
+        osvr::util::fromQuat(state.incrementalRotation).normalized();
+    if (q.w() < 0) {
+        /// Take the short way around.
+        q.coeffs() *= -1;
+    }
+    /// quat_ln gives the half-angle rotation vector.
+    return osvr::util::quat_ln(q) * 2. / state.dt;
+}
+
+struct PredictionParams {
+    /// @brief Prediction intervals in seconds, one per output sensor.
+    std::vector<double> horizons;
+    /// @brief Whether to use the damped constant-velocity process model.
+    bool damped;
+    /// @brief Velocity attenuation per second for the damped model.
+    double damping;
+    /// @brief Velocity reports older than this (in seconds) relative to a
+    /// pose report are ignored, so the pose is passed through unpredicted
+    /// rather than extrapolated with a stale velocity.
+    double velocityTimeout;
+};
+
+class PredictiveTrackingDevice {
+  public:
+    PredictiveTrackingDevice(OSVR_PluginRegContext ctx,
+                             std::string const &name, std::string const &input,
+                             PredictionParams const &params)
+        : m_params(params), m_dampedModel(params.damping) {
+        /// Create the initialization options
+        OSVR_DeviceInitOptions opts = osvrDeviceCreateInitOptions(ctx);
+
+        osvrDeviceTrackerConfigure(opts, &m_trackerOut);
+
+        /// Create the device token with the options
+        OSVR_DeviceToken dev;
+        if (OSVR_RETURN_FAILURE ==
+            osvrAnalysisSyncInit(ctx, name.c_str(), opts, &dev, &m_clientCtx)) {
+            throw std::runtime_error("Could not initialize analysis plugin!");
+        }
+        m_dev = osvr::pluginkit::DeviceToken(dev);
+
+        /// Send JSON descriptor, with one sensor per horizon rather than the
+        /// default of 1.
+        {
+            Json::Reader reader;
+            Json::Value descriptor;
+            if (!reader.parse(osvr::util::makeString(
+                                  org_osvr_filter_predictivetracking_json),
+                              descriptor)) {
+                throw std::logic_error("Faulty JSON file for predictive "
+                                       "tracking filter - should not be "
+                                       "possible!");
+            }
+            descriptor["interfaces"]["tracker"]["count"] =
+                static_cast<Json::UInt>(m_params.horizons.size());
+            m_dev.sendJsonDescriptor(descriptor.toStyledString());
+        }
+
+        /// Register update callback
+        m_dev.registerUpdateCallback(this);
+
+        /// Create our client interface and register callbacks.
+        if (OSVR_RETURN_FAILURE == osvrClientGetInterface(m_clientCtx,
+                                                          input.c_str(),
+                                                          &m_clientInterface)) {
+            throw std::runtime_error(
+                "Could not get client interface for analysis plugin!");
+        }
+        osvrRegisterPoseCallback(m_clientInterface,
+                                 &PredictiveTrackingDevice::poseCallback, this);
+        osvrRegisterVelocityCallback(
+            m_clientInterface, &PredictiveTrackingDevice::velocityCallback,
+            this);
+    }
+
+    ~PredictiveTrackingDevice() {
+        /// Free the client interface so we don't end up getting called after
+        /// destruction.
+        osvrClientFreeInterface(m_clientCtx, m_clientInterface);
+    }
+
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    static void poseCallback(void *userdata, const OSVR_TimeValue *timestamp,
+                             const OSVR_PoseReport *report) {
+        auto &self = *static_cast<PredictiveTrackingDevice *>(userdata);
+        self.handlePose(*timestamp, *report);
+    }
+
+    static void velocityCallback(void *userdata,
+                                 const OSVR_TimeValue *timestamp,
+                                 const OSVR_VelocityReport *report) {
+        auto &self = *static_cast<PredictiveTrackingDevice *>(userdata);
+        self.handleVelocity(*timestamp, *report);
+    }
+
+    /// Records the most recent velocities, for use with the next poses.
+    void handleVelocity(OSVR_TimeValue const &timestamp,
+                        OSVR_VelocityReport const &report) {
+        if (report.state.linearVelocityValid) {
+            m_linearVelocity =
+                osvr::util::vecMap(report.state.linearVelocity);
+            m_linearVelocityTime = timestamp;
+            m_haveLinearVelocity = true;
+        }
+        if (report.state.angularVelocityValid) {
+            m_angularVelocity =
+                toAngularVelocityVector(report.state.angularVelocity);
+            m_angularVelocityTime = timestamp;
+            m_haveAngularVelocity = true;
+        }
+    }
+
+    /// Predicts the pose forward by each horizon and sends the results, each
+    /// stamped with the time of the source report.
+    void handlePose(OSVR_TimeValue const &timestamp,
+                    OSVR_PoseReport const &report) {
+        using osvr::util::vecMap;
+        using osvr::util::fromQuat;
+        using osvr::util::toQuat;
+        m_state.position() = vecMap(report.pose.translation);
+        m_state.incrementalOrientation() = Eigen::Vector3d::Zero();
+        m_state.setQuaternion(fromQuat(report.pose.rotation));
+        m_state.velocity() = isFresh(m_haveLinearVelocity,
+                                     m_linearVelocityTime, timestamp)
+                                 ? m_linearVelocity
+                                 : Eigen::Vector3d::Zero();
+        m_state.angularVelocity() = isFresh(m_haveAngularVelocity,
+                                            m_angularVelocityTime, timestamp)
+                                        ? m_angularVelocity
+                                        : Eigen::Vector3d::Zero();
+
+        OSVR_ChannelCount sensor = 0;
+        for (auto horizon : m_params.horizons) {
+            m_predicted = m_state;
+            m_predicted.setStateVector(
+                m_params.damped
+                    ? m_dampedModel.computeEstimate(m_predicted, horizon)
+                    : m_model.computeEstimate(m_predicted, horizon));
+
+            OSVR_PoseState pose;
+            vecMap(pose.translation) = m_predicted.position();
+            toQuat(m_predicted.getCombinedQuaternion(), pose.rotation);
+            osvrDeviceTrackerSendPoseTimestamped(m_dev, m_trackerOut, &pose,
+                                                 sensor, &timestamp);
+            ++sensor;
+        }
+    }
+
+    OSVR_ReturnCode update() {
+        // Nothing to do here - everything happens in a callback.
+        return OSVR_RETURN_SUCCESS;
+    }
+
+  private:
+    bool isFresh(bool have, OSVR_TimeValue const &velocityTime,
+                 OSVR_TimeValue const &poseTime) const {
+        return have && osvr::util::time::duration(poseTime, velocityTime) <=
+                           m_params.velocityTimeout;
+    }
+
+    const PredictionParams m_params;
+    kalman::PoseConstantVelocityProcessModel m_model;
+    kalman::PoseDampedConstantVelocityProcessModel m_dampedModel;
+
+    /// @brief Filter state built from each incoming report, and a scratch
+    /// copy of it to predict forward, kept as members to avoid reallocating
+    /// per report.
+    PoseState m_state;
+    PoseState m_predicted;
+
+    Eigen::Vector3d m_linearVelocity = Eigen::Vector3d::Zero();
+    OSVR_TimeValue m_linearVelocityTime = {};
+    bool m_haveLinearVelocity = false;
+    Eigen::Vector3d m_angularVelocity = Eigen::Vector3d::Zero();
+    OSVR_TimeValue m_angularVelocityTime = {};
+    bool m_haveAngularVelocity = false;
+
+    OSVR_TrackerDeviceInterface m_trackerOut;
+    osvr::pluginkit::DeviceToken m_dev;
+    OSVR_ClientContext m_clientCtx;
+    OSVR_ClientInterface m_clientInterface;
+};
+
+class AnalysisPluginInstantiation {
+  public:
+    AnalysisPluginInstantiation() {}
+    /// Parameters:
+    ///
+    /// - `input` (required): path of the tracker sensor to predict.
+    /// - `name`: device name, defaulting to the driver name.
+    /// - `predictMilliSeconds`: a number or array of numbers - each becomes
+    ///   an output sensor predicting that far ahead, in order. Default 16.
+    /// - `damping`: if present, use the damped constant-velocity model with
+    ///   this velocity attenuation per second (0 to 1) instead of the
+    ///   constant-velocity model.
+    /// - `velocityTimeoutMilliSeconds`: how old a velocity report may be and
+    ///   still be used for prediction. Default 100.
+    OSVR_ReturnCode operator()(OSVR_PluginRegContext ctx, const char *params) {
+        Json::Value root;
+        {
+            Json::Reader reader;
+            if (!reader.parse(params, root)) {
+                std::cerr << "Couldn't parse JSON for predictive tracker!"
+                          << std::endl;
+                return OSVR_RETURN_FAILURE;
+            }
+        }
+
+        // required
+        if (!root.isMember("input")) {
+            std::cerr << "Error: got configuration for predictive tracker, "
+                         "but no input specified."
+                      << std::endl;
+            return OSVR_RETURN_FAILURE;
+        }
+        auto input = root["input"].asString();
+
+        // optional
+        auto deviceName = root.get("name", DRIVER_NAME).asString();
+
+        PredictionParams predictionParams;
+        auto const &predict = root.get("predictMilliSeconds", 16);
+        if (predict.isArray()) {
+            for (auto const &horizon : predict) {
+                predictionParams.horizons.push_back(horizon.asDouble() * 1e-3);
+            }
+        } else {
+            predictionParams.horizons.push_back(predict.asDouble() * 1e-3);
+        }
+        if (predictionParams.horizons.empty()) {
+            std::cerr << "Error: predictive tracker needs at least one "
+                         "prediction interval."
+                      << std::endl;
+            return OSVR_RETURN_FAILURE;
+        }
+        predictionParams.damped = root.isMember("damping");
+        predictionParams.damping = root.get("damping", 0.1).asDouble();
+        predictionParams.velocityTimeout =
+            root.get("velocityTimeoutMilliSeconds", 100).asDouble() * 1e-3;
+
+        osvr::pluginkit::PluginContext context(ctx);
+
+        /// @todo make the token own this instead once there is API for that.
+        context.registerObjectForDeletion(new PredictiveTrackingDevice(
+            ctx, deviceName, input, predictionParams));
+        return OSVR_RETURN_SUCCESS;
+    }
+};
+} // namespace
+
+OSVR_PLUGIN(org_osvr_filter_predictivetracking) {
+    osvr::pluginkit::PluginContext context(ctx);
+
+    /// Register a detection callback function object.
+    context.registerDriverInstantiationCallback(DRIVER_NAME,
+                                                AnalysisPluginInstantiation());
+
+    return OSVR_RETURN_SUCCESS;
+}
@@ -0,0 +1,163 @@
+/** @file
+    @brief Plugin replaying a report recording made by a server (see the
+    "recordReports" server option) through virtual devices, for load testing
+    the server-to-client path without hardware.
+
+    Configure with a driver entry such as:
+
+        {
+            "plugin": "org_osvr_ReportReplay",
+            "driver": "ReportReplay",
+            "params": {
+                "file": "reports.osvrrec",
+                "speed": 1,
+                "loop": false
+            }
+        }
+
+    "speed" is a multiple of the original rate, or "max" to replay as fast as
+    possible.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/PluginKit/PluginKit.h>
+#include <osvr/PluginHost/PluginSpecificRegistrationContext.h>
+#include <osvr/Connection/Connection.h>
+#include <osvr/Connection/DeviceToken.h>
+#include <osvr/Connection/ReportReplayer.h>
+
+// Library/third-party includes
+#include <json/value.h>
+#include <json/reader.h>
+
+// Standard includes
+#include <iostream>
+#include <string>
+
+// Anonymous namespace to avoid symbol collision
+namespace {
+using osvr::connection::ReportReplayer;
+
+static const char SPEED_MAX[] = "max";
+
+class ReportReplay {
+  public:
+    ReportReplay(OSVR_PluginRegContext ctx, std::string const &name,
+                 std::string const &file, double speed, bool loop) {
+        auto &pluginCtx =
+            osvr::pluginhost::PluginSpecificRegistrationContext::get(ctx);
+        auto conn =
+            osvr::connection::Connection::retrieveConnection(
+                pluginCtx.getParent());
+        m_replayer = ReportReplayer::create(conn, file, speed, loop);
+
+        /// A virtual device of our own, so replay happens in the server
+        /// mainloop, whatever thread sync device updates run on.
+        m_dev = osvr::connection::DeviceToken::createVirtualDevice(
+            pluginCtx.getName() + "/" + name, conn);
+        m_dev->setPreConnectionInteract([&] { m_update(); });
+    }
+
+  private:
+    void m_update() {
+        auto passes = m_replayer->getStats().passes;
+        auto running = m_replayer->update();
+        auto const &stats = m_replayer->getStats();
+        if (stats.passes != passes) {
+            std::cout << "[ReportReplay] Pass " << stats.passes << ": "
+                      << stats.messages << " messages, " << stats.bytes
+                      << " bytes replayed so far, at most "
+                      << stats.maxLagMicroseconds
+                      << "us behind schedule" << std::endl;
+        }
+        if (!running && !m_reportedFinished) {
+            m_reportedFinished = true;
+            std::cout << "[ReportReplay] Finished" << std::endl;
+        }
+    }
+
+    osvr::connection::ReportReplayerPtr m_replayer;
+    osvr::connection::DeviceTokenPtr m_dev;
+    bool m_reportedFinished = false;
+};
+
+class ReportReplayConstructor {
+  public:
+    /// @brief This is the required signature for a device instantiation
+    /// callback.
+    OSVR_ReturnCode operator()(OSVR_PluginRegContext ctx, const char *params) {
+        // Read the JSON data from parameters.
+        Json::Value root;
+        if (params) {
+            Json::Reader r;
+            if (!r.parse(params, root)) {
+                std::cerr << "[ReportReplay] Could not parse parameters!"
+                          << std::endl;
+                return OSVR_RETURN_FAILURE;
+            }
+        }
+
+        if (!root.isMember("file")) {
+            std::cerr << "[ReportReplay] Error: got configuration, but no "
+                         "file specified."
+                      << std::endl;
+            return OSVR_RETURN_FAILURE;
+        }
+        std::string file = root["file"].asString();
+        std::string name = root.get("name", "ReportReplay").asString();
+        bool loop = root.get("loop", false).asBool();
+
+        double speed = 1.;
+        Json::Value const &jsonSpeed = root["speed"];
+        if (jsonSpeed.isString() && jsonSpeed.asString() == SPEED_MAX) {
+            speed = ReportReplayer::AS_FAST_AS_POSSIBLE;
+        } else if (jsonSpeed.isNumeric()) {
+            speed = jsonSpeed.asDouble();
+            if (speed <= 0) {
+                std::cerr << "[ReportReplay] Error: speed must be positive, "
+                             "or \"max\"."
+                          << std::endl;
+                return OSVR_RETURN_FAILURE;
+            }
+        }
+
+        try {
+            osvr::pluginkit::registerObjectForDeletion(
+                ctx, new ReportReplay(ctx, name, file, speed, loop));
+        } catch (std::exception &e) {
+            std::cerr << "[ReportReplay] Error: " << e.what() << std::endl;
+            return OSVR_RETURN_FAILURE;
+        }
+        std::cout << "[ReportReplay] Replaying " << file << std::endl;
+        return OSVR_RETURN_SUCCESS;
+    }
+};
+} // namespace
+
+OSVR_PLUGIN(org_osvr_ReportReplay) {
+    /// Tell the core we're available to create a device object.
+    osvr::pluginkit::registerDriverInstantiationCallback(
+        ctx, "ReportReplay", new ReportReplayConstructor);
+
+    return OSVR_RETURN_SUCCESS;
+}
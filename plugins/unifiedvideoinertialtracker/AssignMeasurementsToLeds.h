@@ -80,8 +80,8 @@ namespace vbtracker {
                                  LedMeasurementVec const &measurements,
                                  const std::size_t numBeacons,
                                  float blobMoveThresh, bool verbose = false)
-            : leds_(leds), measurements_(measurements), ledsEnd_(end(leds_)),
-              numBeacons_(numBeacons), blobMoveThreshFactor_(blobMoveThresh),
+            : leds_(leds), measurements_(measurements), numBeacons_(numBeacons),
+              blobMoveThreshFactor_(blobMoveThresh),
               maxMatches_(std::min(leds_.size(), measurements_.size())),
               verbose_(verbose) {}
 
@@ -99,11 +99,11 @@ namespace vbtracker {
             populated_ = true;
             {
                 /// Clean up LEDs and populate their ref vector.
-                auto led = begin(leds_);
-                while (led != end(leds_)) {
-                    led->resetUsed();
-                    ledRefs_.push_back(led);
-                    ++led;
+                auto nLed = leds_.size();
+                for (size_type ledIdx = 0; ledIdx < nLed; ++ledIdx) {
+                    auto handle = leds_.getHandle(ledIdx);
+                    leds_[handle].resetUsed();
+                    ledRefs_.push_back(handle);
                 }
             }
 
@@ -248,7 +248,7 @@ namespace vbtracker {
                                            "without a valid top element on the "
                                            "heap.");
 
-            auto &topLed = *getTopLed();
+            auto &topLed = getTopLed();
             auto &topMeas = *getTopMeasurement();
 
             /// Mark that we've used this LED and measurement.
@@ -324,27 +324,29 @@ namespace vbtracker {
         size_type numUnclaimedLedObjects() const {
             return std::count_if(
                 begin(ledRefs_), end(ledRefs_),
-                [&](LedIter const &it) { return it != ledsEnd_; });
+                [&](LedHandle const &handle) { return handle.valid(); });
         }
 
         void eraseUnclaimedLedObjects(bool verbose = false) {
-            for (auto &ledIter : ledRefs_) {
-                if (ledIter == ledsEnd_) {
+            for (auto &handle : ledRefs_) {
+                if (!handle.valid()) {
                     /// already used
                     continue;
                 }
                 if (verbose) {
-                    if (ledIter->identified()) {
+                    auto &led = leds_[handle];
+                    if (led.identified()) {
                         std::cout << "Erasing identified LED "
-                                  << ledIter->getOneBasedID().value()
+                                  << led.getOneBasedID().value()
                                   << " because of a lack of updated data.\n";
                     } else {
                         std::cout << "Erasing unidentified LED at "
-                                  << ledIter->getLocation()
+                                  << led.getLocation()
                                   << " because of a lack of updated data.\n";
                     }
                 }
-                leds_.erase(ledIter);
+                /// Handles stay valid as other LEDs are moved around by this.
+                leds_.erase(handle);
             }
         }
 
@@ -368,8 +370,7 @@ namespace vbtracker {
         size_type numCompletedMatches() const { return numMatches_; }
 
       private:
-        using LedIter = LedGroup::iterator;
-        using LedPtr = Led *;
+        using LedHandle = LedGroup::handle_type;
         using MeasPtr = LedMeasurement const *;
         void checkAndThrowNotPopulated(const char *functionName) const {
             if (!populated_) {
@@ -402,16 +403,16 @@ namespace vbtracker {
         void possiblyPushLedMeasurement(std::size_t ledIdx, std::size_t measIdx,
                                         float distThreshSquared) {
             auto meas = measRefs_[measIdx];
-            auto led = ledRefs_[ledIdx];
-            auto squaredDist = sqDist(led->getLocation(), meas->loc);
+            auto &led = leds_[ledRefs_[ledIdx]];
+            auto squaredDist = sqDist(led.getLocation(), meas->loc);
             if (squaredDist < distThreshSquared) {
                 // If we're within the threshold, let's push this candidate
                 // on the vector that will be turned into a heap.
                 distanceHeap_.emplace_back(ledIdx, measIdx, squaredDist);
             }
         }
-        LedIter getTopLed() const {
-            return ledRefs_[ledIndex(distanceHeap_.front())];
+        Led &getTopLed() const {
+            return leds_[ledRefs_[ledIndex(distanceHeap_.front())]];
         }
 
         MeasPtr getTopMeasurement() const {
@@ -419,11 +420,11 @@ namespace vbtracker {
         }
 
         bool isLedValid(size_type idx) const {
-            return (ledRefs_[idx] != ledsEnd_);
+            return ledRefs_[idx].valid();
         }
 
         bool isLedValid(LedMeasDistance const &elt) const {
-            return (ledRefs_[ledIndex(elt)] != ledsEnd_);
+            return ledRefs_[ledIndex(elt)].valid();
         }
 
         bool isMeasValid(size_type idx) const {
@@ -441,7 +442,7 @@ namespace vbtracker {
 
         void markTopConsumed() {
             LedMeasDistance elt = distanceHeap_.front();
-            ledRefs_[ledIndex(elt)] = ledsEnd_;
+            ledRefs_[ledIndex(elt)] = LedHandle();
             measRefs_[measIndex(elt)] = nullptr;
             /// Postcondition assertion.
             BOOST_ASSERT(!isLedValid(elt));
@@ -488,13 +489,13 @@ namespace vbtracker {
         }
 		
         bool populated_ = false;
-        std::vector<LedIter> ledRefs_;
+        /// Handles to the LEDs, reset once claimed.
+        std::vector<LedHandle> ledRefs_;
         std::vector<MeasPtr> measRefs_;
         HeapType distanceHeap_;
         size_type numMatches_ = 0;
         LedGroup &leds_;
         LedMeasurementVec const &measurements_;
-        const LedIter ledsEnd_;
         const std::size_t numBeacons_;
         const float blobMoveThreshFactor_;
         const size_type maxMatches_;
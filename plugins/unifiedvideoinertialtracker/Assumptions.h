@@ -35,10 +35,10 @@
 // Standard includes
 // - none
 
-/// @todo Remove when we no longer assume a single camera or monotonic camera
-/// timestamps, and the build will break in a few places
-/// where known "gotchas" exist
-#define OSVR_UVBI_ASSUME_SINGLE_CAMERA 1
+/// @todo Remove when we no longer assume that video frames (from all cameras,
+/// merged) are processed in monotonic timestamp order, and the build will break
+/// in a few places where known "gotchas" exist
+#define OSVR_UVBI_ASSUME_VIDEO_IN_TIMESTAMP_ORDER 1
 /// @todo Remove when we no longer assume that IMU reports arrive before video
 /// reports with same timestamps.
 #define OSVR_UVBI_ASSUME_CAMERA_ALWAYS_SLOWER 1
@@ -43,6 +43,8 @@ namespace vbtracker {
         struct BodyIdTag;
         /// Type tag for type-safe target ID (per body)
         struct TargetIdTag;
+        /// Type tag for type-safe camera ID
+        struct CameraIdTag;
     } // namespace detail
 } // namespace vbtracker
 namespace util {
@@ -55,6 +57,10 @@ namespace util {
         template <> struct WrappedType<vbtracker::detail::TargetIdTag> {
             using type = std::uint8_t;
         };
+        /// Tag-based specialization of underlying value type for camera ID
+        template <> struct WrappedType<vbtracker::detail::CameraIdTag> {
+            using type = std::uint8_t;
+        };
     } // namespace typesafeid_traits
 } // namespace util
 
@@ -65,6 +71,9 @@ namespace vbtracker {
     using TargetId = util::TypeSafeId<detail::TargetIdTag>;
     /// Type-safe zero-based target ID qualified with its body ID.
     using BodyTargetId = std::pair<BodyId, TargetId>;
+    /// Type-safe zero-based camera ID. Camera 0 is the primary camera, whose
+    /// coordinate system is "tracker space."
+    using CameraId = util::TypeSafeId<detail::CameraIdTag>;
 
     /// Stream output operator for the body-target ID.
     template <typename Stream>
@@ -34,6 +34,7 @@
 // Standard includes
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace osvr {
 namespace vbtracker {
@@ -65,6 +66,17 @@ namespace vbtracker {
         std::int32_t angularVelocityMicrosecondsOffset = 0;
     };
 
+    /// Identifies a camera, in addition to the primary (HDK IR) camera, to
+    /// track with.
+    struct AdditionalCameraParams {
+        /// Serial number of an HDK IR camera to open (not available on
+        /// Windows).
+        std::string serialNumber;
+
+        /// If non-negative, open this OpenCV camera index instead.
+        int opencvIndex = -1;
+    };
+
     struct TuningParams {
         TuningParams();
         double noveltyPenaltyBase;
@@ -140,6 +152,14 @@ namespace vbtracker {
         /// decide (that is, not set an explicit preference)
         int numThreads = 1;
 
+        /// How many video frames may be in flight at once: grabbed and
+        /// processed by the image processing thread while the tracker thread
+        /// is still estimating poses from earlier frames. 1 keeps capture and
+        /// pose estimation in lock-step; 2 or more lets the next frame be
+        /// grabbed and blob-extracted during pose estimation, so slower CPUs
+        /// can keep up with the camera's full frame rate.
+        int imagePipelineDepth = 1;
+
         /// This is the autocorrelation kernel of the process noise. The first
         /// three elements correspond to position, the second three to
         /// incremental rotation.
@@ -243,6 +263,13 @@ namespace vbtracker {
         /// Defaulting to off because it adds some jitter for some reason.
         bool blobsKeepIdentity = false;
 
+        /// If this option is set to true, a blinking sequence that doesn't
+        /// match any LED's pattern but is off by one frame from exactly one of
+        /// them is identified as that LED. This can identify LEDs sooner when
+        /// a frame was dropped or a blob was briefly misread, at the risk of
+        /// more misidentifications.
+        bool tolerateSingleBitPatternErrors = false;
+
         /// Extra verbose developer debugging messages
         bool extraVerbose = false;
 
@@ -253,6 +280,11 @@ namespace vbtracker {
         /// IMU input-related parameters.
         IMUInputParams imu;
 
+        /// Additional cameras: their poses relative to the primary camera are
+        /// calibrated once room calibration completes, by holding a tracked
+        /// body still where both cameras can see it.
+        std::vector<AdditionalCameraParams> additionalCameras;
+
         /// x, y, z, with y up, all in meters.
         double cameraPosition[3];
 
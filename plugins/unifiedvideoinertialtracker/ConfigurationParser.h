@@ -157,7 +157,16 @@ namespace vbtracker {
                              "blobMoveThreshold");
         getOptionalParameter(config.blobsKeepIdentity, root,
                              "blobsKeepIdentity");
+        getOptionalParameter(config.tolerateSingleBitPatternErrors, root,
+                             "tolerateSingleBitPatternErrors");
         getOptionalParameter(config.numThreads, root, "numThreads");
+        getOptionalParameter(config.imagePipelineDepth, root,
+                             "imagePipelineDepth");
+        if (config.imagePipelineDepth < 1) {
+            std::cout << MESSAGE_PREFIX << PARAMNAME("imagePipelineDepth")
+                      << " must be at least 1 - using 1 instead." << std::endl;
+            config.imagePipelineDepth = 1;
+        }
         getOptionalParameter(config.cameraMicrosecondsOffset, root,
                              "cameraMicrosecondsOffset");
         getOptionalParameter(config.streamBeaconDebugInfo, root,
@@ -243,6 +252,22 @@ namespace vbtracker {
                                  imu, "angularVelocityMicrosecondsOffset");
         }
 
+        /// Additional cameras
+        for (auto const &camera : root["additionalCameras"]) {
+            AdditionalCameraParams camParams;
+            getOptionalParameter(camParams.serialNumber, camera,
+                                 "serialNumber");
+            getOptionalParameter(camParams.opencvIndex, camera, "opencvIndex");
+            if (camParams.serialNumber.empty() && camParams.opencvIndex < 0) {
+                std::cout << MESSAGE_PREFIX << PARAMNAME("additionalCameras")
+                          << " entries need either a serialNumber or an "
+                             "opencvIndex - skipping one."
+                          << std::endl;
+                continue;
+            }
+            config.additionalCameras.push_back(camParams);
+        }
+
         return config;
     }
 #undef PARAMNAME
@@ -32,18 +32,21 @@
 
 // Standard includes
 #include <stdexcept>
+#include <vector>
 
 namespace osvr {
 namespace vbtracker {
     static const auto VALIDCHARS = "*.";
+    const size_t OsvrHdkLedIdentifier::MAX_PATTERN_LENGTH;
     OsvrHdkLedIdentifier::~OsvrHdkLedIdentifier() {}
-    // Convert from string encoding representations into lists
-    // of boolean values for use in comparison.
+    // Convert from string encoding representations into a table of the
+    // packed bits of every rotation, for use in identification.
     OsvrHdkLedIdentifier::OsvrHdkLedIdentifier(
-        const PatternStringList &PATTERNS) {
+        const PatternStringList &PATTERNS, bool tolerateSingleBitErrors) {
         // Ensure that we have at least one entry in our list and
         // find the length of the first valid entry.
         d_length = 0;
+        d_mask = 0;
         if (PATTERNS.empty()) {
             return;
         }
@@ -61,14 +64,24 @@ namespace vbtracker {
             // If we still have 0 as the pattern length, return.
             return;
         }
-
-        // Decode each string into a new list of boolean values, making
-        // sure each have the correct length.
-
-        for (auto &pat : PATTERNS) {
+        if (d_length > MAX_PATTERN_LENGTH) {
+            throw std::runtime_error("Got a pattern that is too long!");
+        }
+        d_mask = (d_length == MAX_PATTERN_LENGTH)
+                     ? ~PackedPattern(0)
+                     : ((PackedPattern(1) << d_length) - 1);
+
+        // Pack each string into bits, oldest first (so in the most
+        // significant place), making sure each has the correct length, and
+        // enter every rotation of it in the table, since we don't know when
+        // the code started. For the HDK, the codes are rotationally
+        // invariant.
+        std::vector<PackedPattern> packedPatterns;
+        for (size_t i = 0; i < PATTERNS.size(); i++) {
+            auto &pat = PATTERNS[i];
             if (pat.empty() || pat.find_first_not_of(VALIDCHARS) != pat.npos) {
                 // This is an intentionally disabled beacon/pattern.
-                d_patterns.emplace_back();
+                packedPatterns.push_back(0);
                 continue;
             }
 
@@ -77,17 +90,56 @@ namespace vbtracker {
                 throw std::runtime_error("Got a pattern of incorrect length!");
             }
 
-            // Make a wrapped pattern, which is the original pattern plus
-            // a second copy of the pattern that has all but the last
-            // character in it.  This will enable use to use the string
-            // find() routine to see if any shift of the pattern is a
-            // match.
-            auto wrapped = pat + pat;
-            wrapped.pop_back();
-            d_patterns.push_back(std::move(wrapped));
+            PackedPattern bits = 0;
+            for (auto c : pat) {
+                bits = (bits << 1) | (c == '*' ? 1 : 0);
+            }
+            packedPatterns.push_back(bits);
+            for (size_t shift = 0; shift < d_length; ++shift) {
+                // If patterns share a rotation, the first one wins, as when
+                // searching them in order.
+                d_rotations.emplace(bits, ZeroBasedBeaconId(i));
+                bits = rotate(bits);
+            }
+        }
+
+        if (!tolerateSingleBitErrors) {
+            return;
+        }
+        const auto ambiguous = ZeroBasedBeaconId(
+            Led::SENTINEL_NO_PATTERN_RECOGNIZED_DESPITE_SUFFICIENT_DATA);
+        for (size_t i = 0; i < PATTERNS.size(); i++) {
+            auto bits = packedPatterns[i];
+            auto exact = d_rotations.find(bits);
+            if (exact == end(d_rotations) ||
+                exact->second != ZeroBasedBeaconId(i)) {
+                /// Disabled, or shadowed by an earlier pattern.
+                continue;
+            }
+            for (size_t shift = 0; shift < d_length; ++shift) {
+                for (size_t flip = 0; flip < d_length; ++flip) {
+                    auto flipped = bits ^ (PackedPattern(1) << flip);
+                    if (d_rotations.find(flipped) != end(d_rotations)) {
+                        /// Exact matches take precedence.
+                        continue;
+                    }
+                    auto result = d_nearRotations.emplace(
+                        flipped, ZeroBasedBeaconId(i));
+                    if (!result.second &&
+                        result.first->second != ZeroBasedBeaconId(i)) {
+                        result.first->second = ambiguous;
+                    }
+                }
+                bits = rotate(bits);
+            }
         }
     }
 
+    OsvrHdkLedIdentifier::PackedPattern
+    OsvrHdkLedIdentifier::rotate(PackedPattern bits) const {
+        return ((bits << 1) | (bits >> (d_length - 1))) & d_mask;
+    }
+
     ZeroBasedBeaconId
     OsvrHdkLedIdentifier::getId(ZeroBasedBeaconId currentId,
                                 BrightnessList &brightnesses,
@@ -124,25 +176,22 @@ namespace vbtracker {
             return currentId;
         }
 
-        // Get a list of boolean values for 0's and 1's using
-        // the threshold computed above.
-        auto bits = getBitsUsingThreshold(brightnesses, threshold);
-
-        // Search through the available patterns to see if the passed-in
-        // pattern matches any of them.  If so, return that pattern.  We
-        // need to check all potential rotations of the pattern, since we
-        // don't know when the code started.  For the HDK, the codes are
-        // rotationally invariant.  We do this by making wrapped strings
-        // and seeing if the pattern shows up anywhe in them, relying on
-        // the std::string find method to do efficiently.
-        for (size_t i = 0; i < d_patterns.size(); i++) {
-            if (d_patterns[i].empty()) {
-                /// Skip turned-off patterns.
-                continue;
-            }
-            if (d_patterns[i].find(bits) != std::string::npos) {
-                return ZeroBasedBeaconId(i);
-            }
+        // Pack the 0's and 1's, using the threshold computed above, the same
+        // way the patterns were packed.
+        PackedPattern bits = 0;
+        for (auto val : brightnesses) {
+            bits = (bits << 1) | (val >= threshold ? 1 : 0);
+        }
+
+        // Look up the sequence: if it's any rotation of a pattern, that's our
+        // beacon.
+        auto exact = d_rotations.find(bits);
+        if (exact != end(d_rotations)) {
+            return exact->second;
+        }
+        auto inexact = d_nearRotations.find(bits);
+        if (inexact != end(d_nearRotations)) {
+            return inexact->second;
         }
 
         // No pattern recognized and we should have recognized one, so return
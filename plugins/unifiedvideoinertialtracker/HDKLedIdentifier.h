@@ -32,7 +32,8 @@
 // - none
 
 // Standard includes
-// - none
+#include <cstdint>
+#include <unordered_map>
 
 namespace osvr {
 namespace vbtracker {
@@ -42,8 +43,16 @@ namespace vbtracker {
         /// @brief Give it a list of patterns to use.  There is a string for
         /// each LED, and each is encoded with '*' meaning that the LED is
         /// bright and '.' that it is dim at this point in time. All patterns
-        /// must have the same length.
-        OsvrHdkLedIdentifier(const PatternStringList &PATTERNS);
+        /// must have the same length, of at most MAX_PATTERN_LENGTH.
+        ///
+        /// Every rotation of every pattern is compiled into a table up front,
+        /// so identifying an LED is a table lookup rather than a search.
+        ///
+        /// @param tolerateSingleBitErrors If true, a sequence that doesn't
+        /// match any pattern, but differs in just one frame from (a rotation
+        /// of) exactly one pattern, is identified as that pattern.
+        OsvrHdkLedIdentifier(const PatternStringList &PATTERNS,
+                             bool tolerateSingleBitErrors = false);
 
         ~OsvrHdkLedIdentifier() override;
 
@@ -55,9 +64,26 @@ namespace vbtracker {
                                 BrightnessList &brightnesses, bool &lastBright,
                                 bool blobsKeepId) const override;
 
+        /// @brief Longest pattern supported: patterns are packed into an
+        /// integer, one bit per frame.
+        static const size_t MAX_PATTERN_LENGTH = 64;
+
       private:
-        size_t d_length;        //< Length of all patterns
-        PatternList d_patterns; //< Patterns by index
+        using PackedPattern = std::uint64_t;
+        using PatternTable =
+            std::unordered_map<PackedPattern, ZeroBasedBeaconId>;
+
+        /// @brief Rotates a packed pattern by one frame.
+        PackedPattern rotate(PackedPattern bits) const;
+
+        size_t d_length;      //< Length of all patterns
+        PackedPattern d_mask; //< Low d_length bits set
+        /// Beacon for each rotation of each enabled pattern.
+        PatternTable d_rotations;
+        /// Beacon for each sequence one bit away from a rotation of exactly one
+        /// pattern, or the "no pattern recognized" sentinel if it is one bit
+        /// away from several. Empty unless tolerating single-bit errors.
+        PatternTable d_nearRotations;
     };
 
 } // End namespace vbtracker
@@ -26,6 +26,7 @@
 #define INCLUDED_ImageProcessing_h_GUID_3E426FCE_BED1_4DAC_0669_70D55A14A507
 
 // Internal Includes
+#include "BodyIdTypes.h"
 #include "LedMeasurement.h"
 #include "CameraParameters.h"
 
@@ -44,6 +45,8 @@ namespace vbtracker {
         cv::Mat frame;
         cv::Mat frameGray;
         CameraParameters camParams;
+        /// The camera that captured this frame.
+        CameraId camera = CameraId(0);
     };
     using ImageOutputDataPtr = std::unique_ptr<ImageProcessingOutput>;
 } // namespace vbtracker
@@ -39,12 +39,17 @@ namespace osvr {
 namespace vbtracker {
     ImageProcessingThread::ImageProcessingThread(
         TrackingSystem &trackingSystem, ImageSource &cam,
-        TrackerThread &trackerThread, CameraParameters const &camParams,
-        std::int32_t cameraUsecOffset)
+        TrackerThread &trackerThread, CameraId camera,
+        CameraParameters const &camParams, std::int32_t cameraUsecOffset,
+        bool freshBuffersPerFrame)
         : trackingSystem_(trackingSystem), cam_(cam),
-          trackerThreadObj_(trackerThread), camParams_(camParams),
-          cameraUsecOffset_(cameraUsecOffset),
-          logBlobs_(trackingSystem_.getParams().logRawBlobs) {
+          trackerThreadObj_(trackerThread), camera_(camera),
+          camParams_(camParams), cameraUsecOffset_(cameraUsecOffset),
+          freshBuffersPerFrame_(freshBuffersPerFrame),
+          wantColor_(trackingSystem_.getParams().debug),
+          /// Only the primary camera logs its blobs.
+          logBlobs_(trackingSystem_.getParams().logRawBlobs &&
+                    camera == CameraId(0)) {
         if (logBlobs_) {
             blobFile_.open("blobs.csv");
             if (blobFile_) {
@@ -59,7 +64,7 @@ namespace vbtracker {
     void ImageProcessingThread::signalDoFrame() {
         {
             std::lock_guard<std::mutex> lock{stateMutex_};
-            next_ = NextOp::DoFrame;
+            ++framesPermitted_;
         }
         stateCondVar_.notify_all();
     }
@@ -67,7 +72,7 @@ namespace vbtracker {
     void ImageProcessingThread::signalExit() {
         {
             std::lock_guard<std::mutex> lock{stateMutex_};
-            next_ = NextOp::Exit;
+            exitRequested_ = true;
         }
         stateCondVar_.notify_all();
     }
@@ -77,21 +82,21 @@ namespace vbtracker {
             {
                 std::unique_lock<std::mutex> lock(stateMutex_);
 
-                if (NextOp::Waiting == next_) {
-                    /// Wait until we're notified and next_ isn't just "waiting"
-                    stateCondVar_.wait(
-                        lock, [&] { return next_ != NextOp::Waiting; });
-                }
+                /// Wait until we're notified and either permitted a frame or
+                /// told to exit.
+                stateCondVar_.wait(lock, [&] {
+                    return exitRequested_ || framesPermitted_ > 0;
+                });
 
                 /// OK, we're not supposed to wait anymore. What do we do?
-                if (NextOp::Exit == next_) {
+                if (exitRequested_) {
                     // we are all done.
                     exiting_ = true;
                     return;
                 }
                 /// Otherwise, we should do a frame.
-                /// Re-set the next op while we still hold the mutex.
-                next_ = NextOp::Waiting;
+                /// Use up the permission while we still hold the mutex.
+                --framesPermitted_;
             }
             doFrame();
         }
@@ -102,16 +107,48 @@ namespace vbtracker {
         /// On scope exit, no matter how, signal to the tracker thread that
         /// we're done.
         auto signalCompletion = util::finally([&] {
-            trackerThreadObj_.signalImageProcessingComplete(std::move(data),
-                                                            frame_, gray_);
+            trackerThreadObj_.signalImageProcessingComplete(camera_,
+                                                            std::move(data));
         });
 
-        // Pull the image into an OpenCV matrix named m_frame.
+        // Check camera status.
+        if (!cam_.ok()) {
+            // Hmm, camera seems bad. Might regain it? Skip for now...
+            warn() << "Camera is reporting it is not OK." << std::endl;
+            return;
+        }
+        // Trigger a grab.
+        if (!cam_.grab()) {
+            // Again failing without quitting, in hopes we get better luck
+            // next time...
+            warn() << "Camera grab failed." << std::endl;
+            return;
+        }
+
+        if (freshBuffersPerFrame_) {
+            /// Drop our references and retrieve into pooled buffers, so the
+            /// retrieve doesn't write into buffers that a frame still in the
+            /// pipeline is sharing.
+            frame_ = cv::Mat();
+            gray_ = cv::Mat();
+        }
+        cv::Mat &gray = freshBuffersPerFrame_ ? grayBuffers_.acquire() : gray_;
+
+        // Pull the image into OpenCV matrices: color only if we need it.
         util::time::TimeValue frameTime;
-        cam_.retrieve(frame_, gray_, frameTime);
-        if (!frame_.data || !gray_.data) {
-            // let the tracker thread warn if it wants to, we'll just get
-            // out.
+        if (wantColor_) {
+            cv::Mat &frame =
+                freshBuffersPerFrame_ ? colorBuffers_.acquire() : frame_;
+            cam_.retrieve(frame, gray, frameTime);
+            frame_ = frame;
+        } else {
+            cam_.retrieveGray(gray, frameTime);
+        }
+        gray_ = gray;
+        if ((wantColor_ && !frame_.data) || !gray_.data) {
+            warn() << "Camera retrieve appeared to fail: frames had null "
+                      "pointers!"
+                   << std::endl;
             return;
         }
 
@@ -128,8 +165,8 @@ namespace vbtracker {
 
         // Do the slow, but intentionally async-able part of the image
         // processing.
-        data = trackingSystem_.performInitialImageProcessing(frameTime, frame_,
-                                                             gray_, camParams_);
+        data = trackingSystem_.performInitialImageProcessing(
+            frameTime, frame_, gray_, camParams_, camera_);
         // Log blobs, if applicable
         if (logBlobs_) {
             if (!blobFile_) {
@@ -150,7 +187,11 @@ namespace vbtracker {
     }
 
     std::ostream &ImageProcessingThread::msg() const {
-        return std::cout << "[UnifiedTracker:ImgProcThread] ";
+        if (camera_ == CameraId(0)) {
+            return std::cout << "[UnifiedTracker:ImgProcThread] ";
+        }
+        return std::cout << "[UnifiedTracker:ImgProcThread "
+                         << int(camera_.value()) << "] ";
     }
 
     std::ostream &ImageProcessingThread::warn() const {
@@ -26,13 +26,16 @@
 #define INCLUDED_ImageProcessingThread_h_GUID_307E6652_D346_43B4_291A_5BAAEF4BA909
 
 // Internal Includes
+#include <BodyIdTypes.h>
 #include <CameraParameters.h>
+#include "ImageSources/FrameBufferPool.h"
 
 // Library/third-party includes
 #include <opencv2/core/core.hpp>
 
 // Standard includes
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
 #include <iosfwd>
@@ -49,13 +52,17 @@ namespace vbtracker {
         explicit ImageProcessingThread(TrackingSystem &trackingSystem,
                                        ImageSource &cam,
                                        TrackerThread &trackerThread,
+                                       CameraId camera,
                                        CameraParameters const &camParams,
-                                       std::int32_t cameraUsecOffset);
+                                       std::int32_t cameraUsecOffset,
+                                       bool freshBuffersPerFrame = false);
 
         /// non-assignable.
         ImageProcessingThread &operator=(ImageProcessingThread &) = delete;
 
-        /// called by TrackerThread
+        /// called by TrackerThread: permits the grab, retrieval, and initial
+        /// processing of one more frame. Each call grants one frame, so calling
+        /// it several times lets this thread work ahead of pose estimation.
         void signalDoFrame();
         /// called by TrackerThread
         void signalExit();
@@ -71,27 +78,39 @@ namespace vbtracker {
         std::ostream &msg() const;
         /// Helper providing a prefixed output stream for warning messages.
         std::ostream &warn() const;
-        /// Performs the retrieval and processing of a single frame.
+        /// Performs the grab, retrieval, and processing of a single frame.
         void doFrame();
 
         TrackingSystem &trackingSystem_;
         ImageSource &cam_;
         TrackerThread &trackerThreadObj_;
+        const CameraId camera_;
         const CameraParameters camParams_;
         const std::int32_t cameraUsecOffset_;
+        /// If true, we don't re-use our frame buffers from one frame to the
+        /// next, since earlier frames may still be in use by the tracker
+        /// thread.
+        const bool freshBuffersPerFrame_;
+        /// Only the debug display uses the color image, so we only retrieve
+        /// it when that's enabled.
+        const bool wantColor_;
 
         /// Output file we stream data on the blobs to.
         bool logBlobs_ = false;
         std::ofstream blobFile_;
 
-        enum class NextOp { Waiting, DoFrame, Exit };
-
         std::mutex stateMutex_;
         std::condition_variable stateCondVar_;
-        NextOp next_ = NextOp::Waiting;
+        /// Number of frames we've been permitted to grab and process but
+        /// haven't started yet.
+        std::size_t framesPermitted_ = 0;
+        bool exitRequested_ = false;
 
         cv::Mat frame_;
         cv::Mat gray_;
+        /// Buffers to retrieve into when freshBuffersPerFrame_ is set.
+        FrameBufferPool colorBuffers_;
+        FrameBufferPool grayBuffers_;
 
         bool exiting_ = false;
     };
@@ -51,6 +51,8 @@ namespace vbtracker {
         cv::Size resolution() const override;
         void retrieveColor(cv::Mat &color,
                            osvr::util::time::TimeValue &timestamp) override;
+        void retrieveGray(cv::Mat &gray,
+                          osvr::util::time::TimeValue &timestamp) override;
 
       private:
         ImageSourcePtr m_camera;
@@ -93,6 +95,14 @@ namespace vbtracker {
         retrieve(color, dummy, timestamp);
     }
 
+    void DK2WrappedImageSource::retrieveGray(
+        cv::Mat &gray, osvr::util::time::TimeValue &timestamp) {
+        // The unscrambled image is already gray, so skip the round trip
+        // through color.
+        m_camera->retrieveColor(m_scratch, timestamp);
+        gray = osvr::oculus_dk2::unscramble_image(m_scratch);
+    }
+
     cv::Size DK2WrappedImageSource::resolution() const {
         return m_camera->resolution();
     }
@@ -0,0 +1,84 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_FrameBufferPool_h_GUID_11E17EBF_3E12_4938_B54E_0927A12B9F70
+#define INCLUDED_FrameBufferPool_h_GUID_11E17EBF_3E12_4938_B54E_0927A12B9F70
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <opencv2/core/core.hpp>
+#include <opencv2/core/version.hpp>
+
+// Standard includes
+#include <vector>
+
+namespace osvr {
+namespace vbtracker {
+    /// Is this matrix the only reference to its pixel buffer?
+    inline bool isFrameBufferUnshared(cv::Mat const &mat) {
+#if CV_MAJOR_VERSION == 2 || CV_VERSION_EPOCH == 2
+        return mat.refcount != nullptr && *mat.refcount == 1;
+#else
+        return mat.u != nullptr && mat.u->refcount == 1;
+#endif
+    }
+
+    /// A set of recycled image buffers to retrieve frames into, for when
+    /// frames are handed down a pipeline and may still be in use when the
+    /// next one is retrieved.
+    ///
+    /// The pool keeps one reference to each buffer: once every other
+    /// reference is gone, the buffer is handed out again. Since the pipeline
+    /// holds a bounded number of frames, so does the pool, and in steady
+    /// state retrieving a frame allocates nothing.
+    class FrameBufferPool {
+      public:
+        /// Get a buffer that nothing else references, to pass as the output
+        /// of ImageSource::retrieve() and friends. It may be empty (or the
+        /// wrong size): those will (re)allocate it with cv::Mat::create().
+        ///
+        /// The reference is only valid until the next call.
+        cv::Mat &acquire() {
+            for (auto &buf : buffers_) {
+                if (buf.empty() || isFrameBufferUnshared(buf)) {
+                    return buf;
+                }
+            }
+            buffers_.emplace_back();
+            return buffers_.back();
+        }
+
+        /// Number of buffers the pool has needed so far.
+        std::size_t size() const { return buffers_.size(); }
+
+      private:
+        std::vector<cv::Mat> buffers_;
+    };
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_FrameBufferPool_h_GUID_11E17EBF_3E12_4938_B54E_0927A12B9F70
@@ -39,5 +39,10 @@ namespace vbtracker {
         retrieveColor(color, timestamp);
         cv::cvtColor(color, gray, CV_RGB2GRAY);
     }
+    void ImageSource::retrieveGray(cv::Mat &gray,
+                                   osvr::util::time::TimeValue &timestamp) {
+        retrieveColor(m_colorScratch, timestamp);
+        cv::cvtColor(m_colorScratch, gray, CV_RGB2GRAY);
+    }
 } // namespace vbtracker
 } // namespace osvr
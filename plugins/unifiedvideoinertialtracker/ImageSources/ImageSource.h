@@ -66,6 +66,16 @@ namespace vbtracker {
             retrieve(color, gray, ts);
         }
 
+        /// Call after grab() to get just the grayscale image data, which is
+        /// all the tracker itself uses.
+        ///
+        /// The default implementation retrieves color and converts it: sources
+        /// that can get at luminance directly should override this.
+        /// Implementations write into @p gray with cv::Mat::create(), so a
+        /// buffer of the right size that the caller doesn't share is reused.
+        virtual void retrieveGray(cv::Mat &gray,
+                                  osvr::util::time::TimeValue &timestamp);
+
         /// Get resolution of the images from this source.
         virtual cv::Size resolution() const = 0;
 
@@ -83,6 +93,10 @@ namespace vbtracker {
 
       protected:
         ImageSource() = default;
+
+      private:
+        /// Reused by the default retrieveGray()
+        cv::Mat m_colorScratch;
     };
 
     using ImageSourcePtr = std::unique_ptr<ImageSource>;
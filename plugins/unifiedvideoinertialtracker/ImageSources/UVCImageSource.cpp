@@ -33,6 +33,8 @@
 // Library/third-party includes
 #include <libuvc/libuvc.h>
 #include <opencv2/core/core_c.h>
+#include <opencv2/highgui/highgui.hpp> // for imdecode
+#include <opencv2/imgproc/imgproc.hpp>
 
 // Standard includes
 #include <condition_variable>
@@ -44,6 +46,7 @@
 #include <stdexcept>
 #include <string>
 #include <unistd.h>
+#include <vector>
 
 namespace osvr {
 namespace vbtracker {
@@ -73,7 +76,15 @@ namespace vbtracker {
         /// For those devices that naturally read a non-corrupt color image,
         /// overriding just this method will let the default implementation of
         /// retrieve() do the RGB to Gray for you.
-        virtual void retrieveColor(cv::Mat &color, osvr::util::time::TimeValue &timestamp) override;
+        virtual void
+        retrieveColor(cv::Mat &color,
+                      osvr::util::time::TimeValue &timestamp) override;
+
+        /// Extracts just the luminance from the frame (YUYV or MJPEG) rather
+        /// than decoding to RGB and converting back.
+        virtual void
+        retrieveGray(cv::Mat &gray,
+                     osvr::util::time::TimeValue &timestamp) override;
 
       protected:
         /// This callback function is called each time a new frame is received
@@ -88,9 +99,23 @@ namespace vbtracker {
             void operator()(T *ptr) const { func_addr(ptr); }
         };
 
-        using Frame_ptr =
-            std::unique_ptr<uvc_frame_t,
-                            StatelessDeleter<uvc_frame_t, &uvc_free_frame> >;
+        /// A copy of a raw (undecoded) frame from the camera, in a buffer
+        /// that is recycled once the frame has been retrieved.
+        struct RawFrame {
+            std::vector<unsigned char> data;
+            uvc_frame_format format = UVC_FRAME_FORMAT_UNKNOWN;
+            int width = 0;
+            int height = 0;
+            std::size_t step = 0;
+        };
+        using RawFramePtr = std::unique_ptr<RawFrame>;
+
+        /// Takes the oldest frame from the queue: throws if there is none.
+        RawFramePtr popFrame();
+        /// Returns a frame's buffer to the free list.
+        void recycleFrame(RawFramePtr &&frame);
+        /// Decodes a frame to RGB with libuvc. @return false on failure.
+        bool decodeToRGB(RawFrame &frame, cv::Mat &color);
 
         std::unique_ptr<uvc_context_t,
                         StatelessDeleter<uvc_context_t, &uvc_exit> >
@@ -107,9 +132,11 @@ namespace vbtracker {
         uvc_stream_ctrl_t streamControl_;
         osvr::util::time::TimeValue m_timestamp = {};
         cv::Size resolution_;          //< resolution of camera
-        std::queue<Frame_ptr> frames_; //< raw UVC frames
+        std::queue<RawFramePtr> frames_; //< raw UVC frames
+        std::vector<RawFramePtr> freeFrames_; //< recycled frame buffers
+        cv::Mat colorScratch_; //< for gray frames we must decode to RGB
 
-        std::mutex mutex_;                         //< to protect frames_
+        std::mutex mutex_; //< to protect frames_ and freeFrames_
         std::condition_variable frames_available_; //< To allow grab() to wait
                                                    //for frames to become
                                                    //available
@@ -207,25 +234,107 @@ namespace vbtracker {
 
     cv::Size UVCImageSource::resolution() const { return resolution_; }
 
-    void osvr::vbtracker::UVCImageSource::retrieveColor(cv::Mat& color, util::time::TimeValue& timestamp)
-{
+    UVCImageSource::RawFramePtr UVCImageSource::popFrame() {
         // Grab a frame from the queue, but don't keep the queue locked!
-        Frame_ptr current_frame;
-        {
-            std::unique_lock<std::mutex> lock(mutex_);
-            if (frames_.empty()) {
-                throw std::runtime_error("Error: There's no frames available.");
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (frames_.empty()) {
+            throw std::runtime_error("Error: There's no frames available.");
+        }
+        RawFramePtr ret = std::move(frames_.front());
+        frames_.pop();
+        return ret;
+    }
+
+    void UVCImageSource::recycleFrame(RawFramePtr &&frame) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        freeFrames_.push_back(std::move(frame));
+    }
+
+    bool UVCImageSource::decodeToRGB(RawFrame &frame, cv::Mat &color) {
+        // Non-owning libuvc views of the raw frame and our output buffer.
+        uvc_frame_t in = {};
+        in.data = frame.data.data();
+        in.data_bytes = frame.data.size();
+        in.width = frame.width;
+        in.height = frame.height;
+        in.frame_format = frame.format;
+        in.step = frame.step;
+
+        color.create(frame.height, frame.width, CV_8UC3);
+        uvc_frame_t out = {};
+        out.data = color.data;
+        out.data_bytes = color.total() * color.elemSize();
+
+        auto convert_ret = uvc_mjpeg2rgb(&in, &out);
+        if (UVC_SUCCESS != convert_ret) {
+            // Try any2rgb() instead
+            auto any_ret = uvc_any2rgb(&in, &out);
+            if (UVC_SUCCESS != any_ret) {
+                std::cerr << "Error: Unable to convert frame to rgb: "
+                          << uvc_strerror(convert_ret) << std::endl;
+                return false;
             }
-            current_frame.reset(frames_.front().release());
-            frames_.pop();
         }
+        return true;
+    }
 
-		timestamp = m_timestamp;
+    void UVCImageSource::retrieveColor(cv::Mat &color,
+                                       util::time::TimeValue &timestamp) {
+        auto current_frame = popFrame();
+        timestamp = m_timestamp;
+        if (!decodeToRGB(*current_frame, color)) {
+            color = cv::Mat();
+        }
+        recycleFrame(std::move(current_frame));
+    }
 
-        // Convert the image to at cv::Mat
-        color = cv::Mat(current_frame->height, current_frame->width, CV_8UC3,
-                        current_frame->data)
-                    .clone();    }
+    void UVCImageSource::retrieveGray(cv::Mat &gray,
+                                      util::time::TimeValue &timestamp) {
+        auto current_frame = popFrame();
+        timestamp = m_timestamp;
+        auto &frame = *current_frame;
+        bool done = false;
+        switch (frame.format) {
+        case UVC_FRAME_FORMAT_YUYV: {
+            // Luma is every other byte.
+            auto step = frame.step ? frame.step : frame.width * 2;
+            if (frame.data.size() < step * frame.height) {
+                break;
+            }
+            gray.create(frame.height, frame.width, CV_8UC1);
+            for (int y = 0; y < frame.height; ++y) {
+                auto src = frame.data.data() + step * y;
+                auto dest = gray.ptr<unsigned char>(y);
+                for (int x = 0; x < frame.width; ++x) {
+                    dest[x] = src[2 * x];
+                }
+            }
+            done = true;
+            break;
+        }
+        case UVC_FRAME_FORMAT_MJPEG: {
+            // Decoding straight to grayscale just decodes the Y channel.
+            cv::Mat encoded(1, static_cast<int>(frame.data.size()), CV_8UC1,
+                            frame.data.data());
+            cv::imdecode(encoded, cv::IMREAD_GRAYSCALE, &gray);
+            // Some MJPEG streams leave out the Huffman tables, which libuvc
+            // copes with but not every JPEG decoder does.
+            done = gray.data != nullptr && gray.rows == frame.height &&
+                   gray.cols == frame.width;
+            break;
+        }
+        default:
+            break;
+        }
+        if (!done) {
+            if (decodeToRGB(frame, colorScratch_)) {
+                cv::cvtColor(colorScratch_, gray, CV_RGB2GRAY);
+            } else {
+                gray = cv::Mat();
+            }
+        }
+        recycleFrame(std::move(current_frame));
+    }
 
     void UVCImageSource::callback(uvc_frame_t *frame, void *ptr) {
         auto me = static_cast<UVCImageSource *>(ptr);
@@ -236,36 +345,39 @@ namespace vbtracker {
         // Must be quick here, cannot delay the callback or it will fail to
         // respond to usb events
 
-        // We can either copy the frame, and convert to rgb later, or
-        // just convert and save one copy (and allocation) in the server
-        // thread. As the conversion can't be much more expensive than a
-        // copy, we perform it here.
-
-        Frame_ptr rgb_frame(
-            uvc_allocate_frame(frame->width * frame->height * 3));
-        if (!rgb_frame) {
-            throw std::runtime_error(
-                "Error: Unable to allocate the rgb frame.");
-        }
-
-	auto convert_ret = uvc_mjpeg2rgb(frame, rgb_frame.get());
-	if (UVC_SUCCESS != convert_ret) {
-            // Try any2rgb() instead
-            auto any_ret = uvc_any2rgb(frame, rgb_frame.get());
-            if (UVC_SUCCESS != any_ret) {
-	      throw std::runtime_error(
-				       "Error: Unable to convert frame to rgb: " +
-				       std::string(uvc_strerror(convert_ret)));
+        // So, we just copy the raw frame into a recycled buffer (no allocation
+        // once we've got enough of them), and leave decoding to retrieval,
+        // where only what's actually wanted is decoded.
+        RawFramePtr raw_frame;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!freeFrames_.empty()) {
+                raw_frame = std::move(freeFrames_.back());
+                freeFrames_.pop_back();
             }
         }
+        if (!raw_frame) {
+            raw_frame.reset(new RawFrame);
+        }
+        auto data = static_cast<unsigned char const *>(frame->data);
+        raw_frame->data.assign(data, data + frame->data_bytes);
+        raw_frame->format = frame->frame_format;
+        raw_frame->width = frame->width;
+        raw_frame->height = frame->height;
+        raw_frame->step = frame->step;
+
         std::lock_guard<std::mutex> lock(mutex_);
-        frames_.emplace(rgb_frame.release());
+        frames_.push(std::move(raw_frame));
         if (frames_.size() > 100) {
             std::cerr << "WARNING! Dropping frames from video tracker as they "
                          "are not being processed fast enough! This will "
                          "disrupt tracking."
                       << std::endl;
-            frames_ = std::queue<Frame_ptr>(); //< clear the queue
+            // clear the queue, keeping the buffers
+            while (!frames_.empty()) {
+                freeFrames_.push_back(std::move(frames_.front()));
+                frames_.pop();
+            }
         }
         frames_available_.notify_one();
     }
@@ -25,8 +25,10 @@
 // Internal Includes
 #include "PoseEstimator_RANSAC.h"
 #include "CameraParameters.h"
+#include "CrossProductMatrix.h"
 #include "LED.h"
 #include "PinholeCameraFlip.h"
+#include "ProjectPoint.h"
 #include "UsefulQuaternions.h"
 #include "cvToEigen.h"
 
@@ -34,26 +36,220 @@
 #include <opencv2/calib3d/calib3d.hpp>
 #include <opencv2/core/affine.hpp>
 #include <opencv2/core/core.hpp>
+#include <osvr/Kalman/ExternalQuaternion.h>
+#include <osvr/Kalman/FlexibleKalmanFilter.h>
 
 // Standard includes
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <random>
 
-/// This was enabled/primarily useful to reduce jitter when RANSAC was the only
-/// tracking method, for culling a little tighter than the RANSAC PNP itself
-/// did.
-#undef OSVR_UVBI_TEST_RANSAC_REPROJECTION
+static const double MAX_REPROJECTION_ERROR = 4.;
 
-static const float MAX_REPROJECTION_ERROR = 4.f;
+/// How far (in pixels) a beacon may reproject from its measurement using the
+/// predicted pose and still be used to refine that pose.
+static const double MAX_PREDICTED_REPROJECTION_ERROR = 20.;
+
+/// Don't bother predicting a state forward further than this, in seconds: we
+/// likely lost tracking long ago.
+static const double MAX_PREDICTION_INTERVAL = 0.25;
 
 namespace osvr {
 namespace vbtracker {
+    namespace {
+        /// A pose of the target: takes points in model space to camera space.
+        struct PnPPose {
+            Eigen::Matrix3d rot = Eigen::Matrix3d::Identity();
+            Eigen::Vector3d xlate = Eigen::Vector3d::Zero();
+        };
+
+        /// Matched beacon locations and measurements, in decreasing order of
+        /// confidence in the identification.
+        struct Correspondences {
+            std::vector<Eigen::Vector3d> objectPoints;
+            std::vector<cv::Point2f> imagePoints;
+            std::vector<Led *> leds;
+            std::size_t size() const { return leds.size(); }
+        };
+
+        using IndexList = std::vector<std::size_t>;
+
+        inline Eigen::Vector2d toEigen(cv::Point2f const &pt) {
+            return Eigen::Vector2d(pt.x, pt.y);
+        }
+
+        /// Fills @p inliers with the indices of all correspondences that the
+        /// pose reprojects within @p maxError pixels of their measurement.
+        inline void findInliers(CameraParameters const &camParams,
+                                Correspondences const &corr,
+                                PnPPose const &pose, IndexList &inliers,
+                                double maxError = MAX_REPROJECTION_ERROR) {
+            const double maxSquaredError = maxError * maxError;
+            inliers.clear();
+            const auto n = corr.size();
+            for (std::size_t i = 0; i < n; ++i) {
+                Eigen::Vector3d camPoint =
+                    pose.rot * corr.objectPoints[i] + pose.xlate;
+                if (camPoint.z() == 0) {
+                    continue;
+                }
+                Eigen::Vector2d residual =
+                    projectPoint(camParams.focalLength(),
+                                 camParams.eiPrincipalPoint(), camPoint) -
+                    toEigen(corr.imagePoints[i]);
+                if (residual.squaredNorm() < maxSquaredError) {
+                    inliers.push_back(i);
+                }
+            }
+        }
+
+        /// A few Gauss-Newton steps minimizing reprojection error over the
+        /// given correspondences, with the rotation perturbed on the left by
+        /// an incremental rotation vector.
+        inline void refinePose(CameraParameters const &camParams,
+                               Correspondences const &corr,
+                               IndexList const &indices, PnPPose &pose,
+                               std::size_t iterations) {
+            using Matrix6d = Eigen::Matrix<double, 6, 6>;
+            using Vector6d = Eigen::Matrix<double, 6, 1>;
+            const double fl = camParams.focalLength();
+            const Eigen::Vector2d principalPoint =
+                camParams.eiPrincipalPoint();
+            for (std::size_t iter = 0; iter < iterations; ++iter) {
+                Matrix6d JtJ = Matrix6d::Zero();
+                Vector6d Jtr = Vector6d::Zero();
+                for (auto i : indices) {
+                    Eigen::Vector3d rotated = pose.rot * corr.objectPoints[i];
+                    Eigen::Vector3d camPoint = rotated + pose.xlate;
+                    const double z = camPoint.z();
+                    if (z == 0) {
+                        continue;
+                    }
+                    Eigen::Vector2d residual =
+                        projectPoint(fl, principalPoint, camPoint) -
+                        toEigen(corr.imagePoints[i]);
+                    /// d(projection)/d(camera-space point)
+                    Eigen::Matrix<double, 2, 3> dProj;
+                    dProj << fl / z, 0, -fl * camPoint.x() / (z * z), // row 0
+                        0, fl / z, -fl * camPoint.y() / (z * z);      // row 1
+                    Eigen::Matrix<double, 2, 6> J;
+                    J.leftCols<3>() =
+                        -dProj * skewSymmetricCrossProductMatrix3(rotated);
+                    J.rightCols<3>() = dProj;
+                    JtJ += J.transpose() * J;
+                    Jtr += J.transpose() * residual;
+                }
+                Vector6d delta = JtJ.ldlt().solve(-Jtr);
+                if (!delta.array().allFinite()) {
+                    return;
+                }
+                pose.rot = kalman::external_quat::vecToQuat(delta.head<3>())
+                               .toRotationMatrix() *
+                           pose.rot;
+                pose.xlate += delta.tail<3>();
+            }
+        }
+
+        /// Fits a pose to a minimal set of correspondences.
+        inline bool solveMinimalSet(CameraParameters const &camParams,
+                                    Correspondences const &corr,
+                                    IndexList const &indices, PnPPose &pose) {
+            std::vector<cv::Point3f> objectPoints;
+            std::vector<cv::Point2f> imagePoints;
+            for (auto i : indices) {
+                objectPoints.push_back(vec3dToCVPoint3f(corr.objectPoints[i]));
+                imagePoints.push_back(corr.imagePoints[i]);
+            }
+            cv::Mat rvec;
+            cv::Mat tvec;
+            /// P3P takes exactly four points (the fourth picks among its
+            /// solutions) and needs no initial guess, unlike the default
+            /// iterative solver.
+#if CV_MAJOR_VERSION == 2
+            const int method = CV_P3P;
+#elif CV_MAJOR_VERSION == 3
+            const int method = cv::SOLVEPNP_P3P;
+#else
+#error "Unrecognized OpenCV version!"
+#endif
+            if (!cv::solvePnP(objectPoints, imagePoints, camParams.cameraMatrix,
+                              camParams.distortionParameters, rvec, tvec,
+                              false, method)) {
+                return false;
+            }
+            /// Get to Eigen via OpenCV's Affine transform class.
+            Eigen::Affine3d xform = Eigen::Affine3d(cv::Affine3d(rvec, tvec));
+            pose.rot = xform.rotation();
+            pose.xlate = xform.translation();
+            return pose.rot.allFinite() && pose.xlate.allFinite();
+        }
+
+        /// Draws @p k distinct indices less than @p n at random into
+        /// @p indices, with the first @p poolSize (most confident)
+        /// correspondences @p poolWeight times as likely to be drawn as the
+        /// rest.
+        template <typename RandomEngine>
+        inline void drawSubset(RandomEngine &engine, std::size_t k,
+                               std::size_t n, std::size_t poolSize,
+                               std::size_t poolWeight, IndexList &indices) {
+            indices.clear();
+            auto weightOf = [&](std::size_t i) {
+                return i < poolSize ? poolWeight : std::size_t{1};
+            };
+            const auto inPool = std::min(n, poolSize);
+            std::size_t totalWeight = inPool * poolWeight + (n - inPool);
+            for (std::size_t drawn = 0; drawn < k; ++drawn) {
+                std::uniform_int_distribution<std::size_t> dist(
+                    0, totalWeight - 1);
+                auto target = dist(engine);
+                for (std::size_t i = 0; i < n; ++i) {
+                    if (std::find(begin(indices), end(indices), i) !=
+                        end(indices)) {
+                        continue;
+                    }
+                    auto weight = weightOf(i);
+                    if (target < weight) {
+                        indices.push_back(i);
+                        totalWeight -= weight;
+                        break;
+                    }
+                    target -= weight;
+                }
+            }
+        }
+    } // namespace
+
+    bool predictTargetPose(EstimatorInOutParams const &p,
+                           osvr::util::time::TimeValue const &frameTime,
+                           Eigen::Isometry3d &outPose) {
+        auto dt = util::time::duration(frameTime, p.startingTime);
+        if (dt < 0 || dt > MAX_PREDICTION_INTERVAL) {
+            return false;
+        }
+        BodyState state = p.state;
+        if (dt > 0) {
+            kalman::predict(state, p.processModel, dt);
+        }
+        /// Not getIsometry(): that leaves out the incremental rotation the
+        /// prediction just accumulated from the angular velocity.
+        Eigen::Isometry3d pose;
+        pose.fromPositionOrientationScale(state.position(),
+                                          state.getCombinedQuaternion(),
+                                          Eigen::Vector3d::Constant(1));
+        if (!pose.matrix().allFinite() || pose.translation().z() <= 0) {
+            return false;
+        }
+        outPose = pose;
+        return true;
+    }
+
     bool RANSACPoseEstimator::
     operator()(CameraParameters const &camParams, LedPtrList const &leds,
                BeaconStateVec const &beacons,
                std::vector<BeaconData> &beaconDebug, Eigen::Vector3d &outXlate,
                Eigen::Quaterniond &outQuat, int skipBrightsCutoff,
-               std::size_t iterations) {
+               std::size_t iterations, Eigen::Isometry3d const *predictedPose) {
 
         bool skipBrights = false;
 
@@ -67,149 +263,111 @@ namespace vbtracker {
             }
         }
 
-        // We need to get a pair of matched vectors of points: 2D locations
-        // with in the image and 3D locations in model space.  There needs to
-        // be a correspondence between the points in these vectors, such that
-        // the ith element in one matches the ith element in the other.  We
-        // make these by looking up the locations of LEDs with known identifiers
-        // and pushing both onto the vectors at the same time.
-
-        std::vector<cv::Point3f> objectPoints;
-        std::vector<cv::Point2f> imagePoints;
-        std::vector<ZeroBasedBeaconId> beaconIds;
+        // We need to get a set of matched points: 2D locations with in the
+        // image and 3D locations in model space. We make these by looking up
+        // the locations of LEDs with known identifiers, in order of how much
+        // we trust those identifications: longest-identified first, and
+        // brights (which are less precisely located) last.
+        LedPtrList candidates;
         for (auto const &led : leds) {
             if (skipBrights && led->isBright()) {
                 continue;
             }
+            candidates.push_back(led);
+        }
+        std::stable_sort(begin(candidates), end(candidates),
+                         [](Led const *lhs, Led const *rhs) {
+                             if (lhs->isBright() != rhs->isBright()) {
+                                 return rhs->isBright();
+                             }
+                             return lhs->novelty() < rhs->novelty();
+                         });
+
+        Correspondences corr;
+        for (auto const &led : candidates) {
             auto id = makeZeroBased(led->getID());
             auto index = asIndex(id);
             beaconDebug[index].variance = -1;
             beaconDebug[index].measurement = led->getLocationForTracking();
-            beaconIds.push_back(id);
 
-            /// Effectively invert the image points here so we get the output of
-            /// a coordinate system we want.
-            imagePoints.push_back(led->getLocationForTracking());
-            objectPoints.push_back(
-                vec3dToCVPoint3f(beacons[index]->stateVector()));
+            corr.leds.push_back(led);
+            corr.imagePoints.push_back(led->getLocationForTracking());
+            corr.objectPoints.push_back(beacons[index]->stateVector());
         }
 
         // Make sure we have enough points to do our estimation.
-        if (objectPoints.size() < m_permittedOutliers + m_requiredInliers) {
+        const auto numPoints = corr.size();
+        if (numPoints < m_requiredInliers) {
             return false;
         }
+        const auto enoughInliers =
+            std::max(m_requiredInliers,
+                     static_cast<std::size_t>(std::ceil(
+                         m_earlyExitInlierRatio * double(numPoints))));
+
+        PnPPose bestPose;
+        IndexList bestInliers;
+        PnPPose pose;
+        IndexList inliers;
+        auto considerHypothesis = [&] {
+            findInliers(camParams, corr, pose, inliers);
+            if (inliers.size() > bestInliers.size()) {
+                bestPose = pose;
+                bestInliers.swap(inliers);
+            }
+            return bestInliers.size() >= enoughInliers;
+        };
+
+        bool done = false;
+        if (predictedPose) {
+            // The predicted pose is our best guess: try it first, after
+            // letting it settle onto the points it already roughly explains.
+            pose.rot = predictedPose->rotation();
+            pose.xlate = predictedPose->translation();
+            findInliers(camParams, corr, pose, inliers,
+                        MAX_PREDICTED_REPROJECTION_ERROR);
+            if (inliers.size() >= m_requiredInliers) {
+                refinePose(camParams, corr, inliers, pose,
+                           m_refinementIterations);
+            }
+            done = considerHypothesis();
+        }
 
-        // Produce an estimate of the translation and rotation needed to take
-        // points from model space into camera space.  We allow for at most
-        // m_permittedOutliers outliers. Even in simulation data, we sometimes
-        // find duplicate IDs for LEDs, indicating that we are getting
-        // mis-identified ones sometimes.
-        // We tried using the previous guess to reduce the amount of computation
-        // being done, but this got us stuck in infinite locations.  We seem to
-        // do okay without using it, so leaving it out.
-        // @todo Make number of iterations into a parameter.
-        bool usePreviousGuess = false;
-        cv::Mat inlierIndices;
-
-        cv::Mat rvec;
-        cv::Mat tvec;
-#if CV_MAJOR_VERSION == 2
-        cv::solvePnPRansac(
-            objectPoints, imagePoints, camParams.cameraMatrix,
-            camParams.distortionParameters, rvec, tvec, usePreviousGuess,
-            iterations, MAX_REPROJECTION_ERROR,
-            static_cast<int>(objectPoints.size() - m_permittedOutliers),
-            inlierIndices);
-#elif CV_MAJOR_VERSION == 3
-        // parameter added to the OpenCV 3.0 interface in place of the number of
-        // inliers
-        /// @todo how to determine this requested confidence from the data we're
-        /// given?
-        double confidence = 0.99;
-        auto ransacResult = cv::solvePnPRansac(
-            objectPoints, imagePoints, camParams.cameraMatrix,
-            camParams.distortionParameters, rvec, tvec, usePreviousGuess,
-            iterations, MAX_REPROJECTION_ERROR, confidence, inlierIndices);
-        if (!ransacResult) {
-            return false;
+        if (!done) {
+            // Fit poses to random minimal sets, favoring our most trusted
+            // correspondences: drawn independently, so one misidentified LED
+            // among the trusted ones can't spoil every hypothesis.
+            IndexList subset;
+            for (std::size_t hypotheses = 0; !done && hypotheses < iterations;
+                 ++hypotheses) {
+                drawSubset(m_randEngine, m_requiredInliers, numPoints,
+                           m_hypothesisPoolSize, m_hypothesisPoolWeight,
+                           subset);
+                if (!solveMinimalSet(camParams, corr, subset, pose)) {
+                    continue;
+                }
+                done = considerHypothesis();
+            }
         }
-#else
-#error "Unrecognized OpenCV version!"
-#endif
 
         //==========================================================================
         // Make sure we got all the inliers we needed.  Otherwise, reject this
         // pose.
-        if (inlierIndices.rows < static_cast<int>(m_requiredInliers)) {
+        if (bestInliers.size() < m_requiredInliers) {
             return false;
         }
 
-        if (inlierIndices.rows > 0) {
-
-#ifdef OSVR_UVBI_TEST_RANSAC_REPROJECTION
-            //==========================================================================
-            // Reproject the inliers into the image and make sure they are
-            // actually
-            // close to the expected location; otherwise, we have a bad pose.
-            const double pixelReprojectionErrorForSingleAxisMax = 4;
-            std::vector<cv::Point3f> inlierObjectPoints;
-            std::vector<cv::Point2f> inlierImagePoints;
-            for (int i = 0; i < inlierIndices.rows; i++) {
-                inlierObjectPoints.push_back(objectPoints[i]);
-                inlierImagePoints.push_back(imagePoints[i]);
-            }
-            std::vector<cv::Point2f> reprojectedPoints;
-            cv::projectPoints(
-                inlierObjectPoints, rvec, tvec, camParams.cameraMatrix,
-                camParams.distortionParameters, reprojectedPoints);
-
-            for (size_t i = 0; i < reprojectedPoints.size(); i++) {
-                if (reprojectedPoints[i].x - inlierImagePoints[i].x >
-                    pixelReprojectionErrorForSingleAxisMax) {
-                    std::cout << "Reject on reprojected beacon id "
-                              << makeOneBased(inlierBeaconIds[i]).value()
-                              << " x axis." << std::endl;
-                    return false;
-                }
-                if (reprojectedPoints[i].y - inlierImagePoints[i].y >
-                    pixelReprojectionErrorForSingleAxisMax) {
-                    std::cout << "Reject on reprojected beacon id "
-                              << makeOneBased(inlierBeaconIds[i]).value()
-                              << " y axis." << std::endl;
-                    return false;
-                }
-            }
-#endif
-
-            /// Make a vector of the inlier beacon IDs.
-            std::vector<ZeroBasedBeaconId> inlierBeaconIds;
-            for (int i = 0; i < inlierIndices.rows; i++) {
-                inlierBeaconIds.push_back(beaconIds[i]);
-            }
-
-            /// Now, we will sort that vector of inlier beacon IDs so we can
-            /// rapidly binary search it to flag the LEDs we used.
+        // Polish the pose using all its inliers, then see who those are now.
+        refinePose(camParams, corr, bestInliers, bestPose,
+                   m_refinementIterations);
+        findInliers(camParams, corr, bestPose, inliers);
+        if (inliers.size() < m_requiredInliers) {
+            return false;
+        }
 
-            // Need a custom comparator for the ID type.
-            auto idComparator = [](ZeroBasedBeaconId const &lhs,
-                                   ZeroBasedBeaconId const &rhs) {
-                return lhs.value() < rhs.value();
-            };
-            std::sort(begin(inlierBeaconIds), end(inlierBeaconIds),
-                      idComparator);
-            // This lambda wraps binary_search to do what it says: check to see
-            // if a given beacon ID is in the list of inlier beacons.
-            auto isAnInlierBeacon = [&inlierBeaconIds, &idComparator](
-                ZeroBasedBeaconId const &needle) {
-                return std::binary_search(begin(inlierBeaconIds),
-                                          end(inlierBeaconIds), needle,
-                                          idComparator);
-            };
-            for (auto &led : leds) {
-                if (isAnInlierBeacon(led->getID())) {
-                    led->markAsUsed();
-                }
-            }
+        /// Flag the LEDs we used.
+        for (auto i : inliers) {
+            corr.leds[i]->markAsUsed();
         }
 
         //==========================================================================
@@ -217,11 +375,10 @@ namespace vbtracker {
         // gives the pose of the HDK origin in the camera coordinate system,
         // switching units to meters and encoding the angle in a unit
         // quaternion.
-        // The matrix described by rvec and tvec takes points in model space
-        // (the space where the LEDs are defined, which is in mm away from an
-        // implied origin) into a coordinate system where the center is at the
+        // The pose takes points in model space (the space where the LEDs are
+        // defined) into a coordinate system where the center is at the
         // camera's origin, with X to the right, Y down, and Z in the direction
-        // that the camera is facing (but still in the original units of mm):
+        // that the camera is facing:
         //  |Xc|   |r11 r12 r13 t1| |Xm|
         //  |Yc| = |r21 r22 r23 t2|*|Ym|
         //  |Zc|   |r31 r32 r33 t3| |Zm|
@@ -229,18 +386,15 @@ namespace vbtracker {
         //  That is, it rotates into the camera coordinate system and then adds
         // the translation, which is in the camera coordinate system.
         //  This is the transformation we want, since it reports the sensor's
-        // position and orientation in camera space, except that we want to
-        // convert
-        // the units into meters and the orientation into a Quaternion.
+        // position and orientation in camera space, except that we want the
+        // orientation as a Quaternion.
         //  NOTE: This is a right-handed coordinate system with X pointing
         // towards the right from the camera center of projection, Y pointing
         // down, and Z pointing along the camera viewing direction, if the input
         // points are not inverted.
 
-        /// Get to Eigen via OpenCV's Affine transform class.
-        Eigen::Affine3d xform = Eigen::Affine3d(cv::Affine3d(rvec, tvec));
-        Eigen::Vector3d xlate(xform.translation());
-        Eigen::Quaterniond quat(xform.rotation());
+        Eigen::Vector3d xlate(bestPose.xlate);
+        Eigen::Quaterniond quat(bestPose.rot);
         if (!xlate.array().allFinite()) {
             std::cout << "[UnifiedTracker] Computed a non-finite position with "
                          "RANSAC."
@@ -299,14 +453,20 @@ namespace vbtracker {
         InitialVelocityStateError,    InitialVelocityStateError,
         InitialVelocityStateError,    InitialAngVelStateError,
         InitialAngVelStateError,      InitialAngVelStateError};
-    bool RANSACPoseEstimator::operator()(EstimatorInOutParams const &p,
-                                         LedPtrList const &leds) {
+    bool RANSACPoseEstimator::
+    operator()(EstimatorInOutParams const &p, LedPtrList const &leds,
+               osvr::util::time::TimeValue const &frameTime) {
         Eigen::Vector3d xlate;
         Eigen::Quaterniond quat;
-        /// Call the main pose estimation to get the vector and quat.
+        /// Call the main pose estimation to get the vector and quat, seeded
+        /// with where we think the target is, if we have a clue.
         {
-            auto ret = (*this)(p.camParams, leds, p.beacons, p.beaconDebug,
-                               xlate, quat);
+            Eigen::Isometry3d predictedPose;
+            auto havePrediction =
+                predictTargetPose(p, frameTime, predictedPose);
+            auto ret =
+                (*this)(p.camParams, leds, p.beacons, p.beaconDebug, xlate,
+                        quat, -1, 5, havePrediction ? &predictedPose : nullptr);
             if (!ret) {
                 return false;
             }
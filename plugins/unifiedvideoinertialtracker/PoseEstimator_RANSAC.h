@@ -30,40 +30,82 @@
 #include "PoseEstimatorTypes.h"
 
 // Library/third-party includes
-// - none
+#include <osvr/Util/EigenCoreGeometry.h>
+#include <osvr/Util/TimeValue.h>
 
 // Standard includes
 #include <cstddef>
+#include <random>
 
 namespace osvr {
 namespace vbtracker {
+    /// Predicts the pose (in camera space) of the target at the given frame
+    /// time from the incoming state, for use as a seed for the
+    /// RANSACPoseEstimator.
+    ///
+    /// @return false if the state doesn't look usable as a seed (non-finite,
+    /// behind the camera, or too old).
+    bool predictTargetPose(EstimatorInOutParams const &p,
+                           osvr::util::time::TimeValue const &frameTime,
+                           Eigen::Isometry3d &outPose);
+
+    /// Pose estimation without a usable tracked state (initial acquisition,
+    /// re-acquisition, room calibration).
+    ///
+    /// The predicted pose, if one is supplied, is tried first, then poses fit
+    /// to random minimal sets of LEDs, drawn favoring those we're most
+    /// confident in the identity of (lowest novelty, non-bright first). Each
+    /// is scored by counting the beacons it reprojects close to their
+    /// measurements, and the search ends as soon as enough of them are
+    /// inliers. The winner is refined with a few Gauss-Newton steps on its
+    /// inliers.
     class RANSACPoseEstimator {
       public:
         /// Perform RANSAC-based pose estimation.
         ///
+        /// @param camParams Camera parameters, which must have no distortion.
         /// @param[out] outXlate translation output parameter
         /// @param[out] outQuat rotation output parameter
         /// @param skipBrightsCutoff If positive, the number of non-bright LEDs
         /// seen that will trigger us to skip using bright LEDs in pose
         /// estimation.
+        /// @param iterations Maximum number of minimal-set hypotheses to try.
+        /// @param predictedPose If not null, a predicted pose of the target in
+        /// camera space, tried as the first hypothesis.
         /// @return true if a pose was estimated.
         bool operator()(CameraParameters const &camParams,
                         LedPtrList const &leds, BeaconStateVec const &beacons,
                         std::vector<BeaconData> &beaconDebug,
                         Eigen::Vector3d &outXlate, Eigen::Quaterniond &outQuat,
-                        int skipBrightsCutoff = -1, std::size_t iterations = 5);
+                        int skipBrightsCutoff = -1, std::size_t iterations = 5,
+                        Eigen::Isometry3d const *predictedPose = nullptr);
 
         /// Perform RANSAC-based pose estimation and use it to update a body
         /// state (state vector and error covariance)
         ///
         /// @param[out] state Tracked body state that will be updated if a pose
         /// was estimated
+        /// @param frameTime Time of the frame, used to predict the incoming
+        /// state forward to seed the estimation.
         /// @return true if a pose was estimated.
-        bool operator()(EstimatorInOutParams const &p, LedPtrList const &leds);
+        bool operator()(EstimatorInOutParams const &p, LedPtrList const &leds,
+                        osvr::util::time::TimeValue const &frameTime);
 
       private:
         const std::size_t m_requiredInliers = 4;
-        const std::size_t m_permittedOutliers = 0;
+        /// Once a hypothesis has at least this fraction of the beacons as
+        /// inliers, we stop looking for a better one.
+        const double m_earlyExitInlierRatio = 0.8;
+        /// Number of candidate beacons (in order of confidence) that
+        /// minimal-set hypotheses favor.
+        const std::size_t m_hypothesisPoolSize = 8;
+        /// How many times as likely a beacon in that pool is to be drawn as
+        /// any other.
+        const std::size_t m_hypothesisPoolWeight = 4;
+        /// Gauss-Newton iterations to refine the chosen hypothesis.
+        const std::size_t m_refinementIterations = 3;
+        /// Fixed seed, so a recorded session replays the same way.
+        std::mt19937 m_randEngine{std::mt19937::default_seed};
     };
 } // namespace vbtracker
 } // namespace osvr
@@ -46,10 +46,15 @@ namespace vbtracker {
 
         Eigen::Vector3d xlate;
         Eigen::Quaterniond quat;
-        /// Call the main pose estimation to get the vector and quat.
+        /// Call the main pose estimation to get the vector and quat, seeded
+        /// with where we think the target is.
         {
+            Eigen::Isometry3d predictedPose;
+            auto havePrediction =
+                predictTargetPose(p, frameTime, predictedPose);
             auto ret = m_ransac(p.camParams, leds, p.beacons, p.beaconDebug,
-                                xlate, quat);
+                                xlate, quat, -1, 5,
+                                havePrediction ? &predictedPose : nullptr);
             if (!ret) {
                 return false;
             }
@@ -71,6 +71,15 @@ namespace vbtracker {
     /// initial start of autocalibration.
     static const auto NEAR_MESSAGE_CUTOFF = 0.4;
 
+    /// Tracked body velocities must remain below these levels (in tracker
+    /// space) for a frame to contribute to additional camera calibration.
+    static const auto ADDITIONAL_CAMERA_LINEAR_VELOCITY_CUTOFF = 0.1;
+    static const auto ADDITIONAL_CAMERA_ANGULAR_VELOCITY_CUTOFF = 0.2;
+    /// If a new estimate of an additional camera pose differs from the running
+    /// mean by more than these amounts (in meters and radians), we start over.
+    static const auto ADDITIONAL_CAMERA_XLATE_TOLERANCE = 0.05;
+    static const auto ADDITIONAL_CAMERA_ROTATION_TOLERANCE = 0.1;
+
     RoomCalibration::RoomCalibration(Eigen::Vector3d const &camPosition,
                                      bool cameraIsForward)
         : m_lastVideoData(util::time::getNow()),
@@ -368,6 +377,115 @@ namespace vbtracker {
         return boost::none;
     }
 
+    bool RoomCalibration::wantAdditionalCameraData(TrackingSystem const &sys,
+                                                   CameraId const &camera,
+                                                   BodyId const &body) const {
+        if (!calibrationComplete() || camera == CameraId(0) ||
+            !sys.isValidCameraId(camera) || sys.haveCameraPose(camera)) {
+            return false;
+        }
+        /// We need a reliable pose in tracker space to compare against.
+        return sys.isValidBodyId(body) && sys.getBody(body).hasPoseEstimate();
+    }
+
+    void RoomCalibration::processAdditionalCameraData(
+        CameraId const &camera, BodyState const &trackerSpaceState,
+        Eigen::Vector3d const &xlate, Eigen::Quaterniond const &quat) {
+        if (!xlate.array().allFinite() || !quat.coeffs().array().allFinite()) {
+            // non-finite camera-space pose
+            return;
+        }
+        auto &calib = getAdditionalCameraCalib(camera);
+        if (calib.complete) {
+            return;
+        }
+        if (!calib.instructed) {
+            calib.instructed = true;
+            instructions() << "Calibrating additional camera "
+                           << int(camera.value())
+                           << ": hold the tracked device still where both it "
+                              "and the primary camera can see it.";
+            endInstructions();
+        }
+        if (trackerSpaceState.velocity().norm() >=
+                ADDITIONAL_CAMERA_LINEAR_VELOCITY_CUTOFF ||
+            trackerSpaceState.angularVelocity().norm() >=
+                ADDITIONAL_CAMERA_ANGULAR_VELOCITY_CUTOFF) {
+            // Moving too fast for the pose from the state history to
+            // correspond well with the frame.
+            calib.restart();
+            return;
+        }
+
+        /// Coordinate systems involved here:
+        /// t: Tracker (primary camera)
+        /// c: Additional camera
+        /// b: Body
+        /// tTc = tTb * cTb^-1
+        Eigen::Isometry3d tTb = util::makeIsometry(
+            trackerSpaceState.position(),
+            trackerSpaceState.getCombinedQuaternion());
+        Eigen::Isometry3d cTb = util::makeIsometry(xlate, quat);
+        Eigen::Isometry3d tTc = tTb * cTb.inverse();
+        Eigen::Vector3d tTcXlate = tTc.translation();
+        Eigen::Quaterniond tTcRot(tTc.rotation());
+        if (calib.steadyReports == 0) {
+            // for setup purposes, we'll constrain w to be positive.
+            if (tTcRot.w() < 0) {
+                tTcRot = Eigen::Quaterniond(-tTcRot.coeffs());
+            }
+        } else {
+            // Compare against the running mean, keeping the quaternions
+            // continuous so our average of quat logs isn't bogus.
+            auto n = static_cast<double>(calib.steadyReports);
+            Eigen::Vector3d meanXlate = calib.tTc_xlate_accum / n;
+            Eigen::Quaterniond meanRot = util::quat_exp(calib.tTc_ln_accum / n);
+            tTcRot = util::flipQuatSignToMatch(meanRot, tTcRot);
+            if ((tTcXlate - meanXlate).norm() >
+                    ADDITIONAL_CAMERA_XLATE_TOLERANCE ||
+                meanRot.angularDistance(tTcRot) >
+                    ADDITIONAL_CAMERA_ROTATION_TOLERANCE) {
+                // Inconsistent with what we had so far, start over with this
+                // one.
+                calib.restart();
+            }
+        }
+        calib.tTc_xlate_accum += tTcXlate;
+        calib.tTc_ln_accum += util::quat_ln(tTcRot);
+        ++calib.steadyReports;
+    }
+
+    bool RoomCalibration::postAdditionalCameraCalibrationUpdate(
+        TrackingSystem &sys, CameraId const &camera) {
+        auto &calib = getAdditionalCameraCalib(camera);
+        if (calib.complete || calib.steadyReports < REQUIRED_SAMPLES) {
+            return false;
+        }
+        calib.complete = true;
+        auto n = static_cast<double>(calib.steadyReports);
+        Eigen::Isometry3d tTc =
+            util::makeIsometry(Eigen::Vector3d(calib.tTc_xlate_accum / n),
+                               util::quat_exp(calib.tTc_ln_accum / n));
+        msg() << "Additional camera " << int(camera.value())
+              << " calibration complete. Pose in tracker space AKA tTc: "
+                 "translation: "
+              << tTc.translation().transpose() << " rotation: ";
+        Eigen::AngleAxisd rot(tTc.rotation());
+        msgStream() << rot.angle() << " radians about "
+                    << rot.axis().transpose() << std::endl;
+        sys.setAdditionalCameraPose(camera, tTc);
+        return true;
+    }
+
+    RoomCalibration::AdditionalCameraCalib &
+    RoomCalibration::getAdditionalCameraCalib(CameraId const &camera) {
+        BOOST_ASSERT_MSG(!camera.empty(), "Must pass a valid camera ID!");
+        if (m_additionalCameras.size() <= camera.value()) {
+            m_additionalCameras.resize(camera.value() + 1);
+        }
+        return m_additionalCameras[camera.value()];
+    }
+
     Eigen::Isometry3d RoomCalibration::getCameraPose() const {
         BOOST_ASSERT_MSG(calibrationComplete(), "Not valid to call "
                                                 "getCameraPose() unless "
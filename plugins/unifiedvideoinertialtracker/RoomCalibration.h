@@ -27,6 +27,7 @@
 
 // Internal Includes
 #include "BodyIdTypes.h"
+#include "ModelTypes.h"
 
 // Library/third-party includes
 #include <osvr/Util/Angles.h>
@@ -39,6 +40,7 @@
 // Standard includes
 #include <cstddef>
 #include <iosfwd>
+#include <vector>
 
 namespace osvr {
 namespace vbtracker {
@@ -84,6 +86,37 @@ namespace vbtracker {
         Eigen::Isometry3d getCameraPose() const;
         /// @}
 
+        /// @name Additional camera calibration
+        /// @brief Once room calibration (of the primary camera) is complete,
+        /// the pose of each additional camera in tracker space is found by
+        /// comparing the tracked pose of a body with a RANSAC pose estimate of
+        /// the same body from the additional camera, while the body is held
+        /// still where both can see it.
+        /// @{
+        /// Should we bother computing a RANSAC pose of the given body for the
+        /// given additional camera?
+        bool wantAdditionalCameraData(TrackingSystem const &sys,
+                                      CameraId const &camera,
+                                      BodyId const &body) const;
+
+        /// @param trackerSpaceState The state of the body in tracker space at
+        /// (or just before) the time of the frame.
+        /// @param xlate RANSAC pose estimate of the body from the additional
+        /// camera: translation in camera space.
+        /// @param quat RANSAC pose estimate of the body from the additional
+        /// camera: rotation in camera space.
+        void processAdditionalCameraData(CameraId const &camera,
+                                         BodyState const &trackerSpaceState,
+                                         Eigen::Vector3d const &xlate,
+                                         Eigen::Quaterniond const &quat);
+
+        /// When completed feeding data for a frame from an additional camera,
+        /// this method will check to see if calibration of that camera has
+        /// finished and pass the camera pose to the tracking system if so.
+        bool postAdditionalCameraCalibrationUpdate(TrackingSystem &sys,
+                                                   CameraId const &camera);
+        /// @}
+
       private:
         bool finished() const;
 
@@ -140,6 +173,24 @@ namespace vbtracker {
         Eigen::Isometry3d m_cameraPose = Eigen::Isometry3d::Identity();
         Eigen::Isometry3d m_rTi = Eigen::Isometry3d::Identity();
         /// @}
+
+        /// Accumulated estimates of the pose of an additional camera in
+        /// tracker space (tTc).
+        struct AdditionalCameraCalib {
+            bool instructed = false;
+            bool complete = false;
+            std::size_t steadyReports = 0;
+            Eigen::Vector3d tTc_xlate_accum = Eigen::Vector3d::Zero();
+            Eigen::Vector3d tTc_ln_accum = Eigen::Vector3d::Zero();
+            void restart() {
+                steadyReports = 0;
+                tTc_xlate_accum = Eigen::Vector3d::Zero();
+                tTc_ln_accum = Eigen::Vector3d::Zero();
+            }
+        };
+        AdditionalCameraCalib &getAdditionalCameraCalib(CameraId const &camera);
+        /// Indexed by camera ID - the entry for the primary camera is unused.
+        std::vector<AdditionalCameraCalib> m_additionalCameras;
     };
 
     /// A standalone function that looks at the camera and IMUs in a tracking
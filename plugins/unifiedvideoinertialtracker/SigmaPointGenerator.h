@@ -86,6 +86,11 @@ namespace kalman {
         double weight;
     };
 
+    /// Tag type: passed to the sigma point generator constructor to indicate
+    /// that the matrix passed is already a lower-triangular square root (such
+    /// as a Cholesky factor) of the covariance, rather than the covariance.
+    struct CovarianceSqrtTag {};
+
     template <std::size_t Dim, std::size_t OrigDim = Dim>
     class AugmentedSigmaPointGenerator {
       public:
@@ -102,12 +107,22 @@ namespace kalman {
 
         AugmentedSigmaPointGenerator(MeanVec const &mean, CovMatrix const &cov,
                                      SigmaPointParameters params)
-            : p_(params, L), mean_(mean), covariance_(cov) {
+            : AugmentedSigmaPointGenerator(mean, CovMatrix(cov.llt().matrixL()),
+                                           params, CovarianceSqrtTag()) {}
+
+        /// Constructor taking a lower-triangular square root of the
+        /// covariance instead of the covariance, for callers that can factor
+        /// it more cheaply than by a dense Cholesky decomposition (such as
+        /// block by block, when it's block-diagonal).
+        AugmentedSigmaPointGenerator(MeanVec const &mean,
+                                     CovMatrix const &covSqrt,
+                                     SigmaPointParameters params,
+                                     CovarianceSqrtTag)
+            : p_(params, L), mean_(mean), scaledMatrixSqrt_(covSqrt) {
             weights_ = SigmaPointWeightVec::Constant(p_.weight);
             weightsForCov_ = weights_;
             weights_[0] = p_.weightMean0;
             weightsForCov_[0] = p_.weightCov0;
-            scaledMatrixSqrt_ = cov.llt().matrixL();
             /// scaledMatrixSqrt_ *= p_.gamma;
             sigmaPoints_ << mean,
                 (p_.gamma * scaledMatrixSqrt_).colwise() + mean,
@@ -141,7 +156,6 @@ namespace kalman {
       private:
         SigmaPointParameterDerivedQuantities p_;
         MeanVec mean_;
-        CovMatrix covariance_;
         CovMatrix scaledMatrixSqrt_;
         SigmaPointsMat sigmaPoints_;
         SigmaPointWeightVec weights_;
@@ -0,0 +1,236 @@
+/** @file
+    @brief Header for a contiguous container with stable, generation-checked
+    handles.
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_SlotMap_h_GUID_F63F0C5C_3651_40D1_9DAE_0065CD7D6035
+#define INCLUDED_SlotMap_h_GUID_F63F0C5C_3651_40D1_9DAE_0065CD7D6035
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <boost/assert.hpp>
+
+// Standard includes
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace osvr {
+namespace vbtracker {
+
+    /// Refers to an element of a SlotMap: stays valid until that element is
+    /// erased, whatever else is inserted or erased in the meantime, and
+    /// never refers to a different element afterwards.
+    ///
+    /// A default-constructed handle refers to nothing.
+    class SlotMapHandle {
+      public:
+        SlotMapHandle() = default;
+        SlotMapHandle(std::uint32_t index, std::uint32_t generation)
+            : m_index(index), m_generation(generation) {}
+
+        /// Whether this handle was ever issued: doesn't say whether the
+        /// element is still around, for that, see SlotMap::contains()
+        bool valid() const { return m_generation != 0; }
+
+        std::uint32_t index() const { return m_index; }
+        std::uint32_t generation() const { return m_generation; }
+
+        bool operator==(SlotMapHandle const &other) const {
+            return m_index == other.m_index &&
+                   m_generation == other.m_generation;
+        }
+        bool operator!=(SlotMapHandle const &other) const {
+            return !(*this == other);
+        }
+
+      private:
+        std::uint32_t m_index = (std::numeric_limits<std::uint32_t>::max)();
+        /// Generation 0 is never issued.
+        std::uint32_t m_generation = 0;
+    };
+
+    /// Unordered container keeping its elements contiguous (so iteration is
+    /// over a plain vector), with O(1) insertion, erasure, and lookup by
+    /// handle.
+    ///
+    /// Erasing moves the last element into the hole, so iterators, pointers,
+    /// and references to elements are invalidated by any insertion or
+    /// erasure: keep handles instead. Storage is reused, so once the
+    /// container has reached its working size, inserting and erasing don't
+    /// allocate.
+    template <typename T> class SlotMap {
+      public:
+        using value_type = T;
+        using handle_type = SlotMapHandle;
+        using container_type = std::vector<value_type>;
+        using size_type = typename container_type::size_type;
+        using iterator = typename container_type::iterator;
+        using const_iterator = typename container_type::const_iterator;
+
+        /// Constructs a new element in place.
+        /// @return a handle to the new element.
+        template <typename... Args> handle_type emplace(Args &&... args) {
+            if (m_freeHead == NO_SLOT) {
+                m_slots.push_back(Slot{NO_SLOT, 1});
+                m_freeHead = static_cast<std::uint32_t>(m_slots.size() - 1);
+            }
+            auto slot = m_freeHead;
+            m_slotOfValue.push_back(slot);
+            try {
+                m_values.emplace_back(std::forward<Args>(args)...);
+            } catch (...) {
+                m_slotOfValue.pop_back();
+                throw;
+            }
+            m_freeHead = m_slots[slot].position;
+            m_slots[slot].position =
+                static_cast<std::uint32_t>(m_values.size() - 1);
+            return handle_type(slot, m_slots[slot].generation);
+        }
+
+        /// Erases the element, if the handle still refers to one.
+        /// @return true if an element was erased.
+        bool erase(handle_type const &handle) {
+            if (!contains(handle)) {
+                return false;
+            }
+            auto &slot = m_slots[handle.index()];
+            auto position = slot.position;
+            auto last = static_cast<std::uint32_t>(m_values.size() - 1);
+            if (position != last) {
+                m_values[position] = std::move(m_values[last]);
+                m_slotOfValue[position] = m_slotOfValue[last];
+                m_slots[m_slotOfValue[position]].position = position;
+            }
+            m_values.pop_back();
+            m_slotOfValue.pop_back();
+            m_release(handle.index());
+            return true;
+        }
+
+        /// Erases all elements, invalidating all handles.
+        void clear() {
+            for (auto slot : m_slotOfValue) {
+                m_release(slot);
+            }
+            m_values.clear();
+            m_slotOfValue.clear();
+        }
+
+        /// Whether the handle refers to an element still in the container.
+        bool contains(handle_type const &handle) const {
+            return handle.index() < m_slots.size() &&
+                   m_slots[handle.index()].generation == handle.generation();
+        }
+
+        /// Gets the element the handle refers to, or nullptr if it has been
+        /// erased.
+        value_type *get(handle_type const &handle) {
+            return contains(handle) ? &m_values[m_position(handle)] : nullptr;
+        }
+        value_type const *get(handle_type const &handle) const {
+            return contains(handle) ? &m_values[m_position(handle)] : nullptr;
+        }
+
+        /// Gets the element the handle refers to, which must still be in the
+        /// container.
+        value_type &operator[](handle_type const &handle) {
+            BOOST_ASSERT_MSG(contains(handle), "Stale or invalid handle!");
+            return m_values[m_position(handle)];
+        }
+        value_type const &operator[](handle_type const &handle) const {
+            BOOST_ASSERT_MSG(contains(handle), "Stale or invalid handle!");
+            return m_values[m_position(handle)];
+        }
+
+        /// Gets a handle to the element at the given position in iteration
+        /// order.
+        handle_type getHandle(size_type position) const {
+            BOOST_ASSERT_MSG(position < size(), "Position out of range!");
+            auto slot = m_slotOfValue[position];
+            return handle_type(slot, m_slots[slot].generation);
+        }
+
+        size_type size() const { return m_values.size(); }
+        bool empty() const { return m_values.empty(); }
+
+        /// Reserves storage for at least n elements.
+        void reserve(size_type n) {
+            m_values.reserve(n);
+            m_slotOfValue.reserve(n);
+            m_slots.reserve(n);
+        }
+
+        iterator begin() { return m_values.begin(); }
+        iterator end() { return m_values.end(); }
+        const_iterator begin() const { return m_values.begin(); }
+        const_iterator end() const { return m_values.end(); }
+        const_iterator cbegin() const { return m_values.cbegin(); }
+        const_iterator cend() const { return m_values.cend(); }
+
+      private:
+        static const std::uint32_t NO_SLOT =
+            (std::numeric_limits<std::uint32_t>::max)();
+
+        struct Slot {
+            /// Position of the element in m_values if occupied, otherwise the
+            /// next free slot.
+            std::uint32_t position;
+            /// Matches the handle issued for the current occupant, if any;
+            /// bumped when the occupant is erased so old handles go stale.
+            std::uint32_t generation;
+        };
+
+        size_type m_position(handle_type const &handle) const {
+            return m_slots[handle.index()].position;
+        }
+
+        /// Puts a slot whose occupant is gone on the free list.
+        void m_release(std::uint32_t index) {
+            auto &slot = m_slots[index];
+            ++slot.generation;
+            if (slot.generation == 0) {
+                /// Skip the generation that's never issued.
+                slot.generation = 1;
+            }
+            slot.position = m_freeHead;
+            m_freeHead = index;
+        }
+
+        container_type m_values;
+        /// Parallel to m_values: the slot referring to each element.
+        std::vector<std::uint32_t> m_slotOfValue;
+        std::vector<Slot> m_slots;
+        /// Head of the linked list of free slots, threaded through
+        /// Slot::position.
+        std::uint32_t m_freeHead = NO_SLOT;
+    };
+
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_SlotMap_h_GUID_F63F0C5C_3651_40D1_9DAE_0065CD7D6035
@@ -0,0 +1,37 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#define CATCH_CONFIG_MAIN
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <catch.hpp>
+
+// Standard includes
+// - none
+
+/// Compilation unit exists to separately compile the Catch test runner main
+/// function.
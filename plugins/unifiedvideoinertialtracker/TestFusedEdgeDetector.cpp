@@ -0,0 +1,275 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <BlobParams.h>
+#include <FusedEdgeDetector.h>
+
+// Library/third-party includes
+#include <catch.hpp>
+#include <opencv2/core/core.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+// Standard includes
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using osvr::vbtracker::EdgeHoleParams;
+using osvr::vbtracker::FusedEdgeDetector;
+
+namespace {
+using NamedImage = std::pair<std::string, cv::Mat>;
+
+EdgeHoleParams makeParams(int scale, bool postBlur, int threshold) {
+    EdgeHoleParams params;
+    params.preEdgeDetectionBlurSize = 3;
+    params.laplacianKSize = 3;
+    params.laplacianScale = scale;
+    params.edgeDetectErosion = false;
+    params.postEdgeDetectionBlur = postBlur;
+    params.postEdgeDetectionBlurSize = 3;
+    params.postEdgeDetectionBlurThreshold = threshold;
+    return params;
+}
+
+/// The separate OpenCV passes, as performed by the EdgeHoleBasedLedExtractor
+/// when it isn't using the FusedEdgeDetector.
+void referenceEdgeDetection(cv::Mat const &gray, EdgeHoleParams const &params,
+                            cv::Mat &edge, cv::Mat &edgeBinary) {
+    cv::Mat blurred;
+    cv::GaussianBlur(gray, blurred,
+                     cv::Size(params.preEdgeDetectionBlurSize,
+                              params.preEdgeDetectionBlurSize),
+                     0, 0);
+    cv::Laplacian(blurred, edge, CV_8U, params.laplacianKSize,
+                  params.laplacianScale);
+    if (params.postEdgeDetectionBlur) {
+        cv::Mat edgeTemp;
+        cv::GaussianBlur(edge, edgeTemp,
+                         cv::Size(params.postEdgeDetectionBlurSize,
+                                  params.postEdgeDetectionBlurSize),
+                         0, 0);
+        cv::threshold(edgeTemp, edgeBinary,
+                      params.postEdgeDetectionBlurThreshold, 255,
+                      cv::THRESH_BINARY);
+    } else {
+        cv::threshold(edge, edgeBinary, params.postEdgeDetectionBlurThreshold,
+                      255, cv::THRESH_BINARY);
+    }
+}
+
+/// Number of differing pixels, or -1 if the size or type differs.
+int countDifferences(cv::Mat const &a, cv::Mat const &b) {
+    if (a.size() != b.size() || a.type() != b.type()) {
+        return -1;
+    }
+    int differences = 0;
+    for (int y = 0; y < a.rows; ++y) {
+        auto rowA = a.ptr<std::uint8_t>(y);
+        auto rowB = b.ptr<std::uint8_t>(y);
+        for (int x = 0; x < a.cols; ++x) {
+            if (rowA[x] != rowB[x]) {
+                ++differences;
+            }
+        }
+    }
+    return differences;
+}
+
+/// Inputs of a given size: noise, plus the patterns that push the blur and
+/// Laplacian to their extremes and saturate the output in both directions.
+std::vector<NamedImage> makeImages(int rows, int cols, std::mt19937 &rng) {
+    std::vector<NamedImage> images;
+    auto add = [&](std::string const &name) -> cv::Mat & {
+        images.emplace_back(name, cv::Mat(rows, cols, CV_8UC1));
+        return images.back().second;
+    };
+    auto fill = [&](cv::Mat &img, int lo, int hi) {
+        std::uniform_int_distribution<int> dist(lo, hi);
+        for (int y = 0; y < rows; ++y) {
+            for (int x = 0; x < cols; ++x) {
+                img.at<std::uint8_t>(y, x) =
+                    static_cast<std::uint8_t>(dist(rng));
+            }
+        }
+    };
+    fill(add("random"), 0, 255);
+    fill(add("low-contrast random"), 100, 103);
+    add("black") = cv::Scalar(0);
+    add("white") = cv::Scalar(255);
+    {
+        auto &img = add("checkerboard");
+        for (int y = 0; y < rows; ++y) {
+            for (int x = 0; x < cols; ++x) {
+                img.at<std::uint8_t>(y, x) = ((x + y) % 2) ? 255 : 0;
+            }
+        }
+    }
+    {
+        auto &img = add("vertical stripes");
+        for (int y = 0; y < rows; ++y) {
+            for (int x = 0; x < cols; ++x) {
+                img.at<std::uint8_t>(y, x) = (x % 3) ? 0 : 255;
+            }
+        }
+    }
+    {
+        auto &img = add("bright spots on noise");
+        fill(img, 0, 40);
+        std::uniform_int_distribution<int> row(0, rows - 1);
+        std::uniform_int_distribution<int> col(0, cols - 1);
+        for (int i = 0; i < 1 + rows * cols / 16; ++i) {
+            img.at<std::uint8_t>(row(rng), col(rng)) = 255;
+        }
+    }
+    {
+        auto &img = add("edge pixels only");
+        img = cv::Scalar(0);
+        img.row(0) = cv::Scalar(255);
+        img.row(rows - 1) = cv::Scalar(255);
+        img.col(0) = cv::Scalar(255);
+        img.col(cols - 1) = cv::Scalar(255);
+    }
+    return images;
+}
+
+/// Every configuration canHandle() accepts: each Laplacian scale, with and
+/// without the post-blur, at the extreme thresholds and a few between.
+std::vector<EdgeHoleParams> makeAllParams() {
+    std::vector<EdgeHoleParams> all;
+    for (int scale = 1; scale <= 16; ++scale) {
+        for (bool postBlur : {false, true}) {
+            for (int threshold : {0, 1, 80, 127, 254}) {
+                all.push_back(makeParams(scale, postBlur, threshold));
+            }
+        }
+    }
+    return all;
+}
+} // namespace
+
+TEST_CASE("FusedEdgeDetector parameter support", "[fusededge]") {
+    REQUIRE(FusedEdgeDetector::canHandle(EdgeHoleParams()));
+    for (auto const &params : makeAllParams()) {
+        REQUIRE(FusedEdgeDetector::canHandle(params));
+    }
+
+    auto params = makeParams(5, true, 80);
+    SECTION("scale out of range") {
+        params.laplacianScale = 17;
+        REQUIRE_FALSE(FusedEdgeDetector::canHandle(params));
+        params.laplacianScale = 0;
+        REQUIRE_FALSE(FusedEdgeDetector::canHandle(params));
+    }
+    SECTION("non-integer scale") {
+        params.laplacianScale = 2.5;
+        REQUIRE_FALSE(FusedEdgeDetector::canHandle(params));
+    }
+    SECTION("larger kernels") {
+        params.preEdgeDetectionBlurSize = 5;
+        REQUIRE_FALSE(FusedEdgeDetector::canHandle(params));
+        params.preEdgeDetectionBlurSize = 3;
+        params.laplacianKSize = 5;
+        REQUIRE_FALSE(FusedEdgeDetector::canHandle(params));
+        params.laplacianKSize = 3;
+        params.postEdgeDetectionBlurSize = 5;
+        REQUIRE_FALSE(FusedEdgeDetector::canHandle(params));
+    }
+    SECTION("erosion") {
+        params.edgeDetectErosion = true;
+        REQUIRE_FALSE(FusedEdgeDetector::canHandle(params));
+    }
+    SECTION("threshold out of range") {
+        params.postEdgeDetectionBlurThreshold = 255;
+        REQUIRE_FALSE(FusedEdgeDetector::canHandle(params));
+        params.postEdgeDetectionBlurThreshold = -1;
+        REQUIRE_FALSE(FusedEdgeDetector::canHandle(params));
+    }
+}
+
+TEST_CASE("FusedEdgeDetector declines unsupported images", "[fusededge]") {
+    FusedEdgeDetector fused(EdgeHoleParams{});
+    cv::Mat edge;
+    cv::Mat edgeBinary;
+    SECTION("single row") {
+        REQUIRE_FALSE(fused.apply(cv::Mat(1, 32, CV_8UC1, cv::Scalar(128)),
+                                  edge, edgeBinary));
+    }
+    SECTION("single column") {
+        REQUIRE_FALSE(fused.apply(cv::Mat(32, 1, CV_8UC1, cv::Scalar(128)),
+                                  edge, edgeBinary));
+    }
+    SECTION("color") {
+        REQUIRE_FALSE(fused.apply(cv::Mat(8, 8, CV_8UC3), edge, edgeBinary));
+    }
+    SECTION("16-bit") {
+        REQUIRE_FALSE(fused.apply(cv::Mat(8, 8, CV_16UC1), edge, edgeBinary));
+    }
+    REQUIRE(edge.empty());
+    REQUIRE(edgeBinary.empty());
+}
+
+TEST_CASE("FusedEdgeDetector matches the separate OpenCV passes",
+          "[fusededge]") {
+    std::mt19937 rng(42);
+    /// Widths below, at, and around multiples of the 16-pixel vector loops,
+    /// and heights down to the two-row minimum.
+    const std::vector<int> widths = {2,  3,  5,  7,  15, 16, 17,
+                                     31, 32, 33, 47, 48, 65, 161};
+    const std::vector<int> heights = {2, 3, 4, 7, 33};
+    std::vector<NamedImage> images;
+    for (auto rows : heights) {
+        for (auto cols : widths) {
+            for (auto &image : makeImages(rows, cols, rng)) {
+                images.push_back(std::move(image));
+            }
+        }
+    }
+
+    for (auto const &params : makeAllParams()) {
+        /// One detector per configuration, so its row buffers get reused
+        /// and resized as the image width changes.
+        FusedEdgeDetector fused(params);
+        for (auto const &image : images) {
+            auto const &gray = image.second;
+            INFO("scale " << params.laplacianScale << ", post-blur "
+                          << params.postEdgeDetectionBlur << ", threshold "
+                          << params.postEdgeDetectionBlurThreshold << ": "
+                          << image.first << " " << gray.cols << "x"
+                          << gray.rows);
+            cv::Mat edge;
+            cv::Mat edgeBinary;
+            REQUIRE(fused.apply(gray, edge, edgeBinary));
+
+            cv::Mat expectedEdge;
+            cv::Mat expectedBinary;
+            referenceEdgeDetection(gray, params, expectedEdge, expectedBinary);
+            REQUIRE(countDifferences(edge, expectedEdge) == 0);
+            REQUIRE(countDifferences(edgeBinary, expectedBinary) == 0);
+        }
+    }
+}
@@ -0,0 +1,218 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "HDKLedIdentifier.h"
+#include "LED.h"
+#include "MakeHDKTrackingSystem.h"
+
+// Library/third-party includes
+#include <catch.hpp>
+
+// Standard includes
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <string>
+
+using namespace osvr::vbtracker;
+
+namespace {
+    /// Copies of the sentinels, so they can be passed by reference.
+    const int NO_PATTERN =
+        Led::SENTINEL_NO_PATTERN_RECOGNIZED_DESPITE_SUFFICIENT_DATA;
+    const int NO_EXTREMA = Led::SENTINEL_INSUFFICIENT_EXTREMA_DIFFERENCE;
+
+    /// All the HDK patterns, front then back, as the tracking system uses
+    /// them.
+    PatternStringList getHDKPatterns() {
+        PatternStringList ret = OsvrHdkLedIdentifier_SENSOR0_PATTERNS;
+        ret.insert(end(ret), begin(OsvrHdkLedIdentifier_SENSOR1_PATTERNS),
+                   end(OsvrHdkLedIdentifier_SENSOR1_PATTERNS));
+        return ret;
+    }
+
+    bool isEnabled(std::string const &pattern) {
+        return !pattern.empty() &&
+               pattern.find_first_not_of("*.") == std::string::npos;
+    }
+
+    /// Brightnesses for a sequence written like a pattern.
+    BrightnessList toBrightnesses(std::string const &sequence) {
+        BrightnessList ret;
+        for (auto c : sequence) {
+            ret.push_back(c == '*' ? 3.f : 1.f);
+        }
+        return ret;
+    }
+
+    std::string rotated(std::string const &pattern, std::size_t shift) {
+        return pattern.substr(shift) + pattern.substr(0, shift);
+    }
+
+    /// The search the table lookup replaced: find the sequence in each
+    /// pattern, wrapped around, in order.
+    int searchId(PatternStringList const &patterns,
+                 std::string const &sequence) {
+        if (std::count(begin(sequence), end(sequence), '*') == 0 ||
+            std::count(begin(sequence), end(sequence), '.') == 0) {
+            return NO_EXTREMA;
+        }
+        for (std::size_t i = 0; i < patterns.size(); ++i) {
+            auto const &pattern = patterns[i];
+            if (!isEnabled(pattern)) {
+                continue;
+            }
+            auto wrapped = pattern + pattern;
+            wrapped.pop_back();
+            if (wrapped.find(sequence) != std::string::npos) {
+                return static_cast<int>(i);
+            }
+        }
+        return NO_PATTERN;
+    }
+
+    /// What tolerating a single-bit error should give for a sequence the
+    /// search doesn't recognize: the one pattern with a rotation one bit
+    /// away, if there is just one.
+    int nearestId(PatternStringList const &patterns,
+                  std::string const &sequence) {
+        int ret = NO_PATTERN;
+        for (std::size_t i = 0; i < patterns.size(); ++i) {
+            auto const &pattern = patterns[i];
+            if (!isEnabled(pattern) ||
+                searchId(patterns, pattern) != static_cast<int>(i)) {
+                /// Disabled, or shadowed by an earlier pattern.
+                continue;
+            }
+            for (std::size_t shift = 0; shift < pattern.size(); ++shift) {
+                auto candidate = rotated(pattern, shift);
+                auto differences = std::inner_product(
+                    begin(candidate), end(candidate), begin(sequence), 0,
+                    std::plus<int>(), std::not_equal_to<char>());
+                if (differences == 1) {
+                    if (ret >= 0 && ret != static_cast<int>(i)) {
+                        return NO_PATTERN;
+                    }
+                    ret = static_cast<int>(i);
+                }
+            }
+        }
+        return ret;
+    }
+
+    int identify(LedIdentifier const &identifier,
+                 std::string const &sequence) {
+        auto brightnesses = toBrightnesses(sequence);
+        bool lastBright = false;
+        return identifier
+            .getId(ZeroBasedBeaconId(-1), brightnesses, lastBright, false)
+            .value();
+    }
+} // namespace
+
+TEST_CASE("HDK patterns identified as by string search", "[hdkident]") {
+    auto patterns = getHDKPatterns();
+    OsvrHdkLedIdentifier identifier(patterns);
+    OsvrHdkLedIdentifier tolerant(patterns, true);
+    for (std::size_t i = 0; i < patterns.size(); ++i) {
+        auto const &pattern = patterns[i];
+        if (!isEnabled(pattern)) {
+            continue;
+        }
+        for (std::size_t shift = 0; shift < pattern.size(); ++shift) {
+            auto sequence = rotated(pattern, shift);
+            CAPTURE(i);
+            CAPTURE(sequence);
+            auto expected = searchId(patterns, sequence);
+            REQUIRE(expected >= 0);
+            REQUIRE(identify(identifier, sequence) == expected);
+            REQUIRE(identify(tolerant, sequence) == expected);
+        }
+    }
+}
+
+TEST_CASE("HDK patterns with a single-bit error", "[hdkident]") {
+    auto patterns = getHDKPatterns();
+    OsvrHdkLedIdentifier identifier(patterns);
+    OsvrHdkLedIdentifier tolerant(patterns, true);
+    std::size_t corrected = 0;
+    for (std::size_t i = 0; i < patterns.size(); ++i) {
+        auto const &pattern = patterns[i];
+        if (!isEnabled(pattern)) {
+            continue;
+        }
+        for (std::size_t shift = 0; shift < pattern.size(); ++shift) {
+            for (std::size_t flip = 0; flip < pattern.size(); ++flip) {
+                auto sequence = rotated(pattern, shift);
+                sequence[flip] = sequence[flip] == '*' ? '.' : '*';
+                CAPTURE(i);
+                CAPTURE(sequence);
+                auto expected = searchId(patterns, sequence);
+                REQUIRE(identify(identifier, sequence) == expected);
+                if (expected == NO_PATTERN) {
+                    expected = nearestId(patterns, sequence);
+                }
+                if (expected == static_cast<int>(i)) {
+                    ++corrected;
+                }
+                REQUIRE(identify(tolerant, sequence) == expected);
+            }
+        }
+    }
+    /// Some errors must have been corrected, for this to test anything.
+    REQUIRE(corrected > 0);
+}
+
+TEST_CASE("Single-bit errors", "[hdkident]") {
+    /// Stars next to each other, and stars half the pattern apart.
+    PatternStringList patterns = {"**......", "*...*...", "X......."};
+    OsvrHdkLedIdentifier identifier(patterns);
+    OsvrHdkLedIdentifier tolerant(patterns, true);
+
+    SECTION("exact matches in any rotation") {
+        REQUIRE(identify(identifier, "......**") == 0);
+        REQUIRE(identify(identifier, "..*...*.") == 1);
+        REQUIRE(identify(tolerant, "......**") == 0);
+        REQUIRE(identify(tolerant, "..*...*.") == 1);
+    }
+
+    SECTION("one bit away from a single pattern") {
+        REQUIRE(identify(identifier, "***.....") == NO_PATTERN);
+        REQUIRE(identify(tolerant, "***.....") == 0);
+        REQUIRE(identify(identifier, ".*.*.*..") == NO_PATTERN);
+        REQUIRE(identify(tolerant, ".*.*.*..") == 1);
+    }
+
+    SECTION("one bit away from several patterns is ambiguous") {
+        /// Drop the last star for pattern 0, or the second for pattern 1.
+        auto sequence = "**..*...";
+        REQUIRE(identify(identifier, sequence) == NO_PATTERN);
+        REQUIRE(identify(tolerant, sequence) == NO_PATTERN);
+    }
+
+    SECTION("more than one bit away") {
+        REQUIRE(identify(tolerant, "****....") == NO_PATTERN);
+    }
+}
@@ -179,6 +179,29 @@ TEST_CASE("Sigma point reconstruction validity") {
     }
 }
 
+TEST_CASE("Augmented sigma points from the block-diagonal factor", "[ukf]") {
+    unique_ptr<TestData> data(new TestData);
+    /// Advance a bit so the state covariance isn't just diagonal.
+    data->state.angularVelocity() = Vector3d(0.5, -0.25, 1.);
+    kalman::predict(data->state, data->processModel, 0.01);
+    OrientationMeasurement kalmanMeas{
+        Quaterniond(AngleAxisd(SMALL_VALUE, Vector3d::UnitY())),
+        data->imuVariance};
+
+    using Correction = kalman::SigmaPointCorrectionApplication<
+        BodyState, OrientationMeasurement>;
+    auto inProgress = kalman::beginUnscentedCorrection(data->state, kalmanMeas);
+    /// The way sigma points were generated before: factoring the whole
+    /// augmented covariance.
+    auto fullyFactored = Correction::SigmaPointsGen(
+        Correction::getAugmentedStateVec(data->state, kalmanMeas),
+        Correction::getAugmentedStateCov(data->state, kalmanMeas),
+        kalman::SigmaPointParameters());
+    CAPTURE(data->state.errorCovariance());
+    REQUIRE(inProgress.sigmaPoints.getSigmaPoints().isApprox(
+        fullyFactored.getSigmaPoints()));
+}
+
 enum class Axis : std::size_t { X = 0, Y = 1, Z = 2 };
 
 inline double zeroOrValueForAxis(Axis rotationAxis, Axis currentAxis,
@@ -0,0 +1,167 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "SlotMap.h"
+
+// Library/third-party includes
+#include <catch.hpp>
+
+// Standard includes
+#include <algorithm>
+#include <string>
+#include <vector>
+
+using osvr::vbtracker::SlotMap;
+using osvr::vbtracker::SlotMapHandle;
+using Map = SlotMap<std::string>;
+
+/// Checks that iteration visits exactly the expected elements, in any order.
+static void requireElements(Map const &map,
+                            std::vector<std::string> expected) {
+    std::vector<std::string> actual(map.begin(), map.end());
+    REQUIRE(actual.size() == map.size());
+    std::sort(actual.begin(), actual.end());
+    std::sort(expected.begin(), expected.end());
+    REQUIRE(actual == expected);
+}
+
+TEST_CASE("SlotMap handles", "[slotmap]") {
+    Map map;
+    REQUIRE(map.empty());
+    REQUIRE_FALSE(map.contains(SlotMapHandle{}));
+    REQUIRE(map.get(SlotMapHandle{}) == nullptr);
+
+    auto a = map.emplace("a");
+    auto b = map.emplace("b");
+    auto c = map.emplace("c");
+    REQUIRE(map.size() == 3);
+    REQUIRE(a.valid());
+    REQUIRE(a != b);
+    requireElements(map, {"a", "b", "c"});
+
+    SECTION("stale handles are rejected after erase") {
+        REQUIRE(map.erase(b));
+        REQUIRE_FALSE(map.contains(b));
+        REQUIRE(map.get(b) == nullptr);
+        REQUIRE_FALSE(map.erase(b));
+        REQUIRE(map.size() == 2);
+
+        AND_THEN("after the slot is reused") {
+            auto d = map.emplace("d");
+            /// Same slot, new generation.
+            REQUIRE(d.index() == b.index());
+            REQUIRE(d != b);
+            REQUIRE(map.contains(d));
+            REQUIRE_FALSE(map.contains(b));
+            REQUIRE(map.get(b) == nullptr);
+            REQUIRE_FALSE(map.erase(b));
+            REQUIRE(map[d] == "d");
+            requireElements(map, {"a", "c", "d"});
+        }
+    }
+
+    SECTION("handles survive other elements being erased or moved") {
+        /// Erasing the first element moves the last into its place.
+        REQUIRE(map.erase(a));
+        REQUIRE(map.contains(b));
+        REQUIRE(map.contains(c));
+        REQUIRE(map[b] == "b");
+        REQUIRE(map[c] == "c");
+        REQUIRE(*map.get(c) == "c");
+
+        auto d = map.emplace("d");
+        REQUIRE(map.erase(b));
+        REQUIRE(map[c] == "c");
+        REQUIRE(map[d] == "d");
+        requireElements(map, {"c", "d"});
+    }
+
+    SECTION("getHandle matches iteration order") {
+        REQUIRE(map.erase(a));
+        for (Map::size_type i = 0; i < map.size(); ++i) {
+            auto handle = map.getHandle(i);
+            REQUIRE(map.contains(handle));
+            REQUIRE(&map[handle] == &*(map.begin() + i));
+        }
+    }
+
+    SECTION("clear invalidates all handles") {
+        map.clear();
+        REQUIRE(map.empty());
+        REQUIRE(map.size() == 0);
+        REQUIRE(map.begin() == map.end());
+        for (auto const &handle : {a, b, c}) {
+            REQUIRE_FALSE(map.contains(handle));
+            REQUIRE(map.get(handle) == nullptr);
+            REQUIRE_FALSE(map.erase(handle));
+        }
+
+        AND_THEN("the map can be refilled") {
+            auto d = map.emplace("d");
+            auto e = map.emplace("e");
+            REQUIRE(map.size() == 2);
+            REQUIRE(map[d] == "d");
+            REQUIRE(map[e] == "e");
+            for (auto const &handle : {a, b, c}) {
+                REQUIRE_FALSE(map.contains(handle));
+            }
+            requireElements(map, {"d", "e"});
+        }
+    }
+}
+
+TEST_CASE("SlotMap emplace and erase keep size and iteration consistent",
+          "[slotmap]") {
+    Map map;
+    std::vector<SlotMapHandle> handles;
+    std::vector<std::string> expected;
+    /// Interleave insertions and erasures from the front, middle, and back.
+    for (int i = 0; i < 50; ++i) {
+        auto name = std::to_string(i);
+        handles.push_back(map.emplace(name));
+        expected.push_back(name);
+        if (i % 3 == 2) {
+            auto victim = (i / 3) % handles.size();
+            REQUIRE(map.erase(handles[victim]));
+            REQUIRE_FALSE(map.contains(handles[victim]));
+            handles.erase(handles.begin() + victim);
+            expected.erase(expected.begin() + victim);
+        }
+        REQUIRE(map.size() == expected.size());
+        requireElements(map, expected);
+        for (std::size_t j = 0; j < handles.size(); ++j) {
+            REQUIRE(map[handles[j]] == expected[j]);
+        }
+    }
+
+    while (!handles.empty()) {
+        REQUIRE(map.erase(handles.back()));
+        handles.pop_back();
+        expected.pop_back();
+        REQUIRE(map.size() == expected.size());
+        requireElements(map, expected);
+    }
+    REQUIRE(map.empty());
+}
@@ -164,10 +164,10 @@ namespace vbtracker {
     void TrackedBody::replaceStateSnapshot(
         osvr::util::time::TimeValue const &origTime,
         osvr::util::time::TimeValue const &newTime, BodyState const &newState) {
-#if !(defined(OSVR_UVBI_ASSUME_SINGLE_CAMERA) &&                               \
+#if !(defined(OSVR_UVBI_ASSUME_VIDEO_IN_TIMESTAMP_ORDER) &&                     \
       defined(OSVR_UVBI_ASSUME_CAMERA_ALWAYS_SLOWER))
 #error "Current code assumes that all we have to replay is IMU measurements."
-#endif // !(defined(OSVR_UVBI_ASSUME_SINGLE_CAMERA) &&
+#endif // !(defined(OSVR_UVBI_ASSUME_VIDEO_IN_TIMESTAMP_ORDER) &&
         // defined(OSVR_UVBI_ASSUME_CAMERA_ALWAYS_SLOWER))
 
         /// Clear off the state we're about to invalidate.
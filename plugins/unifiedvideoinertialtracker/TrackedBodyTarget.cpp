@@ -33,6 +33,7 @@
 #include "PoseEstimator_RANSACKalman.h"
 #include "PoseEstimator_SCAATKalman.h"
 #include "TrackedBody.h"
+#include "TransformBodyState.h"
 #include "cvToEigen.h"
 #include <osvr/Util/CSV.h>
 #include <osvr/Util/CSVCellGroup.h>
@@ -152,10 +153,34 @@ namespace vbtracker {
               blobFile("blobs.csv"), csv(blobFile)
 #endif // OSVR_UVBI_DUMP_BLOB_CSV
         {
+            cameraLeds.resize(1);
         }
+
+        /// LEDs are tracked in image space, so each camera needs its own.
+        struct CameraLeds {
+            LedGroup leds;
+            LedPtrList usableLeds;
+        };
+
+        CameraLeds &currentCameraLeds() {
+            return cameraLeds[currentCamera.value()];
+        }
+        CameraLeds const &currentCameraLeds() const {
+            return cameraLeds[currentCamera.value()];
+        }
+
+        /// Select the camera whose LEDs subsequent operations refer to.
+        void setCurrentCamera(CameraId camera) {
+            if (cameraLeds.size() <= camera.value()) {
+                cameraLeds.resize(camera.value() + 1);
+            }
+            currentCamera = camera;
+        }
+
         BodyTargetInterface bodyInterface;
-        LedGroup leds;
-        LedPtrList usableLeds;
+        /// Indexed by camera ID.
+        std::vector<CameraLeds> cameraLeds;
+        CameraId currentCamera = CameraId(0);
         LedIdentifierPtr identifier;
         RANSACPoseEstimator ransacEstimator;
         SCAATKalmanPoseEstimator kalmanEstimator;
@@ -269,7 +294,9 @@ namespace vbtracker {
         {
             /// Create the LED identifier
             std::unique_ptr<OsvrHdkLedIdentifier> identifier(
-                new OsvrHdkLedIdentifier(setupData.patterns));
+                new OsvrHdkLedIdentifier(
+                    setupData.patterns,
+                    getParams().tolerateSingleBitPatternErrors));
             m_impl->identifier = std::move(identifier);
         }
         m_verifyInvariants();
@@ -309,7 +336,8 @@ namespace vbtracker {
     }
 
     std::size_t TrackedBodyTarget::processLedMeasurements(
-        LedMeasurementVec const &undistortedLeds) {
+        LedMeasurementVec const &undistortedLeds, CameraId camera) {
+        m_impl->setCurrentCamera(camera);
         // std::list<LedMeasurement> measurements{begin(undistortedLeds),
         // end(undistortedLeds)};
         LedMeasurementVec measurements{undistortedLeds};
@@ -328,7 +356,7 @@ namespace vbtracker {
 
         const auto blobMoveThreshold = getParams().blobMoveThreshold;
         const auto blobsKeepIdentity = getParams().blobsKeepIdentity;
-        auto &myLeds = m_impl->leds;
+        auto &myLeds = leds();
 
         const auto prevLedCount = myLeds.size();
 
@@ -403,7 +431,7 @@ namespace vbtracker {
         // std::cout << "Had " << Leds.size() << " LEDs, " <<
         // keyPoints.size() << " new ones available" << std::endl;
         assignment.forEachUnclaimedMeasurement([&](LedMeasurement const &meas) {
-            myLeds.emplace_back(m_impl->identifier.get(), meas);
+            myLeds.emplace(m_impl->identifier.get(), meas);
         });
 
         /// Do the initial filtering of the LED group to just the identified
@@ -456,12 +484,19 @@ namespace vbtracker {
         CameraParameters const &camParams,
         osvr::util::time::TimeValue const &tv, BodyState &bodyState,
         osvr::util::time::TimeValue const &startingTime,
-        bool validStateAndTime) {
+        bool validStateAndTime, Eigen::Isometry3d const &cameraFromTracker) {
 
         /// Must pre/post correct the state by our offset :-/
         /// @todo make this state correction less hacky.
         bodyState.position() -= getStateCorrection();
 
+        /// The estimators work in the space of the camera that took the frame.
+        const bool otherCamera = !cameraFromTracker.isApprox(
+            Eigen::Isometry3d::Identity());
+        if (otherCamera) {
+            transformBodyState(bodyState, cameraFromTracker);
+        }
+
         /// Will we permit Kalman this estimation?
         bool permitKalman = m_impl->permitKalman && validStateAndTime;
 
@@ -547,7 +582,8 @@ namespace vbtracker {
             Eigen::Vector3d::Zero()};
         switch (m_impl->trackingState) {
         case TargetTrackingState::RANSAC: {
-            m_hasPoseEstimate = m_impl->ransacEstimator(params, usableLeds());
+            m_hasPoseEstimate =
+                m_impl->ransacEstimator(params, usableLeds(), tv);
             m_impl->lastFrameAlgorithm = TargetTrackingState::RANSAC;
             break;
         }
@@ -635,6 +671,10 @@ namespace vbtracker {
         /// Update our local target-specific timestamp
         m_impl->lastEstimate = tv;
 
+        if (otherCamera) {
+            transformBodyState(bodyState, cameraFromTracker.inverse());
+        }
+
         /// Corresponding post-correction.
         bodyState.position() += getStateCorrection();
 
@@ -752,10 +792,12 @@ namespace vbtracker {
         m_impl->trackingState = TargetTrackingState::RANSACKalman;
     }
 
-    LedGroup const &TrackedBodyTarget::leds() const { return m_impl->leds; }
+    LedGroup const &TrackedBodyTarget::leds() const {
+        return m_impl->currentCameraLeds().leds;
+    }
 
     LedPtrList const &TrackedBodyTarget::usableLeds() const {
-        return m_impl->usableLeds;
+        return m_impl->currentCameraLeds().usableLeds;
     }
 
     std::size_t TrackedBodyTarget::numTrackingResets() const {
@@ -788,13 +830,17 @@ namespace vbtracker {
         return 0.0;
     }
 
-    LedGroup &TrackedBodyTarget::leds() { return m_impl->leds; }
+    LedGroup &TrackedBodyTarget::leds() {
+        return m_impl->currentCameraLeds().leds;
+    }
 
-    LedPtrList &TrackedBodyTarget::usableLeds() { return m_impl->usableLeds; }
+    LedPtrList &TrackedBodyTarget::usableLeds() {
+        return m_impl->currentCameraLeds().usableLeds;
+    }
     void TrackedBodyTarget::updateUsableLeds() {
         auto &usable = usableLeds();
         usable.clear();
-        auto &leds = m_impl->leds;
+        auto &leds = this->leds();
         for (auto &led : leds) {
             if (!led.identified()) {
                 continue;
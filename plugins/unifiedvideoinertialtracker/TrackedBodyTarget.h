@@ -36,6 +36,7 @@
 // Library/third-party includes
 #include <boost/assert.hpp>
 #include <osvr/Kalman/PureVectorState.h>
+#include <osvr/Util/EigenCoreGeometry.h>
 #include <osvr/Util/TimeValue.h>
 
 // Standard includes
@@ -113,10 +114,16 @@ namespace vbtracker {
         /// Called each frame with the results of the blob finding and
         /// undistortion (part of the first phase of the tracking system)
         ///
+        /// @param camera The camera the frame came from: each camera has its
+        /// own set of LEDs, and this also selects the camera that leds(),
+        /// usableLeds(), and the pose estimation methods use until the next
+        /// call.
+        ///
         /// @return number of LED measurements/blobs used locally on existing
         /// LEDs.
         std::size_t
-        processLedMeasurements(LedMeasurementVec const &undistortedLeds);
+        processLedMeasurements(LedMeasurementVec const &undistortedLeds,
+                               CameraId camera = CameraId(0));
 
         /// Override configured setting, disabling Kalman (normal) operating
         /// mode.
@@ -128,11 +135,17 @@ namespace vbtracker {
 
         /// Update the pose estimate using the updated LEDs - part of the third
         /// phase of tracking.
+        ///
+        /// @param cameraFromTracker Transform from tracker space (that of the
+        /// primary camera, where the body state lives) to the space of the
+        /// camera that took the current frame.
         bool updatePoseEstimateFromLeds(
             CameraParameters const &camParams,
             osvr::util::time::TimeValue const &tv, BodyState &bodyState,
             osvr::util::time::TimeValue const &startingTime,
-            bool validStateAndTime);
+            bool validStateAndTime,
+            Eigen::Isometry3d const &cameraFromTracker =
+                Eigen::Isometry3d::Identity());
 
         /// Perform a simple RANSAC pose estimation from updated LEDs (third
         /// phase of tracking) without storing the results internally or
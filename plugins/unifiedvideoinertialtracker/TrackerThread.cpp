@@ -33,10 +33,12 @@
 #include "TrackedBodyTarget.h"
 
 // Library/third-party includes
+#include <boost/assert.hpp>
 #include <osvr/Util/EigenInterop.h>
 #include <osvr/Util/Finally.h>
 
 // Standard includes
+#include <algorithm>
 #include <future>
 #include <iostream>
 #include <type_traits>
@@ -48,26 +50,64 @@ namespace vbtracker {
     // 16 and even 32 was too small - we were dropping messages.
     static const uint32_t IMU_MESSAGE_QUEUE_SIZE = 64 + 1;
 
+    struct TrackerThread::CameraPipeline {
+        CameraPipeline(ImageSource &imageSource,
+                       CameraParameters const &params, CameraId cameraId)
+            : cam(imageSource), camParams(params), id(cameraId) {}
+        ImageSource &cam;
+        CameraParameters camParams;
+        CameraId id;
+        std::unique_ptr<ImageProcessingThread> imageProcThreadObj;
+        /// The thread used by timeConsumingImageStep()
+        std::thread imageThread;
+        /// Output of the image processing thread, in the order it was
+        /// captured (and thus in timestamp order), awaiting pose estimation.
+        std::deque<ImageOutputDataPtr> processedFrames;
+        /// When the image processing thread last delivered a frame.
+        our_clock::time_point lastFrameArrival;
+        /// Whether the frame merge has stopped waiting on this camera.
+        bool stale = false;
+    };
+
     TrackerThread::TrackerThread(TrackingSystem &trackingSystem,
                                  ImageSource &imageSource,
                                  BodyReportingVector &reportingVec,
                                  CameraParameters const &camParams,
                                  std::int32_t cameraUsecOffset, bool bufferImu,
-                                 bool debugData)
-        : m_trackingSystem(trackingSystem), m_cam(imageSource),
-          m_reportingVec(reportingVec), m_camParams(camParams),
+                                 bool debugData, std::size_t imagePipelineDepth)
+        : m_trackingSystem(trackingSystem), m_reportingVec(reportingVec),
           m_cameraUsecOffset(cameraUsecOffset), m_bufferImu(bufferImu),
-          m_debugData(debugData), m_imuMessages(IMU_MESSAGE_QUEUE_SIZE),
-          m_debugDataMessages(32) {
+          m_debugData(debugData),
+          m_imagePipelineDepth(std::max(imagePipelineDepth, std::size_t{1})),
+          m_imuMessages(IMU_MESSAGE_QUEUE_SIZE), m_debugDataMessages(32) {
+        m_cameras.emplace_back(
+            new CameraPipeline(imageSource, camParams, CameraId(0)));
         msg() << "Tracker thread object created." << std::endl;
+        if (m_imagePipelineDepth > 1) {
+            msg() << "Image pipeline depth: " << m_imagePipelineDepth
+                  << " frames" << std::endl;
+        }
     }
 
     TrackerThread::~TrackerThread() {
-        if (m_imageThread.joinable()) {
-            m_imageThread.join();
+        for (auto &camera : m_cameras) {
+            if (camera->imageThread.joinable()) {
+                camera->imageThread.join();
+            }
         }
     }
 
+    CameraId TrackerThread::addCamera(ImageSource &imageSource,
+                                      CameraParameters const &camParams) {
+        auto id = m_trackingSystem.addCamera();
+        BOOST_ASSERT_MSG(id.value() == m_cameras.size(),
+                         "Tracking system and tracker thread should agree on "
+                         "camera IDs!");
+        m_cameras.emplace_back(new CameraPipeline(imageSource, camParams, id));
+        msg() << "Added camera " << int(id.value()) << std::endl;
+        return id;
+    }
+
     void TrackerThread::permitStart() { m_startupSignal.set_value(); }
 
     void TrackerThread::threadAction() {
@@ -88,12 +128,33 @@ namespace vbtracker {
         m_numBodies = m_trackingSystem.getNumBodies();
         setupReportingVectorProcessModels();
 
-        /// Launch the image proc thread in a waiting state.
+        /// Launch an image proc thread for each camera in a waiting state.
+        for (auto &camera : m_cameras) {
+            camera->imageProcThreadObj.reset(new ImageProcessingThread{
+                m_trackingSystem, camera->cam, *this, camera->id,
+                camera->camParams, m_cameraUsecOffset,
+                m_imagePipelineDepth > 1});
+            auto &imageProcThreadObj = *camera->imageProcThreadObj;
+            camera->imageThread =
+                std::thread{[&] { imageProcThreadObj.threadAction(); }};
+        }
 
-        ImageProcessingThread imageProcThreadObj{
-            m_trackingSystem, m_cam, *this, m_camParams, m_cameraUsecOffset};
-        imageProcThreadObj_ = &imageProcThreadObj;
-        m_imageThread = std::thread{[&] { imageProcThreadObj.threadAction(); }};
+        /// Fill the pipeline: the image processing threads may now start on
+        /// as many frames as our depth permits. Each frame we finish with in
+        /// doFrame() permits another from the same camera.
+        {
+            /// Give each camera a full timeout to deliver its first frame.
+            std::lock_guard<std::mutex> lock{m_messageMutex};
+            auto now = our_clock::now();
+            for (auto &camera : m_cameras) {
+                camera->lastFrameArrival = now;
+            }
+        }
+        for (auto &camera : m_cameras) {
+            for (std::size_t i = 0; i < m_imagePipelineDepth; ++i) {
+                launchTimeConsumingImageStep(camera->id);
+            }
+        }
 
         msg() << "Tracker thread object entering its main execution loop."
               << std::endl;
@@ -128,13 +189,18 @@ namespace vbtracker {
 #endif
         msg() << "Tracker thread object: functor exiting." << std::endl;
 
-        if (!imageProcThreadObj.exiting()) {
-            msg() << "Telling image processing thread to exit." << std::endl;
-            imageProcThreadObj.signalExit();
+        for (auto &camera : m_cameras) {
+            if (!camera->imageProcThreadObj->exiting()) {
+                msg() << "Telling image processing thread to exit."
+                      << std::endl;
+                camera->imageProcThreadObj->signalExit();
+            }
         }
-        imageProcThreadObj_ = nullptr;
-        if (m_imageThread.joinable()) {
-            m_imageThread.join();
+        for (auto &camera : m_cameras) {
+            if (camera->imageThread.joinable()) {
+                camera->imageThread.join();
+            }
+            camera->imageProcThreadObj.reset();
         }
     }
 
@@ -175,20 +241,80 @@ namespace vbtracker {
         return m_debugDataMessages.read(data);
     }
 
-    void
-    TrackerThread::signalImageProcessingComplete(ImageOutputDataPtr &&imageData,
-                                                 cv::Mat const &frame,
-                                                 cv::Mat const &frameGray) {
-        m_imageData = std::move(imageData);
-        m_frame = frame;
-        m_frameGray = frameGray;
+    void TrackerThread::signalImageProcessingComplete(
+        CameraId camera, ImageOutputDataPtr &&imageData) {
         {
             std::lock_guard<std::mutex> lock{m_messageMutex};
-            m_timeConsumingImageStepComplete = true;
+            auto &pipeline = *m_cameras[camera.value()];
+            pipeline.processedFrames.emplace_back(std::move(imageData));
+            pipeline.lastFrameArrival = our_clock::now();
         }
         m_messageCondVar.notify_one();
     }
 
+    boost::optional<CameraId> TrackerThread::getNextFrameCamera() {
+        boost::optional<CameraId> ret;
+        util::time::TimeValue earliest;
+        bool waiting = false;
+        auto now = our_clock::now();
+        m_staleCheckTime = boost::none;
+        for (auto &camera : m_cameras) {
+            auto &frames = camera->processedFrames;
+            if (frames.empty()) {
+                if (camera->stale) {
+                    continue;
+                }
+                auto staleTime =
+                    camera->lastFrameArrival + CAMERA_STALE_TIMEOUT;
+                if (now < staleTime) {
+                    /// Can't know that anything else is next in timestamp
+                    /// order until this camera has delivered its next frame
+                    /// (or been silent for too long).
+                    waiting = true;
+                    if (!m_staleCheckTime || staleTime < *m_staleCheckTime) {
+                        m_staleCheckTime = staleTime;
+                    }
+                    continue;
+                }
+                camera->stale = true;
+                warn() << "Camera " << int(camera->id.value())
+                       << " has delivered no frames for "
+                       << CAMERA_STALE_TIMEOUT.count()
+                       << "ms: going on without it." << std::endl;
+                continue;
+            }
+            if (camera->stale) {
+                camera->stale = false;
+                msg() << "Camera " << int(camera->id.value())
+                      << " is delivering frames again." << std::endl;
+            }
+            if (!frames.front()) {
+                /// Failed frames carry no data, so can go at any time.
+                return camera->id;
+            }
+            auto &tv = frames.front()->tv;
+            if (m_lastFrameTv && tv < *m_lastFrameTv) {
+                /// We went on without this camera, and newer frames have
+                /// since been used: pass this one over like a failed frame,
+                /// to keep video in timestamp order.
+                warn() << "Camera " << int(camera->id.value())
+                       << " delivered a frame older than one already used: "
+                          "dropping it."
+                       << std::endl;
+                frames.front().reset();
+                return camera->id;
+            }
+            if (!ret || tv < earliest) {
+                ret = camera->id;
+                earliest = tv;
+            }
+        }
+        if (waiting) {
+            return boost::none;
+        }
+        return ret;
+    }
+
     std::ostream &TrackerThread::msg() const {
         return std::cout << "[UnifiedTracker] ";
     }
@@ -196,46 +322,46 @@ namespace vbtracker {
     std::ostream &TrackerThread::warn() const { return msg() << "Warning: "; }
 
     void TrackerThread::doFrame() {
-        // Check camera status.
-        if (!m_cam.ok()) {
-            // Hmm, camera seems bad. Might regain it? Skip for now...
-            warn() << "Camera is reporting it is not OK." << std::endl;
-            return;
-        }
-        // Trigger a grab.
-        if (!m_cam.grab()) {
-            // Again failing without quitting, in hopes we get better luck
-            // next time...
-            warn() << "Camera grab failed." << std::endl;
-            return;
-        }
-        // When we triggered the grab was a good guess of the time
-        // for the image before that got moved upstream into the ImageSource
-        // library.
-
-        /// Launch an asynchronous task to perform the image retrieval and
-        /// initial image processing.
-        launchTimeConsumingImageStep();
         if (m_bufferImu) {
             setImuOverrideClock();
         }
         /// only used if m_bufferImu
         UpdatedBodyIndices imuIndices;
 
+        ImageOutputDataPtr imageData;
+        CameraId camera;
         bool finishedImage = false;
         do {
 
             {
                 /// Wait for something to do (Completion of image, IMU reports)
                 std::unique_lock<std::mutex> lock(m_messageMutex);
-                m_messageCondVar.wait(lock, [&] {
-                    return m_timeConsumingImageStepComplete ||
-                           !m_imuMessages.isEmpty();
-                });
-                if (m_timeConsumingImageStepComplete) {
-                    /// Set a flag to get us out of this innermost loop - we'll
-                    /// finish up processing this frame and trigger another grab
-                    /// before we look at more IMU data.
+                boost::optional<CameraId> nextCamera;
+                auto ready = [&] {
+                    nextCamera = getNextFrameCamera();
+                    return nextCamera || !m_imuMessages.isEmpty();
+                };
+                while (!ready()) {
+                    if (m_staleCheckTime) {
+                        /// Wake up in time to stop waiting on a camera that
+                        /// has stopped delivering frames.
+                        m_messageCondVar.wait_until(lock, *m_staleCheckTime);
+                    } else {
+                        m_messageCondVar.wait(lock);
+                    }
+                }
+                if (nextCamera) {
+                    /// Take the oldest processed frame and set a flag to get us
+                    /// out of this innermost loop - we'll finish up processing
+                    /// this frame and permit another grab before we look at
+                    /// more IMU data.
+                    camera = *nextCamera;
+                    auto &frames = m_cameras[camera.value()]->processedFrames;
+                    imageData = std::move(frames.front());
+                    frames.pop_front();
+                    if (imageData) {
+                        m_lastFrameTv = imageData->tv;
+                    }
                     finishedImage = true;
                 }
                 // Otherwise we have some IMU reports to keep us busy in the
@@ -279,25 +405,22 @@ namespace vbtracker {
             }
         } while (!finishedImage);
 
-        // OK, once we get here, we know the timeConsumingImageStep is complete.
-        if (!m_frame.data || !m_frameGray.data) {
-            // but it ended early due to error.
-            warn() << "Camera retrieve appeared to fail: frames had null "
-                      "pointers!"
-                   << std::endl;
-            return;
-        }
+        /// However we leave this function, we're done with this frame's slot
+        /// in the pipeline, so the image processing thread may start another.
+        auto permitNextFrame =
+            util::finally([&] { launchTimeConsumingImageStep(camera); });
 
-        if (!m_imageData) {
-            // but it failed to set the pointer? this is very strange...
-            warn() << "Initial image processing failed somehow!" << std::endl;
+        // OK, once we get here, we know the timeConsumingImageStep is complete
+        // for this frame.
+        if (!imageData) {
+            // but it ended early due to error - the image processing thread
+            // has already warned about why.
             return;
         }
 
         // Submit initial image data to the tracking system.
         auto bodyIds =
-            m_trackingSystem.updateBodiesFromVideoData(std::move(m_imageData));
-        m_imageData.reset();
+            m_trackingSystem.updateBodiesFromVideoData(std::move(imageData));
 
         // Sort those body IDs so we can merge them with the body IDs from any
         // IMU messages we're about to process.
@@ -528,13 +651,9 @@ namespace vbtracker {
         }
     }
 
-    void TrackerThread::launchTimeConsumingImageStep() {
-        /// Our thread would be the only one reading or writing this flag at
-        /// this point, so it's OK now to write this without protection.
-        m_timeConsumingImageStepComplete = false;
-
-        /// Release the thread from waiting.
-        imageProcThreadObj_->signalDoFrame();
+    void TrackerThread::launchTimeConsumingImageStep(CameraId camera) {
+        /// Release the thread from waiting, for one more frame.
+        m_cameras[camera.value()]->imageProcThreadObj->signalDoFrame();
     }
 } // namespace vbtracker
 } // namespace osvr
@@ -39,6 +39,7 @@
 #include <opencv2/core/core.hpp> // for basic OpenCV types
 
 #include <boost/noncopyable.hpp>
+#include <boost/optional.hpp>
 #include <folly/ProducerConsumerQueue.h>
 #include <folly/sorted_vector_types.h>
 #include <osvr/TypePack/List.h>
@@ -47,17 +48,25 @@
 #include <array>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <future>
 #include <iosfwd>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <thread>
+#include <vector>
 
 namespace osvr {
 namespace vbtracker {
     static const std::chrono::milliseconds IMU_OVERRIDE_SPACING{2};
 
+    /// How long the merge of frames from several cameras waits on a camera
+    /// that has delivered nothing before going on without it.
+    static const std::chrono::milliseconds CAMERA_STALE_TIMEOUT{500};
+
     static const auto MAX_DEBUG_BEACONS = 34;
     static const auto DEBUG_ANALOGS_PER_BEACON = 6;
     static const auto DEBUG_ANALOGS_REQUIRED =
@@ -80,9 +89,22 @@ namespace vbtracker {
                       BodyReportingVector &reportingVec,
                       CameraParameters const &camParams,
                       std::int32_t cameraUsecOffset = 0, bool bufferImu = false,
-                      bool debugData = false);
+                      bool debugData = false,
+                      std::size_t imagePipelineDepth = 1);
         ~TrackerThread();
 
+        /// Adds an additional camera, to be used once its pose relative to the
+        /// primary camera (the one passed to the constructor) has been
+        /// calibrated. Must be called before permitStart().
+        ///
+        /// Frames from all cameras are merged in timestamp order before pose
+        /// estimation, so the slowest camera sets the pace - unless it
+        /// delivers nothing for CAMERA_STALE_TIMEOUT, in which case it is left
+        /// out of the merge until it does.
+        /// @return The ID of the camera in the tracking system.
+        CameraId addCamera(ImageSource &imageSource,
+                           CameraParameters const &camParams);
+
         /// Thread function-call operator: should be invoked by a lambda in a
         /// dedicated thread.
         void threadAction();
@@ -112,10 +134,10 @@ namespace vbtracker {
         /// @}
 
         /// Call from image processing thread to signal completion of frame
-        /// processing.
-        void signalImageProcessingComplete(ImageOutputDataPtr &&imageData,
-                                           cv::Mat const &frame,
-                                           cv::Mat const &frameGray);
+        /// processing. A null pointer indicates the frame could not be
+        /// grabbed, retrieved, or processed.
+        void signalImageProcessingComplete(CameraId camera,
+                                           ImageOutputDataPtr &&imageData);
 
       private:
         /// Helper providing a prefixed output stream for normal messages.
@@ -143,8 +165,15 @@ namespace vbtracker {
         void updateReportingVector(BodyId const bodyId);
 
         /// This function is responsible for triggering the image capture and
-        /// processing asynchronously in a separate thread.
-        void launchTimeConsumingImageStep();
+        /// processing asynchronously in a separate thread. Each call permits
+        /// one more frame from the given camera to enter the pipeline.
+        void launchTimeConsumingImageStep(CameraId camera);
+
+        /// Call with m_messageMutex held: if the next processed frame in
+        /// timestamp order (across all cameras that haven't gone stale) is
+        /// available, returns the camera it came from. Otherwise, sets
+        /// m_staleCheckTime to when a camera being waited on would go stale.
+        boost::optional<CameraId> getNextFrameCamera();
 
         std::pair<BodyId, ImuMessageCategory>
         processIMUMessage(IMUMessage const &m);
@@ -162,9 +191,7 @@ namespace vbtracker {
         void updateExtraIMUReports();
 
         TrackingSystem &m_trackingSystem;
-        ImageSource &m_cam;
         BodyReportingVector &m_reportingVec;
-        CameraParameters m_camParams;
         std::size_t m_numBodies = 0; //< initialized when loop started.
         const std::int32_t m_cameraUsecOffset = 0;
 
@@ -175,6 +202,12 @@ namespace vbtracker {
 
         const bool m_debugData = false;
 
+        /// How many frames may be in flight (being captured, processed, or
+        /// awaiting/undergoing pose estimation) at once. 1 means that the next
+        /// frame isn't grabbed until pose estimation for the current one is
+        /// done; larger values let the image processing thread work ahead.
+        const std::size_t m_imagePipelineDepth = 1;
+
         using our_clock = std::chrono::steady_clock;
 
         bool shouldSendImuReport() {
@@ -199,34 +232,35 @@ namespace vbtracker {
 
         bool m_setCameraPose = false;
 
-        /// @name Updated asynchronously by timeConsumingImageStep()
-        /// @{
-        cv::Mat m_frame;
-        cv::Mat m_frameGray;
-        ImageOutputDataPtr m_imageData;
-        /// @}
-
         /// @name Run flag
         /// @{
         std::mutex m_runMutex;
         bool m_run = true;
         /// @}
 
+        /// Image source, image processing thread, and queue of processed
+        /// frames for a single camera.
+        struct CameraPipeline;
+        /// Indexed by camera ID: the primary camera is first.
+        std::vector<std::unique_ptr<CameraPipeline>> m_cameras;
+
         /// @name Message queue for async image processing and receiving IMU
         /// reports from other threads.
         /// @{
         std::condition_variable m_messageCondVar;
+        /// Also protects the queues of processed frames in m_cameras.
         std::mutex m_messageMutex;
-        bool m_timeConsumingImageStepComplete = false;
         folly::ProducerConsumerQueue<IMUMessage> m_imuMessages;
+        /// When to stop waiting on a camera that hasn't delivered a frame, if
+        /// we're waiting on one. Protected by m_messageMutex.
+        boost::optional<our_clock::time_point> m_staleCheckTime;
+        /// Timestamp of the last frame taken for pose estimation, so frames
+        /// from a stale camera that arrive out of order can be passed over.
+        /// Protected by m_messageMutex.
+        boost::optional<util::time::TimeValue> m_lastFrameTv;
         /// @}
 
         folly::ProducerConsumerQueue<DebugArray> m_debugDataMessages;
-
-        ImageProcessingThread *imageProcThreadObj_ = nullptr;
-
-        /// The thread used by timeConsumingImageStep()
-        std::thread m_imageThread;
     };
 } // namespace vbtracker
 } // namespace osvr
@@ -464,7 +464,7 @@ namespace vbtracker {
             /// not our turn.
             return;
         }
-        auto &blobEx = impl.blobExtractor;
+        auto &blobEx = impl.primaryCamera().blobExtractor;
         /// Update the display
         switch (m_mode) {
         case DebugDisplayMode::InputImage:
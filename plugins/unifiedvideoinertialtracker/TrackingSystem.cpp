@@ -62,6 +62,17 @@ namespace vbtracker {
         return m_bodies.back().get();
     }
 
+    CameraId TrackingSystem::addCamera() {
+        auto newId = CameraId(
+            static_cast<CameraId::wrapped_type>(m_impl->cameras.size()));
+        m_impl->cameras.emplace_back(new TrackingCameraData(m_params));
+        return newId;
+    }
+
+    std::size_t TrackingSystem::getNumCameras() const {
+        return m_impl->cameras.size();
+    }
+
     TrackedBodyTarget *TrackingSystem::getTarget(BodyTargetId target) {
         return getBody(target.first).getTarget(target.second);
     }
@@ -73,15 +84,20 @@ namespace vbtracker {
 
     ImageOutputDataPtr TrackingSystem::performInitialImageProcessing(
         util::time::TimeValue const &tv, cv::Mat const &frame,
-        cv::Mat const &frameGray, CameraParameters const &camParams) {
+        cv::Mat const &frameGray, CameraParameters const &camParams,
+        CameraId camera) {
+        BOOST_ASSERT_MSG(isValidCameraId(camera),
+                         "Must pass a camera ID from addCamera()!");
 
         ImageOutputDataPtr ret(new ImageProcessingOutput);
         ret->tv = tv;
         ret->frame = frame;
         ret->frameGray = frameGray;
         ret->camParams = camParams.createUndistortedVariant();
+        ret->camera = camera;
         auto rawMeasurements =
-            m_impl->blobExtractor->extractBlobs(ret->frameGray);
+            m_impl->cameras[camera.value()]->blobExtractor->extractBlobs(
+                ret->frameGray);
         ret->ledMeasurements = undistortLeds(rawMeasurements, camParams);
         return ret;
     }
@@ -94,16 +110,19 @@ namespace vbtracker {
         updateCount.clear();
 
         /// Update our frame cache, since we're taking ownership of the image
-        /// data now.
-        m_impl->frame = imageData->frame;
-        m_impl->frameGray = imageData->frameGray;
+        /// data now. (The debug display only shows the primary camera.)
+        if (imageData->camera == CameraId(0)) {
+            m_impl->frame = imageData->frame;
+            m_impl->frameGray = imageData->frameGray;
+        }
         m_impl->camParams = imageData->camParams;
         m_impl->lastFrame = imageData->tv;
+        m_impl->lastCamera = imageData->camera;
 
         /// Go through each target and try to process the measurements.
         forEachTarget(*this, [&](TrackedBodyTarget &target) {
-            auto usedMeasurements =
-                target.processLedMeasurements(imageData->ledMeasurements);
+            auto usedMeasurements = target.processLedMeasurements(
+                imageData->ledMeasurements, imageData->camera);
             if (usedMeasurements != 0) {
                 updateCount[target.getQualifiedId()] = usedMeasurements;
             }
@@ -120,7 +139,9 @@ namespace vbtracker {
         updatePoseEstimates();
 
         /// Trigger debug display, if activated.
-        m_impl->triggerDebugDisplay(*this);
+        if (m_impl->lastCamera == CameraId(0)) {
+            m_impl->triggerDebugDisplay(*this);
+        }
 
         return m_updated;
     }
@@ -138,12 +159,23 @@ namespace vbtracker {
         }
     }
     void TrackingSystem::updatePoseEstimates() {
+        auto const camera = m_impl->lastCamera;
         if (!isRoomCalibrationComplete()) {
-            /// If we need calibration, we need calibration. Go get it done.
-            calibrationVideoPhaseThree();
+            if (camera == CameraId(0)) {
+                /// If we need calibration, we need calibration. Go get it done.
+                calibrationVideoPhaseThree();
+            }
+            /// Additional cameras must wait until the primary one is done.
             return;
         }
 
+        if (!haveCameraPose(camera)) {
+            /// An additional camera that we don't know the pose of yet.
+            additionalCameraCalibrationVideoPhaseThree();
+            return;
+        }
+
+        auto const &trackerToCamera = getTrackerToCamera(camera);
         auto const &updateCount = m_impl->updateCount;
         for (auto &bodyTargetWithMeasurements : updateCount) {
             auto targetPtr = getTarget(bodyTargetWithMeasurements.first);
@@ -160,7 +192,8 @@ namespace vbtracker {
             auto initialTime = stateTime;
 
             auto gotPose = target.updatePoseEstimateFromLeds(
-                m_impl->camParams, newTime, state, stateTime, validState);
+                m_impl->camParams, newTime, state, stateTime, validState,
+                trackerToCamera);
             if (gotPose) {
                 body.replaceStateSnapshot(initialTime, newTime, state);
 #if 0
@@ -208,6 +241,42 @@ namespace vbtracker {
         m_impl->calib.postCalibrationUpdate(*this);
     }
 
+    void TrackingSystem::additionalCameraCalibrationVideoPhaseThree() {
+        auto const camera = m_impl->lastCamera;
+        auto const &updateCount = m_impl->updateCount;
+        for (auto &bodyTargetWithMeasurements : updateCount) {
+            auto &bodyTargetId = bodyTargetWithMeasurements.first;
+            if (!m_impl->calib.wantAdditionalCameraData(*this, camera,
+                                                        bodyTargetId.first)) {
+                continue;
+            }
+            auto targetPtr = getTarget(bodyTargetId);
+            validateTargetPointerFromUpdateList(targetPtr);
+            auto &target = *targetPtr;
+            auto &body = target.getBody();
+
+            /// Get the tracker-space state of the body to compare against.
+            util::time::TimeValue stateTime = {};
+            BodyState state;
+            if (!body.getStateAtOrBefore(m_impl->lastFrame, stateTime,
+                                         state)) {
+                continue;
+            }
+            Eigen::Vector3d xlate;
+            Eigen::Quaterniond quat;
+            auto gotPose = target.uncalibratedRANSACPoseEstimateFromLeds(
+                m_impl->camParams, xlate, quat,
+                ROOM_CALIBRATION_SKIP_BRIGHTS_CUTOFF,
+                CALIBRATION_RANSAC_ITERATIONS);
+            if (gotPose) {
+                m_impl->calib.processAdditionalCameraData(camera, state, xlate,
+                                                          quat);
+            }
+        }
+
+        m_impl->calib.postAdditionalCameraCalibrationUpdate(*this, camera);
+    }
+
     void
     TrackingSystem::calibrationHandleIMUData(BodyId id,
                                              util::time::TimeValue const &tv,
@@ -217,17 +286,45 @@ namespace vbtracker {
     }
 
     void TrackingSystem::setCameraPose(Eigen::Isometry3d const &camPose) {
-        m_impl->haveCameraPose = true;
-        m_impl->cameraPose = camPose;
+        auto &primary = m_impl->primaryCamera();
+        primary.havePose = true;
+        primary.cameraPose = camPose;
         m_impl->cameraPoseInv = camPose.inverse();
     }
 
     bool TrackingSystem::haveCameraPose() const {
-        return m_impl->haveCameraPose;
+        return m_impl->primaryCamera().havePose;
     }
 
     Eigen::Isometry3d const &TrackingSystem::getCameraPose() const {
-        return m_impl->cameraPose;
+        return m_impl->primaryCamera().cameraPose;
+    }
+
+    bool TrackingSystem::haveCameraPose(CameraId camera) const {
+        return m_impl->cameras.at(camera.value())->havePose;
+    }
+
+    void TrackingSystem::setAdditionalCameraPose(
+        CameraId camera, Eigen::Isometry3d const &trackerFromCamera) {
+        BOOST_ASSERT_MSG(camera != CameraId(0),
+                         "The primary camera defines tracker space!");
+        BOOST_ASSERT_MSG(haveCameraPose(), "Additional camera poses can only "
+                                           "be set once the primary camera "
+                                           "pose is known!");
+        auto &cam = *m_impl->cameras.at(camera.value());
+        cam.havePose = true;
+        cam.trackerToCamera = trackerFromCamera.inverse();
+        cam.cameraPose = getCameraPose() * trackerFromCamera;
+    }
+
+    Eigen::Isometry3d const &
+    TrackingSystem::getCameraPose(CameraId camera) const {
+        return m_impl->cameras.at(camera.value())->cameraPose;
+    }
+
+    Eigen::Isometry3d const &
+    TrackingSystem::getTrackerToCamera(CameraId camera) const {
+        return m_impl->cameras.at(camera.value())->trackerToCamera;
     }
 
     Eigen::Isometry3d const &TrackingSystem::getRoomToCamera() const {
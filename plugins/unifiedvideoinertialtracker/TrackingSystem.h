@@ -58,6 +58,12 @@ namespace vbtracker {
         TrackingSystem(ConfigParams const &params);
         ~TrackingSystem();
         TrackedBody *createTrackedBody();
+
+        /// Registers an additional camera, returning its ID. The primary
+        /// camera, CameraId(0), always exists and defines tracker space; the
+        /// pose of each additional camera relative to it is learned during
+        /// operation once room calibration has completed.
+        CameraId addCamera();
         /// @}
 
         /// @name Runtime methods
@@ -65,9 +71,13 @@ namespace vbtracker {
         /// Perform the initial phase of image processing. This does not modify
         /// the bodies, so it can happen in parallel/background processing. It's
         /// also the most expensive, so that's handy.
+        ///
+        /// Safe to call for different cameras in parallel, but not for the
+        /// same camera.
         ImageOutputDataPtr performInitialImageProcessing(
             util::time::TimeValue const &tv, cv::Mat const &frame,
-            cv::Mat const &frameGray, CameraParameters const &camParams);
+            cv::Mat const &frameGray, CameraParameters const &camParams,
+            CameraId camera = CameraId(0));
         /// This is the second phase of the video-based tracking algorithm - the
         /// part that actually changes LED state.
         ///
@@ -95,6 +105,9 @@ namespace vbtracker {
         /// @param imageData Output from the first step - **please std::move()
         /// the output of the first step into this step.**
         ///
+        /// When using more than one camera, frames from all cameras must be
+        /// submitted in timestamp order.
+        ///
         /// @return A reference to a vector of body indices that were updated
         /// with this latest frame.
         BodyIndices const &
@@ -126,6 +139,10 @@ namespace vbtracker {
         }
         TrackedBodyTarget *getTarget(BodyTargetId target);
         TrackedBodyTarget const *getTarget(BodyTargetId target) const;
+        std::size_t getNumCameras() const;
+        bool isValidCameraId(CameraId camera) const {
+            return (!camera.empty()) && (camera.value() < getNumCameras());
+        }
         /// @}
 
         /// @todo refactor;
@@ -143,6 +160,26 @@ namespace vbtracker {
         /// room coordinate system to the camera coordinate system.
         Eigen::Isometry3d const &getRoomToCamera() const;
 
+        /// @name Additional cameras
+        /// @brief The no-argument camera pose methods above refer to the
+        /// primary camera.
+        /// @{
+        /// Is the pose of the given camera known? (Always false for
+        /// additional cameras until the primary camera's pose is known.)
+        bool haveCameraPose(CameraId camera) const;
+        /// Sets the pose of an additional camera in tracker space: the
+        /// transform from that camera's space to the primary camera's space.
+        /// Only valid once the primary camera pose has been set.
+        void setAdditionalCameraPose(CameraId camera,
+                                     Eigen::Isometry3d const &trackerFromCamera);
+        /// Gets the pose of the given camera in the room.
+        Eigen::Isometry3d const &getCameraPose(CameraId camera) const;
+        /// Gets the transform from tracker space (the space body states are
+        /// stored in) to the given camera's space - identity for the primary
+        /// camera.
+        Eigen::Isometry3d const &getTrackerToCamera(CameraId camera) const;
+        /// @}
+
         bool isRoomCalibrationComplete();
 
         /// private impl;
@@ -163,6 +200,11 @@ namespace vbtracker {
         /// calibration is incomplete.
         void calibrationVideoPhaseThree();
 
+        /// Alternate internals called by updatePoseEstimates() when room
+        /// calibration is complete, but the pose of the additional camera that
+        /// captured the frame isn't known yet.
+        void additionalCameraCalibrationVideoPhaseThree();
+
         using BodyPtr = std::unique_ptr<TrackedBody>;
         ConfigParams m_params;
 
@@ -36,13 +36,16 @@
 namespace osvr {
 namespace vbtracker {
 
-    TrackingSystem::Impl::Impl(ConfigParams const &params)
+    TrackingCameraData::TrackingCameraData(ConfigParams const &params)
         : blobExtractor(
-              makeBlobExtractor(params.blobParams, params.extractParams)),
-          debugDisplay(new TrackingDebugDisplay(params)),
+              makeBlobExtractor(params.blobParams, params.extractParams)) {}
+
+    TrackingSystem::Impl::Impl(ConfigParams const &params)
+        : cameraPoseInv(Eigen::Isometry3d::Identity()),
           calib(Eigen::Vector3d(params.cameraPosition), params.cameraIsForward),
-          cameraPose(Eigen::Isometry3d::Identity()),
-          cameraPoseInv(Eigen::Isometry3d::Identity()) {}
+          debugDisplay(new TrackingDebugDisplay(params)) {
+        cameras.emplace_back(new TrackingCameraData(params));
+    }
 
     TrackingSystem::Impl::~Impl() {
         // out line to break circular dep with this and the debug display.
@@ -40,11 +40,30 @@
 
 // Standard includes
 #include <memory>
+#include <vector>
 
 namespace osvr {
 namespace vbtracker {
     class TrackingDebugDisplay;
 
+    /// Per-camera data for TrackingSystem.
+    struct TrackingCameraData : private boost::noncopyable {
+        explicit TrackingCameraData(ConfigParams const &params);
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+        /// Each camera gets its own blob extractor, so cameras can have their
+        /// images processed in parallel.
+        BlobExtractorPtr blobExtractor;
+        /// For the primary camera, this tracks the room calibration status;
+        /// additional cameras also require their pose in tracker space.
+        bool havePose = false;
+        /// rTc - pose of this camera in the room.
+        Eigen::Isometry3d cameraPose = Eigen::Isometry3d::Identity();
+        /// Transform from tracker space to this camera's space: identity for
+        /// the primary camera.
+        Eigen::Isometry3d trackerToCamera = Eigen::Isometry3d::Identity();
+    };
+    using TrackingCameraDataPtr = std::unique_ptr<TrackingCameraData>;
+
     /// Private implementation structure for TrackingSystem
     struct TrackingSystem::Impl : private boost::noncopyable {
         Impl(ConfigParams const &params);
@@ -54,24 +73,30 @@ namespace vbtracker {
 
         /// @name Cached data from the ImageProcessingOutput updated in phase 2
         /// @{
-        /// Cached copy of the last grey frame
+        /// Cached copy of the last grey frame from the primary camera
         cv::Mat frame;
-        /// Cached copy of the last grey frame
+        /// Cached copy of the last grey frame from the primary camera
         cv::Mat frameGray;
         /// Cached copy of the last (undistorted) camera parameters to be used.
         CameraParameters camParams;
         util::time::TimeValue lastFrame;
+        /// The camera that captured the last frame.
+        CameraId lastCamera = CameraId(0);
         /// @}
         bool roomCalibCompleteCached = false;
 
-        bool haveCameraPose = false;
-        Eigen::Isometry3d cameraPose = Eigen::Isometry3d::Identity();
+        /// Inverse of the primary camera pose.
         Eigen::Isometry3d cameraPoseInv = Eigen::Isometry3d::Identity();
 
         RoomCalibration calib;
 
         LedUpdateCount updateCount;
-        BlobExtractorPtr blobExtractor;
+        /// One entry per camera: the primary camera is first.
+        std::vector<TrackingCameraDataPtr> cameras;
+        TrackingCameraData &primaryCamera() { return *cameras.front(); }
+        TrackingCameraData const &primaryCamera() const {
+            return *cameras.front();
+        }
         std::unique_ptr<TrackingDebugDisplay> debugDisplay;
     };
 
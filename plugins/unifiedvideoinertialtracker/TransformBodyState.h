@@ -0,0 +1,70 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_TransformBodyState_h_GUID_B1A8E858_28C6_418F_9C86_FAF07A62FC03
+#define INCLUDED_TransformBodyState_h_GUID_B1A8E858_28C6_418F_9C86_FAF07A62FC03
+
+// Internal Includes
+#include "ModelTypes.h"
+
+// Library/third-party includes
+#include <osvr/Util/EigenCoreGeometry.h>
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace vbtracker {
+    /// Re-expresses a body state, along with its error covariance, in another
+    /// coordinate system: for instance, from tracker (primary camera) space to
+    /// the space of an additional camera.
+    ///
+    /// @param state The state to transform in place.
+    /// @param xform Transform taking points from the state's current
+    /// coordinate system to the new one.
+    ///
+    /// The position is fully transformed; the incremental orientation,
+    /// velocity, and angular velocity are all expressed in the same (spatial)
+    /// frame as the position, so they, and the corresponding blocks of the
+    /// covariance, are just rotated.
+    inline void transformBodyState(BodyState &state,
+                                   Eigen::Isometry3d const &xform) {
+        using namespace kalman::pose_externalized_rotation;
+        const Eigen::Matrix3d rot = xform.rotation();
+        StateSquareMatrix jacobian = StateSquareMatrix::Zero();
+        for (int i = 0; i < 4; ++i) {
+            jacobian.block<3, 3>(3 * i, 3 * i) = rot;
+        }
+        StateVector x = jacobian * state.stateVector();
+        position(x) += xform.translation();
+        state.setStateVector(x);
+        state.setErrorCovariance(jacobian * state.errorCovariance() *
+                                 jacobian.transpose());
+        state.setQuaternion(Eigen::Quaterniond(rot) * state.getQuaternion());
+    }
+
+} // namespace vbtracker
+} // namespace osvr
+
+#endif // INCLUDED_TransformBodyState_h_GUID_B1A8E858_28C6_418F_9C86_FAF07A62FC03
@@ -29,13 +29,13 @@
 #include "BasicTypes.h"
 #include "ConfigParams.h"
 #include "Assumptions.h"
+#include "SlotMap.h"
 
 // Library/third-party includes
 #include <opencv2/features2d/features2d.hpp>
 
 // Standard includes
 #include <vector>
-#include <list>
 #include <string>
 #include <memory>
 #include <functional>
@@ -56,7 +56,11 @@ namespace vbtracker {
 
     typedef std::unique_ptr<LedIdentifier> LedIdentifierPtr;
 
-    typedef std::list<Led> LedGroup;
+    /// All LED objects for a target/camera: contiguous, with handles that
+    /// stay valid as others are added and removed each frame.
+    typedef SlotMap<Led> LedGroup;
+    /// Pointers into a LedGroup: only valid until LEDs are next added or
+    /// removed.
     using LedPtrList = std::vector<Led *>;
 
 } // namespace vbtracker
@@ -73,6 +73,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 // Anonymous namespace to avoid symbol collision
 namespace {
@@ -98,6 +99,7 @@ class UnifiedVideoInertialTracker : boost::noncopyable {
     OSVR_TrackerDeviceInterface m_tracker;
     OSVR_AnalogDeviceInterface m_analog;
     osvr::vbtracker::ImageSourcePtr m_source;
+    std::vector<osvr::vbtracker::ImageSourcePtr> m_additionalSources;
     cv::Mat m_frame;
     cv::Mat m_imageGray;
     TrackingSystemPtr m_trackingSystem;
@@ -111,6 +113,7 @@ class UnifiedVideoInertialTracker : boost::noncopyable {
     const std::int32_t m_angvelUsecOffset = 0;
     const bool m_continuousReporting;
     const bool m_debugData;
+    const std::size_t m_imagePipelineDepth;
     BodyReportingVector m_bodyReportingVector;
     std::unique_ptr<TrackerThread> m_trackerThreadManager;
     bool m_threadLoopStarted = false;
@@ -122,13 +125,16 @@ class UnifiedVideoInertialTracker : boost::noncopyable {
                                 osvr::vbtracker::ConfigParams params,
                                 TrackingSystemPtr &&trackingSystem)
         : m_source(std::move(source)),
+          m_additionalSources(openAdditionalCameras(params)),
           m_trackingSystem(std::move(trackingSystem)),
           m_additionalPrediction(params.additionalPrediction),
           m_camUsecOffset(params.cameraMicrosecondsOffset),
           m_oriUsecOffset(params.imu.orientationMicrosecondsOffset),
           m_angvelUsecOffset(params.imu.angularVelocityMicrosecondsOffset),
           m_continuousReporting(params.continuousReporting),
-          m_debugData(params.streamBeaconDebugInfo) {
+          m_debugData(params.streamBeaconDebugInfo),
+          m_imagePipelineDepth(
+              static_cast<std::size_t>(params.imagePipelineDepth)) {
         if (params.numThreads > 0) {
             // Set the number of threads for OpenCV to use.
             cv::setNumThreads(params.numThreads);
@@ -310,6 +316,38 @@ class UnifiedVideoInertialTracker : boost::noncopyable {
 
     OSVR_ReturnCode update();
 
+    static std::vector<osvr::vbtracker::ImageSourcePtr>
+    openAdditionalCameras(osvr::vbtracker::ConfigParams const &params) {
+        std::vector<osvr::vbtracker::ImageSourcePtr> ret;
+        for (auto const &camParams : params.additionalCameras) {
+            osvr::vbtracker::ImageSourcePtr cam;
+            if (camParams.opencvIndex >= 0) {
+                cam = osvr::vbtracker::openOpenCVCamera(camParams.opencvIndex);
+            } else {
+#ifdef _WIN32
+                std::cerr << "Opening additional cameras by serial number is "
+                             "not supported on this platform: use "
+                             "opencvIndex instead. Skipping camera "
+                          << camParams.serialNumber << std::endl;
+                continue;
+#else  // !_WIN32
+                const int vendor_id = 0x0bda;
+                const int product_id = 0x57e8;
+                cam = osvr::vbtracker::openUVCCamera(
+                    vendor_id, product_id, camParams.serialNumber.c_str());
+#endif // _WIN32
+            }
+            if (!cam || !cam->ok()) {
+                std::cerr << "Could not access an additional tracking camera, "
+                             "skipping it!"
+                          << std::endl;
+                continue;
+            }
+            ret.emplace_back(std::move(cam));
+        }
+        return ret;
+    }
+
     void startTrackerThread() {
         if (m_trackerThreadManager) {
             throw std::logic_error("Trying to start the tracker thread when "
@@ -319,7 +357,11 @@ class UnifiedVideoInertialTracker : boost::noncopyable {
         m_trackerThreadManager.reset(new TrackerThread(
             *m_trackingSystem, *m_source, m_bodyReportingVector,
             osvr::vbtracker::getHDKCameraParameters(), m_camUsecOffset,
-            !m_continuousReporting, m_debugData));
+            !m_continuousReporting, m_debugData, m_imagePipelineDepth));
+        for (auto &source : m_additionalSources) {
+            m_trackerThreadManager->addCamera(
+                *source, osvr::vbtracker::getHDKCameraParameters());
+        }
 
         /// This will start the thread, but it won't enter its full main loop
         /// until we call permitStart()
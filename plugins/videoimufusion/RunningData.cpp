@@ -70,7 +70,8 @@ VideoIMUFusion::RunningData::RunningData(
       m_cameraMeasPos(Vector<3>::Zero(),
                       Vector<3>::Constant(params.videoPosVariance)),
 #endif
-      m_rTc(rTc), m_last(lastTS) {
+      m_rTc(rTc), m_last(lastTS), m_orientationTime(lastTS),
+      m_angVelTime(lastTS), m_positionTime(lastTS) {
 
 #ifdef OSVR_FPE
     FPExceptionEnabler fpe;
@@ -91,6 +91,10 @@ class VideoIMUFusion::RunningData {
     /// Returns true if we succeeded and can filter in some data.
     bool preReport(const OSVR_TimeValue &timestamp);
 
+    /// Timestamp of the newest measurement applied: what the current state
+    /// estimate corresponds to, even if the most recent report was a late one.
+    OSVR_TimeValue const &getLatestTime() const { return m_last; }
+
     Eigen::Quaterniond getOrientation() const {
         return state().getQuaternion();
     }
@@ -105,6 +109,14 @@ class VideoIMUFusion::RunningData {
     }
 
   private:
+    /// Each state field just takes the newest value reported for it, so a
+    /// late report only matters if it's still the newest for its own field.
+    ///
+    /// Returns true (after calling preReport()) if a report at timestamp is
+    /// newer than the one the field was last set from, updating fieldTime.
+    bool takeIfNewer(OSVR_TimeValue &fieldTime,
+                     const OSVR_TimeValue &timestamp);
+
     FilterState &state() { return m_state; }
     FilterState const &state() const { return m_state; }
     ProcessModel &processModel() { return m_processModel; }
@@ -119,6 +131,12 @@ class VideoIMUFusion::RunningData {
 #endif
     const Eigen::Isometry3d m_rTc;
     OSVR_TimeValue m_last;
+    /// @name Timestamps of the reports each state field was last set from
+    /// @{
+    OSVR_TimeValue m_orientationTime;
+    OSVR_TimeValue m_angVelTime;
+    OSVR_TimeValue m_positionTime;
+    /// @}
 };
 
 #endif // INCLUDED_RunningData_h_GUID_6B3479E5_9D56_4BA9_DEC0_84AF53842168
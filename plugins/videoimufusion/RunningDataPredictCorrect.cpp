@@ -42,17 +42,33 @@ namespace ei = osvr::util::eigen_interop;
 
 void VideoIMUFusion::RunningData::handleIMUReport(
     const OSVR_TimeValue &timestamp, const OSVR_OrientationReport &report) {
-    state().setQuaternion(ei::map(report.rotation));
+    if (takeIfNewer(m_orientationTime, timestamp)) {
+        state().setQuaternion(ei::map(report.rotation));
+    }
 }
 
 void VideoIMUFusion::RunningData::handleIMUVelocity(
     const OSVR_TimeValue &timestamp, const Eigen::Vector3d &angVel) {
-    state().angularVelocity() = angVel;
+    if (takeIfNewer(m_angVelTime, timestamp)) {
+        state().angularVelocity() = angVel;
+    }
 }
 
 void VideoIMUFusion::RunningData::handleVideoTrackerReport(
     const OSVR_TimeValue &timestamp, const OSVR_PoseReport &report) {
-    state().position() = takeCameraPoseToRoom(report.pose).translation();
+    if (takeIfNewer(m_positionTime, timestamp)) {
+        state().position() = takeCameraPoseToRoom(report.pose).translation();
+    }
+}
+
+bool VideoIMUFusion::RunningData::takeIfNewer(OSVR_TimeValue &fieldTime,
+                                              const OSVR_TimeValue &timestamp) {
+    if (duration(timestamp, fieldTime) < 0) {
+        // Arrived after a newer report for the same field: superseded.
+        return false;
+    }
+    fieldTime = timestamp;
+    return preReport(timestamp);
 }
 
 /// Returns true if we succeeded and can filter in some data.
@@ -0,0 +1,142 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "VideoIMUFusion.h"
+#include <osvr/Util/EigenInterop.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <cmath>
+
+namespace ei = osvr::util::eigen_interop;
+using osvr::util::time::TimeValue;
+
+/// @brief Timestamp a given number of seconds after some starting time.
+static TimeValue at(TimeValue const &start, double seconds) {
+    TimeValue ret = start;
+    auto usec = static_cast<OSVR_TimeValue_Microseconds>(seconds * 1.e6);
+    ret.seconds += usec / 1000000;
+    ret.microseconds += usec % 1000000;
+    osvrTimeValueNormalize(&ret);
+    return ret;
+}
+
+static OSVR_OrientationReport orientationReport(double angle) {
+    OSVR_OrientationReport ret;
+    ret.sensor = 0;
+    ei::map(ret.rotation) =
+        Eigen::Quaterniond(Eigen::AngleAxisd(angle, Eigen::Vector3d::UnitY()));
+    return ret;
+}
+
+static OSVR_PoseReport videoReport(double z) {
+    OSVR_PoseReport ret;
+    ret.sensor = 0;
+    ei::map(ret.pose).rotation() = Eigen::Quaterniond::Identity();
+    ei::map(ret.pose).translation() = Eigen::Vector3d(0.1, 0.05, z);
+    return ret;
+}
+
+class FusionOutOfOrder : public ::testing::Test {
+  public:
+    FusionOutOfOrder() : start(osvr::util::time::getNow()) {
+        startUp(inOrder);
+        startUp(late);
+    }
+
+    /// Feeds a still video pose and IMU orientation until fusion enters its
+    /// running state, leaving the timestamps before start + 1s.
+    void startUp(VideoIMUFusion &fusion) {
+        auto ori = orientationReport(0);
+        for (int i = 1; i <= 50 && !fusion.running(); ++i) {
+            auto tv = at(start, i * 0.01);
+            fusion.handleIMUData(tv, ori);
+            fusion.handleVideoTrackerDataDuringStartup(tv, videoReport(-1.),
+                                                       ori.rotation);
+        }
+        ASSERT_TRUE(fusion.running());
+    }
+
+    void expectSamePose() {
+        auto const &expected = inOrder.getLatestPose();
+        auto const &actual = late.getLatestPose();
+        EXPECT_TRUE(ei::map(expected).translation().isApprox(
+            ei::map(actual).translation()));
+        EXPECT_TRUE(ei::map(expected).rotation().quat().isApprox(
+            ei::map(actual).rotation().quat()));
+        EXPECT_EQ(inOrder.getLatestTime(), late.getLatestTime());
+    }
+
+    TimeValue start;
+    VideoIMUFusion inOrder;
+    VideoIMUFusion late;
+};
+
+TEST_F(FusionOutOfOrder, LateVideoAfterNewerIMU) {
+    // In order: IMU, video, IMU, IMU.
+    inOrder.handleIMUData(at(start, 1.0), orientationReport(0.1));
+    inOrder.handleVideoTrackerDataWhileRunning(at(start, 1.05),
+                                               videoReport(-1.2));
+    inOrder.handleIMUData(at(start, 1.1), orientationReport(0.2));
+    inOrder.handleIMUData(at(start, 1.2), orientationReport(0.3));
+
+    // The video report shows up only after the newer IMU samples.
+    late.handleIMUData(at(start, 1.0), orientationReport(0.1));
+    late.handleIMUData(at(start, 1.1), orientationReport(0.2));
+    late.handleIMUData(at(start, 1.2), orientationReport(0.3));
+    auto beforeVideo = late.getLatestPose();
+    late.handleVideoTrackerDataWhileRunning(at(start, 1.05),
+                                            videoReport(-1.2));
+
+    expectSamePose();
+    EXPECT_EQ(at(start, 1.2), late.getLatestTime())
+        << "A late report must not move the output time backwards";
+    EXPECT_FALSE(ei::map(beforeVideo).translation().isApprox(
+        ei::map(late.getLatestPose()).translation()))
+        << "The late video report is still the newest position, so it must "
+           "be used";
+    EXPECT_TRUE(ei::map(beforeVideo).rotation().quat().isApprox(
+        ei::map(late.getLatestPose()).rotation().quat()))
+        << "Newer IMU orientation must not be disturbed";
+}
+
+TEST_F(FusionOutOfOrder, SupersededReportsIgnored) {
+    inOrder.handleVideoTrackerDataWhileRunning(at(start, 1.1),
+                                               videoReport(-1.3));
+    inOrder.handleIMUData(at(start, 1.2), orientationReport(0.3));
+
+    late.handleVideoTrackerDataWhileRunning(at(start, 1.1),
+                                            videoReport(-1.3));
+    late.handleIMUData(at(start, 1.2), orientationReport(0.3));
+    // Both older than what has already been applied to the same fields.
+    late.handleVideoTrackerDataWhileRunning(at(start, 1.05),
+                                            videoReport(-1.2));
+    late.handleIMUData(at(start, 1.15), orientationReport(0.2));
+
+    expectSamePose();
+}
@@ -113,7 +113,7 @@ void VideoIMUFusion::handleIMUData(const OSVR_TimeValue &timestamp,
     m_runningData->handleIMUReport(timestamp, report);
 
     // send a pose report
-    updateFusedOutput(timestamp);
+    updateFusedOutput();
 }
 void VideoIMUFusion::handleIMUVelocity(const OSVR_TimeValue &timestamp,
                                        const Eigen::Vector3d &angVel) {
@@ -135,10 +135,10 @@ void VideoIMUFusion::handleIMUVelocity(const OSVR_TimeValue &timestamp,
     }
     m_runningData->handleIMUVelocity(timestamp, angVel);
     // send a pose report
-    updateFusedOutput(timestamp);
+    updateFusedOutput();
 }
 
-void VideoIMUFusion::updateFusedOutput(const OSVR_TimeValue &timestamp) {
+void VideoIMUFusion::updateFusedOutput() {
     Eigen::Isometry3d initialPose =
         Eigen::Translation3d(m_runningData->getPosition() +
                              Eigen::Vector3d::UnitY() * m_params.eyeHeight) *
@@ -147,7 +147,9 @@ void VideoIMUFusion::updateFusedOutput(const OSVR_TimeValue &timestamp) {
     ei::map(m_lastPose).rotation() = Eigen::Quaterniond(transformed.rotation());
     ei::map(m_lastPose).translation() =
         Eigen::Vector3d(transformed.translation());
-    m_lastTime = timestamp;
+    // A late report only changes the fields it's still the newest for, so the
+    // state is still as of the newest measurement.
+    m_lastTime = m_runningData->getLatestTime();
 }
 
 void VideoIMUFusion::handleVideoTrackerDataWhileRunning(
@@ -157,7 +159,7 @@ void VideoIMUFusion::handleVideoTrackerDataWhileRunning(
     // Pass this along to the filter
     m_runningData->handleVideoTrackerReport(timestamp, report);
 
-    updateFusedOutput(timestamp);
+    updateFusedOutput();
     // For debugging, we will output a second sensor that is just the
     // video tracker data re-oriented.
     Eigen::Isometry3d videoPose =
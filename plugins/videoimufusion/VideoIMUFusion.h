@@ -113,7 +113,7 @@ class VideoIMUFusion {
                            const OSVR_TimeValue &timestamp,
                            const OSVR_PoseReport &report,
                            const OSVR_OrientationState &orientation);
-    void updateFusedOutput(const OSVR_TimeValue &timestamp);
+    void updateFusedOutput();
     enum class State {
         /// We do not yet know the relative pose of the camera
         AcquiringCameraPose,
@@ -24,6 +24,7 @@
 
 // Internal Includes
 #include "EdgeHoleBasedLedExtractor.h"
+#include "FusedEdgeDetector.h"
 #include "OptionalStream.h"
 #include "cvUtils.h"
 
@@ -71,6 +72,11 @@ namespace vbtracker {
 #ifdef OSVR_OPENCV_2
         compressionArtifactRemoval_ = cv::createMorphologyFilter(
             cv::MORPH_ERODE, CV_8U, compressionArtifactRemovalKernel_);
+#endif
+#if !OSVR_EDGEHOLE_UMAT
+        if (FusedEdgeDetector::canHandle(extParams_)) {
+            fusedEdgeDetector_.reset(new FusedEdgeDetector(extParams_));
+        }
 #endif
     }
 #ifdef OSVR_UVBI_CORE
@@ -108,6 +114,15 @@ namespace vbtracker {
         minBeaconCenterVal_ =
             static_cast<std::uint8_t>(thresholdInfo.minThreshold);
 
+#if !OSVR_EDGEHOLE_UMAT
+        if (fusedEdgeDetector_ &&
+            fusedEdgeDetector_->apply(gray_, edge_, edgeBinary_)) {
+            /// Blur, edge detection, and thresholding all done in one pass.
+            extractBlobsFromEdges(p);
+            return measurements_;
+        }
+#endif
+
         /// Used to do basic thresholding here first to reduce background noise,
         /// but turns out that actually produced worse results at the end of the
         /// process (presumably by producing very sharp edges)
@@ -152,6 +167,11 @@ namespace vbtracker {
                           cv::THRESH_BINARY);
         }
 
+        extractBlobsFromEdges(p);
+        return measurements_;
+    }
+
+    void EdgeHoleBasedLedExtractor::extractBlobsFromEdges(BlobParams const &p) {
         /// Extract beacons from the edge detection image
 
         // The lambda ("continuation") is called with each "hole" in the edge
@@ -163,7 +183,6 @@ namespace vbtracker {
         consumeHolesOfConnectedComponents(
             binTemp_, contoursTempStorage_, hierarchyTempStorage_,
             [&](ContourType &&contour) { checkBlob(std::move(contour), p); });
-        return measurements_;
     }
     /// out of line for unique_ptr-based pimpl.
     EdgeHoleBasedLedExtractor::~EdgeHoleBasedLedExtractor() = default;
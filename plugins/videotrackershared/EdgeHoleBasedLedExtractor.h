@@ -63,8 +63,9 @@
 
 namespace osvr {
 namespace vbtracker {
-    /// forward declaration
+    /// forward declarations
     class RealtimeLaplacian;
+    class FusedEdgeDetector;
 
     enum class RejectReason { Area, CenterPointValue, Circularity, Convexity };
     class EdgeHoleBasedLedExtractor {
@@ -116,6 +117,8 @@ namespace vbtracker {
             return input;
         }
 #endif
+        /// Find the holes in edgeBinary_ and check them as potential LEDs.
+        void extractBlobsFromEdges(BlobParams const &p);
         void checkBlob(ContourType &&contour, BlobParams const &p);
         void addToRejectList(ContourId id, RejectReason reason,
                              BlobData const &data) {
@@ -162,6 +165,12 @@ namespace vbtracker {
         std::unique_ptr<RealtimeLaplacian> laplacianImpl_;
 #endif
 
+#if !OSVR_EDGEHOLE_UMAT
+        /// Single-pass replacement for the separate blur, edge detection, and
+        /// threshold steps: null if it can't handle our parameters.
+        std::unique_ptr<FusedEdgeDetector> fusedEdgeDetector_;
+#endif
+
         ContourList contours_;
         LedMeasurementVec measurements_;
         RejectList rejectList_;
@@ -0,0 +1,368 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "FusedEdgeDetector.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+/// Define OSVR_FUSED_EDGE_NO_SIMD to build only the scalar row kernels, for
+/// testing them on a machine that would otherwise use SSE2 or AVX2.
+#if defined(OSVR_FUSED_EDGE_NO_SIMD)
+// scalar kernels only
+#elif defined(__AVX2__)
+#define OSVR_FUSED_EDGE_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) ||                                  \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OSVR_FUSED_EDGE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace osvr {
+namespace vbtracker {
+    /// Largest Laplacian scale for which the intermediate values of the
+    /// Laplacian row kernel still fit in 16-bit signed integers.
+    static const int MAX_FUSED_LAPLACIAN_SCALE = 16;
+
+    /// The row kernels. Parameters described as "padded" point to the element
+    /// before the first pixel of the row: the kernels read one element past
+    /// each end of those rows.
+    namespace {
+        using std::uint8_t;
+        using std::uint16_t;
+
+        /// Fill in the padding of a row padded by one element on each end,
+        /// reflecting about the end pixels like OpenCV's BORDER_DEFAULT
+        /// (BORDER_REFLECT_101).
+        template <typename T> inline void padRow(T *padded, int width) {
+            padded[0] = padded[2];
+            padded[width + 1] = padded[width - 1];
+        }
+
+        /// out = a + 2 b + c: the vertical pass of a 3x3 Gaussian blur.
+        inline void verticalSum(uint8_t const *a, uint8_t const *b,
+                                uint8_t const *c, uint16_t *out, int width) {
+            int x = 0;
+#if defined(OSVR_FUSED_EDGE_AVX2)
+            for (; x + 16 <= width; x += 16) {
+                auto load = [&](uint8_t const *p) {
+                    return _mm256_cvtepu8_epi16(_mm_loadu_si128(
+                        reinterpret_cast<__m128i const *>(p + x)));
+                };
+                __m256i sum = _mm256_add_epi16(
+                    _mm256_add_epi16(load(a), load(c)),
+                    _mm256_slli_epi16(load(b), 1));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + x), sum);
+            }
+#elif defined(OSVR_FUSED_EDGE_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            for (; x + 16 <= width; x += 16) {
+                auto load = [&](uint8_t const *p) {
+                    return _mm_loadu_si128(
+                        reinterpret_cast<__m128i const *>(p + x));
+                };
+                __m128i va = load(a);
+                __m128i vb = load(b);
+                __m128i vc = load(c);
+                __m128i lo = _mm_add_epi16(
+                    _mm_add_epi16(_mm_unpacklo_epi8(va, zero),
+                                  _mm_unpacklo_epi8(vc, zero)),
+                    _mm_slli_epi16(_mm_unpacklo_epi8(vb, zero), 1));
+                __m128i hi = _mm_add_epi16(
+                    _mm_add_epi16(_mm_unpackhi_epi8(va, zero),
+                                  _mm_unpackhi_epi8(vc, zero)),
+                    _mm_slli_epi16(_mm_unpackhi_epi8(vb, zero), 1));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + x), lo);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + x + 8), hi);
+            }
+#endif
+            for (; x < width; ++x) {
+                out[x] = static_cast<uint16_t>(a[x] + 2 * b[x] + c[x]);
+            }
+        }
+
+        /// The horizontal pass of a 3x3 Gaussian blur, with the same rounding
+        /// as OpenCV's fixed-point 8-bit implementation.
+        ///
+        /// @param sum Padded vertical sums.
+        /// @param threshold If non-negative, the output is instead binarized:
+        /// 255 where the blurred value is greater than this, 0 elsewhere.
+        inline void horizontalBlur(uint16_t const *sum, uint8_t *out,
+                                   int width, int threshold = -1) {
+            int x = 0;
+#if defined(OSVR_FUSED_EDGE_AVX2) || defined(OSVR_FUSED_EDGE_SSE2)
+            const __m128i thresh =
+                _mm_set1_epi8(static_cast<char>(threshold + 1));
+#endif
+#if defined(OSVR_FUSED_EDGE_AVX2)
+            const __m256i rounding = _mm256_set1_epi16(8);
+            for (; x + 16 <= width; x += 16) {
+                auto load = [&](int offset) {
+                    return _mm256_loadu_si256(
+                        reinterpret_cast<__m256i const *>(sum + x + offset));
+                };
+                __m256i blurred = _mm256_srli_epi16(
+                    _mm256_add_epi16(
+                        _mm256_add_epi16(load(0), load(2)),
+                        _mm256_add_epi16(_mm256_slli_epi16(load(1), 1),
+                                         rounding)),
+                    4);
+                __m128i result =
+                    _mm_packus_epi16(_mm256_castsi256_si128(blurred),
+                                     _mm256_extracti128_si256(blurred, 1));
+                if (threshold >= 0) {
+                    result = _mm_cmpeq_epi8(_mm_max_epu8(result, thresh),
+                                            result);
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + x), result);
+            }
+#elif defined(OSVR_FUSED_EDGE_SSE2)
+            const __m128i rounding = _mm_set1_epi16(8);
+            for (; x + 16 <= width; x += 16) {
+                auto blur8 = [&](int start) {
+                    auto load = [&](int offset) {
+                        return _mm_loadu_si128(
+                            reinterpret_cast<__m128i const *>(sum + start +
+                                                              offset));
+                    };
+                    return _mm_srli_epi16(
+                        _mm_add_epi16(
+                            _mm_add_epi16(load(0), load(2)),
+                            _mm_add_epi16(_mm_slli_epi16(load(1), 1),
+                                          rounding)),
+                        4);
+                };
+                __m128i result = _mm_packus_epi16(blur8(x), blur8(x + 8));
+                if (threshold >= 0) {
+                    result = _mm_cmpeq_epi8(_mm_max_epu8(result, thresh),
+                                            result);
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + x), result);
+            }
+#endif
+            for (; x < width; ++x) {
+                auto blurred = (sum[x] + 2 * sum[x + 1] + sum[x + 2] + 8) >> 4;
+                if (threshold >= 0) {
+                    out[x] = blurred > threshold ? 255 : 0;
+                } else {
+                    out[x] = static_cast<uint8_t>(blurred);
+                }
+            }
+        }
+
+        /// The 3x3 Laplacian (OpenCV's kernel for ksize 3: 2 in the corners,
+        /// -8 in the center), scaled and saturated to 8 bits.
+        ///
+        /// @param above Padded row above
+        /// @param center Padded center row
+        /// @param below Padded row below
+        inline void laplacian(uint8_t const *above, uint8_t const *center,
+                              uint8_t const *below, uint8_t *out, int width,
+                              int scale) {
+            int x = 0;
+#if defined(OSVR_FUSED_EDGE_AVX2)
+            const __m256i cornerWeight = _mm256_set1_epi16(
+                static_cast<short>(2 * scale));
+            const __m256i centerWeight = _mm256_set1_epi16(
+                static_cast<short>(8 * scale));
+            for (; x + 16 <= width; x += 16) {
+                auto load = [&](uint8_t const *p) {
+                    return _mm256_cvtepu8_epi16(_mm_loadu_si128(
+                        reinterpret_cast<__m128i const *>(p + x)));
+                };
+                __m256i corners = _mm256_add_epi16(
+                    _mm256_add_epi16(load(above), load(above + 2)),
+                    _mm256_add_epi16(load(below), load(below + 2)));
+                __m256i result = _mm256_sub_epi16(
+                    _mm256_mullo_epi16(corners, cornerWeight),
+                    _mm256_mullo_epi16(load(center + 1), centerWeight));
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i *>(out + x),
+                    _mm_packus_epi16(_mm256_castsi256_si128(result),
+                                     _mm256_extracti128_si256(result, 1)));
+            }
+#elif defined(OSVR_FUSED_EDGE_SSE2)
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i cornerWeight =
+                _mm_set1_epi16(static_cast<short>(2 * scale));
+            const __m128i centerWeight =
+                _mm_set1_epi16(static_cast<short>(8 * scale));
+            for (; x + 16 <= width; x += 16) {
+                auto load = [&](uint8_t const *p) {
+                    return _mm_loadu_si128(
+                        reinterpret_cast<__m128i const *>(p + x));
+                };
+                __m128i a0 = load(above);
+                __m128i a2 = load(above + 2);
+                __m128i b0 = load(below);
+                __m128i b2 = load(below + 2);
+                __m128i c = load(center + 1);
+                auto half = [&](__m128i (*unpack)(__m128i, __m128i)) {
+                    __m128i corners = _mm_add_epi16(
+                        _mm_add_epi16(unpack(a0, zero), unpack(a2, zero)),
+                        _mm_add_epi16(unpack(b0, zero), unpack(b2, zero)));
+                    return _mm_sub_epi16(
+                        _mm_mullo_epi16(corners, cornerWeight),
+                        _mm_mullo_epi16(unpack(c, zero), centerWeight));
+                };
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(out + x),
+                                 _mm_packus_epi16(half(_mm_unpacklo_epi8),
+                                                  half(_mm_unpackhi_epi8)));
+            }
+#endif
+            for (; x < width; ++x) {
+                auto corners =
+                    above[x] + above[x + 2] + below[x] + below[x + 2];
+                auto result = scale * (2 * corners - 8 * center[x + 1]);
+                out[x] =
+                    static_cast<uint8_t>(std::min(std::max(result, 0), 255));
+            }
+        }
+
+        /// 255 where the input is greater than the threshold, 0 elsewhere.
+        inline void binarize(uint8_t const *in, uint8_t *out, int width,
+                             std::uint8_t threshold) {
+            int x = 0;
+#if defined(OSVR_FUSED_EDGE_AVX2) || defined(OSVR_FUSED_EDGE_SSE2)
+            const __m128i thresh =
+                _mm_set1_epi8(static_cast<char>(threshold + 1));
+            for (; x + 16 <= width; x += 16) {
+                __m128i val =
+                    _mm_loadu_si128(reinterpret_cast<__m128i const *>(in + x));
+                _mm_storeu_si128(
+                    reinterpret_cast<__m128i *>(out + x),
+                    _mm_cmpeq_epi8(_mm_max_epu8(val, thresh), val));
+            }
+#endif
+            for (; x < width; ++x) {
+                out[x] = in[x] > threshold ? 255 : 0;
+            }
+        }
+
+        /// Index of a row or column, reflected into the image like OpenCV's
+        /// BORDER_DEFAULT.
+        inline int reflect101(int i, int n) {
+            return i < 0 ? -i : (i >= n ? 2 * n - 2 - i : i);
+        }
+    } // namespace
+
+    bool FusedEdgeDetector::canHandle(EdgeHoleParams const &params) {
+        return params.preEdgeDetectionBlurSize == 3 &&
+               params.laplacianKSize == 3 && params.laplacianScale >= 1 &&
+               params.laplacianScale <= MAX_FUSED_LAPLACIAN_SCALE &&
+               params.laplacianScale == std::floor(params.laplacianScale) &&
+               !params.edgeDetectErosion &&
+               (!params.postEdgeDetectionBlur ||
+                params.postEdgeDetectionBlurSize == 3) &&
+               params.postEdgeDetectionBlurThreshold >= 0 &&
+               params.postEdgeDetectionBlurThreshold < 255;
+    }
+
+    FusedEdgeDetector::FusedEdgeDetector(EdgeHoleParams const &params)
+        : laplacianScale_(static_cast<int>(params.laplacianScale)),
+          postBlur_(params.postEdgeDetectionBlur),
+          threshold_(static_cast<std::uint8_t>(
+              params.postEdgeDetectionBlurThreshold)) {}
+
+    void FusedEdgeDetector::allocate(int width) {
+        if (width == width_) {
+            return;
+        }
+        width_ = width;
+        const auto paddedWidth = static_cast<std::size_t>(width + 2);
+        blurredRows_.assign(3 * paddedWidth, 0);
+        edgeRows_.assign(3 * paddedWidth, 0);
+        verticalSum_.assign(paddedWidth, 0);
+    }
+
+    bool FusedEdgeDetector::apply(cv::Mat const &gray, cv::Mat &edge,
+                                  cv::Mat &edgeBinary) {
+        if (gray.type() != CV_8UC1 || gray.rows < 2 || gray.cols < 2) {
+            return false;
+        }
+        const int rows = gray.rows;
+        const int width = gray.cols;
+        allocate(width);
+        edge.create(gray.size(), CV_8UC1);
+        edgeBinary.create(gray.size(), CV_8UC1);
+
+        const auto paddedWidth = width + 2;
+        auto blurredRow = [&](int y) {
+            return blurredRows_.data() + (y % 3) * paddedWidth;
+        };
+        auto edgeRow = [&](int y) {
+            return edgeRows_.data() + (y % 3) * paddedWidth;
+        };
+        auto sum = verticalSum_.data();
+
+        /// Each output row needs three edge rows, each of which needs three
+        /// blurred rows: keep each just far enough ahead.
+        int nextBlurred = 0;
+        int nextEdge = 0;
+        for (int y = 0; y < rows; ++y) {
+            const int neededEdge = std::min(y + 1, rows - 1);
+            for (; nextEdge <= neededEdge; ++nextEdge) {
+                const int neededBlurred = std::min(nextEdge + 1, rows - 1);
+                for (; nextBlurred <= neededBlurred; ++nextBlurred) {
+                    int j = nextBlurred;
+                    verticalSum(gray.ptr<std::uint8_t>(reflect101(j - 1, rows)),
+                                gray.ptr<std::uint8_t>(j),
+                                gray.ptr<std::uint8_t>(reflect101(j + 1, rows)),
+                                sum + 1, width);
+                    padRow(sum, width);
+                    horizontalBlur(sum, blurredRow(j) + 1, width);
+                    padRow(blurredRow(j), width);
+                }
+                int k = nextEdge;
+                laplacian(blurredRow(reflect101(k - 1, rows)), blurredRow(k),
+                          blurredRow(reflect101(k + 1, rows)), edgeRow(k) + 1,
+                          width, laplacianScale_);
+                padRow(edgeRow(k), width);
+                std::memcpy(edge.ptr<std::uint8_t>(k), edgeRow(k) + 1, width);
+            }
+
+            if (postBlur_) {
+                verticalSum(edgeRow(reflect101(y - 1, rows)) + 1,
+                            edgeRow(y) + 1,
+                            edgeRow(reflect101(y + 1, rows)) + 1, sum + 1,
+                            width);
+                padRow(sum, width);
+                horizontalBlur(sum, edgeBinary.ptr<std::uint8_t>(y), width,
+                               threshold_);
+            } else {
+                binarize(edgeRow(y) + 1, edgeBinary.ptr<std::uint8_t>(y),
+                         width, threshold_);
+            }
+        }
+        return true;
+    }
+} // namespace vbtracker
+} // namespace osvr
@@ -34,6 +34,7 @@
 #include <osvr/Util/UniquePtr.h>
 #include <osvr/Common/Transform.h>
 #include <osvr/Common/OriginalSource.h>
+#include <osvr/Common/SharedMemoryReportRing.h>
 #include <osvr/Common/JSONTransformVisitor.h>
 #include "PureClientContext.h"
 #include <osvr/Client/InterfaceTree.h>
@@ -57,30 +58,78 @@ namespace client {
     class VRPNAnalogHandler : public RemoteHandler {
       public:
         typedef util::ValueOrRange<int> RangeType;
+        /// @param reports If non-null, reports are read from here (shared
+        /// memory or multicast), rather than over conn.
         VRPNAnalogHandler(vrpn_ConnectionPtr const &conn, const char *src,
+                          common::ReportSourcePtr &&reports,
                           boost::optional<int> sensor,
                           common::InterfaceList &ifaces)
-            : m_remote(new vrpn_Analog_Remote(src, conn.get())),
-              m_internals(ifaces), m_all(!sensor.is_initialized()) {
-            m_remote->register_change_handler(this, &VRPNAnalogHandler::handle);
-            OSVR_DEV_VERBOSE("Constructed an AnalogHandler for " << src);
+            : m_reader(std::move(reports)), m_internals(ifaces),
+              m_all(!sensor.is_initialized()) {
+            if (!m_reader) {
+                m_remote.reset(new vrpn_Analog_Remote(src, conn.get()));
+                m_remote->register_change_handler(this,
+                                                  &VRPNAnalogHandler::handle);
+            }
+            OSVR_DEV_VERBOSE("Constructed an AnalogHandler for "
+                             << src << (m_reader ? " (direct reports)" : ""));
 
             if (sensor.is_initialized()) {
                 m_sensors.setValue(*sensor);
             }
         }
         virtual ~VRPNAnalogHandler() {
-            m_remote->unregister_change_handler(this,
-                                                &VRPNAnalogHandler::handle);
+            if (m_remote) {
+                m_remote->unregister_change_handler(
+                    this, &VRPNAnalogHandler::handle);
+            }
         }
 
         static void VRPN_CALLBACK handle(void *userdata, vrpn_ANALOGCB info) {
             auto self = static_cast<VRPNAnalogHandler *>(userdata);
             self->m_handle(info);
         }
-        virtual void update() { m_remote->mainloop(); }
+        /// Reports from VRPN are dispatched to our callbacks when the context
+        /// drains the shared connection, so there's only anything to do per
+        /// handler when reading records directly.
+        virtual void update() {
+            if (!m_reader) {
+                return;
+            }
+            common::SharedMemoryReport report;
+            while (m_reader->read(report)) {
+                if (report.type == common::SharedMemoryReportType::Analog) {
+                    m_handle(report);
+                }
+            }
+        }
+
+        virtual bool needsConnectionReports() const {
+            return !m_reader || m_reader->requiresInterest();
+        }
 
       private:
+        /// Unlike VRPN messages, which carry every channel, shared memory
+        /// reports are for a single changed channel.
+        void m_handle(common::SharedMemoryReport const &info) {
+            if (m_all) {
+                if (m_sensors.empty()) {
+                    m_sensors.setRangeMaxMin(info.sensor);
+                } else {
+                    m_sensors.extendRangeToMax(info.sensor);
+                }
+            } else if (!m_sensors.contains(info.sensor)) {
+                return;
+            }
+            OSVR_TimeValue timestamp;
+            timestamp.seconds = info.seconds;
+            timestamp.microseconds = info.microseconds;
+            OSVR_AnalogReport report;
+            report.sensor = info.sensor;
+            report.state = info.data[0];
+            m_internals.setStateAndTriggerCallbacks(timestamp, report);
+        }
+
         void m_handle(vrpn_ANALOGCB const &info) {
             auto maxChannel =
                 m_all ? info.num_channel - 1 : m_sensors.getValue();
@@ -108,6 +157,7 @@ namespace client {
                 m_internals.setStateAndTriggerCallbacks(timestamp, report);
             }
         }
+        common::ReportSourcePtr m_reader;
         unique_ptr<vrpn_Analog_Remote> m_remote;
         RemoteHandlerInternals m_internals;
         bool m_all;
@@ -132,9 +182,10 @@ namespace client {
         auto const &devElt = source.getDeviceElement();
 
         /// @todo find out why make_shared causes a crash here
-        ret.reset(new VRPNAnalogHandler(m_conns.getConnection(devElt),
-                                        devElt.getFullDeviceName().c_str(),
-                                        source.getSensorNumber(), ifaces));
+        ret.reset(new VRPNAnalogHandler(
+            m_conns.getConnection(devElt), devElt.getFullDeviceName().c_str(),
+            m_conns.openReportSource(devElt), source.getSensorNumber(),
+            ifaces));
         return ret;
     }
 
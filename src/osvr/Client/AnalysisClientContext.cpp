@@ -49,6 +49,7 @@ namespace client {
 
     AnalysisClientContext::AnalysisClientContext(
         const char appId[], const char host[], vrpn_ConnectionPtr const &conn,
+        common::InProcessTrackerTransportPtr const &trackerTransport,
         common::ClientContextDeleter del)
         : ::OSVR_ClientContextObject(appId, del), m_mainConn(conn),
           m_ifaceMgr(m_pathTreeOwner, m_factory,
@@ -59,13 +60,21 @@ namespace client {
 
         m_vrpnConns.addConnection(m_mainConn, "localhost");
         m_vrpnConns.addConnection(m_mainConn, host);
+        if (trackerTransport) {
+            /// The server delivers tracker reports in-process, so we must
+            /// subscribe there too.
+            m_vrpnConns.setInProcessTrackerTransport("localhost",
+                                                     trackerTransport);
+            m_vrpnConns.setInProcessTrackerTransport(host, trackerTransport);
+        }
         std::string sysDeviceName =
             std::string(common::SystemComponent::deviceName()) + "@" + host;
         m_mainConn = m_vrpnConns.getConnection(
             common::SystemComponent::deviceName(), host);
 
         /// Create the system client device.
-        m_systemDevice = common::createClientDevice(sysDeviceName, m_mainConn);
+        m_systemDevice = common::createSharedConnectionClientDevice(
+            sysDeviceName, m_mainConn);
         m_systemComponent =
             m_systemDevice->addComponent(common::SystemComponent::create());
         using DedupJsonFunction =
@@ -80,6 +89,13 @@ namespace client {
                 m_pathTreeOwner.replaceTree(nodes);
             }));
 
+        /// Let the server know which sources we're using.
+        m_ifaceMgr.setInterestCallback(
+            [&](std::string const &clientId,
+                common::ClientInterestFilter::Interest const &interest) {
+                m_systemComponent->sendClientInterest(clientId, interest);
+            });
+
         // No startup spin.
     }
 
@@ -87,6 +103,9 @@ namespace client {
 
     void AnalysisClientContext::m_update() {
         m_started = true;
+        /// Mainloop connections
+        m_vrpnConns.updateAll();
+
         /// Update system device
         m_systemDevice->update();
         /// Update handlers.
@@ -49,9 +49,11 @@ namespace client {
 
     class AnalysisClientContext : public ::OSVR_ClientContextObject {
       public:
-        AnalysisClientContext(const char appId[], const char host[],
-                              vrpn_ConnectionPtr const &conn,
-                              common::ClientContextDeleter del);
+        AnalysisClientContext(
+            const char appId[], const char host[],
+            vrpn_ConnectionPtr const &conn,
+            common::InProcessTrackerTransportPtr const &trackerTransport,
+            common::ClientContextDeleter del);
         virtual ~AnalysisClientContext();
         EIGEN_MAKE_ALIGNED_OPERATOR_NEW
       private:
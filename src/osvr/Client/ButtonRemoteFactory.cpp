@@ -31,6 +31,7 @@
 #include <osvr/Util/ChannelCountC.h>
 #include <osvr/Util/UniquePtr.h>
 #include <osvr/Common/OriginalSource.h>
+#include <osvr/Common/SharedMemoryReportRing.h>
 #include <osvr/Client/InterfaceTree.h>
 #include <osvr/Util/ValueOrRange.h>
 #include <osvr/Util/Verbosity.h>
@@ -52,25 +53,35 @@ namespace client {
     class VRPNButtonHandler : public RemoteHandler {
       public:
         typedef util::ValueOrRange<int> RangeType;
+        /// @param reports If non-null, reports are read from here (shared
+        /// memory or multicast), rather than over conn.
         VRPNButtonHandler(vrpn_ConnectionPtr const &conn, const char *src,
+                          common::ReportSourcePtr &&reports,
                           boost::optional<int> sensor,
                           common::InterfaceList &ifaces)
-            : m_remote(new vrpn_Button_Remote(src, conn.get())),
-              m_internals(ifaces), m_all(!sensor.is_initialized()) {
-            m_remote->register_change_handler(this, &VRPNButtonHandler::handle);
-            m_remote->register_states_handler(
-                this, &VRPNButtonHandler::handle_states);
-            OSVR_DEV_VERBOSE("Constructed a ButtonHandler for " << src);
+            : m_reader(std::move(reports)), m_internals(ifaces),
+              m_all(!sensor.is_initialized()) {
+            if (!m_reader) {
+                m_remote.reset(new vrpn_Button_Remote(src, conn.get()));
+                m_remote->register_change_handler(this,
+                                                  &VRPNButtonHandler::handle);
+                m_remote->register_states_handler(
+                    this, &VRPNButtonHandler::handle_states);
+            }
+            OSVR_DEV_VERBOSE("Constructed a ButtonHandler for "
+                             << src << (m_reader ? " (direct reports)" : ""));
 
             if (sensor.is_initialized()) {
                 m_sensors.setValue(*sensor);
             }
         }
         virtual ~VRPNButtonHandler() {
-            m_remote->unregister_change_handler(this,
-                                                &VRPNButtonHandler::handle);
-            m_remote->unregister_states_handler(
-                this, &VRPNButtonHandler::handle_states);
+            if (m_remote) {
+                m_remote->unregister_change_handler(
+                    this, &VRPNButtonHandler::handle);
+                m_remote->unregister_states_handler(
+                    this, &VRPNButtonHandler::handle_states);
+            }
         }
 
         static void VRPN_CALLBACK handle(void *userdata, vrpn_BUTTONCB info) {
@@ -83,7 +94,30 @@ namespace client {
             auto self = static_cast<VRPNButtonHandler *>(userdata);
             self->m_handle(info);
         }
-        virtual void update() { m_remote->mainloop(); }
+        /// Reports from VRPN are dispatched to our callbacks when the context
+        /// drains the shared connection, so there's only anything to do per
+        /// handler when reading records directly.
+        virtual void update() {
+            if (!m_reader) {
+                return;
+            }
+            common::SharedMemoryReport report;
+            while (m_reader->read(report)) {
+                if (report.type != common::SharedMemoryReportType::Button ||
+                    (!m_all && !m_sensors.contains(report.sensor))) {
+                    continue;
+                }
+                OSVR_TimeValue timestamp;
+                timestamp.seconds = report.seconds;
+                timestamp.microseconds = report.microseconds;
+                m_report(timestamp, report.sensor,
+                         static_cast<vrpn_int32>(report.data[0]));
+            }
+        }
+
+        virtual bool needsConnectionReports() const {
+            return !m_reader || m_reader->requiresInterest();
+        }
 
       private:
         void m_handle(vrpn_BUTTONCB const &info) {
@@ -128,6 +162,7 @@ namespace client {
             report.state = static_cast<uint8_t>(state);
             m_internals.setStateAndTriggerCallbacks(timestamp, report);
         }
+        common::ReportSourcePtr m_reader;
         unique_ptr<vrpn_Button_Remote> m_remote;
         RemoteHandlerInternals m_internals;
         bool m_all;
@@ -152,9 +187,10 @@ namespace client {
         auto const &devElt = source.getDeviceElement();
 
         /// @todo find out why make_shared causes a crash here
-        ret.reset(new VRPNButtonHandler(m_conns.getConnection(devElt),
-                                        devElt.getFullDeviceName().c_str(),
-                                        source.getSensorNumber(), ifaces));
+        ret.reset(new VRPNButtonHandler(
+            m_conns.getConnection(devElt), devElt.getFullDeviceName().c_str(),
+            m_conns.openReportSource(devElt), source.getSensorNumber(),
+            ifaces));
         return ret;
     }
 
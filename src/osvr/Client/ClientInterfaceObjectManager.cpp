@@ -32,11 +32,15 @@
 #include <osvr/Common/ClientInterface.h>
 #include <osvr/Util/Verbosity.h>
 #include <osvr/Common/ResolveTreeNode.h>
+#include <osvr/Common/PathElementTypes.h>
 
 // Library/third-party includes
 #include <boost/assert.hpp>
 
 // Standard includes
+#include <iomanip>
+#include <random>
+#include <sstream>
 #include <unordered_set>
 
 namespace osvr {
@@ -45,10 +49,23 @@ namespace client {
         common::PathTreeOwner &tree, RemoteHandlerFactory &handlerFactory,
         common::ClientContext &ctx)
         : m_pathTree(tree.get()), m_treeObserver(tree.makeObserver()),
-          m_factory(handlerFactory), m_ctx(&ctx) {
+          m_factory(handlerFactory), m_ctx(&ctx), m_lastAdvertised{0, 0} {
+        {
+            /// Unique enough to tell apart several clients with the same app
+            /// ID.
+            std::random_device rd;
+            std::ostringstream os;
+            os << ctx.getAppId() << "/" << std::hex << std::setfill('0')
+               << std::setw(8) << rd() << std::setw(8) << rd();
+            m_clientId = os.str();
+        }
         m_treeObserver->setEventCallback(
-            common::PathTreeEvents::AboutToUpdate,
-            [&](common::PathTree &) { m_interfaces.clearHandlers(); });
+            common::PathTreeEvents::AboutToUpdate, [&](common::PathTree &) {
+                m_interfaces.clearHandlers();
+                m_pathSources.clear();
+                m_resolutionCache.clear();
+                m_interestDirty = true;
+            });
         m_treeObserver->setEventCallback(
             common::PathTreeEvents::AfterUpdate,
             [&](common::PathTree &) { m_connectNeededCallbacks(); });
@@ -73,6 +90,21 @@ namespace client {
 
     void ClientInterfaceObjectManager::updateHandlers() {
         m_interfaces.updateHandlers();
+        if (!m_interestCallback) {
+            return;
+        }
+        auto now = util::time::getNow();
+        if (m_interestDirty ||
+            util::time::duration(now, m_lastAdvertised) * 1000. >=
+                common::ClientInterestFilter::REFRESH_INTERVAL_MS) {
+            m_advertiseInterest(now);
+        }
+    }
+
+    void ClientInterfaceObjectManager::setInterestCallback(
+        InterestCallback cb) {
+        m_interestCallback = cb;
+        m_interestDirty = true;
     }
 
     bool ClientInterfaceObjectManager::m_connectCallbacksOnPath(
@@ -81,8 +113,12 @@ namespace client {
         /// for this path, if found. Ensures that if we early-out (fail to set
         /// up a handler) we don't have a leftover one still active.
         m_interfaces.eraseHandlerForPath(path);
+        if (m_pathSources.erase(path) > 0) {
+            m_interestDirty = true;
+        }
 
-        auto source = common::resolveTreeNode(m_pathTree, path);
+        auto source =
+            common::resolveTreeNode(m_pathTree, path, m_resolutionCache);
         if (!source.is_initialized()) {
             if (verboseFailure) {
                 logger()->info() << "Could not resolve source for " << path;
@@ -100,6 +136,11 @@ namespace client {
             BOOST_ASSERT_MSG(
                 !oldHandler,
                 "We removed the old handler before so it should be null now");
+            if (handler->needsConnectionReports()) {
+                m_pathSources[path] =
+                    source->getDeviceElement().getDeviceName();
+                m_interestDirty = true;
+            }
             return true;
         }
 
@@ -112,6 +153,9 @@ namespace client {
     void ClientInterfaceObjectManager::m_removeCallbacksOnPath(
         std::string const &path) {
         m_interfaces.eraseHandlerForPath(path);
+        if (m_pathSources.erase(path) > 0) {
+            m_interestDirty = true;
+        }
     }
 
     void ClientInterfaceObjectManager::m_connectNeededCallbacks() {
@@ -132,6 +176,34 @@ namespace client {
                          << " unconnected paths successfully";
     }
 
+    void ClientInterfaceObjectManager::m_advertiseInterest(
+        util::time::TimeValue const &now) {
+        using common::ClientInterestFilter;
+        ClientInterestFilter::Interest interest;
+        for (auto const &pathSource : m_pathSources) {
+            auto const &ifaces =
+                m_interfaces.getInterfacesForPath(pathSource.first);
+            if (ifaces.empty()) {
+                continue;
+            }
+            auto rate = ifaces.front()->getMaxReportRate();
+            for (auto const &iface : ifaces) {
+                rate = ClientInterestFilter::combineMaxRates(
+                    rate, iface->getMaxReportRate());
+            }
+            auto it = interest.find(pathSource.second);
+            if (it == end(interest)) {
+                interest.emplace(pathSource.second, rate);
+            } else {
+                it->second =
+                    ClientInterestFilter::combineMaxRates(it->second, rate);
+            }
+        }
+        m_interestCallback(m_clientId, interest);
+        m_interestDirty = false;
+        m_lastAdvertised = now;
+    }
+
     util::log::LoggerPtr const &ClientInterfaceObjectManager::logger() const {
         return m_ctx->logger();
     }
@@ -49,8 +49,9 @@ namespace client {
     }
 
     common::ClientContext *
-    createAnalysisClientContext(const char appId[], const char host[],
-                                vrpn_ConnectionPtr const &conn) {
+    createAnalysisClientContext(
+        const char appId[], const char host[], vrpn_ConnectionPtr const &conn,
+        common::InProcessTrackerTransportPtr const &trackerTransport) {
         common::ClientContext *ret = nullptr;
         if (!appId || !appId[0]) {
             OSVR_DEV_VERBOSE("Could not create analysis client context - null "
@@ -70,7 +71,8 @@ namespace client {
             return ret;
         }
 
-        ret = common::makeContext<AnalysisClientContext>(appId, host, conn);
+        ret = common::makeContext<AnalysisClientContext>(appId, host, conn,
+                                                         trackerTransport);
         return ret;
     }
 
@@ -52,7 +52,8 @@ namespace client {
                                       std::string const &deviceName,
                                       boost::optional<OSVR_ChannelCount> sensor,
                                       common::InterfaceList &ifaces)
-            : m_dev(common::createClientDevice(deviceName, conn)),
+            : m_dev(common::createSharedConnectionClientDevice(deviceName,
+                                                               conn)),
               m_internals(ifaces), m_all(!sensor.is_initialized()),
               m_sensor(sensor) {
             auto direction = common::DirectionComponent::create();
@@ -78,7 +78,8 @@ namespace client {
                                 Options const &options,
                                 boost::optional<OSVR_ChannelCount> sensor,
                                 common::InterfaceList &ifaces)
-            : m_dev(common::createClientDevice(deviceName, conn)),
+            : m_dev(common::createSharedConnectionClientDevice(deviceName,
+                                                               conn)),
               m_internals(ifaces), m_all(!sensor.is_initialized()),
               m_opts(options), m_sensor(sensor) {
             auto eyetracker = common::EyeTrackerComponent::create();
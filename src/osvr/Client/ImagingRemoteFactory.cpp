@@ -52,7 +52,8 @@ namespace client {
                              std::string const &deviceName,
                              boost::optional<OSVR_ChannelCount> sensor,
                              common::InterfaceList &ifaces)
-            : m_dev(common::createClientDevice(deviceName, conn)),
+            : m_dev(common::createSharedConnectionClientDevice(deviceName,
+                                                               conn)),
               m_internals(ifaces), m_all(!sensor.is_initialized()),
               m_sensor(sensor) {
             auto imaging = common::ImagingComponent::create();
@@ -91,6 +92,7 @@ namespace client {
             m_internals.forEachInterface(
                 [&timestamp, &report, &data](common::ClientInterface &iface) {
                     // Note: not setting state here! we don't store image state.
+                    iface.recordReportAge(timestamp);
                     auto n = iface.getNumCallbacksFor(report);
                     for (std::size_t i = 0; i < n; ++i) {
                         // Acquire a reference for each callback we're going to
@@ -102,7 +102,8 @@ namespace client {
             common::SystemComponent::deviceName(), host);
 
         /// Create the system client device.
-        m_systemDevice = common::createClientDevice(sysDeviceName, m_mainConn);
+        m_systemDevice = common::createSharedConnectionClientDevice(
+            sysDeviceName, m_mainConn);
         m_systemComponent =
             m_systemDevice->addComponent(common::SystemComponent::create());
         using DedupJsonFunction =
@@ -122,6 +123,40 @@ namespace client {
                 m_pathTreeOwner.replaceTree(nodes);
             }));
 
+        /// Read reports from shared memory rather than VRPN messages where the
+        /// server offers it. Device elements have a port attached to the
+        /// host, so register the directory under both forms.
+        m_systemComponent->registerSharedMemoryReportsHandler(
+            [&](common::SharedMemoryReportDirectory const &directory) {
+                m_vrpnConns.setSharedMemoryReports(m_host, directory);
+                m_vrpnConns.setSharedMemoryReports(
+                    common::elements::DeviceElement::createDeviceElement(
+                        std::string(), m_host)
+                        .getServer(),
+                    directory);
+            });
+
+        /// Failing that, from a multicast group, if the server sends to one.
+        m_systemComponent->registerMulticastReportsHandler(
+            [&](common::MulticastReportDirectory const &directory) {
+                m_vrpnConns.setMulticastReports(m_host, directory);
+                m_vrpnConns.setMulticastReports(
+                    common::elements::DeviceElement::createDeviceElement(
+                        std::string(), m_host)
+                        .getServer(),
+                    directory);
+            });
+
+        /// Keep track of the server clock, to tell how old reports are.
+        m_clockSync.reset(new ServerClockSync(*m_systemComponent));
+
+        /// Let the server know which sources we're using.
+        m_ifaceMgr.setInterestCallback(
+            [&](std::string const &clientId,
+                common::ClientInterestFilter::Interest const &interest) {
+                m_systemComponent->sendClientInterest(clientId, interest);
+            });
+
         typedef std::chrono::system_clock clock;
         auto begin = clock::now();
 
@@ -177,6 +212,11 @@ namespace client {
 
         /// Update system device
         m_systemDevice->update();
+        if (m_mainConn->connected()) {
+            m_clockSync->update();
+        } else {
+            m_clockSync->reset();
+        }
         /// Update handlers.
         m_ifaceMgr.updateHandlers();
     }
@@ -200,6 +240,11 @@ namespace client {
         return m_gotConnection && m_pathTreeOwner;
     }
 
+    common::ClockOffsetEstimator const *
+    PureClientContext::m_getServerClock() const {
+        return &m_clockSync->getEstimator();
+    }
+
     common::PathTree const &PureClientContext::m_getPathTree() const {
         return m_pathTreeOwner.get();
     }
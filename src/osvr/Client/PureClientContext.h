@@ -26,6 +26,7 @@
 #define INCLUDED_PureClientContext_h_GUID_0A40DCCB_0451_4DB0_855B_7ECE66C52D07
 
 // Internal Includes
+#include "ServerClockSync.h"
 #include "VRPNConnectionCollection.h"
 #include <osvr/Client/ClientInterfaceObjectManager.h>
 #include <osvr/Client/InterfaceTree.h>
@@ -38,6 +39,7 @@
 #include <osvr/Common/SystemComponent_fwd.h>
 #include <osvr/Common/Transform.h>
 #include <osvr/Util/TimeValue_fwd.h>
+#include <osvr/Util/UniquePtr.h>
 
 // Library/third-party includes
 #include <json/value.h>
@@ -80,6 +82,8 @@ namespace client {
 
         bool m_getStatus() const override;
 
+        common::ClockOffsetEstimator const *m_getServerClock() const override;
+
         /// @brief The main OSVR server host: usually localhost
         std::string m_host;
 
@@ -93,6 +97,9 @@ namespace client {
         /// control messages.
         common::SystemComponent *m_systemComponent;
 
+        /// @brief Estimate of the main server's clock relative to ours.
+        unique_ptr<ServerClockSync> m_clockSync;
+
         /// @brief All open VRPN connections, keyed by host
         VRPNConnectionCollection m_vrpnConns;
 
@@ -61,6 +61,7 @@ namespace client {
 
             forEachInterface(
                 [&timestamp, &report](common::ClientInterface &iface) {
+                    iface.recordReportAge(timestamp);
                     iface.setState(timestamp, report);
                     iface.triggerCallbacks(timestamp, report);
                 });
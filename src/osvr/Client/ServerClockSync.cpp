@@ -0,0 +1,97 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "ServerClockSync.h"
+#include <osvr/Common/SystemComponent.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <chrono>
+#include <random>
+
+namespace osvr {
+namespace client {
+    const std::size_t ServerClockSync::STARTUP_REQUESTS;
+    const double ServerClockSync::STARTUP_INTERVAL = 0.1;
+    const double ServerClockSync::INTERVAL = 1.;
+
+    namespace {
+        inline uint64_t makeClientId() {
+            std::random_device rd;
+            std::mt19937_64 gen(
+                (uint64_t(rd()) << 32) ^ rd() ^
+                static_cast<uint64_t>(
+                    std::chrono::high_resolution_clock::now()
+                        .time_since_epoch()
+                        .count()));
+            return gen();
+        }
+    } // namespace
+
+    ServerClockSync::ServerClockSync(common::SystemComponent &sys)
+        : m_sys(sys), m_id(makeClientId()), m_sequence(0),
+          m_resetSequence(0), m_sentSinceReset(0), m_lastSent() {
+        m_sys.registerClockSyncResponseHandler(
+            [&](common::ClockSyncResponse const &response,
+                util::time::TimeValue const &received) {
+                m_handleResponse(response, received);
+            });
+    }
+
+    void ServerClockSync::update() {
+        auto now = util::time::getNow();
+        if (m_sentSinceReset > 0) {
+            auto interval = m_sentSinceReset < STARTUP_REQUESTS
+                                ? STARTUP_INTERVAL
+                                : INTERVAL;
+            if (util::time::duration(now, m_lastSent) < interval) {
+                return;
+            }
+        }
+        ++m_sequence;
+        ++m_sentSinceReset;
+        m_lastSent = now;
+        m_sys.sendClockSyncRequest(m_id, m_sequence);
+    }
+
+    void ServerClockSync::reset() {
+        m_resetSequence = m_sequence;
+        m_sentSinceReset = 0;
+        m_estimator.reset();
+    }
+
+    void ServerClockSync::m_handleResponse(
+        common::ClockSyncResponse const &response,
+        util::time::TimeValue const &received) {
+        if (response.client != m_id || response.sequence <= m_resetSequence) {
+            return;
+        }
+        m_estimator.addSample(common::ClockSyncSample(
+            response, common::timeToMicroseconds(received)));
+    }
+} // namespace client
+} // namespace osvr
@@ -0,0 +1,87 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ServerClockSync_h_GUID_BE45CF42_55AE_4F3A_9664_3330B10EE293
+#define INCLUDED_ServerClockSync_h_GUID_BE45CF42_55AE_4F3A_9664_3330B10EE293
+
+// Internal Includes
+#include <osvr/Common/ClockSync.h>
+#include <osvr/Common/SystemComponent_fwd.h>
+#include <osvr/Util/StdInt.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <cstddef>
+
+namespace osvr {
+namespace client {
+    /// @brief Keeps an estimate of the offset between the server clock and
+    /// ours up to date, by exchanging clock sync messages through the system
+    /// component: quickly at first, then just often enough to follow drift.
+    class ServerClockSync : boost::noncopyable {
+      public:
+        /// @brief Requests sent at the startup interval after (re)starting.
+        static const std::size_t STARTUP_REQUESTS = 8;
+        /// @brief Seconds between requests while starting up.
+        static const double STARTUP_INTERVAL;
+        /// @brief Seconds between requests thereafter.
+        static const double INTERVAL;
+
+        explicit ServerClockSync(common::SystemComponent &sys);
+
+        /// @brief Sends a request if one is due: call frequently while
+        /// connected.
+        void update();
+
+        /// @brief Forgets the estimate and starts over, e.g. when the
+        /// connection is lost.
+        void reset();
+
+        common::ClockOffsetEstimator const &getEstimator() const {
+            return m_estimator;
+        }
+
+      private:
+        void m_handleResponse(common::ClockSyncResponse const &response,
+                              util::time::TimeValue const &received);
+        common::SystemComponent &m_sys;
+        /// @brief Random identifier, to pick our responses out from those to
+        /// other clients.
+        uint64_t const m_id;
+        /// @brief Sequence number of the last request sent.
+        uint32_t m_sequence;
+        /// @brief Responses to requests up to this one predate the last
+        /// reset, so are ignored.
+        uint32_t m_resetSequence;
+        std::size_t m_sentSinceReset;
+        util::time::TimeValue m_lastSent;
+        common::ClockOffsetEstimator m_estimator;
+    };
+} // namespace client
+} // namespace osvr
+
+#endif // INCLUDED_ServerClockSync_h_GUID_BE45CF42_55AE_4F3A_9664_3330B10EE293
@@ -29,15 +29,18 @@
 #include "VRPNConnectionCollection.h"
 #include <osvr/Client/InterfaceTree.h>
 #include <osvr/Common/ClientInterface.h>
+#include <osvr/Common/InProcessTrackerTransport.h>
 #include <osvr/Common/JSONTransformVisitor.h>
 #include <osvr/Common/OriginalSource.h>
 #include <osvr/Common/PathTreeFull.h>
+#include <osvr/Common/SharedMemoryReportRing.h>
 #include <osvr/Common/Tracing.h>
 #include <osvr/Common/TrackerSensorInfo.h>
 #include <osvr/Common/Transform.h>
 #include <osvr/Util/ChannelCountC.h>
 #include <osvr/Util/EigenInterop.h>
 #include <osvr/Util/QuatlibInteropC.h>
+#include <osvr/Util/TimeValue.h>
 #include <osvr/Util/UniquePtr.h>
 #include <osvr/Util/Verbosity.h>
 
@@ -63,51 +66,50 @@ namespace client {
             bool reportPosition = false;
             bool reportOrientation = false;
         };
-        VRPNTrackerHandler(vrpn_ConnectionPtr const &conn, const char *src,
-                           Options const &options,
-                           common::TrackerSensorInfo const &info,
-                           common::Transform const &t,
-                           boost::optional<int> sensor,
-                           common::InterfaceList &ifaces,
-                           common::ClientContext &ctx)
-            : m_remote(new vrpn_Tracker_Remote(src, conn.get())),
-              m_transform(t), m_ctx(ctx), m_internals(ifaces), m_opts(options),
-              m_info(info), m_sensor(sensor) {
+        /// @param direct If non-null, reports come straight from the
+        /// in-process tracker server through this, rather than over conn.
+        /// @param reports If non-null (and direct is null), reports are read
+        /// from here (shared memory or multicast), rather than over conn.
+        VRPNTrackerHandler(
+            vrpn_ConnectionPtr const &conn, const char *src,
+            common::InProcessTrackerSubscriptionPtr const &direct,
+            common::ReportSourcePtr &&reports, Options const &options,
+            common::TrackerSensorInfo const &info, common::Transform const &t,
+            boost::optional<int> sensor, common::InterfaceList &ifaces,
+            common::ClientContext &ctx)
+            : m_direct(direct), m_reader(std::move(reports)), m_transform(t),
+              m_ctx(ctx), m_internals(ifaces), m_opts(options), m_info(info),
+              m_sensor(sensor) {
+            if (m_direct) {
+                m_reader.reset();
+            } else if (!m_reader) {
+                m_remote.reset(new vrpn_Tracker_Remote(src, conn.get()));
+            }
             if (m_info.reportsPosition || m_info.reportsOrientation) {
-                m_remote->register_change_handler(this,
-                                                  &VRPNTrackerHandler::handle,
-                                                  m_sensor.get_value_or(-1));
+                m_registerHandler(&VRPNTrackerHandler::handle);
             }
             if (m_info.reportsLinearVelocity || m_info.reportsAngularVelocity) {
-                m_remote->register_change_handler(
-                    this, &VRPNTrackerHandler::handleVel,
-                    m_sensor.get_value_or(-1));
+                m_registerHandler(&VRPNTrackerHandler::handleVel);
             }
             if (m_info.reportsLinearAcceleration ||
                 m_info.reportsAngularAcceleration) {
-                m_remote->register_change_handler(
-                    this, &VRPNTrackerHandler::handleAccel,
-                    m_sensor.get_value_or(-1));
+                m_registerHandler(&VRPNTrackerHandler::handleAccel);
             }
             OSVR_DEV_VERBOSE("Constructed a TrackerHandler for "
-                             << src << " sensor " << m_sensor.get_value_or(-1));
+                             << src << " sensor " << m_sensor.get_value_or(-1)
+                             << (m_direct ? " (in-process)" : "")
+                             << (m_reader ? " (direct reports)" : ""));
         }
         virtual ~VRPNTrackerHandler() {
             if (m_info.reportsPosition || m_info.reportsOrientation) {
-                m_remote->unregister_change_handler(this,
-                                                    &VRPNTrackerHandler::handle,
-                                                    m_sensor.get_value_or(-1));
+                m_unregisterHandler(&VRPNTrackerHandler::handle);
             }
             if (m_info.reportsLinearVelocity || m_info.reportsAngularVelocity) {
-                m_remote->unregister_change_handler(
-                    this, &VRPNTrackerHandler::handleVel,
-                    m_sensor.get_value_or(-1));
+                m_unregisterHandler(&VRPNTrackerHandler::handleVel);
             }
             if (m_info.reportsLinearAcceleration ||
                 m_info.reportsAngularAcceleration) {
-                m_remote->unregister_change_handler(
-                    this, &VRPNTrackerHandler::handleAccel,
-                    m_sensor.get_value_or(-1));
+                m_unregisterHandler(&VRPNTrackerHandler::handleAccel);
             }
         }
 
@@ -133,9 +135,102 @@ namespace client {
             auto self = static_cast<VRPNTrackerHandler *>(userdata);
             self->m_handle(info);
         }
-        virtual void update() { m_remote->mainloop(); }
+        /// Reports from VRPN are dispatched to our callbacks when the context
+        /// drains the shared connection, so there's only anything to do per
+        /// handler when reading records directly.
+        virtual void update() {
+            if (!m_reader) {
+                return;
+            }
+            common::SharedMemoryReport report;
+            while (m_reader->read(report)) {
+                if (m_sensor && report.sensor != *m_sensor) {
+                    continue;
+                }
+                m_handle(report);
+            }
+        }
+
+        virtual bool needsConnectionReports() const {
+            return !m_reader || m_reader->requiresInterest();
+        }
 
       private:
+        template <typename CallbackType>
+        void m_registerHandler(void(VRPN_CALLBACK *handler)(void *,
+                                                            CallbackType)) {
+            if (m_reader) {
+                // Polled in update() instead.
+            } else if (m_direct) {
+                m_direct->registerHandler(this, handler,
+                                          m_sensor.get_value_or(-1));
+            } else {
+                m_remote->register_change_handler(this, handler,
+                                                  m_sensor.get_value_or(-1));
+            }
+        }
+        template <typename CallbackType>
+        void m_unregisterHandler(void(VRPN_CALLBACK *handler)(void *,
+                                                              CallbackType)) {
+            if (m_reader) {
+                // Nothing registered.
+            } else if (m_direct) {
+                m_direct->unregisterHandler(this, handler,
+                                            m_sensor.get_value_or(-1));
+            } else {
+                m_remote->unregister_change_handler(this, handler,
+                                                    m_sensor.get_value_or(-1));
+            }
+        }
+
+        /// Pass a report from shared memory to the same code as the
+        /// corresponding VRPN message, if we'd have registered for that kind.
+        void m_handle(common::SharedMemoryReport const &report) {
+            OSVR_TimeValue timestamp;
+            timestamp.seconds = report.seconds;
+            timestamp.microseconds = report.microseconds;
+            auto const &data = report.data;
+            switch (report.type) {
+            case common::SharedMemoryReportType::Pose:
+                if (m_info.reportsPosition || m_info.reportsOrientation) {
+                    vrpn_TRACKERCB info;
+                    util::time::toStructTimeval(info.msg_time, timestamp);
+                    info.sensor = report.sensor;
+                    std::copy(data, data + 3, info.pos);
+                    std::copy(data + 3, data + 7, info.quat);
+                    m_handle(info);
+                }
+                break;
+            case common::SharedMemoryReportType::Velocity:
+                if (m_info.reportsLinearVelocity ||
+                    m_info.reportsAngularVelocity) {
+                    vrpn_TRACKERVELCB info;
+                    util::time::toStructTimeval(info.msg_time, timestamp);
+                    info.sensor = report.sensor;
+                    std::copy(data, data + 3, info.vel);
+                    std::copy(data + 3, data + 7, info.vel_quat);
+                    info.vel_quat_dt = data[7];
+                    m_handle(info);
+                }
+                break;
+            case common::SharedMemoryReportType::Acceleration:
+                if (m_info.reportsLinearAcceleration ||
+                    m_info.reportsAngularAcceleration) {
+                    vrpn_TRACKERACCCB info;
+                    util::time::toStructTimeval(info.msg_time, timestamp);
+                    info.sensor = report.sensor;
+                    std::copy(data, data + 3, info.acc);
+                    std::copy(data + 3, data + 7, info.acc_quat);
+                    info.acc_quat_dt = data[7];
+                    m_handle(info);
+                }
+                break;
+            default:
+                // Not a tracker report.
+                break;
+            }
+        }
+
         /// Pass pose messages on to the client
         void m_handle(vrpn_TRACKERCB const &info) {
             common::tracing::markNewTrackerData();
@@ -266,6 +361,8 @@ namespace client {
 
             m_internals.setStateAndTriggerCallbacks(timestamp, overallReport);
         }
+        common::InProcessTrackerSubscriptionPtr m_direct;
+        common::ReportSourcePtr m_reader;
         unique_ptr<vrpn_Tracker_Remote> m_remote;
         common::Transform m_transform;
         common::ClientContext &m_ctx;
@@ -304,10 +401,20 @@ namespace client {
             xform = xformParse.getTransform();
         }
 
+        common::InProcessTrackerSubscriptionPtr direct;
+        common::ReportSourcePtr reports;
+        auto subscriber = m_conns.getInProcessTrackerSubscriber(devElt);
+        if (subscriber) {
+            direct = subscriber->subscribe(devElt.getDeviceName());
+        } else {
+            reports = m_conns.openReportSource(devElt);
+        }
+
         /// @todo find out why make_shared causes a crash here
         ret.reset(new VRPNTrackerHandler(
             m_conns.getConnection(devElt), devElt.getFullDeviceName().c_str(),
-            opts, info, xform, source.getSensorNumber(), ifaces, ctx));
+            direct, std::move(reports), opts, info, xform,
+            source.getSensorNumber(), ifaces, ctx));
         return ret;
     }
 
@@ -24,17 +24,23 @@
 
 // Internal Includes
 #include "VRPNConnectionCollection.h"
+#include <osvr/Common/InProcessTrackerTransport.h>
 
 // Library/third-party includes
 #include <vrpn_Connection.h>
 
 // Standard includes
-// - none
+#include <algorithm>
 
 namespace osvr {
 namespace client {
     VRPNConnectionCollection::VRPNConnectionCollection()
-        : m_connMap(make_shared<ConnectionMap>()) {}
+        : m_connMap(make_shared<ConnectionMap>()),
+          m_conns(make_shared<ConnectionList>()),
+          m_trackerSubscribers(make_shared<TrackerSubscriberMap>()),
+          m_reportDirectories(make_shared<ReportDirectoryMap>()),
+          m_multicastDirectories(make_shared<MulticastDirectoryMap>()),
+          m_multicastReceivers(make_shared<MulticastReceiverMap>()) {}
 
     vrpn_ConnectionPtr VRPNConnectionCollection::getConnection(
         common::elements::DeviceElement const &elt) {
@@ -50,6 +56,7 @@ namespace client {
             return existing->second;
         }
         connMap[host] = conn;
+        m_addDistinct(conn);
         BOOST_ASSERT(!empty());
         return conn;
     }
@@ -68,14 +75,131 @@ namespace client {
             vrpn_get_connection_by_name(fullName.c_str(), nullptr, nullptr,
                                         nullptr, nullptr, nullptr, true));
         connMap[host] = newConn;
+        m_addDistinct(newConn);
         newConn->removeReference(); // Remove extra reference.
         BOOST_ASSERT(!empty());
         return newConn;
     }
 
+    void
+    VRPNConnectionCollection::m_addDistinct(vrpn_ConnectionPtr const &conn) {
+        auto &conns = *m_conns;
+        auto alreadyHave = std::any_of(
+            begin(conns), end(conns), [&](vrpn_ConnectionPtr const &other) {
+                return other.get() == conn.get();
+            });
+        if (!alreadyHave) {
+            conns.push_back(conn);
+        }
+    }
+
+    void VRPNConnectionCollection::setInProcessTrackerTransport(
+        std::string const &host,
+        common::InProcessTrackerTransportPtr const &transport) {
+        auto &subscribers = *m_trackerSubscribers;
+        auto existing = std::find_if(
+            begin(subscribers), end(subscribers),
+            [&](TrackerSubscriberMap::value_type const &entry) {
+                return entry.second->getTransport() == transport;
+            });
+        if (existing != end(subscribers)) {
+            subscribers[host] = existing->second;
+        } else {
+            subscribers[host] =
+                make_shared<common::InProcessTrackerSubscriber>(transport);
+        }
+    }
+
+    common::InProcessTrackerSubscriberPtr
+    VRPNConnectionCollection::getInProcessTrackerSubscriber(
+        common::elements::DeviceElement const &elt) const {
+        auto &subscribers = *m_trackerSubscribers;
+        auto it = subscribers.find(elt.getServer());
+        if (it == end(subscribers)) {
+            return common::InProcessTrackerSubscriberPtr{};
+        }
+        return it->second;
+    }
+
+    void VRPNConnectionCollection::setSharedMemoryReports(
+        std::string const &host,
+        common::SharedMemoryReportDirectory const &directory) {
+        (*m_reportDirectories)[host] = directory;
+    }
+
+    common::SharedMemoryReportRingPtr
+    VRPNConnectionCollection::openSharedMemoryReports(
+        common::elements::DeviceElement const &elt) const {
+        common::SharedMemoryReportRingPtr ret;
+        auto &directories = *m_reportDirectories;
+        auto dirIt = directories.find(elt.getServer());
+        if (dirIt == end(directories)) {
+            return ret;
+        }
+        auto ringIt = dirIt->second.find(elt.getDeviceName());
+        if (ringIt == end(dirIt->second)) {
+            return ret;
+        }
+        /// Fails harmlessly if the server is on some other machine.
+        ret = common::SharedMemoryReportRing::open(ringIt->second);
+        return ret;
+    }
+
+    void VRPNConnectionCollection::setMulticastReports(
+        std::string const &host,
+        common::MulticastReportDirectory const &directory) {
+        (*m_multicastDirectories)[host] = directory;
+        /// Let go of receivers for servers that have gone away: any handlers
+        /// still subscribed keep theirs alive.
+        auto &receivers = *m_multicastReceivers;
+        for (auto it = begin(receivers); it != end(receivers);) {
+            auto isCurrent = std::any_of(
+                begin(*m_multicastDirectories), end(*m_multicastDirectories),
+                [&](MulticastDirectoryMap::value_type const &entry) {
+                    return entry.second.sender == it->first;
+                });
+            if (isCurrent) {
+                ++it;
+            } else {
+                it = receivers.erase(it);
+            }
+        }
+    }
+
+    common::ReportSourcePtr VRPNConnectionCollection::openReportSource(
+        common::elements::DeviceElement const &elt) const {
+        common::ReportSourcePtr ret;
+        auto ring = openSharedMemoryReports(elt);
+        if (ring) {
+            ret.reset(new common::SharedMemoryReportRing::Reader(ring));
+            return ret;
+        }
+
+        auto &directories = *m_multicastDirectories;
+        auto dirIt = directories.find(elt.getServer());
+        if (dirIt == end(directories) || dirIt->second.group.empty()) {
+            return ret;
+        }
+        auto const &directory = dirIt->second;
+        auto &receiver = (*m_multicastReceivers)[directory.sender];
+        if (!receiver || !receiver->updateDirectory(directory)) {
+            /// Null if we can't join the group: just use VRPN then.
+            receiver = common::MulticastReportReceiver::create(directory);
+        }
+        if (receiver) {
+            ret = receiver->subscribe(elt.getDeviceName());
+        }
+        return ret;
+    }
+
     void VRPNConnectionCollection::updateAll() {
-        for (auto &connPair : *m_connMap) {
-            connPair.second->mainloop();
+        for (auto &conn : *m_conns) {
+            conn->mainloop();
+        }
+        /// A subscriber known by several hosts just has nothing left to
+        /// deliver after the first time.
+        for (auto &subscriber : *m_trackerSubscribers) {
+            subscriber.second->deliverQueued();
         }
     }
 
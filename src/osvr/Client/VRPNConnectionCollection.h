@@ -28,6 +28,10 @@
 // Internal Includes
 #include <osvr/Util/SharedPtr.h>
 #include <osvr/Common/PathElementTypes.h>
+#include <osvr/Common/InProcessTrackerTransport_fwd.h>
+#include <osvr/Common/SharedMemoryReportPublisher_fwd.h>
+#include <osvr/Common/SharedMemoryReportRing.h>
+#include <osvr/Common/MulticastReports.h>
 #include <osvr/Client/Export.h>
 
 // Library/third-party includes
@@ -36,6 +40,7 @@
 // Standard includes
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace osvr {
 namespace client {
@@ -50,15 +55,80 @@ namespace client {
                                          std::string const &host);
         vrpn_ConnectionPtr
         getConnection(common::elements::DeviceElement const &elt);
+        /// @brief Mainloops each distinct connection once, dispatching any
+        /// received messages to the handlers registered on it, then delivers
+        /// any tracker reports queued on in-process transports.
         OSVR_CLIENT_EXPORT void updateAll();
+
+        /// @brief Use the given transport for tracker reports from devices on
+        /// the given host, instead of VRPN tracker messages.
+        ///
+        /// This collection subscribes to the transport once, however many
+        /// hosts it's set for, and updateAll() delivers only the reports
+        /// queued for that subscription.
+        OSVR_CLIENT_EXPORT void setInProcessTrackerTransport(
+            std::string const &host,
+            common::InProcessTrackerTransportPtr const &transport);
+
+        /// @brief Get this collection's subscriber to the in-process tracker
+        /// transport for the host of a device, if any.
+        common::InProcessTrackerSubscriberPtr
+        getInProcessTrackerSubscriber(
+            common::elements::DeviceElement const &elt) const;
+
+        /// @brief Sets the shared memory report rings announced by the server
+        /// on the given host, replacing any previously set.
+        OSVR_CLIENT_EXPORT void setSharedMemoryReports(
+            std::string const &host,
+            common::SharedMemoryReportDirectory const &directory);
+
+        /// @brief Opens the shared memory report ring for a device, if its
+        /// server announced one and it's on this machine.
+        common::SharedMemoryReportRingPtr openSharedMemoryReports(
+            common::elements::DeviceElement const &elt) const;
+
+        /// @brief Sets the multicast group and streams announced by the server
+        /// on the given host, replacing any previously set.
+        OSVR_CLIENT_EXPORT void
+        setMulticastReports(std::string const &host,
+                            common::MulticastReportDirectory const &directory);
+
+        /// @brief Opens a source of report records for a device to use
+        /// instead of VRPN messages, if its server offers one: a shared
+        /// memory ring if the server is on this machine, otherwise a
+        /// multicast subscription.
+        common::ReportSourcePtr
+        openReportSource(common::elements::DeviceElement const &elt) const;
+
         bool empty() const {
             return m_connMap->empty();
         }
 
       private:
+        void m_addDistinct(vrpn_ConnectionPtr const &conn);
         typedef std::unordered_map<std::string, vrpn_ConnectionPtr>
             ConnectionMap;
         shared_ptr<ConnectionMap> m_connMap;
+        /// Each connection only once, even if it's known by several hosts.
+        typedef std::vector<vrpn_ConnectionPtr> ConnectionList;
+        shared_ptr<ConnectionList> m_conns;
+        typedef std::unordered_map<std::string,
+                                   common::InProcessTrackerSubscriberPtr>
+            TrackerSubscriberMap;
+        shared_ptr<TrackerSubscriberMap> m_trackerSubscribers;
+        typedef std::unordered_map<std::string,
+                                   common::SharedMemoryReportDirectory>
+            ReportDirectoryMap;
+        shared_ptr<ReportDirectoryMap> m_reportDirectories;
+        typedef std::unordered_map<std::string,
+                                   common::MulticastReportDirectory>
+            MulticastDirectoryMap;
+        shared_ptr<MulticastDirectoryMap> m_multicastDirectories;
+        /// By sender, since a server is known by several hosts.
+        typedef std::unordered_map<uint64_t,
+                                   common::MulticastReportReceiverPtr>
+            MulticastReceiverMap;
+        shared_ptr<MulticastReceiverMap> m_multicastReceivers;
     };
 
 } // namespace client
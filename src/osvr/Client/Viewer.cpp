@@ -40,6 +40,10 @@ namespace client {
 
     OSVR_Pose3 Viewer::getPose() const {
         OSVR_TimeValue timestamp;
+        return getPose(timestamp);
+    }
+
+    OSVR_Pose3 Viewer::getPose(OSVR_TimeValue &timestamp) const {
         OSVR_Pose3 pose;
         bool hasState = m_head->getState<OSVR_PoseReport>(timestamp, pose);
         if (!hasState) {
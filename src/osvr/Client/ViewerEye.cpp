@@ -45,8 +45,12 @@ namespace client {
         if (!hasState) {
             throw NoPoseYet();
         }
+        return getPoseIsometry(pose);
+    }
+    Eigen::Isometry3d
+    ViewerEye::getPoseIsometry(OSVR_Pose3 const &viewerPose) const {
         Eigen::Isometry3d transformedPose =
-            util::fromPose(pose) * Eigen::Translation3d(m_offset) *
+            util::fromPose(viewerPose) * Eigen::Translation3d(m_offset) *
             Eigen::AngleAxisd(util::getRadians(m_opticalAxisOffsetY),
                               Eigen::Vector3d::UnitY());
         return transformedPose;
@@ -57,6 +61,12 @@ namespace client {
         util::toPose(transformedPose, pose);
         return pose;
     }
+    OSVR_Pose3 ViewerEye::getPose(OSVR_Pose3 const &viewerPose) const {
+        Eigen::Isometry3d transformedPose = getPoseIsometry(viewerPose);
+        OSVR_Pose3 pose;
+        util::toPose(transformedPose, pose);
+        return pose;
+    }
 
     bool ViewerEye::hasPose() const {
         return m_pose->hasStateForReportType<OSVR_PoseReport>();
@@ -67,6 +77,11 @@ namespace client {
         return transformedPose.inverse().matrix();
     }
 
+    Eigen::Matrix4d ViewerEye::getView(OSVR_Pose3 const &viewerPose) const {
+        Eigen::Isometry3d transformedPose = getPoseIsometry(viewerPose);
+        return transformedPose.inverse().matrix();
+    }
+
     util::Rectd ViewerEye::m_getRect(double near, double /*far*/ = 100) const {
         util::Rectd rect(m_unitBounds);
         // Scale the in-plane positions based on the near plane to put
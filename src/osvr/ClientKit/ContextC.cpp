@@ -26,6 +26,7 @@
 #include <osvr/Client/CreateContext.h>
 #include <osvr/ClientKit/ContextC.h>
 #include <osvr/Common/ClientContext.h>
+#include <osvr/Common/ClockSync.h>
 #include <osvr/Common/Tracing.h>
 #include <osvr/Util/GetEnvironmentVariable.h>
 #include <osvr/Util/Log.h>
@@ -69,6 +70,26 @@ OSVR_ReturnCode osvrClientCheckStatus(OSVR_ClientContext ctx) {
     return ctx->getStatus() ? OSVR_RETURN_SUCCESS : OSVR_RETURN_FAILURE;
 }
 
+OSVR_ReturnCode osvrClientGetServerClockOffset(OSVR_ClientContext ctx,
+                                               double *offset, double *drift,
+                                               double *roundTrip) {
+    if (!ctx || !offset) {
+        return OSVR_RETURN_FAILURE;
+    }
+    auto clock = ctx->getServerClock();
+    if (!clock || !clock->hasEstimate()) {
+        return OSVR_RETURN_FAILURE;
+    }
+    *offset = clock->getOffsetAt(osvr::util::time::getNow());
+    if (drift) {
+        *drift = clock->getDrift();
+    }
+    if (roundTrip) {
+        *roundTrip = clock->getRoundTrip();
+    }
+    return OSVR_RETURN_SUCCESS;
+}
+
 OSVR_ClientContext osvrClientInitHost(const char applicationIdentifier[],
                                       const char host[],
                                       uint32_t /*flags*/) {
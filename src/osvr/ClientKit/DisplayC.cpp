@@ -316,6 +316,23 @@ OSVR_ReturnCode osvrClientGetViewerEyeSurfaceDisplayInputIndex(
     return OSVR_RETURN_SUCCESS;
 }
 
+template <typename Scalar>
+static inline bool checkClippingPlanes(Scalar near, Scalar far) {
+    if (near == 0 || far == 0) {
+        OSVR_DEV_VERBOSE("Can't specify a near or far distance as 0!");
+        return false;
+    }
+    if (near < 0 || far < 0) {
+        OSVR_DEV_VERBOSE("Can't specify a negative near or far distance!");
+        return false;
+    }
+    if (near == far) {
+        OSVR_DEV_VERBOSE("Can't specify equal near and far distances!");
+        return false;
+    }
+    return true;
+}
+
 template <typename Scalar>
 static inline OSVR_ReturnCode
 getProjectionMatrixImpl(OSVR_DisplayConfig disp, OSVR_ViewerCount viewer,
@@ -327,16 +344,7 @@ getProjectionMatrixImpl(OSVR_DisplayConfig disp, OSVR_ViewerCount viewer,
     OSVR_VALIDATE_EYE_ID;
     OSVR_VALIDATE_SURFACE_ID;
     OSVR_VALIDATE_OUTPUT_PTR(mat, "projection matrix");
-    if (near == 0 || far == 0) {
-        OSVR_DEV_VERBOSE("Can't specify a near or far distance as 0!");
-        return OSVR_RETURN_FAILURE;
-    }
-    if (near < 0 || far < 0) {
-        OSVR_DEV_VERBOSE("Can't specify a negative near or far distance!");
-        return OSVR_RETURN_FAILURE;
-    }
-    if (near == far) {
-        OSVR_DEV_VERBOSE("Can't specify equal near and far distances!");
+    if (!checkClippingPlanes(near, far)) {
         return OSVR_RETURN_FAILURE;
     }
     osvr::util::matrixEigenAssign(
@@ -426,3 +434,76 @@ OSVR_ReturnCode osvrClientGetViewerEyeSurfaceRadialDistortion(
     }
     return OSVR_RETURN_FAILURE;
 }
+
+OSVR_ReturnCode osvrClientGetDisplayFrameSnapshot(
+    OSVR_DisplayConfig disp, double near, double far,
+    OSVR_MatrixConventions flags, OSVR_DisplaySurfaceSnapshot *snapshots,
+    size_t capacity, size_t *count) {
+    OSVR_VALIDATE_DISPLAY_CONFIG;
+    OSVR_VALIDATE_OUTPUT_PTR(count, "snapshot count");
+    if (!checkClippingPlanes(near, far)) {
+        return OSVR_RETURN_FAILURE;
+    }
+    auto &cfg = *disp->cfg;
+    auto numViewers = cfg.getNumViewers();
+    size_t needed = 0;
+    for (OSVR_ViewerCount viewer = 0; viewer < numViewers; ++viewer) {
+        if (!cfg.getViewer(viewer).hasPose()) {
+            OSVR_DEV_VERBOSE(
+                "Error getting display frame snapshot: no pose yet available");
+            return OSVR_RETURN_FAILURE;
+        }
+        auto numEyes = cfg.getNumViewerEyes(viewer);
+        for (OSVR_EyeCount eye = 0; eye < numEyes; ++eye) {
+            needed += cfg.getNumViewerEyeSurfaces(viewer, eye);
+        }
+    }
+    *count = needed;
+    if (capacity < needed) {
+        OSVR_DEV_VERBOSE("Display frame snapshot array too small: need "
+                         << needed << " entries, given " << capacity);
+        return OSVR_RETURN_FAILURE;
+    }
+    OSVR_VALIDATE_OUTPUT_PTR(snapshots, "snapshot array");
+
+    try {
+        auto out = snapshots;
+        for (OSVR_ViewerCount viewer = 0; viewer < numViewers; ++viewer) {
+            /// Only retrieve the tracker state once per viewer: all eyes are
+            /// computed from it.
+            OSVR_TimeValue timestamp;
+            auto viewerPose = cfg.getViewer(viewer).getPose(timestamp);
+            auto numEyes = cfg.getNumViewerEyes(viewer);
+            for (OSVR_EyeCount eye = 0; eye < numEyes; ++eye) {
+                auto &viewerEye = cfg.getViewerEye(viewer, eye);
+                auto eyePose = viewerEye.getPose(viewerPose);
+                Eigen::Matrix4d view = viewerEye.getView(viewerPose);
+                auto numSurfaces = cfg.getNumViewerEyeSurfaces(viewer, eye);
+                for (OSVR_SurfaceCount surface = 0; surface < numSurfaces;
+                     ++surface, ++out) {
+                    out->viewer = viewer;
+                    out->eye = eye;
+                    out->surface = surface;
+                    out->timestamp = timestamp;
+                    out->viewerPose = viewerPose;
+                    out->eyePose = eyePose;
+                    osvr::util::matrixEigenAssign(view, flags,
+                                                  out->viewMatrix);
+                    osvr::util::matrixEigenAssign(
+                        cfg.getViewerEyeSurface(viewer, eye, surface)
+                            .getProjection(near, far, flags),
+                        flags, out->projectionMatrix);
+                }
+            }
+        }
+        return OSVR_RETURN_SUCCESS;
+    } catch (osvr::client::NoPoseYet &) {
+        OSVR_DEV_VERBOSE(
+            "Error getting display frame snapshot: no pose yet available");
+        return OSVR_RETURN_FAILURE;
+    } catch (std::exception &e) {
+        OSVR_DEV_VERBOSE(
+            "Error getting display frame snapshot - exception: " << e.what());
+        return OSVR_RETURN_FAILURE;
+    }
+}
@@ -71,3 +71,40 @@ OSVR_ReturnCode osvrClientFreeInterface(OSVR_ClientContext ctx,
     }
     return OSVR_RETURN_SUCCESS;
 }
+
+OSVR_ReturnCode osvrClientSetInterfaceMaxReportRate(OSVR_ClientInterface iface,
+                                                    double maxRate) {
+    if (nullptr == iface) {
+        /// Return failure if given a null interface
+        return OSVR_RETURN_FAILURE;
+    }
+    if (!(maxRate >= 0)) {
+        /// Return failure if given a negative (or NaN) rate
+        return OSVR_RETURN_FAILURE;
+    }
+    iface->setMaxReportRate(maxRate);
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode
+osvrClientGetInterfaceReportAge(OSVR_ClientInterface iface,
+                                OSVR_ReportAgeStatistics *stats) {
+    if (nullptr == iface || nullptr == stats) {
+        return OSVR_RETURN_FAILURE;
+    }
+    auto const &age = iface->getReportAge();
+    stats->count = age.getCount();
+    stats->last = age.getLast();
+    stats->mean = age.getMean();
+    stats->min = age.getMin();
+    stats->max = age.getMax();
+    return OSVR_RETURN_SUCCESS;
+}
+
+OSVR_ReturnCode osvrClientResetInterfaceReportAge(OSVR_ClientInterface iface) {
+    if (nullptr == iface) {
+        return OSVR_RETURN_FAILURE;
+    }
+    iface->resetReportAge();
+    return OSVR_RETURN_SUCCESS;
+}
@@ -101,8 +101,13 @@ namespace common {
         if (ret != 0) {
             throw std::runtime_error("Could not pack message!");
         }
+        m_messagePacked(msgType, timestamp, buf, len);
     }
 
+    void BaseDevice::m_messagePacked(RawMessageType const &,
+                                     util::time::TimeValue const &,
+                                     const char *, size_t) {}
+
     void BaseDevice::m_setup(vrpn_ConnectionPtr conn, RawSenderType sender,
                              std::string const &name) {
         m_conn = conn;
@@ -160,6 +160,11 @@ ClientContextDeleter OSVR_ClientContextObject::getDeleter() const {
 
 bool OSVR_ClientContextObject::getStatus() const { return m_getStatus(); }
 
+osvr::common::ClockOffsetEstimator const *
+OSVR_ClientContextObject::getServerClock() const {
+    return m_getServerClock();
+}
+
 void OSVR_ClientContextObject::log(osvr::util::log::LogLevel severity,
                                    const char *message) {
     m_clientLogger->log(severity, message);
@@ -170,6 +175,12 @@ bool OSVR_ClientContextObject::m_getStatus() const {
     return true;
 }
 
+osvr::common::ClockOffsetEstimator const *
+OSVR_ClientContextObject::m_getServerClock() const {
+    // by default, no separate server.
+    return nullptr;
+}
+
 void OSVR_ClientContextObject::m_handleNewInterface(
     ::osvr::common::ClientInterfacePtr const &) {
     // by default do nothing
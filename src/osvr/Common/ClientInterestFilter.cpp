@@ -0,0 +1,132 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Internal Includes
+#include <osvr/Common/ClientInterestFilter.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace common {
+    bool ClientInterestFilter::Device::m_checkRate(
+        uint32_t stream, util::time::TimeValue const &tv) {
+        auto it = m_lastSent.find(stream);
+        if (it == end(m_lastSent)) {
+            m_lastSent.emplace(stream, tv);
+            return true;
+        }
+        auto elapsed = util::time::duration(tv, it->second);
+        /// A timestamp going backwards means a restarted or re-synced source:
+        /// start over rather than waiting for it to catch up.
+        if (elapsed >= m_minInterval || elapsed < 0) {
+            it->second = tv;
+            return true;
+        }
+        return false;
+    }
+
+    ClientInterestFilter::ClientInterestFilter() {}
+
+    ClientInterestFilter::DevicePtr
+    ClientInterestFilter::getDevice(std::string const &deviceName) {
+        auto &ret = m_devices[deviceName];
+        if (!ret) {
+            ret = make_shared<Device>();
+            m_update(deviceName, *ret);
+        }
+        return ret;
+    }
+
+    void ClientInterestFilter::setEnabled(bool enabled) {
+        if (enabled == m_enabled) {
+            return;
+        }
+        m_enabled = enabled;
+        m_update();
+    }
+
+    void ClientInterestFilter::setClientInterest(
+        std::string const &clientId, Interest const &interest,
+        util::time::TimeValue const &now) {
+        auto &record = m_clients[clientId];
+        record.lastHeard = now;
+        if (record.interest == interest) {
+            /// Just a refresh.
+            return;
+        }
+        record.interest = interest;
+        m_update();
+    }
+
+    void
+    ClientInterestFilter::expireClients(util::time::TimeValue const &now) {
+        bool changed = false;
+        for (auto it = begin(m_clients); it != end(m_clients);) {
+            if (util::time::duration(now, it->second.lastHeard) * 1000. >
+                EXPIRY_MS) {
+                it = m_clients.erase(it);
+                changed = true;
+            } else {
+                ++it;
+            }
+        }
+        if (changed) {
+            m_update();
+        }
+    }
+
+    void ClientInterestFilter::m_update() {
+        for (auto &dev : m_devices) {
+            m_update(dev.first, *dev.second);
+        }
+    }
+
+    void ClientInterestFilter::m_update(std::string const &deviceName,
+                                        Device &dev) const {
+        if (!m_enabled) {
+            dev.m_wanted = true;
+            dev.m_minInterval = 0;
+            return;
+        }
+        bool wanted = false;
+        double maxRate = 0;
+        for (auto const &client : m_clients) {
+            auto it = client.second.interest.find(deviceName);
+            if (it == end(client.second.interest)) {
+                continue;
+            }
+            maxRate = wanted ? combineMaxRates(maxRate, it->second)
+                             : it->second;
+            wanted = true;
+        }
+        dev.m_wanted = wanted;
+        dev.m_minInterval = (wanted && maxRate > 0) ? 1. / maxRate : 0;
+    }
+} // namespace common
+} // namespace osvr
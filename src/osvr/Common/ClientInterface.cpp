@@ -24,6 +24,7 @@
 
 // Internal Includes
 #include <osvr/Common/ClientInterface.h>
+#include <osvr/Common/ClientContext.h>
 #include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
@@ -34,7 +35,7 @@
 
 OSVR_ClientInterfaceObject::OSVR_ClientInterfaceObject(
     ::osvr::common::ClientContext &ctx, std::string const &path)
-    : m_ctx(ctx), m_path(path) {
+    : m_ctx(ctx), m_path(path), m_maxReportRate(0) {
     OSVR_DEV_VERBOSE("Interface initialized for " << m_path);
 }
 
@@ -43,3 +44,13 @@ std::string const &OSVR_ClientInterfaceObject::getPath() const {
 }
 
 void OSVR_ClientInterfaceObject::update() {}
+
+void OSVR_ClientInterfaceObject::recordReportAge(
+    const OSVR_TimeValue &timestamp) {
+    auto clock = m_ctx.getServerClock();
+    if (!clock || !clock->hasEstimate()) {
+        return;
+    }
+    auto now = clock->toServerTime(osvr::util::time::getNow());
+    m_reportAge.addSample(osvr::util::time::duration(now, timestamp));
+}
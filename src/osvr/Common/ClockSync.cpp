@@ -0,0 +1,169 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/ClockSync.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace osvr {
+namespace common {
+    const std::size_t ClockOffsetEstimator::WINDOW_SIZE;
+    const std::size_t ClockOffsetEstimator::HISTORY_SIZE;
+    const int64_t ClockOffsetEstimator::MIN_DRIFT_SPAN;
+    const double ClockOffsetEstimator::MAX_DRIFT = 1e-3;
+
+    ClockOffsetEstimator::ClockOffsetEstimator()
+        : m_sampleCount(0), m_drift(0) {}
+
+    bool ClockOffsetEstimator::addSample(ClockSyncSample const &sample) {
+        if (sample.getRoundTrip() < 0) {
+            return false;
+        }
+        m_history.push_back(sample);
+        if (m_history.size() > HISTORY_SIZE) {
+            m_history.pop_front();
+        }
+        ++m_sampleCount;
+
+        /// Shortest round trip among the most recent exchanges, preferring
+        /// the later of equals: less drift to extrapolate over.
+        auto windowBegin =
+            m_history.end() -
+            static_cast<std::ptrdiff_t>((std::min)(WINDOW_SIZE,
+                                                   m_history.size()));
+        auto best = windowBegin;
+        for (auto it = windowBegin; it != m_history.end(); ++it) {
+            if (it->getRoundTrip() <= best->getRoundTrip()) {
+                best = it;
+            }
+        }
+        m_best = *best;
+        m_estimateDrift();
+        return true;
+    }
+
+    void ClockOffsetEstimator::reset() {
+        m_history.clear();
+        m_sampleCount = 0;
+        m_best = ClockSyncSample();
+        m_drift = 0;
+    }
+
+    double ClockOffsetEstimator::getOffsetAt(
+        util::time::TimeValue const &clientTime) const {
+        return m_getOffsetAt(timeToMicroseconds(clientTime)) / 1e6;
+    }
+
+    util::time::TimeValue ClockOffsetEstimator::toServerTime(
+        util::time::TimeValue const &clientTime) const {
+        if (!hasEstimate()) {
+            return clientTime;
+        }
+        auto us = timeToMicroseconds(clientTime);
+        return microsecondsToTime(us + m_getOffsetAt(us));
+    }
+
+    int64_t ClockOffsetEstimator::m_getOffsetAt(int64_t clientTime) const {
+        return m_best.getOffset() +
+               static_cast<int64_t>(std::floor(
+                   m_drift * double(clientTime - m_best.getMidpoint()) +
+                   0.5));
+    }
+
+    void ClockOffsetEstimator::m_estimateDrift() {
+        m_drift = 0;
+        auto minRoundTrip = std::numeric_limits<int64_t>::max();
+        for (auto const &sample : m_history) {
+            minRoundTrip = (std::min)(minRoundTrip, sample.getRoundTrip());
+        }
+
+        /// Fit only to the exchanges whose offsets can be trusted about as
+        /// much as the best one's, relative to the best one's midpoint to
+        /// keep the sums small.
+        auto origin = m_best.getMidpoint();
+        auto isGood = [&](ClockSyncSample const &sample) {
+            return sample.getRoundTrip() <= 2 * minRoundTrip;
+        };
+        std::size_t n = 0;
+        double sumX = 0;
+        double sumY = 0;
+        int64_t first = std::numeric_limits<int64_t>::max();
+        int64_t last = std::numeric_limits<int64_t>::min();
+        for (auto const &sample : m_history) {
+            if (!isGood(sample)) {
+                continue;
+            }
+            ++n;
+            sumX += double(sample.getMidpoint() - origin);
+            sumY += double(sample.getOffset());
+            first = (std::min)(first, sample.getMidpoint());
+            last = (std::max)(last, sample.getMidpoint());
+        }
+        if (n < 3 || last - first < MIN_DRIFT_SPAN) {
+            return;
+        }
+        auto meanX = sumX / n;
+        auto meanY = sumY / n;
+        double sumXY = 0;
+        double sumXX = 0;
+        for (auto const &sample : m_history) {
+            if (!isGood(sample)) {
+                continue;
+            }
+            auto x = double(sample.getMidpoint() - origin) - meanX;
+            auto y = double(sample.getOffset()) - meanY;
+            sumXY += x * y;
+            sumXX += x * x;
+        }
+        m_drift = (std::max)(-MAX_DRIFT, (std::min)(MAX_DRIFT, sumXY / sumXX));
+    }
+
+    void ReportAgeStatistics::addSample(double age) {
+        ++m_count;
+        m_last = age;
+        if (m_count == 1) {
+            m_mean = m_min = m_max = age;
+            return;
+        }
+        m_mean += (age - m_mean) / double(m_count);
+        m_min = (std::min)(m_min, age);
+        m_max = (std::max)(m_max, age);
+    }
+
+    void ReportAgeStatistics::reset() {
+        m_count = 0;
+        m_last = 0;
+        m_mean = 0;
+        m_min = 0;
+        m_max = 0;
+    }
+} // namespace common
+} // namespace osvr
@@ -39,6 +39,12 @@ namespace common {
         auto ret = make_shared<DeviceWrapper>(name, conn, true);
         return ret;
     }
+    BaseDevicePtr
+    createSharedConnectionClientDevice(std::string const &name,
+                                       vrpn_ConnectionPtr const &conn) {
+        auto ret = make_shared<DeviceWrapper>(name, conn, true, false);
+        return ret;
+    }
     BaseDevicePtr createServerDevice(std::string const &name,
                                      vrpn_ConnectionPtr const &conn) {
         auto ret = make_shared<DeviceWrapper>(name, conn, false);
@@ -35,9 +35,10 @@ namespace osvr {
 namespace common {
 
     DeviceWrapper::DeviceWrapper(std::string const &name,
-                                 vrpn_ConnectionPtr const &conn, bool client)
+                                 vrpn_ConnectionPtr const &conn, bool client,
+                                 bool serviceConnection)
         : vrpn_BaseClass(name.c_str(), conn.get()), m_conn(conn),
-          m_client(client) {
+          m_client(client), m_serviceConnection(serviceConnection) {
         vrpn_BaseClass::init();
         m_setup(conn, common::RawSenderType(d_sender_id), name);
 
@@ -53,8 +54,10 @@ namespace common {
 
     void DeviceWrapper::m_update() {
         if (m_client) {
-            m_getConnection()->mainloop();
-            client_mainloop();
+            if (m_serviceConnection) {
+                m_getConnection()->mainloop();
+                client_mainloop();
+            }
         } else {
             server_mainloop();
         }
@@ -42,8 +42,10 @@ namespace common {
     /// devices on top of VRPN.
     class DeviceWrapper : public vrpn_BaseClass, public BaseDevice {
       public:
+        /// @param serviceConnection For client devices, whether update()
+        /// should mainloop the connection, or leave that to its owner.
         DeviceWrapper(std::string const &name, vrpn_ConnectionPtr const &conn,
-                      bool client);
+                      bool client, bool serviceConnection = true);
         virtual ~DeviceWrapper();
 
       private:
@@ -58,6 +60,7 @@ namespace common {
         /// @}
         vrpn_ConnectionPtr m_conn;
         bool m_client;
+        bool m_serviceConnection;
     };
 } // namespace common
 } // namespace osvr
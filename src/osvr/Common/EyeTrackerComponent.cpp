@@ -28,6 +28,7 @@
 #include <osvr/Common/BaseDevice.h>
 #include <osvr/Common/Serialization.h>
 #include <osvr/Common/Buffer.h>
+#include <osvr/Common/FixedLayoutSerialization.h>
 #include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
@@ -43,6 +44,8 @@ namespace common {
 
             MessageSerialization() {}
 
+            typedef serialization::FixedLayout<OSVR_ChannelCount> fixed_layout;
+
             template <typename T> void processMessage(T &p) {
                 p(m_notification.sensor);
             }
@@ -74,10 +77,10 @@ namespace common {
     EyeTrackerComponent::sendNotification(OSVR_ChannelCount sensor,
                                           OSVR_TimeValue const &timestamp) {
 
-        Buffer<> buf;
         OSVR_EyeNotification notification;
         notification.sensor = sensor;
         messages::EyeRegion::MessageSerialization msg(notification);
+        FixedMessageBuffer<messages::EyeRegion::MessageSerialization> buf;
 
         serialize(buf, msg);
 
@@ -88,11 +91,11 @@ namespace common {
     EyeTrackerComponent::m_handleEyeRegion(void *userdata,
                                            vrpn_HANDLERPARAM p) {
         auto self = static_cast<EyeTrackerComponent *>(userdata);
-        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
-
-        messages::EyeRegion::MessageSerialization msg;
-        deserialize(bufReader, msg);
-        auto data = msg.getNotification();
+        auto view =
+            viewFixedMessage<messages::EyeRegion::MessageSerialization>(
+                p.buffer, p.payload_len);
+        OSVR_EyeNotification data;
+        data.sensor = view.get<0>();
         auto timestamp = util::time::fromStructTimeval(p.msg_time);
 
         for (auto const &cb : self->m_cb) {
@@ -53,6 +53,11 @@ namespace common {
         }
     }
 
+    void GeneralizedTransform::nest(GeneralizedTransform const &transform) {
+        auto const &levels = transform.container();
+        container().insert(container().end(), levels.begin(), levels.end());
+    }
+
     void GeneralizedTransform::wrap(Json::Value const &transform) {
         Json::Value newLayer{transform};
         if (newLayer.isObject()) {
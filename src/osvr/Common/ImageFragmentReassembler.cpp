@@ -0,0 +1,188 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "ImageFragmentReassembler.h"
+#include <osvr/Util/AlignedMemoryPool.h>
+#include <osvr/Util/Verbosity.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <utility>
+
+namespace osvr {
+namespace common {
+    static inline uint32_t getBufferSize(OSVR_ImagingMetadata const &meta) {
+        return meta.height * meta.width * meta.depth * meta.channels;
+    }
+    static inline uint32_t getRowSize(OSVR_ImagingMetadata const &meta) {
+        return meta.width * meta.depth * meta.channels;
+    }
+
+    struct ImageFragmentReassembler::FragmentedFrame {
+        /// @brief Begins reassembling a new frame, abandoning any incomplete
+        /// one.
+        ///
+        /// @return false if the header doesn't describe a frame we can handle.
+        bool start(ImageFragmentHeader const &header) {
+            data.clear();
+            bytesReceived = 0;
+            auto rawSize = getBufferSize(header.metadata);
+            if (rawSize == 0) {
+                return false;
+            }
+            switch (header.codec) {
+            case ImageWireCodec::Raw:
+                if (header.encodedSize != rawSize) {
+                    return false;
+                }
+                break;
+            case ImageWireCodec::RowDeltaRLE:
+                if (header.encodedSize >
+                    getMaxRowDeltaRLESize(getRowSize(header.metadata),
+                                          header.metadata.height)) {
+                    return false;
+                }
+                break;
+            default:
+                OSVR_DEV_VERBOSE("Unrecognized image codec "
+                                 << int(header.codec));
+                return false;
+            }
+            frameSequence = header.frameSequence;
+            metadata = header.metadata;
+            codec = header.codec;
+            bigEndian = header.bigEndian;
+            data.resize(header.encodedSize);
+            return true;
+        }
+
+        /// @brief Adds the next fragment of the current frame.
+        ///
+        /// @return false if it isn't the next fragment, in which case the
+        /// frame is abandoned.
+        bool add(ImageFragmentHeader const &header, char const *fragmentData) {
+            if (data.empty() || header.frameSequence != frameSequence ||
+                header.fragmentOffset != bytesReceived ||
+                header.fragmentLength > data.size() - bytesReceived) {
+                data.clear();
+                return false;
+            }
+            std::copy(fragmentData, fragmentData + header.fragmentLength,
+                      data.begin() + bytesReceived);
+            bytesReceived += header.fragmentLength;
+            return true;
+        }
+
+        bool complete() const {
+            return !data.empty() && bytesReceived == data.size();
+        }
+
+        /// @brief Decodes the completed frame into a newly-allocated image
+        /// buffer, leaving us ready for the next frame.
+        ///
+        /// @return an empty pointer if the frame couldn't be decoded.
+        BufferPtr finish() {
+            auto rawSize = getBufferSize(metadata);
+            auto img = util::makePooledImageBuffer(rawSize);
+            bool success = true;
+            if (codec == ImageWireCodec::Raw) {
+                std::copy(data.begin(), data.end(), img.get());
+            } else {
+                success = decodeRowDeltaRLE(data.data(), data.size(),
+                                            getRowSize(metadata),
+                                            metadata.height, img.get());
+            }
+            data.clear();
+            if (!success) {
+                return BufferPtr();
+            }
+            if (bigEndian != HOST_IS_BIG_ENDIAN) {
+                swapSampleByteOrder(img.get(), rawSize, metadata.depth);
+            }
+            return BufferPtr(std::move(img));
+        }
+
+        uint32_t frameSequence = 0;
+        OSVR_ImagingMetadata metadata;
+        ImageWireCodec codec = ImageWireCodec::Raw;
+        bool bigEndian = false;
+        /// @brief Encoded frame data: empty if we're not in the middle of
+        /// receiving a frame.
+        std::vector<char> data;
+        std::size_t bytesReceived = 0;
+    };
+
+    ImageFragmentReassembler::ImageFragmentReassembler() = default;
+
+    ImageFragmentReassembler::~ImageFragmentReassembler() = default;
+
+    ImageFragmentReassembler::BufferPtr
+    ImageFragmentReassembler::addFragment(ImageFragmentHeader const &header,
+                                          char const *fragmentData) {
+        if (m_frames.size() <= header.sensor) {
+            m_frames.resize(header.sensor + 1);
+        }
+        auto &frame = m_frames[header.sensor];
+        if (!frame) {
+            frame.reset(new FragmentedFrame);
+        }
+        if (header.fragmentOffset == 0 && !frame->start(header)) {
+            return BufferPtr();
+        }
+        if (!frame->add(header, fragmentData) || !frame->complete()) {
+            /// Either we missed part of this frame, or there's more to come.
+            return BufferPtr();
+        }
+        auto ret = frame->finish();
+        if (!ret) {
+            OSVR_DEV_VERBOSE("Could not decode fragmented image frame");
+        }
+        return ret;
+    }
+
+    bool ImageFragmentReassembler::alreadyDelivered(
+        OSVR_ChannelCount sensor,
+        util::time::TimeValue const &timestamp) const {
+        return sensor < m_lastDelivered.size() &&
+               m_lastDelivered[sensor] == timestamp;
+    }
+
+    bool ImageFragmentReassembler::markDelivered(
+        OSVR_ChannelCount sensor, util::time::TimeValue const &timestamp) {
+        /// Messages for the same frame all carry its timestamp.
+        if (alreadyDelivered(sensor, timestamp)) {
+            return false;
+        }
+        if (m_lastDelivered.size() <= sensor) {
+            m_lastDelivered.resize(sensor + 1);
+        }
+        m_lastDelivered[sensor] = timestamp;
+        return true;
+    }
+} // namespace common
+} // namespace osvr
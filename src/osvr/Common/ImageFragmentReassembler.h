@@ -0,0 +1,103 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ImageFragmentReassembler_h_GUID_1C22316F_0176_4449_8038_BE326C16CDE8
+#define INCLUDED_ImageFragmentReassembler_h_GUID_1C22316F_0176_4449_8038_BE326C16CDE8
+
+// Internal Includes
+#include "ImageWireCodec.h"
+#include <osvr/Util/ChannelCountC.h>
+#include <osvr/Util/ImagingReportTypesC.h>
+#include <osvr/Util/SharedPtr.h>
+#include <osvr/Util/StdInt.h>
+#include <osvr/Util/TimeValue.h>
+#include <osvr/Util/UniquePtr.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <vector>
+
+namespace osvr {
+namespace common {
+    /// @brief Everything but the data in an imagefragment message.
+    struct ImageFragmentHeader {
+        OSVR_ImagingMetadata metadata;
+        OSVR_ChannelCount sensor;
+        /// @brief Identifies the frame this is a fragment of.
+        uint32_t frameSequence;
+        ImageWireCodec codec;
+        /// @brief Byte order of the samples, if depth > 1
+        bool bigEndian;
+        /// @brief Total size of the (encoded) frame data.
+        uint32_t encodedSize;
+        /// @brief Position of this fragment in the encoded frame data.
+        uint32_t fragmentOffset;
+        uint32_t fragmentLength;
+    };
+
+    /// @brief The receiving end of imaging frames: reassembles frames sent in
+    /// fragments, one per sensor, and keeps track of the frames delivered,
+    /// since the same frame may arrive by more than one message.
+    class ImageFragmentReassembler {
+      public:
+        typedef shared_ptr<OSVR_ImageBufferElement> BufferPtr;
+
+        ImageFragmentReassembler();
+        ~ImageFragmentReassembler();
+
+        /// @brief Adds a fragment of a frame.
+        ///
+        /// The fragment at offset 0 starts a frame, abandoning any incomplete
+        /// one for the same sensor. Each following fragment must pick up
+        /// exactly where the last one left off, or the frame is abandoned.
+        ///
+        /// @return The decoded frame, if this fragment completed it.
+        BufferPtr addFragment(ImageFragmentHeader const &header,
+                              char const *fragmentData);
+
+        /// @brief Whether a frame with this timestamp was already delivered
+        /// for this sensor.
+        bool alreadyDelivered(OSVR_ChannelCount sensor,
+                              util::time::TimeValue const &timestamp) const;
+
+        /// @brief Records that a frame is being delivered.
+        ///
+        /// @return false if it was already delivered, and so shouldn't be
+        /// delivered again.
+        bool markDelivered(OSVR_ChannelCount sensor,
+                           util::time::TimeValue const &timestamp);
+
+      private:
+        struct FragmentedFrame;
+        /// @brief One for each sensor
+        std::vector<unique_ptr<FragmentedFrame>> m_frames;
+        /// @brief Timestamp of the last frame delivered, one for each sensor.
+        std::vector<util::time::TimeValue> m_lastDelivered;
+    };
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ImageFragmentReassembler_h_GUID_1C22316F_0176_4449_8038_BE326C16CDE8
@@ -0,0 +1,164 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "ImageWireCodec.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+
+namespace osvr {
+namespace common {
+    namespace {
+        /// @brief Longest run or literal sequence a PackBits header byte can
+        /// describe.
+        static const std::size_t MAX_PACKET = 128;
+
+        /// @brief Length of the run of identical bytes starting at `begin`,
+        /// up to MAX_PACKET.
+        inline std::size_t runLength(uint8_t const *begin,
+                                     uint8_t const *end) {
+            auto limit = std::min<std::size_t>(end - begin, MAX_PACKET);
+            std::size_t ret = 1;
+            while (ret < limit && begin[ret] == begin[0]) {
+                ++ret;
+            }
+            return ret;
+        }
+
+        /// @brief PackBits-encodes one row, appending to `out`.
+        inline void packRow(uint8_t const *row, std::size_t n,
+                            std::vector<char> &out) {
+            auto end = row + n;
+            auto it = row;
+            while (it != end) {
+                auto run = runLength(it, end);
+                if (run > 1) {
+                    out.push_back(static_cast<char>(1 - int(run)));
+                    out.push_back(static_cast<char>(*it));
+                    it += run;
+                    continue;
+                }
+                /// Literal sequence: extends until a run worth encoding as
+                /// such (3 or more bytes) begins.
+                auto litEnd = it + 1;
+                while (litEnd != end && std::size_t(litEnd - it) < MAX_PACKET &&
+                       runLength(litEnd, end) < 3) {
+                    ++litEnd;
+                }
+                out.push_back(static_cast<char>(litEnd - it - 1));
+                out.insert(out.end(), it, litEnd);
+                it = litEnd;
+            }
+        }
+    } // namespace
+
+    bool encodeRowDeltaRLE(OSVR_ImageBufferElement const *img,
+                           std::size_t rowBytes, std::size_t rows,
+                           std::size_t maxBytes, std::vector<char> &out) {
+        auto initialSize = out.size();
+        std::vector<uint8_t> delta(rowBytes);
+        for (std::size_t y = 0; y < rows; ++y) {
+            auto row = img + y * rowBytes;
+            if (y == 0) {
+                std::copy(row, row + rowBytes, delta.begin());
+            } else {
+                auto prev = row - rowBytes;
+                for (std::size_t x = 0; x < rowBytes; ++x) {
+                    delta[x] = static_cast<uint8_t>(row[x] - prev[x]);
+                }
+            }
+            packRow(delta.data(), rowBytes, out);
+            if (out.size() - initialSize > maxBytes) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool decodeRowDeltaRLE(char const *data, std::size_t len,
+                           std::size_t rowBytes, std::size_t rows,
+                           OSVR_ImageBufferElement *img) {
+        auto in = reinterpret_cast<uint8_t const *>(data);
+        auto inEnd = in + len;
+        for (std::size_t y = 0; y < rows; ++y) {
+            auto row = img + y * rowBytes;
+            std::size_t x = 0;
+            while (x < rowBytes) {
+                if (in == inEnd) {
+                    return false;
+                }
+                auto header = static_cast<int8_t>(*in++);
+                if (header == -128) {
+                    /// No-op per PackBits, though we never emit it.
+                    continue;
+                }
+                if (header >= 0) {
+                    std::size_t n = header + 1;
+                    if (std::size_t(inEnd - in) < n || rowBytes - x < n) {
+                        return false;
+                    }
+                    std::copy(in, in + n, row + x);
+                    in += n;
+                    x += n;
+                } else {
+                    std::size_t n = 1 - header;
+                    if (in == inEnd || rowBytes - x < n) {
+                        return false;
+                    }
+                    std::fill_n(row + x, n, *in++);
+                    x += n;
+                }
+            }
+            if (y > 0) {
+                auto prev = row - rowBytes;
+                for (x = 0; x < rowBytes; ++x) {
+                    row[x] = static_cast<OSVR_ImageBufferElement>(row[x] +
+                                                                  prev[x]);
+                }
+            }
+        }
+        return in == inEnd;
+    }
+
+    std::size_t getMaxRowDeltaRLESize(std::size_t rowBytes,
+                                      std::size_t rows) {
+        /// Worst case is all literals: one header byte per MAX_PACKET bytes.
+        return rows * (rowBytes + (rowBytes + MAX_PACKET - 1) / MAX_PACKET);
+    }
+
+    void swapSampleByteOrder(OSVR_ImageBufferElement *img, std::size_t bytes,
+                             std::size_t depth) {
+        if (depth < 2) {
+            return;
+        }
+        for (std::size_t i = 0; i + depth <= bytes; i += depth) {
+            std::reverse(img + i, img + i + depth);
+        }
+    }
+} // namespace common
+} // namespace osvr
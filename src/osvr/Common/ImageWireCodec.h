@@ -0,0 +1,93 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ImageWireCodec_h_GUID_DCCADCEF_634D_4C00_8826_5A4330303A03
+#define INCLUDED_ImageWireCodec_h_GUID_DCCADCEF_634D_4C00_8826_5A4330303A03
+
+// Internal Includes
+#include <osvr/Common/Endianness.h>
+#include <osvr/Util/ImagingReportTypesC.h>
+#include <osvr/Util/StdInt.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <cstddef>
+#include <vector>
+
+namespace osvr {
+namespace common {
+#ifdef OSVR_IS_BIG_ENDIAN
+    static const bool HOST_IS_BIG_ENDIAN = true;
+#else
+    static const bool HOST_IS_BIG_ENDIAN = false;
+#endif
+
+    /// @brief How the pixel data of an image sent in fragments over the wire
+    /// is encoded. Values are part of the wire format.
+    enum class ImageWireCodec : uint8_t {
+        /// @brief Pixel data as-is.
+        Raw = 0,
+        /// @brief Each row replaced by its bytewise difference from the row
+        /// above (modulo 256), then each row run-length encoded PackBits
+        /// style. Lossless, cheap, and effective on camera and IR images,
+        /// whose rows tend to resemble their neighbors.
+        RowDeltaRLE = 1
+    };
+
+    /// @brief Encodes an image with ImageWireCodec::RowDeltaRLE, appending to
+    /// `out`.
+    ///
+    /// @param maxBytes Give up once the encoded data would exceed this size
+    /// (typically the raw size, since there's no sense in sending an
+    /// "compressed" image larger than the original)
+    ///
+    /// @return false if we gave up, in which case the contents of `out` are
+    /// unspecified.
+    bool encodeRowDeltaRLE(OSVR_ImageBufferElement const *img,
+                           std::size_t rowBytes, std::size_t rows,
+                           std::size_t maxBytes, std::vector<char> &out);
+
+    /// @brief Decodes an image encoded by encodeRowDeltaRLE() into `img`, which
+    /// must have room for `rowBytes * rows` bytes.
+    ///
+    /// @return false if the data is malformed or doesn't describe an image of
+    /// the given size.
+    bool decodeRowDeltaRLE(char const *data, std::size_t len,
+                           std::size_t rowBytes, std::size_t rows,
+                           OSVR_ImageBufferElement *img);
+
+    /// @brief The largest an image with the given dimensions can get when
+    /// encoded with ImageWireCodec::RowDeltaRLE
+    std::size_t getMaxRowDeltaRLESize(std::size_t rowBytes, std::size_t rows);
+
+    /// @brief Reverses the byte order of each `depth`-byte sample in an image,
+    /// for images received from a machine with the opposite byte order.
+    void swapSampleByteOrder(OSVR_ImageBufferElement *img, std::size_t bytes,
+                             std::size_t depth);
+} // namespace common
+} // namespace osvr
+
+#endif // INCLUDED_ImageWireCodec_h_GUID_DCCADCEF_634D_4C00_8826_5A4330303A03
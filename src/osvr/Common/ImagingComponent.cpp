@@ -27,7 +27,9 @@
 #include <osvr/Common/BaseDevice.h>
 #include <osvr/Common/Serialization.h>
 #include <osvr/Common/Buffer.h>
-#include <osvr/Util/AlignedMemoryUniquePtr.h>
+#include "ImageFragmentReassembler.h"
+#include "ImageWireCodec.h"
+#include <osvr/Util/AlignedMemoryPool.h>
 #include <osvr/Util/Flag.h>
 #include <osvr/Util/Verbosity.h>
 
@@ -35,6 +37,7 @@
 // - none
 
 // Standard includes
+#include <algorithm>
 #include <sstream>
 #include <utility>
 
@@ -43,6 +46,9 @@ namespace common {
     static inline uint32_t getBufferSize(OSVR_ImagingMetadata const &meta) {
         return meta.height * meta.width * meta.depth * meta.channels;
     }
+    static inline uint32_t getRowSize(OSVR_ImagingMetadata const &meta) {
+        return meta.width * meta.depth * meta.channels;
+    }
     namespace messages {
         namespace {
             template <typename T>
@@ -72,7 +78,7 @@ namespace common {
 
             template <typename T>
             void allocateBuffer(T &, size_t bytes, std::true_type const &) {
-                m_imgBuf = util::makeAlignedImageBuffer(bytes);
+                m_imgBuf = util::makePooledImageBuffer(bytes);
             }
 
             template <typename T>
@@ -193,6 +199,58 @@ namespace common {
         const char *ImagePlacedInSharedMemory::identifier() {
             return "com.osvr.imaging.imageplacedinsharedmemory";
         }
+
+        namespace {
+            template <typename T>
+            void process(ImageFragmentHeader &header, T &p) {
+                process(header.metadata, p);
+                p(header.sensor);
+                p(header.frameSequence);
+                p(header.codec,
+                  serialization::EnumAsIntegerTag<ImageWireCodec, uint8_t>());
+                p(header.bigEndian);
+                p(header.encodedSize);
+                p(header.fragmentOffset);
+                p(header.fragmentLength);
+            }
+        } // namespace
+
+        class ImageFragment::MessageSerialization {
+          public:
+            MessageSerialization() : m_data(nullptr) {}
+            MessageSerialization(ImageFragmentHeader const &header,
+                                 char const *data)
+                : m_header(header), m_data(data) {}
+
+            /// When deserializing, only the header is read: the fragment data
+            /// follows it in the buffer, for the caller to copy directly to
+            /// wherever the frame is being reassembled.
+            template <typename T> void processMessage(T &p) {
+                process(m_header, p);
+                processData(p, p.isDeserialize());
+            }
+
+            ImageFragmentHeader const &getHeader() const { return m_header; }
+
+          private:
+            template <typename T>
+            void processData(T &p, std::false_type const &) {
+                p(m_data, serialization::AlignedDataBufferTag(
+                              m_header.fragmentLength));
+            }
+            template <typename T>
+            void processData(T &, std::true_type const &) {}
+
+            ImageFragmentHeader m_header;
+            char const *m_data;
+        };
+        const char *ImageFragment::identifier() {
+            return "com.osvr.imaging.imagefragment";
+        }
+
+        const char *ImageFragmentsRequested::identifier() {
+            return "com.osvr.imaging.fragmentsrequested";
+        }
     } // namespace messages
 
     shared_ptr<ImagingComponent>
@@ -200,7 +258,10 @@ namespace common {
         shared_ptr<ImagingComponent> ret(new ImagingComponent());
         return ret;
     }
-    ImagingComponent::ImagingComponent() {}
+    ImagingComponent::ImagingComponent()
+        : m_sendFragments(false), m_fragmentedFrameSequence(0),
+          m_reassembler(new ImageFragmentReassembler),
+          m_fragmentsRequested(false) {}
 
     ImagingComponent::~ImagingComponent() = default;
 
@@ -231,7 +292,9 @@ namespace common {
         OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp) {
 
         auto imageBufferSize = getBufferSize(metadata);
-        auto imageBufferCopy = util::makeAlignedImageBuffer(imageBufferSize);
+        /// Comes from, and is returned by the receiving end to, the
+        /// process-wide image buffer pool.
+        auto imageBufferCopy = util::makePooledImageBuffer(imageBufferSize);
         memcpy(imageBufferCopy.get(), imageData, imageBufferSize);
 
         Buffer<> buf;
@@ -291,24 +354,75 @@ namespace common {
     bool ImagingComponent::m_sendImageDataOnTheWire(
         OSVR_ImagingMetadata metadata, OSVR_ImageBufferElement *imageData,
         OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp) {
-        /// @todo currently only handle 8bit data over network
-        if (metadata.depth != 1) {
+        /// Small 8-bit frames go in a single message, as they always have;
+        /// anything else is sent in fragments, but only once some client has
+        /// asked for them: local clients already have the frame.
+        if (metadata.depth == 1 &&
+            getBufferSize(metadata) < vrpn_CONNECTION_TCP_BUFLEN) {
+            Buffer<> buf;
+            messages::ImageRegion::MessageSerialization msg(metadata,
+                                                            imageData, sensor);
+            serialize(buf, msg);
+            if (buf.size() <= vrpn_CONNECTION_TCP_BUFLEN) {
+                m_getParent().packMessage(buf, imageRegion.getMessageType(),
+                                          timestamp);
+                m_getParent().sendPending();
+                return true;
+            }
+        }
+        if (!m_sendFragments) {
             return false;
         }
-        Buffer<> buf;
-        messages::ImageRegion::MessageSerialization msg(metadata, imageData,
-                                                        sensor);
-        serialize(buf, msg);
-        if (buf.size() > vrpn_CONNECTION_TCP_BUFLEN) {
-#if 0
-            OSVR_DEV_VERBOSE("Skipping imaging message: size is "
-                             << buf.size() << " vs the maximum of "
-                             << vrpn_CONNECTION_TCP_BUFLEN);
-#endif
+        return m_sendImageDataInFragments(metadata, imageData, sensor,
+                                          timestamp);
+    }
+
+    bool ImagingComponent::m_sendImageDataInFragments(
+        OSVR_ImagingMetadata metadata, OSVR_ImageBufferElement *imageData,
+        OSVR_ChannelCount sensor, OSVR_TimeValue const &timestamp) {
+        /// Room left in each message for the fragment header: far more than
+        /// it actually needs.
+        static const uint32_t FRAGMENT_HEADER_ALLOWANCE = 256;
+        static const uint32_t MAX_FRAGMENT_LENGTH =
+            vrpn_CONNECTION_TCP_BUFLEN - FRAGMENT_HEADER_ALLOWANCE;
+
+        uint32_t rawSize = getBufferSize(metadata);
+        if (rawSize == 0) {
             return false;
         }
-        m_getParent().packMessage(buf, imageRegion.getMessageType(), timestamp);
-        m_getParent().sendPending();
+        ImageFragmentHeader header;
+        header.metadata = metadata;
+        header.sensor = sensor;
+        header.frameSequence = m_fragmentedFrameSequence++;
+        header.bigEndian = HOST_IS_BIG_ENDIAN;
+
+        /// Compress if it actually makes the frame smaller.
+        header.codec = ImageWireCodec::Raw;
+        header.encodedSize = rawSize;
+        auto payload = reinterpret_cast<char const *>(imageData);
+        m_encodeBuf.clear();
+        if (encodeRowDeltaRLE(imageData, getRowSize(metadata), metadata.height,
+                              rawSize - 1, m_encodeBuf)) {
+            header.codec = ImageWireCodec::RowDeltaRLE;
+            header.encodedSize = static_cast<uint32_t>(m_encodeBuf.size());
+            payload = m_encodeBuf.data();
+        }
+
+        Buffer<> buf;
+        uint32_t offset = 0;
+        while (offset < header.encodedSize) {
+            header.fragmentOffset = offset;
+            header.fragmentLength =
+                (std::min)(header.encodedSize - offset, MAX_FRAGMENT_LENGTH);
+            messages::ImageFragment::MessageSerialization msg(header,
+                                                              payload + offset);
+            buf.getContents().clear();
+            serialize(buf, msg);
+            m_getParent().packMessage(buf, imageFragment.getMessageType(),
+                                      timestamp);
+            m_getParent().sendPending();
+            offset += header.fragmentLength;
+        }
         return true;
     }
 
@@ -319,12 +433,41 @@ namespace common {
 
         messages::ImageRegion::MessageSerialization msg;
         deserialize(bufReader, msg);
-        auto data = msg.getData();
         auto timestamp = util::time::fromStructTimeval(p.msg_time);
+        self->m_deliver(msg.getData(), timestamp);
+        return 0;
+    }
+
+    int VRPN_CALLBACK
+    ImagingComponent::m_handleImageFragment(void *userdata,
+                                            vrpn_HANDLERPARAM p) {
+        auto self = static_cast<ImagingComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+
+        messages::ImageFragment::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        auto const &header = msg.getHeader();
+        auto fragmentData = bufReader.readBytes(header.fragmentLength);
+        auto timestamp = util::time::fromStructTimeval(p.msg_time);
+        if (self->m_reassembler->alreadyDelivered(header.sensor, timestamp)) {
+            /// Got it from shared memory: don't bother reassembling it.
+            return 0;
+        }
+        auto buffer = self->m_reassembler->addFragment(header, fragmentData);
+        if (buffer) {
+            self->m_deliver(ImageData{header.sensor, header.metadata, buffer},
+                            timestamp);
+        }
+        return 0;
+    }
 
-        self->m_checkFirst(data.metadata);
-        for (auto const &cb : self->m_cb) {
-            cb(data, timestamp);
+    int VRPN_CALLBACK
+    ImagingComponent::m_handleFragmentsRequested(void *userdata,
+                                                 vrpn_HANDLERPARAM) {
+        auto self = static_cast<ImagingComponent *>(userdata);
+        if (!self->m_sendFragments) {
+            OSVR_DEV_VERBOSE("A client asked for imaging frames in fragments");
+            self->m_sendFragments = true;
         }
         return 0;
     }
@@ -343,13 +486,11 @@ namespace common {
         data.metadata = msg.metadata;
         data.buffer.reset(
             reinterpret_cast<OSVR_ImageBufferElement *>(msg.buffer),
-            &util::alignedFree);
+            util::PooledAlignedDeleter(
+                util::AlignedMemoryPool::getImageBufferPool(),
+                getBufferSize(msg.metadata)));
         auto timestamp = util::time::fromStructTimeval(p.msg_time);
-
-        self->m_checkFirst(msg.metadata);
-        for (auto const &cb : self->m_cb) {
-            cb(data, timestamp);
-        }
+        self->m_deliver(data, timestamp);
         return 0;
     }
 #endif
@@ -367,6 +508,7 @@ namespace common {
         if (IPCRingBuffer::getABILevel() != msg.abiLevel) {
             /// Can't interoperate with this server over shared memory
             OSVR_DEV_VERBOSE("Can't handle SHM ABI level " << msg.abiLevel);
+            self->m_requestFragments();
             return 0;
         }
         self->m_growShmVecIfRequired(msg.sensor);
@@ -386,6 +528,7 @@ namespace common {
             /// client
             OSVR_DEV_VERBOSE("Can't find desired IPC ring buffer "
                              << msg.shmName);
+            self->m_requestFragments();
             return 0;
         }
 
@@ -393,12 +536,8 @@ namespace common {
         auto getResult = shm->get(msg.seqNum);
         if (getResult) {
             auto bufptr = getResult.getBufferSmartPointer();
-            self->m_checkFirst(msg.metadata);
-            auto data = ImageData{msg.sensor, msg.metadata, bufptr};
-
-            for (auto const &cb : self->m_cb) {
-                cb(data, timestamp);
-            }
+            self->m_deliver(ImageData{msg.sensor, msg.metadata, bufptr},
+                            timestamp);
         }
         return 0;
     }
@@ -412,6 +551,9 @@ namespace common {
                 &ImagingComponent::m_handleImagePlacedInSharedMemory, this,
                 imagePlacedInSharedMemory.getMessageType());
 
+            m_registerHandler(&ImagingComponent::m_handleImageFragment, this,
+                              imageFragment.getMessageType());
+
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
             m_registerHandler(
                 &ImagingComponent::m_handleImagePlacedInProcessMemory, this,
@@ -423,11 +565,36 @@ namespace common {
     void ImagingComponent::m_parentSet() {
         m_getParent().registerMessageType(imageRegion);
         m_getParent().registerMessageType(imagePlacedInSharedMemory);
+        m_getParent().registerMessageType(imageFragment);
+        m_getParent().registerMessageType(fragmentsRequested);
+        m_registerHandler(&ImagingComponent::m_handleFragmentsRequested, this,
+                          fragmentsRequested.getMessageType());
 #ifdef OSVR_COMMON_IN_PROCESS_IMAGING
         m_getParent().registerMessageType(imagePlacedInProcessMemory);
 #endif
     }
 
+    void ImagingComponent::m_requestFragments() {
+        if (m_fragmentsRequested) {
+            return;
+        }
+        m_fragmentsRequested = true;
+        Buffer<> buf;
+        m_getParent().packMessage(buf, fragmentsRequested.getMessageType());
+    }
+
+    void ImagingComponent::m_deliver(ImageData const &data,
+                                     util::time::TimeValue const &timestamp) {
+        if (!m_reassembler->markDelivered(data.sensor, timestamp)) {
+            return;
+        }
+
+        m_checkFirst(data.metadata);
+        for (auto const &cb : m_cb) {
+            cb(data, timestamp);
+        }
+    }
+
     void ImagingComponent::m_checkFirst(OSVR_ImagingMetadata const &metadata) {
         if (m_gotOne) {
             return;
@@ -27,6 +27,7 @@
 #include <osvr/Common/BaseDevice.h>
 #include <osvr/Common/Serialization.h>
 #include <osvr/Common/Buffer.h>
+#include <osvr/Common/FixedLayoutSerialization.h>
 #include <osvr/Util/Verbosity.h>
 
 // Library/third-party includes
@@ -47,6 +48,10 @@ namespace common {
 
             MessageSerialization() {}
 
+            typedef serialization::FixedLayout<OSVR_NaviVelocityState,
+                                               OSVR_ChannelCount>
+                fixed_layout;
+
             template <typename T> void processMessage(T &p) {
                 p(m_naviVelState);
                 p(m_sensor);
@@ -74,6 +79,10 @@ namespace common {
 
             MessageSerialization() {}
 
+            typedef serialization::FixedLayout<OSVR_NaviPositionState,
+                                               OSVR_ChannelCount>
+                fixed_layout;
+
             template <typename T> void processMessage(T &p) {
                 p(m_naviPosnState);
                 p(m_sensor);
@@ -108,10 +117,10 @@ namespace common {
         OSVR_NaviVelocityState naviVelocityState, OSVR_ChannelCount sensor,
         OSVR_TimeValue const &timestamp) {
 
-        Buffer<> buf;
-
         messages::NaviVelocityRecord::MessageSerialization msg(
             naviVelocityState, sensor);
+        FixedMessageBuffer<messages::NaviVelocityRecord::MessageSerialization>
+            buf;
 
         serialize(buf, msg);
         m_getParent().packMessage(buf, naviVelRecord.getMessageType(),
@@ -122,10 +131,10 @@ namespace common {
         OSVR_NaviPositionState naviPositionState, OSVR_ChannelCount sensor,
         OSVR_TimeValue const &timestamp) {
 
-        Buffer<> buf;
-
         messages::NaviPositionRecord::MessageSerialization msg(
             naviPositionState, sensor);
+        FixedMessageBuffer<messages::NaviPositionRecord::MessageSerialization>
+            buf;
         serialize(buf, msg);
 
         m_getParent().packMessage(buf, naviPosnRecord.getMessageType(),
@@ -136,11 +145,12 @@ namespace common {
     LocomotionComponent::m_handleNaviVelocityRecord(void *userdata,
                                                     vrpn_HANDLERPARAM p) {
         auto self = static_cast<LocomotionComponent *>(userdata);
-        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
-
-        messages::NaviVelocityRecord::MessageSerialization msg;
-        deserialize(bufReader, msg);
-        auto data = msg.getData();
+        auto view = viewFixedMessage<
+            messages::NaviVelocityRecord::MessageSerialization>(
+            p.buffer, p.payload_len);
+        NaviVelocityData data;
+        data.naviVelState = view.get<0>();
+        data.sensor = view.get<1>();
         auto timestamp = util::time::fromStructTimeval(p.msg_time);
 
         for (auto const &cb : self->m_cb_vel) {
@@ -153,11 +163,12 @@ namespace common {
     LocomotionComponent::m_handleNaviPositionRecord(void *userdata,
                                                     vrpn_HANDLERPARAM p) {
         auto self = static_cast<LocomotionComponent *>(userdata);
-        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
-
-        messages::NaviPositionRecord::MessageSerialization msg;
-        deserialize(bufReader, msg);
-        auto data = msg.getData();
+        auto view = viewFixedMessage<
+            messages::NaviPositionRecord::MessageSerialization>(
+            p.buffer, p.payload_len);
+        NaviPositionData data;
+        data.naviPosnState = view.get<0>();
+        data.sensor = view.get<1>();
         auto timestamp = util::time::fromStructTimeval(p.msg_time);
 
         for (auto const &cb : self->m_cb_posn) {
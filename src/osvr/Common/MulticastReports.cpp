@@ -0,0 +1,517 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/MulticastReports.h>
+#include <osvr/Common/Buffer.h>
+#include <osvr/Common/FixedLayoutSerialization.h>
+#include <osvr/Common/NetworkingSupport.h>
+#include <osvr/Common/Serialization.h>
+#include <osvr/Util/Logger.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <random>
+#include <stdexcept>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace osvr {
+namespace common {
+    const uint32_t MulticastReportPacket::MAGIC;
+    const uint32_t MulticastReportPacket::VERSION;
+    const char MulticastReportPublisher::DEFAULT_GROUP[] = "239.255.0.83";
+    const uint16_t MulticastReportPublisher::DEFAULT_PORT;
+    const std::size_t MulticastReportReceiver::MAX_QUEUED;
+
+    /// Grab a logger for multicast report verbosity and errors.
+    static util::log::Logger &getMulticastLogger() {
+        static util::log::LoggerPtr logger =
+            util::log::make_logger("MulticastReports");
+        return *logger;
+    }
+
+    namespace {
+#ifdef _WIN32
+        typedef SOCKET NativeSocket;
+        static const NativeSocket INVALID_NATIVE_SOCKET = INVALID_SOCKET;
+        inline void closeNativeSocket(NativeSocket s) { closesocket(s); }
+        inline int lastSocketError() { return WSAGetLastError(); }
+        inline bool setNonBlocking(NativeSocket s) {
+            u_long nonBlocking = 1;
+            return ioctlsocket(s, FIONBIO, &nonBlocking) == 0;
+        }
+#else
+        typedef int NativeSocket;
+        static const NativeSocket INVALID_NATIVE_SOCKET = -1;
+        inline void closeNativeSocket(NativeSocket s) { ::close(s); }
+        inline int lastSocketError() { return errno; }
+        inline bool setNonBlocking(NativeSocket s) {
+            auto flags = fcntl(s, F_GETFL, 0);
+            return flags != -1 && fcntl(s, F_SETFL, flags | O_NONBLOCK) == 0;
+        }
+#endif
+
+        /// @brief Parses a dotted-quad IPv4 address, returning false if it
+        /// isn't one.
+        inline bool parseAddress(std::string const &str, in_addr &addr) {
+            return inet_pton(AF_INET, str.c_str(), &addr) == 1;
+        }
+
+        /// @brief Owns a non-blocking UDP socket.
+        class UdpSocket : boost::noncopyable {
+          public:
+            UdpSocket() : m_socket(INVALID_NATIVE_SOCKET) {
+                if (!m_net.isUp()) {
+                    m_fail("Networking unavailable: " + m_net.getError());
+                }
+                m_socket = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+                if (m_socket == INVALID_NATIVE_SOCKET) {
+                    m_fail("Could not create socket");
+                }
+                if (!setNonBlocking(m_socket)) {
+                    m_fail("Could not make socket non-blocking");
+                }
+            }
+            ~UdpSocket() {
+                if (m_socket != INVALID_NATIVE_SOCKET) {
+                    closeNativeSocket(m_socket);
+                }
+            }
+
+            template <typename T>
+            void setOption(int level, int name, T const &val,
+                           const char *what) {
+                if (::setsockopt(m_socket, level, name,
+                                 reinterpret_cast<const char *>(&val),
+                                 sizeof(val)) != 0) {
+                    m_fail(std::string("Could not set ") + what);
+                }
+            }
+
+            NativeSocket get() const { return m_socket; }
+
+          private:
+            void m_fail(std::string const &msg) {
+                auto err = lastSocketError();
+                if (m_socket != INVALID_NATIVE_SOCKET) {
+                    closeNativeSocket(m_socket);
+                    m_socket = INVALID_NATIVE_SOCKET;
+                }
+                throw std::runtime_error(msg + " (error " +
+                                         std::to_string(err) + ")");
+            }
+            NetworkingSupport m_net;
+            NativeSocket m_socket;
+        };
+
+        inline uint64_t makeSenderId() {
+            std::random_device rd;
+            std::mt19937_64 gen(
+                (uint64_t(rd()) << 32) ^ rd() ^
+                static_cast<uint64_t>(
+                    std::chrono::high_resolution_clock::now()
+                        .time_since_epoch()
+                        .count()));
+            uint64_t ret = 0;
+            /// Zero means "none" in a default-constructed directory.
+            while (ret == 0) {
+                ret = gen();
+            }
+            return ret;
+        }
+    } // namespace
+
+    class MulticastReportPublisher::Sender {
+      public:
+        Sender(std::string const &group, uint16_t port, int ttl,
+               std::string const &iface)
+            : m_id(makeSenderId()) {
+            std::memset(&m_dest, 0, sizeof(m_dest));
+            m_dest.sin_family = AF_INET;
+            m_dest.sin_port = htons(port);
+            if (!parseAddress(group, m_dest.sin_addr) ||
+                !IN_MULTICAST(ntohl(m_dest.sin_addr.s_addr))) {
+                throw std::runtime_error("Not a multicast group address: " +
+                                         group);
+            }
+            m_socket.setOption(IPPROTO_IP, IP_MULTICAST_TTL,
+                               static_cast<unsigned char>(ttl),
+                               "multicast TTL");
+            /// So clients on this machine (or tests) can receive too.
+            m_socket.setOption(IPPROTO_IP, IP_MULTICAST_LOOP,
+                               static_cast<unsigned char>(1),
+                               "multicast loopback");
+            if (!iface.empty()) {
+                in_addr ifaceAddr;
+                if (!parseAddress(iface, ifaceAddr)) {
+                    throw std::runtime_error("Not an interface address: " +
+                                             iface);
+                }
+                m_socket.setOption(IPPROTO_IP, IP_MULTICAST_IF, ifaceAddr,
+                                   "multicast interface");
+            }
+        }
+
+        uint64_t getId() const { return m_id; }
+
+        void send(uint32_t stream, uint32_t sequence,
+                  SharedMemoryReport const &report) {
+            MulticastReportPacket packet;
+            packet.sender = m_id;
+            packet.stream = stream;
+            packet.sequence = sequence;
+            packet.report = report;
+            FixedMessageBuffer<MulticastReportPacket> buf;
+            serialize(buf, packet);
+            auto sent = ::sendto(
+                m_socket.get(), reinterpret_cast<const char *>(buf.data()),
+                static_cast<int>(buf.size()), 0,
+                reinterpret_cast<sockaddr const *>(&m_dest), sizeof(m_dest));
+            if (sent != static_cast<decltype(sent)>(buf.size())) {
+                /// Like any other UDP loss, as far as receivers can tell.
+                m_failures.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        uint64_t getFailures() const {
+            return m_failures.load(std::memory_order_relaxed);
+        }
+
+      private:
+        UdpSocket m_socket;
+        sockaddr_in m_dest;
+        const uint64_t m_id;
+        std::atomic<uint64_t> m_failures{0};
+    };
+
+    MulticastReportPublisherPtr
+    MulticastReportPublisher::create(std::string const &group, uint16_t port,
+                                     int ttl, std::string const &iface) {
+        auto sender = make_shared<Sender>(group, port, ttl, iface);
+        MulticastReportPublisherPtr ret(new MulticastReportPublisher(sender));
+        ret->m_directory.group = group;
+        ret->m_directory.port = port;
+        return ret;
+    }
+
+    MulticastReportPublisher::MulticastReportPublisher(
+        shared_ptr<Sender> const &sender)
+        : m_sender(sender) {
+        m_directory.sender = m_sender->getId();
+    }
+
+    MulticastReportPublisher::~MulticastReportPublisher() {}
+
+    MulticastReportStreamPtr
+    MulticastReportPublisher::getStream(std::string const &deviceName) {
+        auto it = m_streams.find(deviceName);
+        if (it != end(m_streams)) {
+            return it->second;
+        }
+        auto id = static_cast<uint32_t>(m_streams.size());
+        auto stream = make_shared<MulticastReportStream>(m_sender, id);
+        m_streams[deviceName] = stream;
+        m_directory.streams[deviceName] = id;
+        return stream;
+    }
+
+    uint64_t MulticastReportPublisher::getSendFailures() const {
+        return m_sender->getFailures();
+    }
+
+    MulticastReportStream::MulticastReportStream(
+        shared_ptr<MulticastReportPublisher::Sender> const &sender,
+        uint32_t id)
+        : m_sender(sender), m_id(id) {}
+
+    void MulticastReportStream::send(SharedMemoryReport const &report) {
+        ++m_sequence;
+        m_sender->send(m_id, m_sequence, report);
+    }
+
+    class MulticastReportReceiver::Socket {
+      public:
+        Socket(MulticastReportDirectory const &directory,
+               std::string const &iface) {
+            ip_mreq membership;
+            std::memset(&membership, 0, sizeof(membership));
+            if (!parseAddress(directory.group, membership.imr_multiaddr)) {
+                throw std::runtime_error("Not a group address: " +
+                                         directory.group);
+            }
+            membership.imr_interface.s_addr = htonl(INADDR_ANY);
+            if (!iface.empty() &&
+                !parseAddress(iface, membership.imr_interface)) {
+                throw std::runtime_error("Not an interface address: " +
+                                         iface);
+            }
+
+            /// Any number of clients on a machine share the port.
+            m_socket.setOption(SOL_SOCKET, SO_REUSEADDR, int(1),
+                               "address reuse");
+#if defined(SO_REUSEPORT) && !defined(__linux__)
+            m_socket.setOption(SOL_SOCKET, SO_REUSEPORT, int(1),
+                               "port reuse");
+#endif
+            /// Room for bursts between client updates; best-effort.
+            int rcvbuf = 1 << 20;
+            ::setsockopt(m_socket.get(), SOL_SOCKET, SO_RCVBUF,
+                         reinterpret_cast<const char *>(&rcvbuf),
+                         sizeof(rcvbuf));
+
+            sockaddr_in addr;
+            std::memset(&addr, 0, sizeof(addr));
+            addr.sin_family = AF_INET;
+            addr.sin_port = htons(directory.port);
+            addr.sin_addr.s_addr = htonl(INADDR_ANY);
+            if (::bind(m_socket.get(), reinterpret_cast<sockaddr *>(&addr),
+                       sizeof(addr)) != 0) {
+                throw std::runtime_error(
+                    "Could not bind to port " + std::to_string(directory.port) +
+                    " (error " + std::to_string(lastSocketError()) + ")");
+            }
+            m_socket.setOption(IPPROTO_IP, IP_ADD_MEMBERSHIP, membership,
+                               "group membership");
+        }
+
+        /// @brief Receives a datagram, if one is waiting.
+        ///
+        /// @return The length, or a negative value if there was nothing to
+        /// receive (or an error, which is no different as far as the caller
+        /// is concerned: the reports will be missed either way).
+        int receive(char *buf, std::size_t len) {
+            auto ret = ::recvfrom(m_socket.get(), buf, static_cast<int>(len),
+                                  0, nullptr, nullptr);
+            return static_cast<int>(ret);
+        }
+
+      private:
+        UdpSocket m_socket;
+    };
+
+    /// @brief A subscriber's queue of reports from one stream.
+    class MulticastReportReceiver::Subscription : public ReportSource {
+      public:
+        Subscription(MulticastReportReceiverPtr const &receiver,
+                     uint32_t stream)
+            : m_receiver(receiver), m_stream(stream) {}
+
+        ~Subscription() { m_receiver->m_remove(this); }
+
+        bool read(SharedMemoryReport &report) override {
+            if (m_queue.empty()) {
+                m_receiver->poll();
+            }
+            if (m_queue.empty()) {
+                return false;
+            }
+            report = m_queue.front();
+            m_queue.pop_front();
+            return true;
+        }
+
+        /// Sent once for everyone, whether anyone's interested or not.
+        bool requiresInterest() const override { return false; }
+
+        uint32_t getStream() const { return m_stream; }
+
+        /// @brief Queues a report, returning false if the oldest had to be
+        /// discarded to make room.
+        bool push(SharedMemoryReport const &report) {
+            bool ret = true;
+            if (m_queue.size() >= MAX_QUEUED) {
+                m_queue.pop_front();
+                ret = false;
+            }
+            m_queue.push_back(report);
+            return ret;
+        }
+
+      private:
+        MulticastReportReceiverPtr m_receiver;
+        uint32_t m_stream;
+        std::deque<SharedMemoryReport> m_queue;
+    };
+
+    MulticastReportReceiverPtr
+    MulticastReportReceiver::create(MulticastReportDirectory const &directory,
+                                    std::string const &iface) {
+        MulticastReportReceiverPtr ret;
+        unique_ptr<Socket> socket;
+        try {
+            socket.reset(new Socket(directory, iface));
+        } catch (std::exception &e) {
+            getMulticastLogger().warn()
+                << "Could not join multicast report group " << directory.group
+                << ":" << directory.port << ": " << e.what();
+            return ret;
+        }
+        ret.reset(new MulticastReportReceiver(directory, std::move(socket)));
+        return ret;
+    }
+
+    MulticastReportReceiver::MulticastReportReceiver(
+        MulticastReportDirectory const &directory, unique_ptr<Socket> &&socket)
+        : m_directory(directory), m_socket(std::move(socket)) {}
+
+    MulticastReportReceiver::~MulticastReportReceiver() {}
+
+    ReportSourcePtr
+    MulticastReportReceiver::subscribe(std::string const &deviceName) {
+        ReportSourcePtr ret;
+        auto it = m_directory.streams.find(deviceName);
+        if (it == end(m_directory.streams)) {
+            return ret;
+        }
+        unique_ptr<Subscription> subscription(
+            new Subscription(shared_from_this(), it->second));
+        m_streams[it->second].subscriptions.push_back(subscription.get());
+        ret = std::move(subscription);
+        return ret;
+    }
+
+    bool MulticastReportReceiver::updateDirectory(
+        MulticastReportDirectory const &directory) {
+        if (directory.group != m_directory.group ||
+            directory.port != m_directory.port ||
+            directory.sender != m_directory.sender) {
+            return false;
+        }
+        m_directory.streams = directory.streams;
+        return true;
+    }
+
+    void MulticastReportReceiver::poll() {
+        /// Comfortably bigger than a packet, so anything bigger is noticed.
+        char buf[2 * FixedMessageSize<MulticastReportPacket>::value];
+        int len;
+        while ((len = m_socket->receive(buf, sizeof(buf))) >= 0) {
+            handleDatagram(buf, static_cast<std::size_t>(len));
+        }
+    }
+
+    void MulticastReportReceiver::handleDatagram(void const *data,
+                                                 std::size_t len) {
+        auto bytes = static_cast<BufferElement const *>(data);
+        MulticastReportPacket packet;
+        if (len != FixedMessageSize<MulticastReportPacket>::value) {
+            ++m_ignored;
+            return;
+        }
+        try {
+            auto reader = readExternalBuffer(bytes, len);
+            deserialize(reader, packet);
+        } catch (std::exception &) {
+            ++m_ignored;
+            return;
+        }
+        if (packet.magic != MulticastReportPacket::MAGIC ||
+            packet.version != MulticastReportPacket::VERSION ||
+            packet.sender != m_directory.sender) {
+            ++m_ignored;
+            return;
+        }
+        auto it = m_streams.find(packet.stream);
+        if (it == end(m_streams)) {
+            /// Nobody subscribed to this stream (yet): no point tracking
+            /// gaps.
+            return;
+        }
+        auto &stream = it->second;
+        if (stream.started) {
+            /// Modular difference, so wrap-around is handled.
+            auto ahead = static_cast<int32_t>(packet.sequence - stream.next);
+            if (ahead < 0) {
+                ++stream.stats.late;
+                return;
+            }
+            stream.stats.lost += static_cast<uint32_t>(ahead);
+        }
+        stream.started = true;
+        stream.next = packet.sequence + 1;
+        ++stream.stats.received;
+        for (auto subscription : stream.subscriptions) {
+            if (!subscription->push(packet.report)) {
+                ++stream.stats.overflowed;
+            }
+        }
+    }
+
+    MulticastReportStats MulticastReportReceiver::getStats() const {
+        MulticastReportStats ret;
+        for (auto const &stream : m_streams) {
+            auto const &stats = stream.second.stats;
+            ret.received += stats.received;
+            ret.lost += stats.lost;
+            ret.late += stats.late;
+            ret.overflowed += stats.overflowed;
+        }
+        return ret;
+    }
+
+    MulticastReportStats
+    MulticastReportReceiver::getStats(std::string const &deviceName) const {
+        MulticastReportStats ret;
+        auto id = m_directory.streams.find(deviceName);
+        if (id == end(m_directory.streams)) {
+            return ret;
+        }
+        auto it = m_streams.find(id->second);
+        if (it != end(m_streams)) {
+            ret = it->second.stats;
+        }
+        return ret;
+    }
+
+    void MulticastReportReceiver::m_remove(Subscription *subscription) {
+        auto it = m_streams.find(subscription->getStream());
+        if (it == end(m_streams)) {
+            return;
+        }
+        auto &subscriptions = it->second.subscriptions;
+        subscriptions.erase(std::remove(begin(subscriptions),
+                                        end(subscriptions), subscription),
+                            end(subscriptions));
+    }
+} // namespace common
+} // namespace osvr
@@ -70,6 +70,17 @@ namespace common {
         m_transform.nest(transform);
     }
 
+    void OriginalSource::nestResolvedSource(OriginalSource const &inner) {
+        BOOST_ASSERT_MSG(inner.isResolved(),
+                         "Can only nest a resolved source.");
+        m_transform.nest(inner.m_transform);
+        setDevice(*inner.m_device);
+        setInterface(*inner.m_interface);
+        if (inner.m_sensor) {
+            setSensor(*inner.m_sensor);
+        }
+    }
+
     std::string OriginalSource::getDevicePath() const {
         BOOST_ASSERT_MSG(isResolved(),
                          "Only makes sense when called on a resolved source.");
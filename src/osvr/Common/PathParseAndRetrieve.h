@@ -32,9 +32,6 @@
 
 // Library/third-party includes
 #include <boost/assert.hpp>
-#include <boost/algorithm/string/find_iterator.hpp>
-#include <boost/algorithm/string/finder.hpp>
-#include <boost/range/adaptor/sliced.hpp>
 
 // Standard includes
 #include <string>
@@ -61,7 +58,7 @@ namespace common {
 
         template <typename GetChildFunctor, typename Node>
         inline Node &treePathRetrieveImplementation(
-            GetChildFunctor f, Node &node, std::string path,
+            GetChildFunctor f, Node &node, std::string const &path,
             ParentPolicy permitParent = GETPARENT_DENY,
             AbsolutePolicy permitAbsolute = ABSOLUTEPATH_PERMIT) {
 
@@ -70,8 +67,13 @@ namespace common {
             }
             Node *ret = &node;
 
+            // Work on the [pos, stop) range of the path, rather than copying
+            // and trimming it.
+            std::string::size_type pos = 0;
+            std::string::size_type stop = path.size();
+
             // Check for leading slash, indicating absolute path
-            if (path.at(0) == getPathSeparatorCharacter()) {
+            if (path[0] == getPathSeparatorCharacter()) {
                 if (ABSOLUTEPATH_PERMIT != permitAbsolute) {
                     throw exceptions::ForbiddenAbsolutePath();
                 }
@@ -83,60 +85,53 @@ namespace common {
                     // Literally just asking for the root.
                     return *ret;
                 }
-                // Remove the leading slash for the iterator's benefit.
-                path.erase(begin(path));
+                // Skip the leading slash.
+                ++pos;
             }
 
-            // Remove any trailing slash
-            if (path.back() == getPathSeparatorCharacter()) {
-                path.pop_back();
+            // Ignore any trailing slash
+            if (path[stop - 1] == getPathSeparatorCharacter()) {
+                --stop;
             }
 
-            // new scope for the iterators and loop:
-            {
-                // Create a boost string algorithm "split iterator" to iterate
-                // through components of the path.
-                auto begin = boost::algorithm::make_split_iterator(
-                    path,
-                    boost::first_finder(getPathSeparator(), boost::is_equal()));
-                // Create the corresponding end iterator: same type as begin,
-                // but default constructed.
-                auto end = decltype(begin)();
-
-                // Temporary string that will be re-used each pass through the
-                // loop
-                std::string component;
-
-                // Use the iterators as a range in a loop, to process each
-                // component of the path
-                for (auto rangeIt : boost::make_iterator_range(begin, end)) {
-                    // Extract the component to a string for interpretation.
-                    component = boost::copy_range<std::string>(rangeIt);
-
-                    // Interpret the component: four cases
-                    if (component.empty()) {
-                        // Empty components are forbidden
-                        throw exceptions::EmptyPathComponent(path);
-                    } else if (component == ".") {
-                        // current location - go to the next component without
-                        // changing location
-                        continue;
-                    } else if (component == "..") {
-                        // parent path - must check for permission first, then
-                        // possibility (root has no parent)
-                        if (GETPARENT_PERMIT != permitParent) {
-                            throw exceptions::ForbiddenParentPath();
-                        }
-                        if (ret->isRoot()) {
-                            throw exceptions::ImpossibleParentPath();
-                        }
-                        ret = ret->getParent();
-                    } else {
-                        // A non-special string: just get the child
-                        ret = f(ret, component);
+            // Temporary string that will be re-used each pass through the
+            // loop
+            std::string component;
+
+            // Process each component of the path: each is followed by a
+            // separator, or by the end of the range.
+            while (pos <= stop) {
+                auto separator = path.find(getPathSeparatorCharacter(), pos);
+                if (separator == std::string::npos || separator > stop) {
+                    separator = stop;
+                }
+                // Extract the component to a string for interpretation.
+                component.assign(path, pos, separator - pos);
+                pos = separator + 1;
+
+                // Interpret the component: four cases
+                if (component.empty()) {
+                    // Empty components are forbidden
+                    throw exceptions::EmptyPathComponent(path);
+                } else if (component == ".") {
+                    // current location - go to the next component without
+                    // changing location
+                    continue;
+                } else if (component == "..") {
+                    // parent path - must check for permission first, then
+                    // possibility (root has no parent)
+                    if (GETPARENT_PERMIT != permitParent) {
+                        throw exceptions::ForbiddenParentPath();
                     }
-                    // if we make it to here we've updated ret.
+                    if (ret->isRoot()) {
+                        throw exceptions::ImpossibleParentPath();
+                    }
+                    ret = ret->getParent();
+                } else {
+                    // A non-special string: just get the child
+                    ret = f(ret, component);
                 }
+                // if we make it to here we've updated ret.
             }
 
             return *ret;
@@ -163,7 +158,7 @@ namespace common {
     /// exceptions::ForbiddenParentPath, exceptions::ImpossibleParentPath
     template <typename ValueType>
     inline util::TreeNode<ValueType> &
-    treePathRetrieve(util::TreeNode<ValueType> &node, std::string path,
+    treePathRetrieve(util::TreeNode<ValueType> &node, std::string const &path,
                      bool permitParent = false) {
         return detail::treePathRetrieveImplementation(
             detail::GetOrCreateFunctor(), node, path,
@@ -176,8 +171,8 @@ namespace common {
     /// children: instead it throws util::tree::NoSuchChild.
     template <typename ValueType>
     inline util::TreeNode<ValueType> const &
-    treePathRetrieve(util::TreeNode<ValueType> const &node, std::string path,
-                     bool permitParent = false) {
+    treePathRetrieve(util::TreeNode<ValueType> const &node,
+                     std::string const &path, bool permitParent = false) {
         return detail::treePathRetrieveImplementation(
             detail::GetChildFunctor(), node, path,
             permitParent ? detail::GETPARENT_PERMIT : detail::GETPARENT_DENY);
@@ -40,11 +40,18 @@
 #include <boost/variant/get.hpp>
 
 // Standard includes
-// - none
+#include <atomic>
 
 namespace osvr {
 namespace common {
-    PathTree::PathTree() : m_root(PathNode::createRoot()) {}
+    /// @brief Source of PathTree versions, unique across all trees.
+    static uint64_t getNextPathTreeVersion() {
+        static std::atomic<uint64_t> nextVersion(0);
+        return ++nextVersion;
+    }
+
+    PathTree::PathTree()
+        : m_root(PathNode::createRoot()), m_version(getNextPathTreeVersion()) {}
     PathNode &PathTree::getNodeByPath(std::string const &path) {
         return pathParseAndRetrieve(*m_root, path);
     }
@@ -63,7 +70,10 @@ namespace common {
                                     path);
     }
 
-    void PathTree::reset() { m_root = PathNode::createRoot(); }
+    void PathTree::reset() {
+        m_root = PathNode::createRoot();
+        m_version = getNextPathTreeVersion();
+    }
 
     /// @brief Determine if the node needs updating given that we want to add an
     /// alias there pointing to source with the given automatic status.
@@ -71,15 +71,17 @@ namespace common {
 
     // Forward declaration
     void resolveTreeNodeImpl(PathTree &pathTree, std::string const &path,
-                             OriginalSource &source);
+                             OriginalSource &source,
+                             PathResolutionCache *cache);
 
     class TreeResolutionVisitor : public boost::static_visitor<>,
                                   boost::noncopyable {
       public:
         TreeResolutionVisitor(common::PathTree &tree, common::PathNode &node,
-                              common::OriginalSource &source)
+                              common::OriginalSource &source,
+                              PathResolutionCache *cache)
             : boost::static_visitor<>(), m_tree(tree), m_node(node),
-              m_source(source) {}
+              m_source(source), m_cache(cache) {}
 
         /// @brief Fallback case
         template <typename T> void operator()(T const &) {
@@ -125,35 +127,63 @@ namespace common {
       private:
         void m_decompose() { m_source.decompose(m_node); }
         void m_recurse(std::string const &path) {
-            resolveTreeNodeImpl(m_tree, path, m_source);
+            if (!m_cache) {
+                resolveTreeNodeImpl(m_tree, path, m_source, nullptr);
+                return;
+            }
+            /// Resolve the alias target on its own, so the result can be
+            /// reused by anything else aliasing it, then nest it into ours.
+            auto target = resolveTreeNode(m_tree, path, *m_cache);
+            if (target) {
+                m_source.nestResolvedSource(*target);
+            }
         }
         PathTree &m_getPathTree() { return m_tree; }
 
         PathTree &m_tree;
         PathNode &m_node;
         OriginalSource &m_source;
+        PathResolutionCache *m_cache;
     };
 
     inline void resolveTreeNodeImpl(PathTree &pathTree, std::string const &path,
-                                    OriginalSource &source) {
+                                    OriginalSource &source,
+                                    PathResolutionCache *cache) {
         auto &node = pathTree.getNodeByPath(path);
 
         // First do any inference possible here.
         ifNullTryInferFromParent(node);
 
         // Now visit.
-        TreeResolutionVisitor visitor(pathTree, node, source);
+        TreeResolutionVisitor visitor(pathTree, node, source, cache);
         boost::apply_visitor(visitor, node.value());
     }
 
     boost::optional<OriginalSource> resolveTreeNode(PathTree &pathTree,
                                                     std::string const &path) {
         OriginalSource source;
-        resolveTreeNodeImpl(pathTree, path, source);
+        resolveTreeNodeImpl(pathTree, path, source, nullptr);
         if (source.isResolved()) {
             return source;
         }
         return boost::optional<OriginalSource>();
     }
+
+    boost::optional<OriginalSource>
+    resolveTreeNode(PathTree &pathTree, std::string const &path,
+                    PathResolutionCache &cache) {
+        auto cached = cache.find(pathTree, path);
+        if (cached) {
+            return *cached;
+        }
+        OriginalSource source;
+        resolveTreeNodeImpl(pathTree, path, source, &cache);
+        boost::optional<OriginalSource> ret;
+        if (source.isResolved()) {
+            ret = source;
+        }
+        cache.insert(pathTree, path, ret);
+        return ret;
+    }
 } // namespace common
 } // namespace osvr
\ No newline at end of file
@@ -0,0 +1,70 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/SharedMemoryReportPublisher.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <chrono>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+namespace osvr {
+namespace common {
+    SharedMemoryReportPublisher::SharedMemoryReportPublisher() {
+        std::random_device rd;
+        std::mt19937_64 gen(
+            (uint64_t(rd()) << 32) ^ rd() ^
+            static_cast<uint64_t>(
+                std::chrono::high_resolution_clock::now()
+                    .time_since_epoch()
+                    .count()));
+        std::ostringstream os;
+        os << "OSVRReports_" << std::hex << std::setfill('0') << std::setw(16)
+           << gen() << "_";
+        m_prefix = os.str();
+    }
+
+    SharedMemoryReportRingPtr
+    SharedMemoryReportPublisher::getRing(std::string const &deviceName) {
+        auto it = m_rings.find(deviceName);
+        if (it != end(m_rings)) {
+            return it->second;
+        }
+        /// Device names aren't safe to use in shared memory names, so just
+        /// number the rings.
+        auto ringName = m_prefix + std::to_string(m_rings.size());
+        auto ring = SharedMemoryReportRing::create(ringName);
+        m_rings[deviceName] = ring;
+        if (ring) {
+            m_directory[deviceName] = ringName;
+        }
+        return ring;
+    }
+} // namespace common
+} // namespace osvr
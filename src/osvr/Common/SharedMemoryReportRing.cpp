@@ -0,0 +1,255 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/SharedMemoryReportRing.h>
+#include <osvr/Util/Logger.h>
+
+// Library/third-party includes
+#include <boost/assert.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#if defined(BOOST_INTERPROCESS_WINDOWS)
+#include <boost/interprocess/windows_shared_memory.hpp>
+#else
+#include <boost/interprocess/shared_memory_object.hpp>
+#endif
+
+// Standard includes
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <new>
+
+namespace osvr {
+namespace common {
+    namespace bip = boost::interprocess;
+
+    /// Grab a logger for report ring verbosity and errors.
+    static util::log::Logger &getReportRingLogger() {
+        static util::log::LoggerPtr logger =
+            util::log::make_logger("SharedMemoryReportRing");
+        return *logger;
+    }
+
+#if defined(BOOST_INTERPROCESS_WINDOWS)
+    /// Destroyed by the OS once the last handle is closed, so a crashed
+    /// server doesn't leave anything behind.
+    typedef bip::windows_shared_memory ShmDevice;
+#else
+    typedef bip::shared_memory_object ShmDevice;
+#endif
+
+    static const uint32_t RING_MAGIC = 0x4f535652; // "OSVR"
+    /// @brief Bump whenever the layout of the segment changes.
+    static const uint32_t RING_VERSION = 1;
+
+    static_assert(sizeof(SharedMemoryReport) == 88 &&
+                      offsetof(SharedMemoryReport, seconds) == 8 &&
+                      offsetof(SharedMemoryReport, data) == 24,
+                  "Report records must have the same layout in 32 and "
+                  "64-bit processes!");
+
+    ReportSource::~ReportSource() {}
+
+    struct SharedMemoryReportRing::RingHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t capacity;
+        uint32_t slotSize;
+        std::atomic<uint64_t> writeCount;
+    };
+
+    struct SharedMemoryReportRing::Slot {
+        /// @brief 2n + 1 while record n is being written, 2n + 2 once it is
+        /// complete.
+        std::atomic<uint64_t> sequence;
+        SharedMemoryReport report;
+    };
+
+    /// @brief Slots start on their own cache line, away from the write count.
+    static const std::size_t SLOTS_OFFSET = 64;
+
+    struct SharedMemoryReportRing::Impl {
+        ShmDevice device;
+        bip::mapped_region region;
+    };
+
+    static inline std::size_t getSegmentSize(std::size_t capacity,
+                                             std::size_t slotSize) {
+        return SLOTS_OFFSET + capacity * slotSize;
+    }
+
+    SharedMemoryReportRingPtr
+    SharedMemoryReportRing::create(std::string const &name,
+                                   uint32_t capacity) {
+        static_assert(sizeof(RingHeader) <= SLOTS_OFFSET,
+                      "Ring header must fit before the slots!");
+        SharedMemoryReportRingPtr ret;
+        capacity = (std::max)(capacity, uint32_t(1));
+        auto bytes = getSegmentSize(capacity, sizeof(Slot));
+        unique_ptr<Impl> impl(new Impl);
+        try {
+#if defined(BOOST_INTERPROCESS_WINDOWS)
+            ShmDevice device(bip::create_only, name.c_str(), bip::read_write,
+                             bytes);
+#else
+            ShmDevice::remove(name.c_str());
+            ShmDevice device(bip::create_only, name.c_str(), bip::read_write);
+            device.truncate(static_cast<bip::offset_t>(bytes));
+#endif
+            bip::mapped_region region(device, bip::read_write, 0, bytes);
+            impl->device.swap(device);
+            impl->region.swap(region);
+        } catch (bip::interprocess_exception &e) {
+            getReportRingLogger().error() << "Could not create report ring "
+                                          << name << ": " << e.what();
+            return ret;
+        }
+
+        auto header = new (impl->region.get_address()) RingHeader;
+        header->version = RING_VERSION;
+        header->capacity = capacity;
+        header->slotSize = sizeof(Slot);
+        header->writeCount.store(0, std::memory_order_relaxed);
+        auto slots = reinterpret_cast<Slot *>(
+            static_cast<char *>(impl->region.get_address()) + SLOTS_OFFSET);
+        for (uint32_t i = 0; i < capacity; ++i) {
+            new (&slots[i].sequence) std::atomic<uint64_t>(0);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        header->magic = RING_MAGIC;
+
+        getReportRingLogger().debug() << "Created report ring " << name
+                                      << " with " << capacity << " slots";
+        ret.reset(new SharedMemoryReportRing(name, std::move(impl), true));
+        return ret;
+    }
+
+    SharedMemoryReportRingPtr
+    SharedMemoryReportRing::open(std::string const &name) {
+        SharedMemoryReportRingPtr ret;
+        unique_ptr<Impl> impl(new Impl);
+        try {
+            /// Read-write even though we only read: on some platforms, a
+            /// 64-bit atomic load is done with an instruction that writes.
+            ShmDevice device(bip::open_only, name.c_str(), bip::read_write);
+            bip::mapped_region region(device, bip::read_write);
+            impl->device.swap(device);
+            impl->region.swap(region);
+        } catch (bip::interprocess_exception &e) {
+            getReportRingLogger().debug() << "Could not open report ring "
+                                          << name << ": " << e.what();
+            return ret;
+        }
+
+        auto size = impl->region.get_size();
+        auto header = static_cast<RingHeader *>(impl->region.get_address());
+        if (size < SLOTS_OFFSET || header->magic != RING_MAGIC ||
+            header->version != RING_VERSION ||
+            header->slotSize != sizeof(Slot) || header->capacity == 0 ||
+            size < getSegmentSize(header->capacity, sizeof(Slot))) {
+            getReportRingLogger().warn()
+                << "Report ring " << name
+                << " is not in a format we understand, ignoring it";
+            return ret;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        ret.reset(new SharedMemoryReportRing(name, std::move(impl), false));
+        return ret;
+    }
+
+    SharedMemoryReportRing::SharedMemoryReportRing(std::string const &name,
+                                                   unique_ptr<Impl> &&impl,
+                                                   bool owner)
+        : m_name(name), m_impl(std::move(impl)), m_owner(owner),
+          m_header(static_cast<RingHeader *>(m_impl->region.get_address())),
+          m_slots(reinterpret_cast<Slot *>(
+              static_cast<char *>(m_impl->region.get_address()) +
+              SLOTS_OFFSET)) {}
+
+    SharedMemoryReportRing::~SharedMemoryReportRing() {
+#if !defined(BOOST_INTERPROCESS_WINDOWS)
+        if (m_owner) {
+            /// Only removes the name: existing mappings stay valid.
+            ShmDevice::remove(m_name.c_str());
+        }
+#endif
+    }
+
+    uint32_t SharedMemoryReportRing::getCapacity() const {
+        return m_header->capacity;
+    }
+
+    uint64_t SharedMemoryReportRing::getWriteCount() const {
+        return m_header->writeCount.load(std::memory_order_acquire);
+    }
+
+    void SharedMemoryReportRing::put(SharedMemoryReport const &report) {
+        BOOST_ASSERT_MSG(m_owner, "Only the creator of a ring may write it!");
+        auto index = m_header->writeCount.load(std::memory_order_relaxed);
+        auto &slot = m_slots[index % m_header->capacity];
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.report = report;
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+        m_header->writeCount.store(index + 1, std::memory_order_release);
+    }
+
+    SharedMemoryReportRing::Reader::Reader(
+        SharedMemoryReportRingPtr const &ring)
+        : m_ring(ring), m_next(ring->getWriteCount()) {}
+
+    bool SharedMemoryReportRing::Reader::read(SharedMemoryReport &report) {
+        auto &ring = *m_ring;
+        uint64_t capacity = ring.m_header->capacity;
+        auto written = ring.getWriteCount();
+        while (m_next < written) {
+            if (written - m_next > capacity) {
+                /// Lapped: skip to the oldest record still there.
+                m_dropped += written - capacity - m_next;
+                m_next = written - capacity;
+            }
+            auto &slot = ring.m_slots[m_next % capacity];
+            auto expected = 2 * m_next + 2;
+            if (slot.sequence.load(std::memory_order_acquire) == expected) {
+                report = slot.report;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) ==
+                    expected) {
+                    ++m_next;
+                    return true;
+                }
+            }
+            /// The writer got to this slot again before (or while) we read
+            /// it.
+            ++m_dropped;
+            ++m_next;
+            written = ring.getWriteCount();
+        }
+        return false;
+    }
+} // namespace common
+} // namespace osvr
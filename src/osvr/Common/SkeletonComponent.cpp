@@ -26,6 +26,7 @@
 #include <osvr/Common/BaseDevice.h>
 #include <osvr/Common/Buffer.h>
 #include <osvr/Common/CommonComponent.h>
+#include <osvr/Common/FixedLayoutSerialization.h>
 #include <osvr/Common/JSONSerializationTags.h>
 #include <osvr/Common/Serialization.h>
 #include <osvr/Common/SkeletonComponent.h>
@@ -48,6 +49,8 @@ namespace common {
 
             MessageSerialization() {}
 
+            typedef serialization::FixedLayout<OSVR_ChannelCount> fixed_layout;
+
             template <typename T> void processMessage(T &p) {
                 p(m_notification.sensor);
             }
@@ -109,10 +112,10 @@ namespace common {
     void SkeletonComponent::sendNotification(OSVR_ChannelCount sensor,
                                              OSVR_TimeValue const &timestamp) {
 
-        Buffer<> buf;
         SkeletonNotification notification;
         notification.sensor = sensor;
         messages::SkeletonRecord::MessageSerialization msg(notification);
+        FixedMessageBuffer<messages::SkeletonRecord::MessageSerialization> buf;
 
         serialize(buf, msg);
 
@@ -141,11 +144,11 @@ namespace common {
     int VRPN_CALLBACK SkeletonComponent::m_handleSkeletonRecord(
         void *userdata, vrpn_HANDLERPARAM p) {
         auto self = static_cast<SkeletonComponent *>(userdata);
-        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
-
-        messages::SkeletonRecord::MessageSerialization msg;
-        deserialize(bufReader, msg);
-        auto data = msg.getNotification();
+        auto view =
+            viewFixedMessage<messages::SkeletonRecord::MessageSerialization>(
+                p.buffer, p.payload_len);
+        SkeletonNotification data;
+        data.sensor = view.get<0>();
         auto timestamp = util::time::fromStructTimeval(p.msg_time);
 
         for (auto const &cb : self->m_cb) {
@@ -30,12 +30,14 @@
 #include <osvr/Common/JSONSerializationTags.h>
 #include <osvr/Common/Buffer.h>
 #include <osvr/Common/PathTreeSerialization.h>
+#include <osvr/Common/MulticastReports.h>
+#include <osvr/Common/ClockSync.h>
 
 // Library/third-party includes
 #include <json/value.h>
 
 // Standard includes
-// - none
+#include <sstream>
 
 namespace osvr {
 namespace common {
@@ -93,6 +95,100 @@ namespace common {
         const char *ReplacementTreeFromServer::identifier() {
             return "com.osvr.system.ReplacementTreeFromServer";
         }
+
+        class ClientInterestToServer::MessageSerialization {
+          public:
+            MessageSerialization(Json::Value const &msg = Json::objectValue)
+                : m_msg(msg) {}
+
+            template <typename T> void processMessage(T &p) {
+                p(m_msg, serialization::JsonOnlyMessageTag());
+            }
+
+            Json::Value const &getValue() const { return m_msg; }
+
+          private:
+            Json::Value m_msg;
+        };
+        const char *ClientInterestToServer::identifier() {
+            return "com.osvr.system.ClientInterestToServer";
+        }
+
+        class SharedMemoryReportsFromServer::MessageSerialization {
+          public:
+            MessageSerialization(Json::Value const &msg = Json::objectValue)
+                : m_msg(msg) {}
+
+            template <typename T> void processMessage(T &p) {
+                p(m_msg, serialization::JsonOnlyMessageTag());
+            }
+
+            Json::Value const &getValue() const { return m_msg; }
+
+          private:
+            Json::Value m_msg;
+        };
+        const char *SharedMemoryReportsFromServer::identifier() {
+            return "com.osvr.system.SharedMemoryReportsFromServer";
+        }
+
+        class MulticastReportsFromServer::MessageSerialization {
+          public:
+            MessageSerialization(Json::Value const &msg = Json::objectValue)
+                : m_msg(msg) {}
+
+            template <typename T> void processMessage(T &p) {
+                p(m_msg, serialization::JsonOnlyMessageTag());
+            }
+
+            Json::Value const &getValue() const { return m_msg; }
+
+          private:
+            Json::Value m_msg;
+        };
+        const char *MulticastReportsFromServer::identifier() {
+            return "com.osvr.system.MulticastReportsFromServer";
+        }
+
+        class ClockSyncRequestToServer::MessageSerialization {
+          public:
+            MessageSerialization(
+                ClockSyncRequest const &request = ClockSyncRequest())
+                : m_request(request) {}
+
+            template <typename T> void processMessage(T &p) {
+                m_request.processMessage(p);
+            }
+
+            ClockSyncRequest const &getRequest() const { return m_request; }
+
+          private:
+            ClockSyncRequest m_request;
+        };
+        const char *ClockSyncRequestToServer::identifier() {
+            return "com.osvr.system.ClockSyncRequestToServer";
+        }
+
+        class ClockSyncResponseFromServer::MessageSerialization {
+          public:
+            MessageSerialization(
+                ClockSyncResponse const &response = ClockSyncResponse())
+                : m_response(response) {}
+
+            template <typename T> void processMessage(T &p) {
+                m_response.processMessage(p);
+            }
+
+            ClockSyncResponse const &getResponse() const {
+                return m_response;
+            }
+
+          private:
+            ClockSyncResponse m_response;
+        };
+        const char *ClockSyncResponseFromServer::identifier() {
+            return "com.osvr.system.ClockSyncResponseFromServer";
+        }
     } // namespace messages
 
     const char *SystemComponent::deviceName() {
@@ -150,11 +246,148 @@ namespace common {
         m_replaceTreeHandlers.push_back(cb);
     }
 
+    static const char CLIENT_KEY[] = "client";
+    static const char SOURCES_KEY[] = "sources";
+
+    void SystemComponent::sendClientInterest(
+        std::string const &clientId,
+        ClientInterestFilter::Interest const &interest) {
+        Json::Value msgValue(Json::objectValue);
+        msgValue[CLIENT_KEY] = clientId;
+        Json::Value &sources = msgValue[SOURCES_KEY] = Json::objectValue;
+        for (auto const &source : interest) {
+            sources[source.first] = source.second;
+        }
+        Buffer<> buf;
+        messages::ClientInterestToServer::MessageSerialization msg(msgValue);
+        serialize(buf, msg);
+        m_getParent().packMessage(buf, interestIn.getMessageType());
+    }
+
+    void SystemComponent::registerClientInterestHandler(
+        ClientInterestHandler cb) {
+        if (m_clientInterestHandlers.empty()) {
+            m_registerHandler(&SystemComponent::m_handleClientInterest, this,
+                              interestIn.getMessageType());
+        }
+        m_clientInterestHandlers.push_back(cb);
+    }
+
+    void SystemComponent::sendSharedMemoryReports(
+        SharedMemoryReportDirectory const &directory) {
+        Json::Value msgValue(Json::objectValue);
+        for (auto const &entry : directory) {
+            msgValue[entry.first] = entry.second;
+        }
+        Buffer<> buf;
+        messages::SharedMemoryReportsFromServer::MessageSerialization msg(
+            msgValue);
+        serialize(buf, msg);
+        m_getParent().packMessage(buf,
+                                  sharedMemoryReportsOut.getMessageType());
+    }
+
+    void SystemComponent::registerSharedMemoryReportsHandler(
+        SharedMemoryReportsHandler cb) {
+        if (m_sharedMemoryReportsHandlers.empty()) {
+            m_registerHandler(&SystemComponent::m_handleSharedMemoryReports,
+                              this, sharedMemoryReportsOut.getMessageType());
+        }
+        m_sharedMemoryReportsHandlers.push_back(cb);
+    }
+
+    static const char MULTICAST_GROUP_KEY[] = "group";
+    static const char MULTICAST_PORT_KEY[] = "port";
+    static const char MULTICAST_SENDER_KEY[] = "sender";
+    static const char MULTICAST_STREAMS_KEY[] = "streams";
+
+    void SystemComponent::sendMulticastReports(
+        MulticastReportDirectory const &directory) {
+        Json::Value msgValue(Json::objectValue);
+        msgValue[MULTICAST_GROUP_KEY] = directory.group;
+        msgValue[MULTICAST_PORT_KEY] = directory.port;
+        /// As a string: not every JSON consumer handles 64-bit integers.
+        std::ostringstream sender;
+        sender << std::hex << directory.sender;
+        msgValue[MULTICAST_SENDER_KEY] = sender.str();
+        Json::Value &streams = msgValue[MULTICAST_STREAMS_KEY];
+        streams = Json::objectValue;
+        for (auto const &entry : directory.streams) {
+            streams[entry.first] = entry.second;
+        }
+        Buffer<> buf;
+        messages::MulticastReportsFromServer::MessageSerialization msg(
+            msgValue);
+        serialize(buf, msg);
+        m_getParent().packMessage(buf, multicastReportsOut.getMessageType());
+    }
+
+    void SystemComponent::registerMulticastReportsHandler(
+        MulticastReportsHandler cb) {
+        if (m_multicastReportsHandlers.empty()) {
+            m_registerHandler(&SystemComponent::m_handleMulticastReports, this,
+                              multicastReportsOut.getMessageType());
+        }
+        m_multicastReportsHandlers.push_back(cb);
+    }
+
+    void SystemComponent::sendClockSyncRequest(uint64_t client,
+                                               uint32_t sequence) {
+        ClockSyncRequest request;
+        request.client = client;
+        request.sequence = sequence;
+        request.clientSent = timeToMicroseconds(util::time::getNow());
+        Buffer<> buf;
+        messages::ClockSyncRequestToServer::MessageSerialization msg(request);
+        serialize(buf, msg);
+        m_getParent().packMessage(buf, clockSyncIn.getMessageType());
+
+        /// Waiting for the next mainloop would count towards the round trip.
+        m_getParent().sendPending();
+    }
+
+    void SystemComponent::registerClockSyncRequestHandler(
+        ClockSyncRequestHandler cb) {
+        if (m_clockSyncRequestHandlers.empty()) {
+            m_registerHandler(&SystemComponent::m_handleClockSyncRequest, this,
+                              clockSyncIn.getMessageType());
+        }
+        m_clockSyncRequestHandlers.push_back(cb);
+    }
+
+    void SystemComponent::sendClockSyncResponse(
+        ClockSyncRequest const &request,
+        util::time::TimeValue const &received) {
+        ClockSyncResponse response(request);
+        response.serverReceived = timeToMicroseconds(received);
+        response.serverSent = timeToMicroseconds(util::time::getNow());
+        Buffer<> buf;
+        messages::ClockSyncResponseFromServer::MessageSerialization msg(
+            response);
+        serialize(buf, msg);
+        m_getParent().packMessage(buf, clockSyncOut.getMessageType());
+        m_getParent().sendPending();
+    }
+
+    void SystemComponent::registerClockSyncResponseHandler(
+        ClockSyncResponseHandler cb) {
+        if (m_clockSyncResponseHandlers.empty()) {
+            m_registerHandler(&SystemComponent::m_handleClockSyncResponse,
+                              this, clockSyncOut.getMessageType());
+        }
+        m_clockSyncResponseHandlers.push_back(cb);
+    }
+
     void SystemComponent::m_parentSet() {
         m_getParent().registerMessageType(routesOut);
         m_getParent().registerMessageType(appStartup);
         m_getParent().registerMessageType(routeIn);
         m_getParent().registerMessageType(treeOut);
+        m_getParent().registerMessageType(interestIn);
+        m_getParent().registerMessageType(sharedMemoryReportsOut);
+        m_getParent().registerMessageType(multicastReportsOut);
+        m_getParent().registerMessageType(clockSyncIn);
+        m_getParent().registerMessageType(clockSyncOut);
     }
 
     int SystemComponent::m_handleReplaceTree(void *userdata,
@@ -171,5 +404,114 @@ namespace common {
         }
         return 0;
     }
+
+    int SystemComponent::m_handleClientInterest(void *userdata,
+                                                vrpn_HANDLERPARAM p) {
+        auto self = static_cast<SystemComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+        messages::ClientInterestToServer::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        auto const &msgValue = msg.getValue();
+        if (!msgValue.isObject() || !msgValue[CLIENT_KEY].isString()) {
+            /// Malformed: ignore it rather than mistaking it for a client
+            /// that wants nothing.
+            return 0;
+        }
+        auto clientId = msgValue[CLIENT_KEY].asString();
+        ClientInterestFilter::Interest interest;
+        auto const &sources = msgValue[SOURCES_KEY];
+        if (sources.isObject()) {
+            for (auto const &name : sources.getMemberNames()) {
+                auto const &rate = sources[name];
+                interest[name] = rate.isNumeric() ? rate.asDouble() : 0.;
+            }
+        }
+        auto timestamp = util::time::fromStructTimeval(p.msg_time);
+        for (auto const &cb : self->m_clientInterestHandlers) {
+            cb(clientId, interest, timestamp);
+        }
+        return 0;
+    }
+
+    int SystemComponent::m_handleSharedMemoryReports(void *userdata,
+                                                     vrpn_HANDLERPARAM p) {
+        auto self = static_cast<SystemComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+        messages::SharedMemoryReportsFromServer::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        auto const &msgValue = msg.getValue();
+        SharedMemoryReportDirectory directory;
+        if (msgValue.isObject()) {
+            for (auto const &device : msgValue.getMemberNames()) {
+                auto const &ringName = msgValue[device];
+                if (ringName.isString()) {
+                    directory[device] = ringName.asString();
+                }
+            }
+        }
+        for (auto const &cb : self->m_sharedMemoryReportsHandlers) {
+            cb(directory);
+        }
+        return 0;
+    }
+
+    int SystemComponent::m_handleMulticastReports(void *userdata,
+                                                  vrpn_HANDLERPARAM p) {
+        auto self = static_cast<SystemComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+        messages::MulticastReportsFromServer::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        auto const &msgValue = msg.getValue();
+        MulticastReportDirectory directory;
+        if (msgValue.isObject()) {
+            directory.group = msgValue[MULTICAST_GROUP_KEY].asString();
+            directory.port =
+                static_cast<uint16_t>(msgValue[MULTICAST_PORT_KEY].asUInt());
+            std::istringstream sender(
+                msgValue[MULTICAST_SENDER_KEY].asString());
+            sender >> std::hex >> directory.sender;
+            auto const &streams = msgValue[MULTICAST_STREAMS_KEY];
+            if (streams.isObject()) {
+                for (auto const &device : streams.getMemberNames()) {
+                    auto const &stream = streams[device];
+                    if (stream.isUInt()) {
+                        directory.streams[device] = stream.asUInt();
+                    }
+                }
+            }
+        }
+        for (auto const &cb : self->m_multicastReportsHandlers) {
+            cb(directory);
+        }
+        return 0;
+    }
+
+    int SystemComponent::m_handleClockSyncRequest(void *userdata,
+                                                  vrpn_HANDLERPARAM p) {
+        /// Before anything else, so as little as possible counts as the
+        /// server taking time to respond.
+        auto received = util::time::getNow();
+        auto self = static_cast<SystemComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+        messages::ClockSyncRequestToServer::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        for (auto const &cb : self->m_clockSyncRequestHandlers) {
+            cb(msg.getRequest(), received);
+        }
+        return 0;
+    }
+
+    int SystemComponent::m_handleClockSyncResponse(void *userdata,
+                                                   vrpn_HANDLERPARAM p) {
+        auto received = util::time::getNow();
+        auto self = static_cast<SystemComponent *>(userdata);
+        auto bufReader = readExternalBuffer(p.buffer, p.payload_len);
+        messages::ClockSyncResponseFromServer::MessageSerialization msg;
+        deserialize(bufReader, msg);
+        for (auto const &cb : self->m_clockSyncResponseHandlers) {
+            cb(msg.getResponse(), received);
+        }
+        return 0;
+    }
 } // namespace common
 } // namespace osvr
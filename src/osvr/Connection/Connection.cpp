@@ -28,6 +28,7 @@
 #include <osvr/Util/SharedPtr.h>
 #include <osvr/PluginHost/RegistrationContext.h>
 #include <osvr/Connection/MessageType.h>
+#include <osvr/Connection/DeviceUpdateScheduler.h>
 #include "VrpnBasedConnection.h"
 #include "GenericConnectionDevice.h"
 #include <osvr/Util/LogNames.h>
@@ -138,6 +139,9 @@ namespace connection {
             }
         }
         m_devices.push_back(device);
+        if (m_recorder) {
+            device->setReportRecorder(m_recorder);
+        }
     }
 
     void Connection::process() {
@@ -162,8 +166,41 @@ namespace connection {
         }
     }
 
+    void Connection::setInProcessTrackerTransport(
+        common::InProcessTrackerTransportPtr const &transport) {
+        m_trackerTransport = transport;
+    }
+
+    void Connection::setClientInterestFilter(
+        common::ClientInterestFilterPtr const &filter) {
+        m_interestFilter = filter;
+    }
+
+    void Connection::setSharedMemoryReportPublisher(
+        common::SharedMemoryReportPublisherPtr const &publisher) {
+        m_reportPublisher = publisher;
+    }
+
+    void Connection::setMulticastReportPublisher(
+        common::MulticastReportPublisherPtr const &publisher) {
+        m_multicastPublisher = publisher;
+    }
+
+    void Connection::setDeviceUpdateScheduler(
+        DeviceUpdateSchedulerPtr const &scheduler) {
+        m_updateScheduler = scheduler;
+    }
+
+    void Connection::setReportRecorder(ReportRecorderPtr const &recorder) {
+        m_recorder = recorder;
+        for (auto &dev : m_devices) {
+            dev->setReportRecorder(m_recorder);
+        }
+    }
+
     Connection::Connection()
-        : m_log(util::log::make_logger(util::log::OSVR_SERVER_LOG)) {}
+        : m_log(util::log::make_logger(util::log::OSVR_SERVER_LOG)),
+          m_updateScheduler(DeviceUpdateScheduler::createInline()) {}
 
     Connection::~Connection() {}
 
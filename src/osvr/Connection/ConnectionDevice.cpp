@@ -25,6 +25,7 @@
 // Internal Includes
 #include <osvr/Connection/ConnectionDevice.h>
 #include <osvr/Connection/DeviceToken.h>
+#include <osvr/Connection/ReportRecording.h>
 
 // Library/third-party includes
 #include <boost/assert.hpp>
@@ -65,9 +66,23 @@ namespace connection {
         m_token = &token;
     }
 
+    void ConnectionDevice::setReportRecorder(
+        ReportRecorderPtr const &recorder) {
+        m_recorder = recorder;
+        if (m_recorder && !m_descriptor.empty()) {
+            m_recorder->recordDescriptor(getName(), m_descriptor);
+        }
+        m_setReportRecorder(recorder);
+    }
+
+    void ConnectionDevice::m_setReportRecorder(ReportRecorderPtr const &) {}
+
     void ConnectionDevice::setDeviceDescriptor(std::string const &jsonString) {
         /// @todo validate descriptor here
         m_descriptor = jsonString;
+        if (m_recorder) {
+            m_recorder->recordDescriptor(getName(), m_descriptor);
+        }
     }
 
     std::string const &ConnectionDevice::getDeviceDescriptor() const {
@@ -0,0 +1,100 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_DeferredSendQueue_h_GUID_25BF2575_7BF6_4AA8_BE7D_66319D45AF15
+#define INCLUDED_DeferredSendQueue_h_GUID_25BF2575_7BF6_4AA8_BE7D_66319D45AF15
+
+// Internal Includes
+#include <osvr/Connection/MessageTypePtr.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace osvr {
+namespace connection {
+    /// @brief A lock-free, fixed-capacity, single-producer single-consumer
+    /// queue of messages, copied in by a device's update on a worker thread
+    /// and sent on by the thread that owns the connection.
+    class DeferredSendQueue : boost::noncopyable {
+      public:
+        /// @brief Capacity, in messages: a power of two.
+        static const std::size_t CAPACITY = 64;
+
+        DeferredSendQueue() : m_messages(CAPACITY), m_head(0), m_tail(0) {}
+
+        /// @brief Copies a message into the queue (producer only).
+        ///
+        /// @returns false if the queue is full.
+        bool push(util::time::TimeValue const &timestamp, MessageType *type,
+                  const char *bytestream, std::size_t len) {
+            auto head = m_head.load(std::memory_order_relaxed);
+            auto tail = m_tail.load(std::memory_order_acquire);
+            if (head - tail == CAPACITY) {
+                return false;
+            }
+            auto &msg = m_messages[head & (CAPACITY - 1)];
+            msg.timestamp = timestamp;
+            msg.type = type;
+            msg.data.assign(bytestream, bytestream + len);
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /// @brief Passes each queued message, oldest first, to
+        /// `f(timestamp, type, bytestream, len)` (consumer only).
+        template <typename F> void drain(F &&f) {
+            auto tail = m_tail.load(std::memory_order_relaxed);
+            auto head = m_head.load(std::memory_order_acquire);
+            for (; tail != head; ++tail) {
+                auto const &msg = m_messages[tail & (CAPACITY - 1)];
+                f(msg.timestamp, msg.type,
+                  msg.data.empty() ? nullptr : msg.data.data(),
+                  msg.data.size());
+                m_tail.store(tail + 1, std::memory_order_release);
+            }
+        }
+
+      private:
+        struct Message {
+            util::time::TimeValue timestamp;
+            MessageType *type;
+            /// @brief Keeps its capacity from one use of the slot to the next.
+            std::vector<char> data;
+        };
+        std::vector<Message> m_messages;
+        /// @brief Next slot to write: only stored by the producer.
+        std::atomic<std::size_t> m_head;
+        /// @brief Next slot to read: only stored by the consumer.
+        std::atomic<std::size_t> m_tail;
+    };
+} // namespace connection
+} // namespace osvr
+
+#endif // INCLUDED_DeferredSendQueue_h_GUID_25BF2575_7BF6_4AA8_BE7D_66319D45AF15
@@ -27,6 +27,10 @@
 
 // Internal Includes
 #include <osvr/Connection/DeviceInitObject.h>
+#include <osvr/Common/ClientInterestFilter.h>
+#include <osvr/Common/InProcessTrackerTransport.h>
+#include <osvr/Common/SharedMemoryReportPublisher.h>
+#include <osvr/Common/MulticastReports.h>
 
 // Library/third-party includes
 #include <vrpn_Connection.h>
@@ -38,15 +42,51 @@
 namespace osvr {
 namespace connection {
     class vrpn_BaseFlexServer;
+    class DeviceMessageRecorder;
     class DeviceConstructionData : boost::noncopyable {
       public:
         DeviceConstructionData(DeviceInitObject &initObject,
                                vrpn_Connection *connection)
-            : obj(initObject), conn(connection), flexServer(nullptr) {}
+            : obj(initObject), conn(connection), flexServer(nullptr),
+              recording(nullptr), trackerTransport(nullptr),
+              reportPublisher(nullptr), multicastPublisher(nullptr) {}
         std::string getQualifiedName() const { return obj.getQualifiedName(); }
         DeviceInitObject &obj;
         vrpn_Connection *conn;
         vrpn_BaseFlexServer *flexServer;
+        /// Every server passes the messages it packs to this, to be recorded
+        /// if the connection is recording.
+        DeviceMessageRecorder *recording;
+        /// If non-null, tracker reports go here instead of over conn.
+        common::InProcessTrackerTransport *trackerTransport;
+        /// If non-null, consulted before sending reports.
+        common::ClientInterestFilter::DevicePtr interest;
+        /// If non-null, reports are also written to a shared memory ring from
+        /// here, for local clients.
+        common::SharedMemoryReportPublisher *reportPublisher;
+        /// If non-null, reports are also sent to a multicast group from here,
+        /// for LAN clients.
+        common::MulticastReportPublisher *multicastPublisher;
+
+        /// @brief Gets this device's shared memory report ring, if reports
+        /// are to be published that way.
+        common::SharedMemoryReportRingPtr getReportRing() const {
+            common::SharedMemoryReportRingPtr ret;
+            if (reportPublisher) {
+                ret = reportPublisher->getRing(getQualifiedName());
+            }
+            return ret;
+        }
+
+        /// @brief Gets this device's multicast report stream, if reports are
+        /// to be published that way.
+        common::MulticastReportStreamPtr getMulticastStream() const {
+            common::MulticastReportStreamPtr ret;
+            if (multicastPublisher) {
+                ret = multicastPublisher->getStream(getQualifiedName());
+            }
+            return ret;
+        }
     };
 } // namespace connection
 } // namespace osvr
@@ -0,0 +1,84 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INCLUDED_DeviceMessageRecorder_h_GUID_3A067DDF_E83B_49C1_9F8B_A866259B19AB
+#define INCLUDED_DeviceMessageRecorder_h_GUID_3A067DDF_E83B_49C1_9F8B_A866259B19AB
+
+// Internal Includes
+#include <osvr/Connection/ReportRecording.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+#include <vrpn_Connection.h>
+#include <boost/noncopyable.hpp>
+
+// Standard includes
+#include <cstddef>
+#include <string>
+
+namespace osvr {
+namespace connection {
+    /// @brief Shared by the VRPN server objects making up a device, which
+    /// each call record() as they pack a message, so that it is written to
+    /// the connection's report recorder, if any.
+    class DeviceMessageRecorder : boost::noncopyable {
+      public:
+        DeviceMessageRecorder(std::string const &deviceName,
+                              vrpn_Connection *conn)
+            : m_deviceName(deviceName), m_conn(conn) {}
+
+        void setRecorder(ReportRecorderPtr const &recorder) {
+            m_recorder = recorder;
+        }
+
+        /// @brief Whether messages are being recorded: check before doing
+        /// any extra work to encode a message just for the recording.
+        bool isRecording() const { return bool(m_recorder); }
+
+        /// @brief Records a message packed with the given VRPN message type
+        /// ID, if recording.
+        void record(vrpn_int32 type, struct timeval const &timestamp,
+                    const char *bytestream, std::size_t len) {
+            if (!m_recorder) {
+                return;
+            }
+            auto typeName = m_conn->message_type_name(type);
+            if (!typeName) {
+                return;
+            }
+            m_recorder->recordMessage(m_deviceName, typeName,
+                                      util::time::fromStructTimeval(timestamp),
+                                      bytestream, len);
+        }
+
+      private:
+        std::string const m_deviceName;
+        vrpn_Connection *m_conn;
+        ReportRecorderPtr m_recorder;
+    };
+} // namespace connection
+} // namespace osvr
+
+#endif // INCLUDED_DeviceMessageRecorder_h_GUID_3A067DDF_E83B_49C1_9F8B_A866259B19AB
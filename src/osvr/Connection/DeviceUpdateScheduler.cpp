@@ -0,0 +1,274 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Connection/DeviceUpdateScheduler.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <deque>
+
+namespace osvr {
+namespace connection {
+    /// @brief A queue of device updates waiting for a worker thread.
+    class DeviceUpdateScheduler::WorkQueue : boost::noncopyable {
+      public:
+        /// @returns false if the queue has been stopped.
+        bool push(DeviceUpdateTaskPtr const &task) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_stopping) {
+                    return false;
+                }
+                m_pending.push_back(task);
+            }
+            m_wake.notify_one();
+            return true;
+        }
+
+        /// @brief Blocks until there's an update to run: returns null once
+        /// the queue has been stopped.
+        DeviceUpdateTaskPtr pop() {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wake.wait(lock, [&] { return m_stopping || !m_pending.empty(); });
+            DeviceUpdateTaskPtr ret;
+            if (!m_stopping) {
+                ret = m_pending.front();
+                m_pending.pop_front();
+            }
+            return ret;
+        }
+
+        /// @brief Stops the queue, returning the updates that never ran.
+        std::deque<DeviceUpdateTaskPtr> stop() {
+            std::deque<DeviceUpdateTaskPtr> ret;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+                ret.swap(m_pending);
+            }
+            m_wake.notify_all();
+            return ret;
+        }
+
+      private:
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::deque<DeviceUpdateTaskPtr> m_pending;
+        bool m_stopping = false;
+    };
+
+    DeviceUpdateSchedulerPtr DeviceUpdateScheduler::createInline() {
+        DeviceUpdateSchedulerPtr ret(
+            new DeviceUpdateScheduler(Mode::Inline, 0));
+        return ret;
+    }
+
+    DeviceUpdateSchedulerPtr
+    DeviceUpdateScheduler::createPool(std::size_t threads) {
+        DeviceUpdateSchedulerPtr ret(new DeviceUpdateScheduler(
+            Mode::Pool, (std::max)(threads, std::size_t(1))));
+        return ret;
+    }
+
+    DeviceUpdateSchedulerPtr DeviceUpdateScheduler::createPerDevice() {
+        DeviceUpdateSchedulerPtr ret(
+            new DeviceUpdateScheduler(Mode::PerDevice, 0));
+        return ret;
+    }
+
+    DeviceUpdateScheduler::DeviceUpdateScheduler(Mode mode,
+                                                 std::size_t threads)
+        : m_mode(mode) {
+        if (m_mode == Mode::Pool) {
+            m_poolQueue = make_shared<WorkQueue>();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (std::size_t i = 0; i < threads; ++i) {
+                m_startThread(m_poolQueue);
+            }
+        }
+    }
+
+    DeviceUpdateScheduler::~DeviceUpdateScheduler() {
+        for (auto &queue : m_queues) {
+            m_stopQueue(*queue);
+        }
+        for (auto &thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    DeviceUpdateTaskPtr
+    DeviceUpdateScheduler::addDevice(std::string const &name,
+                                     UpdateFunction const &update) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        WorkQueuePtr queue;
+        bool ownsQueue = false;
+        switch (m_mode) {
+        case Mode::Inline:
+            break;
+        case Mode::Pool:
+            queue = m_poolQueue;
+            break;
+        case Mode::PerDevice:
+            queue = make_shared<WorkQueue>();
+            m_startThread(queue);
+            ownsQueue = true;
+            break;
+        }
+        DeviceUpdateTaskPtr ret(
+            new DeviceUpdateTask(name, update, queue, ownsQueue));
+        /// Forget tasks that have since gone away.
+        m_tasks.erase(std::remove_if(begin(m_tasks), end(m_tasks),
+                                     [](weak_ptr<DeviceUpdateTask> const &t) {
+                                         return t.expired();
+                                     }),
+                      end(m_tasks));
+        m_tasks.push_back(ret);
+        return ret;
+    }
+
+    std::vector<DeviceUpdateStats> DeviceUpdateScheduler::getStats() const {
+        std::vector<DeviceUpdateStats> ret;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto const &weakTask : m_tasks) {
+            auto task = weakTask.lock();
+            if (task) {
+                ret.push_back(task->getStats());
+            }
+        }
+        return ret;
+    }
+
+    void DeviceUpdateScheduler::m_startThread(WorkQueuePtr const &queue) {
+        m_queues.push_back(queue);
+        m_threads.emplace_back(&DeviceUpdateScheduler::m_work, queue);
+    }
+
+    void DeviceUpdateScheduler::m_work(WorkQueuePtr queue) {
+        while (auto task = queue->pop()) {
+            task->m_runQueued();
+        }
+    }
+
+    void DeviceUpdateScheduler::m_stopQueue(WorkQueue &queue) {
+        for (auto &task : queue.stop()) {
+            task->m_finish();
+        }
+    }
+
+    DeviceUpdateTask::DeviceUpdateTask(
+        std::string const &name,
+        DeviceUpdateScheduler::UpdateFunction const &update,
+        WorkQueuePtr const &queue, bool ownsQueue)
+        : m_name(name), m_update(update), m_queue(queue),
+          m_ownsQueue(ownsQueue), m_busy(false), m_cancelled(false),
+          m_updates(0), m_skipped(0), m_totalMicroseconds(0),
+          m_lastMicroseconds(0), m_maxMicroseconds(0) {}
+
+    bool DeviceUpdateTask::requestUpdate() {
+        if (m_cancelled) {
+            return false;
+        }
+        if (!m_queue) {
+            m_run();
+            return true;
+        }
+        bool expected = false;
+        if (!m_busy.compare_exchange_strong(expected, true)) {
+            m_skipped.store(m_skipped.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+            return false;
+        }
+        if (!m_queue->push(shared_from_this())) {
+            m_finish();
+            return false;
+        }
+        return true;
+    }
+
+    void DeviceUpdateTask::cancel() {
+        m_cancelled = true;
+        if (m_ownsQueue) {
+            DeviceUpdateScheduler::m_stopQueue(*m_queue);
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_idle.wait(lock, [&] { return !m_busy; });
+    }
+
+    DeviceUpdateStats DeviceUpdateTask::getStats() const {
+        DeviceUpdateStats ret;
+        ret.name = m_name;
+        ret.updates = m_updates.load(std::memory_order_relaxed);
+        ret.skipped = m_skipped.load(std::memory_order_relaxed);
+        ret.lastMicroseconds =
+            m_lastMicroseconds.load(std::memory_order_relaxed);
+        ret.maxMicroseconds = m_maxMicroseconds.load(std::memory_order_relaxed);
+        if (ret.updates > 0) {
+            ret.meanMicroseconds =
+                double(m_totalMicroseconds.load(std::memory_order_relaxed)) /
+                double(ret.updates);
+        }
+        return ret;
+    }
+
+    void DeviceUpdateTask::m_run() {
+        auto start = std::chrono::steady_clock::now();
+        m_update();
+        uint64_t duration =
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start)
+                .count();
+
+        m_lastMicroseconds.store(duration, std::memory_order_relaxed);
+        if (duration > m_maxMicroseconds.load(std::memory_order_relaxed)) {
+            m_maxMicroseconds.store(duration, std::memory_order_relaxed);
+        }
+        m_totalMicroseconds.store(
+            m_totalMicroseconds.load(std::memory_order_relaxed) + duration,
+            std::memory_order_relaxed);
+        m_updates.store(m_updates.load(std::memory_order_relaxed) + 1,
+                        std::memory_order_relaxed);
+    }
+
+    void DeviceUpdateTask::m_runQueued() {
+        if (!m_cancelled) {
+            m_run();
+        }
+        m_finish();
+    }
+
+    void DeviceUpdateTask::m_finish() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_busy = false;
+        }
+        m_idle.notify_all();
+    }
+} // namespace connection
+} // namespace osvr
@@ -0,0 +1,304 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Connection/ReportRecording.h>
+#include <osvr/Common/Buffer.h>
+#include <osvr/Common/FixedLayoutSerialization.h>
+#include <osvr/Common/Serialization.h>
+#include <osvr/Util/Logger.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <stdexcept>
+
+namespace osvr {
+namespace connection {
+    const uint32_t ReportRecorder::MAGIC;
+    const uint32_t ReportRecorder::VERSION;
+
+    namespace {
+        using common::serialization::FixedLayout;
+
+        /// @brief Starts the file.
+        struct FileHeader {
+            FileHeader()
+                : magic(ReportRecorder::MAGIC),
+                  version(ReportRecorder::VERSION) {}
+            uint32_t magic;
+            uint32_t version;
+
+            typedef FixedLayout<uint32_t, uint32_t> fixed_layout;
+
+            template <typename T> void processMessage(T &p) {
+                p(magic);
+                p(version);
+            }
+        };
+
+        /// @brief Precedes each entry, so readers can skip kinds they don't
+        /// know.
+        struct EntryHeader {
+            EntryHeader() : kind(0), length(0) {}
+            uint32_t kind;
+            /// @brief Bytes in the entry, not counting this header.
+            uint32_t length;
+
+            typedef FixedLayout<uint32_t, uint32_t> fixed_layout;
+
+            template <typename T> void processMessage(T &p) {
+                p(kind);
+                p(length);
+            }
+        };
+
+        template <typename T>
+        inline void processTime(T &p, util::time::TimeValue &tv) {
+            p(tv.seconds);
+            p(tv.microseconds);
+        }
+
+        struct StreamBody {
+            explicit StreamBody(RecordedEntry &e) : entry(e) {}
+            RecordedEntry &entry;
+
+            template <typename T> void processMessage(T &p) {
+                p(entry.stream);
+                p(entry.device);
+                p(entry.messageType);
+            }
+        };
+
+        struct DescriptorBody {
+            explicit DescriptorBody(RecordedEntry &e) : entry(e) {}
+            RecordedEntry &entry;
+
+            template <typename T> void processMessage(T &p) {
+                processTime(p, entry.sent);
+                p(entry.device);
+                p(entry.data);
+            }
+        };
+
+        /// @brief Followed by the message bytes, to the end of the entry.
+        struct MessageBody {
+            explicit MessageBody(RecordedEntry &e) : entry(e) {}
+            RecordedEntry &entry;
+
+            template <typename T> void processMessage(T &p) {
+                p(entry.stream);
+                processTime(p, entry.sent);
+                processTime(p, entry.timestamp);
+            }
+        };
+
+        inline uint32_t kindToInt(RecordedEntry::Kind kind) {
+            return static_cast<uint32_t>(kind);
+        }
+    } // namespace
+
+    ReportRecorderPtr ReportRecorder::create(std::string const &filename) {
+        ReportRecorderPtr ret(new ReportRecorder(filename));
+        return ret;
+    }
+
+    ReportRecorder::ReportRecorder(std::string const &filename)
+        : m_filename(filename),
+          m_file(filename, std::ios::out | std::ios::binary | std::ios::trunc),
+          m_messages(0), m_failed(false) {
+        if (!m_file) {
+            throw std::runtime_error("Could not open report recording file " +
+                                     filename);
+        }
+        FileHeader header;
+        common::FixedMessageBuffer<FileHeader> buf;
+        common::serialize(buf, header);
+        m_file.write(buf.data(), buf.size());
+        if (!m_file) {
+            throw std::runtime_error("Could not write to report recording "
+                                     "file " +
+                                     filename);
+        }
+    }
+
+    ReportRecorder::~ReportRecorder() { flush(); }
+
+    void ReportRecorder::recordMessage(std::string const &device,
+                                       std::string const &messageType,
+                                       util::time::TimeValue const &timestamp,
+                                       const char *bytestream,
+                                       std::size_t len) {
+        RecordedEntry entry;
+        util::time::getNow(entry.sent);
+        entry.timestamp = timestamp;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_failed) {
+            return;
+        }
+        auto key = StreamKey(device, messageType);
+        auto it = m_streams.find(key);
+        if (it == end(m_streams)) {
+            entry.stream = static_cast<uint32_t>(m_streams.size());
+            entry.device = device;
+            entry.messageType = messageType;
+            StreamBody streamBody(entry);
+            m_write(RecordedEntry::Kind::Stream, streamBody);
+            m_streams[key] = entry.stream;
+        } else {
+            entry.stream = it->second;
+        }
+        MessageBody body(entry);
+        m_write(RecordedEntry::Kind::Message, body, bytestream, len);
+        ++m_messages;
+    }
+
+    void ReportRecorder::recordDescriptor(std::string const &device,
+                                          std::string const &descriptor) {
+        RecordedEntry entry;
+        util::time::getNow(entry.sent);
+        entry.device = device;
+        entry.data = descriptor;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_failed) {
+            return;
+        }
+        DescriptorBody body(entry);
+        m_write(RecordedEntry::Kind::Descriptor, body);
+    }
+
+    void ReportRecorder::flush() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_file.flush();
+    }
+
+    uint64_t ReportRecorder::getMessageCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_messages;
+    }
+
+    bool ReportRecorder::hasFailed() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_failed;
+    }
+
+    template <typename Body>
+    void ReportRecorder::m_write(RecordedEntry::Kind kind, Body &body,
+                                 const char *extra, std::size_t extraLen) {
+        common::Buffer<> buf;
+        common::serialize(buf, body);
+        if (extraLen) {
+            buf.append(extra, extraLen);
+        }
+        EntryHeader header;
+        header.kind = kindToInt(kind);
+        header.length = static_cast<uint32_t>(buf.size());
+        common::FixedMessageBuffer<EntryHeader> headerBuf;
+        common::serialize(headerBuf, header);
+        m_file.write(headerBuf.data(), headerBuf.size());
+        m_file.write(buf.data(), buf.size());
+        if (!m_file) {
+            m_failed = true;
+            util::log::make_logger("ReportRecorder")
+                ->error()
+                << "Could not write to " << m_filename
+                << ": no more reports will be recorded";
+        }
+    }
+
+    ReportRecordingReader::ReportRecordingReader(std::string const &filename)
+        : m_file(filename, std::ios::in | std::ios::binary) {
+        if (!m_file) {
+            throw std::runtime_error("Could not open report recording file " +
+                                     filename);
+        }
+        char bytes[common::FixedMessageSize<FileHeader>::value];
+        FileHeader header;
+        header.magic = 0;
+        if (m_file.read(bytes, sizeof(bytes))) {
+            auto reader = common::readExternalBuffer(bytes, sizeof(bytes));
+            common::deserialize(reader, header);
+        }
+        if (header.magic != ReportRecorder::MAGIC) {
+            throw std::runtime_error("Not a report recording: " + filename);
+        }
+        if (header.version != ReportRecorder::VERSION) {
+            throw std::runtime_error(
+                "Unsupported report recording version " +
+                std::to_string(header.version) + ": " + filename);
+        }
+        m_firstEntry = m_file.tellg();
+    }
+
+    ReportRecordingReader::~ReportRecordingReader() {}
+
+    bool ReportRecordingReader::read(RecordedEntry &entry) {
+        while (true) {
+            char bytes[common::FixedMessageSize<EntryHeader>::value];
+            if (!m_file.read(bytes, sizeof(bytes))) {
+                return false;
+            }
+            EntryHeader header;
+            {
+                auto reader = common::readExternalBuffer(bytes, sizeof(bytes));
+                common::deserialize(reader, header);
+            }
+            m_body.resize(header.length);
+            if (header.length > 0 && !m_file.read(&m_body[0], header.length)) {
+                return false;
+            }
+            auto reader =
+                common::readExternalBuffer(m_body.data(), m_body.size());
+            if (header.kind == kindToInt(RecordedEntry::Kind::Stream)) {
+                entry.kind = RecordedEntry::Kind::Stream;
+                StreamBody body(entry);
+                common::deserialize(reader, body);
+                return true;
+            }
+            if (header.kind == kindToInt(RecordedEntry::Kind::Descriptor)) {
+                entry.kind = RecordedEntry::Kind::Descriptor;
+                DescriptorBody body(entry);
+                common::deserialize(reader, body);
+                return true;
+            }
+            if (header.kind == kindToInt(RecordedEntry::Kind::Message)) {
+                entry.kind = RecordedEntry::Kind::Message;
+                MessageBody body(entry);
+                common::deserialize(reader, body);
+                auto len = reader.bytesRemaining();
+                auto data = reader.readBytes(len);
+                entry.data.assign(data, data + len);
+                return true;
+            }
+            /// Some later kind of entry: skip it.
+        }
+    }
+
+    void ReportRecordingReader::rewind() {
+        m_file.clear();
+        m_file.seekg(m_firstEntry);
+    }
+} // namespace connection
+} // namespace osvr
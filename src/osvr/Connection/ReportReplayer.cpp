@@ -0,0 +1,223 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Connection/ReportReplayer.h>
+#include <osvr/Connection/Connection.h>
+#include <osvr/Connection/DeviceToken.h>
+#include <osvr/Connection/MessageType.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace osvr {
+namespace connection {
+    const double ReportReplayer::AS_FAST_AS_POSSIBLE = 0.;
+    const std::size_t ReportReplayer::UNPACED_BATCH_SIZE;
+
+    namespace {
+        inline int64_t toMicroseconds(util::time::TimeValue const &tv) {
+            return int64_t(tv.seconds) * 1000000 + tv.microseconds;
+        }
+
+        inline util::time::TimeValue fromMicroseconds(int64_t us) {
+            util::time::TimeValue ret;
+            ret.seconds = us / 1000000;
+            ret.microseconds =
+                static_cast<OSVR_TimeValue_Microseconds>(us % 1000000);
+            return ret;
+        }
+
+        /// @brief Sends replayed entries through virtual devices on a
+        /// connection, created as each device name first appears.
+        class ConnectionReplayTarget : boost::noncopyable {
+          public:
+            explicit ConnectionReplayTarget(ConnectionPtr const &conn)
+                : m_conn(conn) {}
+
+            void operator()(RecordedEntry const &entry,
+                            util::time::TimeValue const &timestamp) {
+                switch (entry.kind) {
+                case RecordedEntry::Kind::Stream: {
+                    if (m_streams.size() <= entry.stream) {
+                        m_streams.resize(entry.stream + 1);
+                    }
+                    auto &stream = m_streams[entry.stream];
+                    stream.device = &m_getDevice(entry.device);
+                    stream.type = &m_getMessageType(entry.messageType);
+                    break;
+                }
+                case RecordedEntry::Kind::Descriptor: {
+                    /// Don't re-send the path tree each time a loop starts.
+                    auto &descriptor = m_descriptors[entry.device];
+                    if (descriptor != entry.data) {
+                        descriptor = entry.data;
+                        m_getDevice(entry.device)
+                            .setDeviceDescriptor(entry.data);
+                    }
+                    break;
+                }
+                case RecordedEntry::Kind::Message:
+                    if (entry.stream < m_streams.size() &&
+                        m_streams[entry.stream].device) {
+                        auto const &stream = m_streams[entry.stream];
+                        stream.device->sendData(timestamp, stream.type,
+                                                entry.data.data(),
+                                                entry.data.size());
+                    }
+                    break;
+                }
+            }
+
+          private:
+            DeviceToken &m_getDevice(std::string const &name) {
+                auto &token = m_devices[name];
+                if (!token) {
+                    token = DeviceToken::createVirtualDevice(name, m_conn);
+                }
+                return *token;
+            }
+
+            MessageType &m_getMessageType(std::string const &name) {
+                auto &type = m_messageTypes[name];
+                if (!type) {
+                    type = m_conn->registerMessageType(name);
+                }
+                return *type;
+            }
+
+            struct Stream {
+                Stream() : device(nullptr), type(nullptr) {}
+                DeviceToken *device;
+                MessageType *type;
+            };
+
+            ConnectionPtr m_conn;
+            std::unordered_map<std::string, DeviceTokenPtr> m_devices;
+            std::unordered_map<std::string, MessageTypePtr> m_messageTypes;
+            std::unordered_map<std::string, std::string> m_descriptors;
+            std::vector<Stream> m_streams;
+        };
+    } // namespace
+
+    ReportReplayerPtr ReportReplayer::create(ConnectionPtr const &conn,
+                                             std::string const &filename,
+                                             double speed, bool loop) {
+        auto target = make_shared<ConnectionReplayTarget>(conn);
+        return create(
+            [target](RecordedEntry const &entry,
+                     util::time::TimeValue const &timestamp) {
+                (*target)(entry, timestamp);
+            },
+            filename, speed, loop);
+    }
+
+    ReportReplayerPtr ReportReplayer::create(Handler const &handler,
+                                             std::string const &filename,
+                                             double speed, bool loop) {
+        ReportReplayerPtr ret(
+            new ReportReplayer(handler, filename, speed, loop));
+        return ret;
+    }
+
+    ReportReplayer::ReportReplayer(Handler const &handler,
+                                   std::string const &filename, double speed,
+                                   bool loop)
+        : m_handler(handler), m_reader(filename),
+          m_speed((std::max)(speed, AS_FAST_AS_POSSIBLE)), m_loop(loop),
+          m_started(false), m_passStart(0), m_haveRecordingStart(false),
+          m_recordingStart(0) {
+        if (!m_reader.read(m_next)) {
+            m_stats.finished = true;
+        }
+    }
+
+    ReportReplayer::~ReportReplayer() {}
+
+    bool ReportReplayer::update() { return update(util::time::getNow()); }
+
+    bool ReportReplayer::update(util::time::TimeValue const &now) {
+        if (m_stats.finished) {
+            return false;
+        }
+        auto nowUs = toMicroseconds(now);
+        if (!m_started) {
+            m_started = true;
+            m_passStart = nowUs;
+            m_haveRecordingStart = false;
+        }
+        std::size_t unpaced = 0;
+        while (true) {
+            auto timestamp = now;
+            if (m_next.kind != RecordedEntry::Kind::Stream) {
+                auto sentUs = toMicroseconds(m_next.sent);
+                if (!m_haveRecordingStart) {
+                    m_recordingStart = sentUs;
+                    m_haveRecordingStart = true;
+                }
+                if (m_speed > AS_FAST_AS_POSSIBLE) {
+                    auto dueUs = m_passStart +
+                                 static_cast<int64_t>(
+                                     (sentUs - m_recordingStart) / m_speed);
+                    if (dueUs > nowUs) {
+                        return true;
+                    }
+                    m_stats.maxLagMicroseconds =
+                        (std::max)(m_stats.maxLagMicroseconds, nowUs - dueUs);
+                } else if (unpaced == UNPACED_BATCH_SIZE) {
+                    return true;
+                } else {
+                    ++unpaced;
+                }
+                if (m_next.kind == RecordedEntry::Kind::Message) {
+                    timestamp = fromMicroseconds(
+                        nowUs - (sentUs - toMicroseconds(m_next.timestamp)));
+                    ++m_stats.messages;
+                    m_stats.bytes += m_next.data.size();
+                }
+            }
+            m_handler(m_next, timestamp);
+            if (!m_reader.read(m_next)) {
+                ++m_stats.passes;
+                if (!m_loop || !m_rewind()) {
+                    m_stats.finished = true;
+                    return false;
+                }
+                m_started = false;
+                return true;
+            }
+        }
+    }
+
+    bool ReportReplayer::m_rewind() {
+        m_reader.rewind();
+        return m_reader.read(m_next);
+    }
+} // namespace connection
+} // namespace osvr
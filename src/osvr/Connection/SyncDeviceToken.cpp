@@ -26,7 +26,9 @@
 
 // Internal Includes
 #include "SyncDeviceToken.h"
+#include <osvr/Connection/Connection.h>
 #include <osvr/Connection/ConnectionDevice.h>
+#include <osvr/Connection/DeviceUpdateScheduler.h>
 #include <osvr/Util/Verbosity.h>
 #include <osvr/Util/GuardInterfaceDummy.h>
 
@@ -34,15 +36,15 @@
 // - none
 
 // Standard includes
-// - none
+#include <functional>
 
 namespace osvr {
 namespace connection {
 
     SyncDeviceToken::SyncDeviceToken(std::string const &name)
-        : OSVR_DeviceTokenObject(name) {}
+        : OSVR_DeviceTokenObject(name), m_threaded(false) {}
 
-    SyncDeviceToken::~SyncDeviceToken() {}
+    SyncDeviceToken::~SyncDeviceToken() { m_stopThreads(); }
 
     void SyncDeviceToken::m_setUpdateCallback(DeviceUpdateCallback const &cb) {
         OSVR_DEV_VERBOSE("In SyncDeviceToken::m_setUpdateCallback");
@@ -52,17 +54,100 @@ namespace connection {
     void SyncDeviceToken::m_sendData(util::time::TimeValue const &timestamp,
                                      MessageType *type, const char *bytestream,
                                      size_t len) {
-        m_getConnectionDevice()->sendData(timestamp, type, bytestream, len);
+        if (!m_needsHandoff()) {
+            m_sendQueued();
+            m_getConnectionDevice()->sendData(timestamp, type, bytestream,
+                                              len);
+            return;
+        }
+        if (m_queue.push(timestamp, type, bytestream, len)) {
+            return;
+        }
+        OSVR_DEV_VERBOSE("SyncDeviceToken::m_sendData\t"
+                         "queue full, waiting for CTS");
+        RequestToSend rts(m_accessControl);
+        if (rts.request()) {
+            m_sendQueued();
+            m_getConnectionDevice()->sendData(timestamp, type, bytestream,
+                                              len);
+        }
     }
 
+    namespace {
+        /// @brief Send guard for an update running on a worker thread: once
+        /// the mainloop clears it to send, sends anything queued first, to
+        /// keep messages in order.
+        class HandoffSendGuard : public util::GuardInterface {
+          public:
+            HandoffSendGuard(AsyncAccessControl &control,
+                             std::function<void()> const &sendQueued)
+                : m_rts(control), m_sendQueued(sendQueued) {}
+            virtual bool lock() {
+                if (!m_rts.request()) {
+                    return false;
+                }
+                m_sendQueued();
+                return true;
+            }
+            virtual ~HandoffSendGuard() {}
+
+          private:
+            RequestToSend m_rts;
+            std::function<void()> m_sendQueued;
+        };
+    } // namespace
+
     util::GuardPtr SyncDeviceToken::m_getSendGuard() {
-        return util::GuardPtr(new util::DummyGuard);
+        if (!m_needsHandoff()) {
+            return util::GuardPtr(new util::DummyGuard);
+        }
+        return util::GuardPtr(
+            new HandoffSendGuard(m_accessControl, [&] { m_sendQueued(); }));
     }
 
     void SyncDeviceToken::m_connectionInteract() {
-        if (m_cb) {
-            m_cb();
+        if (!m_cb) {
+            return;
+        }
+        if (!m_task) {
+            /// Join the connection's scheduler on the first update, so
+            /// the server can be configured after devices are created.
+            m_mainThread = std::this_thread::get_id();
+            m_scheduler = m_getConnection()->getDeviceUpdateScheduler();
+            if (!m_scheduler) {
+                m_cb();
+                return;
+            }
+            auto cb = m_cb;
+            m_task = m_scheduler->addDevice(getName(), [cb] { cb(); });
+            m_threaded = m_task->isThreaded();
         }
+        if (m_threaded) {
+            m_sendQueued();
+            m_accessControl.mainThreadCTS();
+        }
+        m_task->requestUpdate();
+    }
+
+    void SyncDeviceToken::m_stopThreads() {
+        if (m_task) {
+            /// Let an update blocked waiting to send finish.
+            m_accessControl.mainThreadDenyPermanently();
+            m_task->cancel();
+        }
+    }
+
+    bool SyncDeviceToken::m_needsHandoff() const {
+        return m_threaded && std::this_thread::get_id() != m_mainThread;
+    }
+
+    void SyncDeviceToken::m_sendQueued() {
+        m_queue.drain([&](util::time::TimeValue const &timestamp,
+                          MessageType *type, const char *bytestream,
+                          std::size_t len) {
+            m_getConnectionDevice()->sendData(timestamp, type, bytestream,
+                                              len);
+        });
     }
 
 } // namespace connection
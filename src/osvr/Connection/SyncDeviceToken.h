@@ -26,16 +26,26 @@
 #define INCLUDED_SyncDeviceToken_h_GUID_0A738016_90A8_4E81_B5C0_247478D59FD2
 
 // Internal Includes
+#include "AsyncAccessControl.h"
+#include "DeferredSendQueue.h"
 #include <osvr/Connection/DeviceToken.h>
+#include <osvr/Connection/DeviceUpdateSchedulerPtr.h>
 
 // Library/third-party includes
 // - none
 
 // Standard includes
-// - none
+#include <thread>
 
 namespace osvr {
 namespace connection {
+    /// @brief Device token for a device with an update method called once
+    /// per pass of the server mainloop.
+    ///
+    /// The update runs through the connection's DeviceUpdateScheduler. If
+    /// that runs it on a worker thread, messages sent from the update are
+    /// queued for the mainloop to send, and server interface sends wait for
+    /// the mainloop's clearance, as for an async device.
     class SyncDeviceToken : public OSVR_DeviceTokenObject {
       public:
         SyncDeviceToken(std::string const &name);
@@ -48,9 +58,22 @@ namespace connection {
                         size_t len) override;
         util::GuardPtr m_getSendGuard() override;
         void m_connectionInteract() override;
+        void m_stopThreads() override;
 
       private:
+        /// @brief Whether a send from the calling thread must be handed off
+        /// to the mainloop.
+        bool m_needsHandoff() const;
+        /// @brief Sends any messages queued by the update.
+        void m_sendQueued();
         DeviceUpdateCallback m_cb;
+        /// @brief Held so the task's threads outlive it.
+        DeviceUpdateSchedulerPtr m_scheduler;
+        DeviceUpdateTaskPtr m_task;
+        bool m_threaded;
+        std::thread::id m_mainThread;
+        DeferredSendQueue m_queue;
+        AsyncAccessControl m_accessControl;
     };
 } // namespace connection
 } // namespace osvr
@@ -27,12 +27,14 @@
 
 // Internal Includes
 #include "DeviceConstructionData.h"
+#include "DeviceMessageRecorder.h"
 #include <osvr/Connection/AnalogServerInterface.h>
 
 // Library/third-party includes
 #include <vrpn_Analog.h>
 
 // Standard includes
+#include <algorithm>
 #include <cmath>
 
 namespace osvr {
@@ -41,12 +43,17 @@ namespace connection {
       public:
         typedef vrpn_Analog Base;
         VrpnAnalogServer(DeviceConstructionData &init)
-            : Base(init.getQualifiedName().c_str(), init.conn) {
+            : Base(init.getQualifiedName().c_str(), init.conn),
+              m_recording(init.recording) {
             m_setNumChannels(std::min(*init.obj.getAnalogs(),
                                       OSVR_ChannelCount(vrpn_CHANNEL_MAX)));
             // Initialize data
             memset(Base::channel, 0, sizeof(Base::channel));
             memset(Base::last, 0, sizeof(Base::last));
+            m_interest = init.interest;
+            m_ring = init.getReportRing();
+            m_multicast = init.getMulticastStream();
+            memset(m_multicastLast, 0, sizeof(m_multicastLast));
 
             // Report interface out.
             init.obj.returnAnalogInterface(*this);
@@ -81,11 +88,79 @@ namespace connection {
         void m_setNumChannels(OSVR_ChannelCount chans) {
             Base::num_channel = chans;
         }
+        /// @brief Calls f with a report record for each channel that differs
+        /// from the given previously-reported values.
+        template <typename F>
+        void m_forEachChange(const vrpn_float64 previous[],
+                             util::time::TimeValue const &tv, F &&f) {
+            for (OSVR_ChannelCount i = 0; i < m_getNumChannels(); ++i) {
+                if (Base::channel[i] != previous[i]) {
+                    auto report = common::makeSharedMemoryReport(
+                        common::SharedMemoryReportType::Analog,
+                        static_cast<int32_t>(i), tv);
+                    report.data[0] = Base::channel[i];
+                    f(report);
+                }
+            }
+        }
+
         void m_reportChanges(util::time::TimeValue const &tv) {
+            if (m_multicast) {
+                /// Sent once for every LAN client, so regardless of interest:
+                /// compared with what was last multicast, not what VRPN last
+                /// sent.
+                m_forEachChange(m_multicastLast, tv,
+                                [&](common::SharedMemoryReport const &report) {
+                                    m_multicast->send(report);
+                                });
+                std::copy(Base::channel, Base::channel + m_getNumChannels(),
+                          m_multicastLast);
+            }
+            if (m_interest && !m_interest->isWanted()) {
+                return;
+            }
+            if (m_ring) {
+                /// Before report_changes() updates the last-reported values.
+                m_forEachChange(Base::last, tv,
+                                [&](common::SharedMemoryReport const &report) {
+                                    m_ring->put(report);
+                                });
+            }
             struct timeval t;
             util::time::toStructTimeval(t, tv);
+            if (m_recording && m_recording->isRecording()) {
+                m_recordChanges(t);
+            }
             Base::report_changes(CLASS_OF_SERVICE, t);
         }
+
+        /// @brief Records the message report_changes() is about to send, if
+        /// it will send one.
+        void m_recordChanges(struct timeval const &t) {
+            auto changed =
+                !std::equal(Base::channel, Base::channel + m_getNumChannels(),
+                            Base::last);
+            if (!changed) {
+                return;
+            }
+            char msgbuf[(vrpn_CHANNEL_MAX + 1) * sizeof(vrpn_float64)];
+            vrpn_int32 len = Base::encode_to(msgbuf);
+            m_recording->record(Base::channel_m_id, t, msgbuf, len);
+        }
+
+        /// Messages sent go here too, to be recorded.
+        DeviceMessageRecorder *m_recording;
+
+        /// Set if reports no client wants should be skipped.
+        common::ClientInterestFilter::DevicePtr m_interest;
+
+        /// Set if changed channels should also go to local clients through
+        /// shared memory.
+        common::SharedMemoryReportRingPtr m_ring;
+
+        /// Set if changed channels should also go to LAN clients by multicast.
+        common::MulticastReportStreamPtr m_multicast;
+        vrpn_float64 m_multicastLast[vrpn_CHANNEL_MAX];
     };
 
 } // namespace connection
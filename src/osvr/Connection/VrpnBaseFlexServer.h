@@ -27,6 +27,7 @@
 
 // Internal Includes
 #include "DeviceConstructionData.h"
+#include "DeviceMessageRecorder.h"
 #include <osvr/Common/BaseDevice.h>
 #include <osvr/Util/Verbosity.h>
 #include <osvr/Util/TimeValue.h>
@@ -44,7 +45,8 @@ namespace connection {
                                 public common::BaseDevice {
       public:
         vrpn_BaseFlexServer(DeviceConstructionData &init)
-            : vrpn_BaseClass(init.getQualifiedName().c_str(), init.conn) {
+            : vrpn_BaseClass(init.getQualifiedName().c_str(), init.conn),
+              m_recording(init.recording) {
             vrpn_BaseClass::init();
             init.flexServer = this;
             m_setup(vrpn_ConnectionPtr(init.conn),
@@ -68,6 +70,9 @@ namespace connection {
             util::time::toStructTimeval(now, timestamp);
             d_connection->pack_message(len, now, msgID, d_sender_id, bytestream,
                                        vrpn_CONNECTION_LOW_LATENCY);
+            if (m_recording) {
+                m_recording->record(msgID, now, bytestream, len);
+            }
         }
 
       protected:
@@ -75,6 +80,19 @@ namespace connection {
         virtual void m_update() {
             // can be empty since we handle things in mainloop above.
         }
+        /// @brief Records messages from device components.
+        virtual void m_messagePacked(common::RawMessageType const &msgType,
+                                     util::time::TimeValue const &timestamp,
+                                     const char *buf, size_t len) {
+            if (m_recording && m_recording->isRecording()) {
+                struct timeval t;
+                util::time::toStructTimeval(t, timestamp);
+                m_recording->record(msgType.get(), t, buf, len);
+            }
+        }
+
+      private:
+        DeviceMessageRecorder *m_recording;
     };
 } // namespace connection
 } // namespace osvr
@@ -89,8 +89,10 @@ namespace connection {
 
     ConnectionDevicePtr
     VrpnBasedConnection::m_createConnectionDevice(DeviceInitObject &init) {
-        ConnectionDevicePtr ret =
-            make_shared<VrpnConnectionDevice>(init, m_vrpnConnection);
+        ConnectionDevicePtr ret = make_shared<VrpnConnectionDevice>(
+            init, m_vrpnConnection, getInProcessTrackerTransport(),
+            getClientInterestFilter(), getSharedMemoryReportPublisher(),
+            getMulticastReportPublisher());
         return ret;
     }
 
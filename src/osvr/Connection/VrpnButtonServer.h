@@ -27,12 +27,14 @@
 
 // Internal includes
 #include "DeviceConstructionData.h"
+#include "DeviceMessageRecorder.h"
 #include <osvr/Connection/ButtonServerInterface.h>
 
 // Library/third-party includes
 #include <vrpn_Button.h>
 
 // Standard includes
+#include <algorithm>
 #include <cmath>
 
 namespace osvr {
@@ -42,13 +44,18 @@ namespace connection {
       public:
         typedef vrpn_Button_Filter Base;
         VrpnButtonServer(DeviceConstructionData &init)
-            : vrpn_Button_Filter(init.getQualifiedName().c_str(), init.conn) {
+            : vrpn_Button_Filter(init.getQualifiedName().c_str(), init.conn),
+              m_recording(init.recording) {
             m_setNumChannels(
                 std::min(*init.obj.getButtons(),
                          OSVR_ChannelCount(vrpn_BUTTON_MAX_BUTTONS)));
             // Initialize data
             memset(Base::buttons, 0, sizeof(Base::buttons));
             memset(Base::lastbuttons, 0, sizeof(Base::lastbuttons));
+            m_interest = init.interest;
+            m_ring = init.getReportRing();
+            m_multicast = init.getMulticastStream();
+            memset(m_multicastLast, 0, sizeof(m_multicastLast));
 
             // Report interface out.
             init.obj.returnButtonInterface(*this);
@@ -82,10 +89,78 @@ namespace connection {
         void m_setNumChannels(OSVR_ChannelCount chans) {
             Base::num_buttons = chans;
         }
+        /// @brief Calls f with a report record for each channel that differs
+        /// from the given previously-reported states.
+        template <typename F>
+        void m_forEachChange(const unsigned char previous[],
+                             util::time::TimeValue const &tv, F &&f) {
+            for (OSVR_ChannelCount i = 0; i < m_getNumChannels(); ++i) {
+                if (Base::buttons[i] != previous[i]) {
+                    auto report = common::makeSharedMemoryReport(
+                        common::SharedMemoryReportType::Button,
+                        static_cast<int32_t>(i), tv);
+                    report.data[0] = Base::buttons[i];
+                    f(report);
+                }
+            }
+        }
+
         void m_reportChanges(util::time::TimeValue const &tv) {
+            if (m_multicast) {
+                /// Sent once for every LAN client, so regardless of interest:
+                /// compared with what was last multicast, not what VRPN last
+                /// sent.
+                m_forEachChange(m_multicastLast, tv,
+                                [&](common::SharedMemoryReport const &report) {
+                                    m_multicast->send(report);
+                                });
+                std::copy(Base::buttons, Base::buttons + m_getNumChannels(),
+                          m_multicastLast);
+            }
+            if (m_interest && !m_interest->isWanted()) {
+                return;
+            }
+            if (m_ring) {
+                /// Before report_changes() updates the last-reported states.
+                m_forEachChange(Base::lastbuttons, tv,
+                                [&](common::SharedMemoryReport const &report) {
+                                    m_ring->put(report);
+                                });
+            }
             util::time::toStructTimeval(Base::timestamp, tv);
+            if (m_recording && m_recording->isRecording()) {
+                m_recordChanges();
+            }
             Base::report_changes();
         }
+
+        /// @brief Records the change messages report_changes() is about to
+        /// send, one for each button that changed.
+        void m_recordChanges() {
+            char msgbuf[1000];
+            for (OSVR_ChannelCount i = 0; i < m_getNumChannels(); ++i) {
+                if (Base::buttons[i] != Base::lastbuttons[i]) {
+                    vrpn_int32 len = Base::encode_to(
+                        msgbuf, static_cast<vrpn_int32>(i), Base::buttons[i]);
+                    m_recording->record(Base::change_message_id,
+                                        Base::timestamp, msgbuf, len);
+                }
+            }
+        }
+
+        /// Messages sent go here too, to be recorded.
+        DeviceMessageRecorder *m_recording;
+
+        /// Set if reports no client wants should be skipped.
+        common::ClientInterestFilter::DevicePtr m_interest;
+
+        /// Set if changed buttons should also go to local clients through
+        /// shared memory.
+        common::SharedMemoryReportRingPtr m_ring;
+
+        /// Set if changed buttons should also go to LAN clients by multicast.
+        common::MulticastReportStreamPtr m_multicast;
+        unsigned char m_multicastLast[vrpn_BUTTON_MAX_BUTTONS];
     };
 
 } // namespace connection
@@ -28,6 +28,10 @@
 // Internal Includes
 #include <osvr/Connection/ConnectionDevice.h>
 #include <osvr/Connection/DeviceToken.h>
+#include <osvr/Common/ClientInterestFilter.h>
+#include <osvr/Common/InProcessTrackerTransport_fwd.h>
+#include <osvr/Common/SharedMemoryReportPublisher_fwd.h>
+#include <osvr/Common/MulticastReports_fwd.h>
 #include <osvr/Util/UniquePtr.h>
 #include "VrpnBaseFlexServer.h"
 #include "GenerateVrpnDynamicServer.h"
@@ -43,10 +47,23 @@ namespace connection {
     /// @brief ConnectionDevice implementation for a VrpnBasedConnection
     class VrpnConnectionDevice : public ConnectionDevice {
       public:
-        VrpnConnectionDevice(DeviceInitObject &init,
-                             vrpn_ConnectionPtr const &vrpnConn)
-            : ConnectionDevice(init.getQualifiedName()) {
+        VrpnConnectionDevice(
+            DeviceInitObject &init, vrpn_ConnectionPtr const &vrpnConn,
+            common::InProcessTrackerTransportPtr const &trackerTransport,
+            common::ClientInterestFilterPtr const &interestFilter,
+            common::SharedMemoryReportPublisherPtr const &reportPublisher,
+            common::MulticastReportPublisherPtr const &multicastPublisher)
+            : ConnectionDevice(init.getQualifiedName()),
+              m_recording(init.getQualifiedName(), vrpnConn.get()) {
             DeviceConstructionData data(init, vrpnConn.get());
+            data.recording = &m_recording;
+            data.trackerTransport = trackerTransport.get();
+            data.reportPublisher = reportPublisher.get();
+            data.multicastPublisher = multicastPublisher.get();
+            if (interestFilter) {
+                m_interest = interestFilter->getDevice(init.getQualifiedName());
+                data.interest = m_interest;
+            }
             m_server.reset(generateVrpnDynamicServer(data));
             m_baseobj = data.flexServer;
             for (auto const &component : init.getComponents()) {
@@ -62,13 +79,22 @@ namespace connection {
         virtual void m_sendData(util::time::TimeValue const &timestamp,
                                 MessageType *type, const char *bytestream,
                                 size_t len) {
+            if (m_interest && !m_interest->isWanted()) {
+                return;
+            }
             VrpnMessageType *msgtype = static_cast<VrpnMessageType *>(type);
             m_baseobj->sendData(timestamp, msgtype->getID(), bytestream, len);
         }
+        virtual void m_setReportRecorder(ReportRecorderPtr const &recorder) {
+            m_recording.setRecorder(recorder);
+        }
 
       private:
+        /// Declared before the servers, which keep a pointer to it.
+        DeviceMessageRecorder m_recording;
         vrpn_BaseFlexServer *m_baseobj;
         unique_ptr<vrpn_MainloopObject> m_server;
+        common::ClientInterestFilter::DevicePtr m_interest;
     };
 } // namespace connection
 } // namespace osvr
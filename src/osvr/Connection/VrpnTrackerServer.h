@@ -27,6 +27,8 @@
 
 // Internal Includes
 #include "DeviceConstructionData.h"
+#include "DeviceMessageRecorder.h"
+#include <osvr/Common/InProcessTrackerTransport.h>
 #include <osvr/Connection/TrackerServerInterface.h>
 #include <osvr/Util/QuatlibInteropC.h>
 
@@ -35,7 +37,7 @@
 #include <vrpn_Tracker.h>
 
 // Standard includes
-// - none
+#include <algorithm>
 
 namespace osvr {
 namespace connection {
@@ -44,7 +46,8 @@ namespace connection {
       public:
         typedef vrpn_Tracker Base;
         VrpnTrackerServer(DeviceConstructionData &init)
-            : vrpn_Tracker(init.getQualifiedName().c_str(), init.conn) {
+            : vrpn_Tracker(init.getQualifiedName().c_str(), init.conn),
+              m_recording(init.recording) {
             // Initialize data
             m_resetPos();
             m_resetQuat();
@@ -52,6 +55,14 @@ namespace connection {
             m_resetVel();
             m_resetAccel();
 
+            if (init.trackerTransport) {
+                m_direct =
+                    init.trackerTransport->getDevice(init.getQualifiedName());
+            }
+            m_interest = init.interest;
+            m_ring = init.getReportRing();
+            m_multicast = init.getMulticastStream();
+
             // Report interface out.
             init.obj.returnTrackerInterface(*this);
         }
@@ -162,41 +173,172 @@ namespace connection {
             Base::acc_quat_dt = 0;
         }
 
+        /// @brief Kinds of report, combined with the sensor to identify a
+        /// stream for rate limiting.
+        enum ReportKind { POSE_REPORT, VELOCITY_REPORT, ACCEL_REPORT };
+
+        /// @brief Checks with the interest filter, if any, whether to send a
+        /// report.
+        bool m_shouldSend(ReportKind kind, OSVR_ChannelCount sensor,
+                          util::time::TimeValue const &ts) {
+            if (!m_interest) {
+                return true;
+            }
+            return m_interest->shouldSend((uint32_t(kind) << 16) | sensor, ts);
+        }
+
+        /// @brief Makes a report record in the same form as the VRPN
+        /// message.
+        static common::SharedMemoryReport
+        m_makeReport(common::SharedMemoryReportType type,
+                     OSVR_ChannelCount sensor, util::time::TimeValue const &ts,
+                     const vrpn_float64 vec[3], const vrpn_float64 quat[4],
+                     vrpn_float64 dt) {
+            auto report = common::makeSharedMemoryReport(
+                type, static_cast<int32_t>(sensor), ts);
+            std::copy(vec, vec + 3, report.data);
+            std::copy(quat, quat + 4, report.data + 3);
+            report.data[7] = dt;
+            return report;
+        }
+
+        /// @brief Writes a report to the shared memory ring, if any.
+        void m_publish(common::SharedMemoryReportType type,
+                       OSVR_ChannelCount sensor,
+                       util::time::TimeValue const &ts,
+                       const vrpn_float64 vec[3], const vrpn_float64 quat[4],
+                       vrpn_float64 dt = 0) {
+            if (!m_ring) {
+                return;
+            }
+            m_ring->put(m_makeReport(type, sensor, ts, vec, quat, dt));
+        }
+
+        /// @brief Sends a report to the multicast group, if any. Called ahead
+        /// of the interest check: it's sent once for every LAN client, so
+        /// there's nothing to save by skipping it.
+        void m_multicastReport(common::SharedMemoryReportType type,
+                               OSVR_ChannelCount sensor,
+                               util::time::TimeValue const &ts,
+                               const vrpn_float64 vec[3],
+                               const vrpn_float64 quat[4],
+                               vrpn_float64 dt = 0) {
+            if (!m_multicast) {
+                return;
+            }
+            m_multicast->send(m_makeReport(type, sensor, ts, vec, quat, dt));
+        }
+
+        /// @brief Sends an encoded report over VRPN, recording it if the
+        /// connection is recording.
+        void m_pack(vrpn_int32 type, const char *msgbuf, vrpn_int32 len) {
+            d_connection->pack_message(len, Base::timestamp, type,
+                                       Base::d_sender_id, msgbuf,
+                                       CLASS_OF_SERVICE);
+            if (m_recording) {
+                m_recording->record(type, Base::timestamp, msgbuf, len);
+            }
+        }
+
         void m_sendPose(OSVR_ChannelCount sensor,
                         util::time::TimeValue const &ts) {
+            m_multicastReport(common::SharedMemoryReportType::Pose, sensor, ts,
+                              Base::pos, Base::d_quat);
+            if (!m_shouldSend(POSE_REPORT, sensor, ts)) {
+                return;
+            }
 
             Base::d_sensor = sensor;
             util::time::toStructTimeval(Base::timestamp, ts);
+            if (m_direct) {
+                vrpn_TRACKERCB info;
+                info.msg_time = Base::timestamp;
+                info.sensor = sensor;
+                std::copy(Base::pos, Base::pos + 3, info.pos);
+                std::copy(Base::d_quat, Base::d_quat + 4, info.quat);
+                m_direct->send(info);
+                return;
+            }
+            m_publish(common::SharedMemoryReportType::Pose, sensor, ts,
+                      Base::pos, Base::d_quat);
             char msgbuf[1000];
             vrpn_int32 len = Base::encode_to(msgbuf);
-            d_connection->pack_message(len, Base::timestamp,
-                                       Base::position_m_id, Base::d_sender_id,
-                                       msgbuf, CLASS_OF_SERVICE);
+            m_pack(Base::position_m_id, msgbuf, len);
         }
 
         void m_sendVelocity(OSVR_ChannelCount sensor,
                             util::time::TimeValue const &ts) {
+            m_multicastReport(common::SharedMemoryReportType::Velocity, sensor,
+                              ts, Base::vel, Base::vel_quat,
+                              Base::vel_quat_dt);
+            if (!m_shouldSend(VELOCITY_REPORT, sensor, ts)) {
+                return;
+            }
 
             Base::d_sensor = sensor;
             util::time::toStructTimeval(Base::timestamp, ts);
+            if (m_direct) {
+                vrpn_TRACKERVELCB info;
+                info.msg_time = Base::timestamp;
+                info.sensor = sensor;
+                std::copy(Base::vel, Base::vel + 3, info.vel);
+                std::copy(Base::vel_quat, Base::vel_quat + 4, info.vel_quat);
+                info.vel_quat_dt = Base::vel_quat_dt;
+                m_direct->send(info);
+                return;
+            }
+            m_publish(common::SharedMemoryReportType::Velocity, sensor, ts,
+                      Base::vel, Base::vel_quat, Base::vel_quat_dt);
             char msgbuf[1000];
             vrpn_int32 len = Base::encode_vel_to(msgbuf);
-            d_connection->pack_message(len, Base::timestamp,
-                                       Base::velocity_m_id, Base::d_sender_id,
-                                       msgbuf, CLASS_OF_SERVICE);
+            m_pack(Base::velocity_m_id, msgbuf, len);
         }
 
         void m_sendAccel(OSVR_ChannelCount sensor,
                          util::time::TimeValue const &ts) {
+            m_multicastReport(common::SharedMemoryReportType::Acceleration,
+                              sensor, ts, Base::acc, Base::acc_quat,
+                              Base::acc_quat_dt);
+            if (!m_shouldSend(ACCEL_REPORT, sensor, ts)) {
+                return;
+            }
 
             Base::d_sensor = sensor;
             util::time::toStructTimeval(Base::timestamp, ts);
+            if (m_direct) {
+                vrpn_TRACKERACCCB info;
+                info.msg_time = Base::timestamp;
+                info.sensor = sensor;
+                std::copy(Base::acc, Base::acc + 3, info.acc);
+                std::copy(Base::acc_quat, Base::acc_quat + 4, info.acc_quat);
+                info.acc_quat_dt = Base::acc_quat_dt;
+                m_direct->send(info);
+                return;
+            }
+            m_publish(common::SharedMemoryReportType::Acceleration, sensor, ts,
+                      Base::acc, Base::acc_quat, Base::acc_quat_dt);
             char msgbuf[1000];
             vrpn_int32 len = Base::encode_acc_to(msgbuf);
-            d_connection->pack_message(len, Base::timestamp, Base::accel_m_id,
-                                       Base::d_sender_id, msgbuf,
-                                       CLASS_OF_SERVICE);
+            m_pack(Base::accel_m_id, msgbuf, len);
         }
+
+        /// Reports sent over VRPN go here too, to be recorded.
+        DeviceMessageRecorder *m_recording;
+
+        /// Set if reports should bypass VRPN and be queued for in-process
+        /// handlers instead: these aren't recorded, since they never leave as
+        /// messages.
+        common::InProcessTrackerTransport::DevicePtr m_direct;
+
+        /// Set if reports no client wants should be skipped.
+        common::ClientInterestFilter::DevicePtr m_interest;
+
+        /// Set if reports should also go to local clients through shared
+        /// memory.
+        common::SharedMemoryReportRingPtr m_ring;
+
+        /// Set if reports should also go to LAN clients by multicast.
+        common::MulticastReportStreamPtr m_multicast;
     };
 
 } // namespace connection
@@ -27,6 +27,7 @@
 #include <osvr/Common/ClientInterface.h>
 #include <osvr/Common/CreateDevice.h>
 #include <osvr/Common/DeduplicatingFunctionWrapper.h>
+#include <osvr/Common/InProcessTrackerTransport.h>
 #include <osvr/Common/PathElementTools.h>
 #include <osvr/Common/PathElementTypes.h>
 #include <osvr/Common/PathTreeFull.h>
@@ -67,6 +68,15 @@ namespace client {
         m_vrpnConns.addConnection(m_mainConn, HOST);
         BOOST_ASSERT(!m_vrpnConns.empty());
 
+        /// Nobody outside this process can reach the loopback connection, so
+        /// tracker reports can skip VRPN entirely: the devices' tracker servers
+        /// queue them for our tracker handlers, which get them in m_update()
+        /// as they would from the connection.
+        auto trackerTransport =
+            make_shared<common::InProcessTrackerTransport>();
+        std::get<1>(conn)->setInProcessTrackerTransport(trackerTransport);
+        m_vrpnConns.setInProcessTrackerTransport(HOST, trackerTransport);
+
         /// Get the OSVR connection out and use it to make a server.
         m_server = server::Server::createNonListening(std::get<1>(conn));
 
@@ -74,7 +84,8 @@ namespace client {
             std::string(common::SystemComponent::deviceName()) + "@" + HOST;
 
         /// Create the system client device.
-        m_systemDevice = common::createClientDevice(sysDeviceName, m_mainConn);
+        m_systemDevice = common::createSharedConnectionClientDevice(
+            sysDeviceName, m_mainConn);
         m_systemComponent =
             m_systemDevice->addComponent(common::SystemComponent::create());
         typedef common::DeduplicatingFunctionWrapper<Json::Value const &>
@@ -0,0 +1,293 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "ConfigReload.h"
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <set>
+
+namespace osvr {
+namespace server {
+
+    static const char SERVER_KEY[] = "server";
+    static const char PLUGINS_KEY[] = "plugins";
+    static const char DRIVERS_KEY[] = "drivers";
+    static const char DRIVER_KEY[] = "driver";
+    static const char PLUGIN_KEY[] = "plugin";
+    static const char ROUTES_KEY[] = "routes";
+    static const char DESTINATION_KEY[] = "destination";
+    static const char ALIASES_KEY[] = "aliases";
+    static const char EXTERNALDEVICES_KEY[] = "externalDevices";
+    static const char DISPLAY_KEY[] = "display";
+    static const char RENDERMANAGER_KEY[] = "renderManagerConfig";
+
+    namespace {
+        inline bool containsValue(Json::Value const &list,
+                                  Json::Value const &value) {
+            for (auto const &elt : list) {
+                if (elt == value) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        inline std::string describeValue(Json::Value const &value) {
+            return value.isString() ? value.asString()
+                                    : value.toStyledString();
+        }
+
+        inline std::string describeDriver(Json::Value const &driver) {
+            return driver[PLUGIN_KEY].asString() + "/" +
+                   driver[DRIVER_KEY].asString();
+        }
+
+        /// @brief Puts the members of an object that are new or changed into
+        /// the delta, and returns the names of those removed.
+        inline std::vector<std::string> diffObjects(Json::Value const &oldObj,
+                                                    Json::Value const &newObj,
+                                                    Json::Value &delta) {
+            std::vector<std::string> removed;
+            for (auto const &name : newObj.getMemberNames()) {
+                if (!oldObj.isMember(name) || oldObj[name] != newObj[name]) {
+                    delta[name] = newObj[name];
+                }
+            }
+            for (auto const &name : oldObj.getMemberNames()) {
+                if (!newObj.isMember(name)) {
+                    removed.push_back(name);
+                }
+            }
+            return removed;
+        }
+
+        /// @brief Copies the members of the delta object over those of the
+        /// target, which must be an object or null.
+        inline void mergeObject(Json::Value const &delta,
+                                Json::Value &target) {
+            for (auto const &name : delta.getMemberNames()) {
+                target[name] = delta[name];
+            }
+        }
+
+        /// @brief Appends those entries of the delta whose names are found in
+        /// the list of successes, each success used only once.
+        template <typename F>
+        inline void appendSucceeded(Json::Value const &delta,
+                                    ConfigReload::SuccessList const &successes,
+                                    F &&describe, Json::Value &target) {
+            std::multiset<std::string> remaining(begin(successes),
+                                                 end(successes));
+            for (auto const &entry : delta) {
+                auto it = remaining.find(describe(entry));
+                if (it != end(remaining)) {
+                    remaining.erase(it);
+                    target.append(entry);
+                }
+            }
+        }
+    } // namespace
+
+    ConfigReload::ConfigReload(Json::Value const &oldRoot,
+                               Json::Value const &newRoot)
+        : m_old(oldRoot), m_new(newRoot), m_delta(Json::objectValue) {
+
+        if (oldRoot[SERVER_KEY] != newRoot[SERVER_KEY]) {
+            m_restartRequiredFor(SERVER_KEY,
+                                 "Server settings only take effect on startup");
+        }
+
+        Json::Value const &oldPlugins = oldRoot[PLUGINS_KEY];
+        Json::Value const &newPlugins = newRoot[PLUGINS_KEY];
+        for (auto const &plugin : newPlugins) {
+            if (!containsValue(oldPlugins, plugin)) {
+                m_delta[PLUGINS_KEY].append(plugin);
+            }
+        }
+        for (auto const &plugin : oldPlugins) {
+            if (!containsValue(newPlugins, plugin)) {
+                m_restartRequiredFor(describeValue(plugin),
+                                     "Plugins can't be unloaded");
+            }
+        }
+
+        /// A changed driver entry looks like one removed and one added: since
+        /// the old instance can't be removed, don't add another that may well
+        /// conflict with it.
+        Json::Value const &oldDrivers = oldRoot[DRIVERS_KEY];
+        Json::Value const &newDrivers = newRoot[DRIVERS_KEY];
+        std::set<std::string> removedDrivers;
+        for (auto const &driver : oldDrivers) {
+            if (!containsValue(newDrivers, driver)) {
+                removedDrivers.insert(describeDriver(driver));
+            }
+        }
+        for (auto const &driver : removedDrivers) {
+            m_restartRequiredFor(driver, "Driver instances can't be removed "
+                                         "or changed, only added");
+        }
+        for (auto const &driver : newDrivers) {
+            if (!containsValue(oldDrivers, driver) &&
+                removedDrivers.count(describeDriver(driver)) == 0) {
+                m_delta[DRIVERS_KEY].append(driver);
+            }
+        }
+
+        /// A route replaces any other to the same destination, so only those
+        /// routes left with no destination at all are a problem.
+        Json::Value const &oldRoutes = oldRoot[ROUTES_KEY];
+        Json::Value const &newRoutes = newRoot[ROUTES_KEY];
+        std::set<std::string> destinations;
+        for (auto const &route : newRoutes) {
+            destinations.insert(route[DESTINATION_KEY].asString());
+            if (!containsValue(oldRoutes, route)) {
+                m_delta[ROUTES_KEY].append(route);
+            }
+        }
+        for (auto const &route : oldRoutes) {
+            auto destination = route[DESTINATION_KEY].asString();
+            if (destinations.count(destination) == 0) {
+                m_restartRequiredFor(destination, "Routes can't be removed");
+            }
+        }
+
+        Json::Value const &oldAliases = oldRoot[ALIASES_KEY];
+        Json::Value const &newAliases = newRoot[ALIASES_KEY];
+        if (oldAliases.isObject() && newAliases.isObject()) {
+            Json::Value aliases(Json::objectValue);
+            for (auto const &name :
+                 diffObjects(oldAliases, newAliases, aliases)) {
+                m_restartRequiredFor(name, "Aliases can't be removed");
+            }
+            if (!aliases.empty()) {
+                m_delta[ALIASES_KEY] = aliases;
+            }
+        } else if (oldAliases != newAliases) {
+            /// Some other form: re-adding the unchanged ones does no harm.
+            if (!oldAliases.isNull()) {
+                m_restartRequiredFor(ALIASES_KEY, "Aliases can't be removed");
+            }
+            if (!newAliases.isNull()) {
+                m_delta[ALIASES_KEY] = newAliases;
+            }
+        }
+
+        Json::Value const &oldDevices = oldRoot[EXTERNALDEVICES_KEY];
+        Json::Value const &newDevices = newRoot[EXTERNALDEVICES_KEY];
+        Json::Value devices(Json::objectValue);
+        for (auto const &path :
+             diffObjects(oldDevices.isObject() ? oldDevices : Json::Value(),
+                         newDevices.isObject() ? newDevices : Json::Value(),
+                         devices)) {
+            m_restartRequiredFor(path, "External devices can't be removed");
+        }
+        if (!devices.empty()) {
+            m_delta[EXTERNALDEVICES_KEY] = devices;
+        }
+
+        for (auto key : {DISPLAY_KEY, RENDERMANAGER_KEY}) {
+            if (oldRoot[key] == newRoot[key]) {
+                continue;
+            }
+            if (newRoot[key].isNull()) {
+                m_restartRequiredFor(key, "Can't be removed, only replaced");
+            } else {
+                m_delta[key] = newRoot[key];
+            }
+        }
+    }
+
+    Json::Value
+    ConfigReload::getApplied(SuccessList const &loadedPlugins,
+                             SuccessList const &instantiatedDrivers) const {
+        /// Anything not mentioned below (e.g. the `server` section) stays as
+        /// it was.
+        Json::Value applied = m_old;
+
+        /// Removed plugins stay loaded and removed or changed driver entries
+        /// stay instantiated, so keep the old ones.
+        if (m_delta.isMember(PLUGINS_KEY)) {
+            appendSucceeded(m_delta[PLUGINS_KEY], loadedPlugins,
+                            &describeValue, applied[PLUGINS_KEY]);
+        }
+        if (m_delta.isMember(DRIVERS_KEY)) {
+            appendSucceeded(m_delta[DRIVERS_KEY], instantiatedDrivers,
+                            &describeDriver, applied[DRIVERS_KEY]);
+        }
+
+        /// The new routes, plus the old ones to destinations no new route
+        /// replaced.
+        Json::Value const &newRoutes = m_new[ROUTES_KEY];
+        Json::Value const &oldRoutes = m_old[ROUTES_KEY];
+        if (!newRoutes.isNull() || !oldRoutes.isNull()) {
+            Json::Value routes(Json::arrayValue);
+            std::set<std::string> destinations;
+            for (auto const &route : newRoutes) {
+                destinations.insert(route[DESTINATION_KEY].asString());
+                routes.append(route);
+            }
+            for (auto const &route : oldRoutes) {
+                if (destinations.count(route[DESTINATION_KEY].asString()) ==
+                    0) {
+                    routes.append(route);
+                }
+            }
+            applied[ROUTES_KEY] = routes;
+        }
+
+        Json::Value const &aliases = m_delta[ALIASES_KEY];
+        if (aliases.isObject() && applied[ALIASES_KEY].isObject()) {
+            mergeObject(aliases, applied[ALIASES_KEY]);
+        } else if (!aliases.isNull()) {
+            applied[ALIASES_KEY] = aliases;
+        }
+
+        Json::Value const &devices = m_delta[EXTERNALDEVICES_KEY];
+        if (!devices.isNull()) {
+            if (!applied[EXTERNALDEVICES_KEY].isObject()) {
+                applied[EXTERNALDEVICES_KEY] = Json::Value(Json::objectValue);
+            }
+            mergeObject(devices, applied[EXTERNALDEVICES_KEY]);
+        }
+
+        for (auto key : {DISPLAY_KEY, RENDERMANAGER_KEY}) {
+            if (m_delta.isMember(key)) {
+                applied[key] = m_delta[key];
+            }
+        }
+        return applied;
+    }
+
+    void ConfigReload::m_restartRequiredFor(std::string const &what,
+                                            std::string const &why) {
+        m_restartRequired.push_back(std::make_pair(what, why));
+    }
+
+} // namespace server
+} // namespace osvr
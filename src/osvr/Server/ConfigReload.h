@@ -0,0 +1,86 @@
+/** @file
+    @brief Header
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//        http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INCLUDED_ConfigReload_h_GUID_5B80EF64_3418_48FF_8B69_004A24C4A78D
+#define INCLUDED_ConfigReload_h_GUID_5B80EF64_3418_48FF_8B69_004A24C4A78D
+
+// Internal Includes
+// - none
+
+// Library/third-party includes
+#include <json/value.h>
+
+// Standard includes
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace osvr {
+namespace server {
+    /// @brief The differences between the configuration in effect and a new
+    /// one, as used by ConfigureServer::reloadConfig().
+    class ConfigReload {
+      public:
+        /// @brief Container for plugin/driver names
+        typedef std::vector<std::string> SuccessList;
+        /// @brief `.first` is what changed, `.second` why it can't be applied
+        typedef std::pair<std::string, std::string> ErrorPair;
+        typedef std::vector<ErrorPair> ErrorList;
+
+        /// @brief Compares the configurations, both as written.
+        ConfigReload(Json::Value const &oldRoot, Json::Value const &newRoot);
+
+        /// @brief Gets a configuration of just what to add or replace, to run
+        /// through the usual configuration steps.
+        Json::Value const &getDelta() const { return m_delta; }
+
+        /// @brief Gets the changes that only a restart can apply.
+        ErrorList const &getRestartRequired() const {
+            return m_restartRequired;
+        }
+
+        /// @brief Gets the configuration in effect once the delta has been
+        /// run through: the old one, with whatever of the new one was applied.
+        ///
+        /// Entries that couldn't be applied are kept as they were, or left
+        /// out if new, so the next reload reports or retries them again.
+        ///
+        /// @param loadedPlugins Plugins from the delta that loaded.
+        /// @param instantiatedDrivers `plugin/driver` names of the driver
+        /// entries from the delta that were instantiated.
+        Json::Value getApplied(SuccessList const &loadedPlugins,
+                               SuccessList const &instantiatedDrivers) const;
+
+      private:
+        void m_restartRequiredFor(std::string const &what,
+                                  std::string const &why);
+        Json::Value m_old;
+        Json::Value m_new;
+        Json::Value m_delta;
+        ErrorList m_restartRequired;
+    };
+} // namespace server
+} // namespace osvr
+
+#endif // INCLUDED_ConfigReload_h_GUID_5B80EF64_3418_48FF_8B69_004A24C4A78D
@@ -26,8 +26,10 @@
 #include <osvr/Server/ConfigureServer.h>
 #include <osvr/Server/Server.h>
 #include <osvr/Connection/Connection.h>
+#include <osvr/Common/MulticastReports.h>
 #include <osvr/PluginHost/SearchPath.h>
 #include <osvr/Util/Verbosity.h>
+#include "ConfigReload.h"
 #include "JSONResolvePossibleRef.h"
 
 // Library/third-party includes
@@ -39,6 +41,7 @@
 #include <boost/algorithm/string/predicate.hpp> // for iends_with()
 
 // Standard includes
+#include <algorithm>
 #include <stdexcept>
 #include <iostream>
 #include <vector>
@@ -104,6 +107,14 @@ namespace server {
     static const char LOCAL_KEY[] = "local";
     static const char PORT_KEY[] = "port"; // not the triwizard cup.
     static const char SLEEP_KEY[] = "sleep";
+    static const char INTEREST_FILTERING_KEY[] = "clientInterestFiltering";
+    static const char SHARED_MEMORY_REPORTS_KEY[] = "sharedMemoryReports";
+    static const char DEVICE_UPDATE_THREADS_KEY[] = "deviceUpdateThreads";
+    static const char PER_DEVICE_VALUE[] = "perDevice";
+    static const char MULTICAST_REPORTS_KEY[] = "multicastReports";
+    static const char MULTICAST_GROUP_KEY[] = "group";
+    static const char MULTICAST_TTL_KEY[] = "ttl";
+    static const char RECORD_REPORTS_KEY[] = "recordReports";
 
     ServerPtr ConfigureServer::constructServer() {
         Json::Value const &root(m_data->root);
@@ -115,6 +126,14 @@ namespace server {
 #else
         int sleepTime = 1000; // microseconds
 #endif
+        bool interestFiltering = false;
+        bool sharedMemoryReports = false;
+        int deviceUpdateThreads = 0;
+        std::string multicastGroup;
+        int multicastPort = 0;
+        int multicastTtl = 1;
+        std::string multicastIface;
+        std::string recordReports;
 
         /// Extract data from the JSON structure.
         if (root.isMember(SERVER_KEY)) {
@@ -146,6 +165,50 @@ namespace server {
                 // Convert to microseconds for internal use.
                 sleepTime = static_cast<int>(jsonSleepTime.asDouble() * 1000.0);
             }
+
+            Json::Value jsonInterestFiltering =
+                jsonServer[INTEREST_FILTERING_KEY];
+            if (jsonInterestFiltering.isBool()) {
+                interestFiltering = jsonInterestFiltering.asBool();
+            }
+
+            Json::Value jsonSharedMemoryReports =
+                jsonServer[SHARED_MEMORY_REPORTS_KEY];
+            if (jsonSharedMemoryReports.isBool()) {
+                sharedMemoryReports = jsonSharedMemoryReports.asBool();
+            }
+
+            Json::Value jsonDeviceUpdateThreads =
+                jsonServer[DEVICE_UPDATE_THREADS_KEY];
+            if (jsonDeviceUpdateThreads.isString() &&
+                jsonDeviceUpdateThreads.asString() == PER_DEVICE_VALUE) {
+                deviceUpdateThreads = Server::DEVICE_UPDATE_THREAD_PER_DEVICE;
+            } else if (jsonDeviceUpdateThreads.isInt()) {
+                deviceUpdateThreads =
+                    (std::max)(jsonDeviceUpdateThreads.asInt(), 0);
+            }
+
+            /// Either true, for the defaults, or an object with any of
+            /// "group", "port", "ttl", and "interface".
+            Json::Value jsonMulticast = jsonServer[MULTICAST_REPORTS_KEY];
+            auto defaultGroup = common::MulticastReportPublisher::DEFAULT_GROUP;
+            if (jsonMulticast.isBool() && jsonMulticast.asBool()) {
+                multicastGroup = defaultGroup;
+            } else if (jsonMulticast.isObject()) {
+                multicastGroup =
+                    jsonMulticast.get(MULTICAST_GROUP_KEY, defaultGroup)
+                        .asString();
+                multicastPort = jsonMulticast.get(PORT_KEY, 0).asInt();
+                multicastTtl = jsonMulticast.get(MULTICAST_TTL_KEY, 1).asInt();
+                multicastIface =
+                    jsonMulticast.get(INTERFACE_KEY, "").asString();
+            }
+
+            /// Filename to record device messages to, for later replay.
+            Json::Value jsonRecordReports = jsonServer[RECORD_REPORTS_KEY];
+            if (jsonRecordReports.isString()) {
+                recordReports = jsonRecordReports.asString();
+            }
         }
 
         /// Construct a server, or a connection then a server, based on the
@@ -166,6 +229,27 @@ namespace server {
             m_server->setSleepTime(sleepTime);
         }
 
+        if (interestFiltering) {
+            m_server->setClientInterestFiltering(true);
+        }
+
+        if (sharedMemoryReports) {
+            m_server->setSharedMemoryReports(true);
+        }
+
+        if (!multicastGroup.empty()) {
+            m_server->setMulticastReports(multicastGroup, multicastPort,
+                                          multicastTtl, multicastIface);
+        }
+
+        if (deviceUpdateThreads != 0) {
+            m_server->setDeviceUpdateThreads(deviceUpdateThreads);
+        }
+
+        if (!recordReports.empty()) {
+            m_server->setReportRecording(recordReports);
+        }
+
         m_server->setHardwareDetectOnConnection();
 
         return m_server;
@@ -401,5 +485,52 @@ namespace server {
 
     void ConfigureServer::loadAutoPlugins() { m_server->loadAutoPlugins(); }
 
+    void ConfigureServer::setServer(ServerPtr const &server) {
+        m_server = server;
+    }
+
+    bool ConfigureServer::reloadConfig(std::string const &json) {
+        unique_ptr<ConfigureServerData> newData(new ConfigureServerData());
+        newData->parse(json);
+        return m_reload(std::move(newData));
+    }
+
+    bool ConfigureServer::reloadConfig(std::istream &json) {
+        unique_ptr<ConfigureServerData> newData(new ConfigureServerData());
+        newData->parse(json);
+        return m_reload(std::move(newData));
+    }
+
+    ConfigureServer::ErrorList const &
+    ConfigureServer::getRestartRequired() const {
+        return m_restartRequired;
+    }
+
+    bool ConfigureServer::m_reload(unique_ptr<ConfigureServerData> newData) {
+        m_successfulPlugins.clear();
+        m_failedPlugins.clear();
+        m_successfulInstances.clear();
+        m_failedInstances.clear();
+
+        ConfigReload reload(m_data->root, newData->root);
+        m_restartRequired = reload.getRestartRequired();
+
+        /// Apply the delta, then make current only what of the new
+        /// configuration took effect.
+        m_data->root = reload.getDelta();
+        loadPlugins();
+        instantiateDrivers();
+        processExternalDevices();
+        processRoutes();
+        processAliases();
+        processDisplay();
+        processRenderManagerParameters();
+        m_data->root =
+            reload.getApplied(m_successfulPlugins, m_successfulInstances);
+
+        return m_failedPlugins.empty() && m_failedInstances.empty() &&
+               m_restartRequired.empty();
+    }
+
 } // namespace server
 } // namespace osvr
@@ -30,11 +30,14 @@
 #include <osvr/Util/PlatformConfig.h>
 #include <osvr/Util/Logger.h>
 #include <osvr/Util/LogNames.h>
+#include <osvr/Util/TimeValue.h>
 
 // Library/third-party includes
-// - none
+#include <boost/filesystem.hpp>
+#include <boost/noncopyable.hpp>
 
 // Standard includes
+#include <ctime>
 #include <exception>
 #include <fstream>
 #include <iostream>
@@ -44,6 +47,39 @@
 namespace osvr {
 namespace server {
 
+    inline void logPluginResults(::osvr::util::log::LoggerPtr log,
+                                 ConfigureServer const &srvConfig) {
+        if (!srvConfig.getSuccessfulPlugins().empty()) {
+            log->info() << "Successfully loaded the following plugins:";
+            for (auto const &plugin : srvConfig.getSuccessfulPlugins()) {
+                log->info() << " - " << plugin;
+            }
+        }
+        if (!srvConfig.getFailedPlugins().empty()) {
+            log->warn() << "Failed to load the following plugins:";
+            for (auto const &pluginError : srvConfig.getFailedPlugins()) {
+                log->warn() << " - " << pluginError.first << "\t"
+                            << pluginError.second;
+            }
+        }
+    }
+
+    inline void logDriverResults(::osvr::util::log::LoggerPtr log,
+                                 ConfigureServer const &srvConfig) {
+        if (!srvConfig.getSuccessfulInstantiations().empty()) {
+            log->info() << "Successes:";
+            for (auto const &driver : srvConfig.getSuccessfulInstantiations()) {
+                log->info() << " - " << driver;
+            }
+        }
+        if (!srvConfig.getFailedInstantiations().empty()) {
+            log->error() << "Errors:";
+            for (auto const &error : srvConfig.getFailedInstantiations()) {
+                log->error() << " - " << error.first << "\t" << error.second;
+            }
+        }
+    }
+
     ServerPtr configureServerFromString(std::string const &json) {
         auto log =
             ::osvr::util::log::make_logger(::osvr::util::log::OSVR_SERVER_LOG);
@@ -70,38 +106,13 @@ namespace server {
         {
             log->info() << "Loading plugins...";
             srvConfig.loadPlugins();
-            if (!srvConfig.getSuccessfulPlugins().empty()) {
-                log->info() << "Successfully loaded the following plugins:";
-                for (auto const &plugin : srvConfig.getSuccessfulPlugins()) {
-                    log->info() << " - " << plugin;
-                }
-            }
-            if (!srvConfig.getFailedPlugins().empty()) {
-                log->warn() << "Failed to load the following plugins:";
-                for (auto const &pluginError : srvConfig.getFailedPlugins()) {
-                    log->warn() << " - " << pluginError.first << "\t"
-                                << pluginError.second;
-                }
-            }
+            logPluginResults(log, srvConfig);
         }
 
         {
             log->info() << "Instantiating configured drivers...";
-            bool success = srvConfig.instantiateDrivers();
-            if (!srvConfig.getSuccessfulInstantiations().empty()) {
-                log->info() << "Successes:";
-                for (auto const &driver :
-                     srvConfig.getSuccessfulInstantiations()) {
-                    log->info() << " - " << driver;
-                }
-            }
-            if (!srvConfig.getFailedInstantiations().empty()) {
-                log->error() << "Errors:";
-                for (auto const &error : srvConfig.getFailedInstantiations()) {
-                    log->error()
-                        << " - " << error.first << "\t" << error.second;
-                }
-            }
+            srvConfig.instantiateDrivers();
+            logDriverResults(log, srvConfig);
         }
 
         if (srvConfig.processExternalDevices()) {
@@ -144,9 +155,99 @@ namespace server {
         }
     }
 
+    /// @brief Seconds between checks for a changed config file.
+    static const double CONFIG_FILE_CHECK_INTERVAL = 1.;
+
+    /// @brief Checks now and then, from the server mainloop, whether the
+    /// config file has changed, and if so, applies the changes to the server.
+    class ConfigFileWatcher : boost::noncopyable {
+      public:
+        ConfigFileWatcher(Server &server, std::string const &path,
+                          std::string const &json,
+                          ::osvr::util::log::LoggerPtr log)
+            : m_server(server), m_path(path), m_json(json), m_log(log),
+              m_lastWrite(m_getLastWrite()),
+              m_lastCheck(util::time::getNow()) {
+            /// Non-owning: the server owns us, by way of the mainloop method.
+            m_config.setServer(ServerPtr(&m_server, [](Server *) {}));
+            m_config.loadConfig(json);
+        }
+
+        void operator()() {
+            auto now = util::time::getNow();
+            if (util::time::duration(now, m_lastCheck) <
+                CONFIG_FILE_CHECK_INTERVAL) {
+                return;
+            }
+            m_lastCheck = now;
+            auto lastWrite = m_getLastWrite();
+            if (lastWrite == m_lastWrite) {
+                return;
+            }
+            m_lastWrite = lastWrite;
+
+            std::ifstream config(m_path);
+            if (!config.good()) {
+                return;
+            }
+            std::stringstream sstr;
+            sstr << config.rdbuf();
+            auto json = sstr.str();
+            if (json == m_json) {
+                return;
+            }
+
+            m_log->info() << "Config file '" << m_path
+                          << "' changed, reloading...";
+            bool success;
+            try {
+                success = m_config.reloadConfig(json);
+            } catch (std::exception &e) {
+                m_log->error() << "Could not reload config file: " << e.what();
+                /// Perhaps caught part-way through being saved: check again
+                /// next time even if the modification time doesn't change.
+                m_lastWrite = 0;
+                return;
+            }
+            m_json = json;
+            logPluginResults(m_log, m_config);
+            logDriverResults(m_log, m_config);
+            if (!m_config.getRestartRequired().empty()) {
+                m_log->warn() << "These changes will only take effect when "
+                                 "the server is restarted:";
+                for (auto const &change : m_config.getRestartRequired()) {
+                    m_log->warn()
+                        << " - " << change.first << "\t" << change.second;
+                }
+            }
+            if (!m_config.getSuccessfulPlugins().empty()) {
+                /// Newly loaded plugins may well be waiting for it.
+                m_log->info() << "Triggering automatic hardware detection...";
+                m_server.triggerHardwareDetect();
+            }
+            m_log->info() << (success ? "Config file reloaded."
+                                      : "Config file partially reloaded.");
+        }
+
+      private:
+        std::time_t m_getLastWrite() const {
+            boost::system::error_code ec;
+            auto ret = boost::filesystem::last_write_time(m_path, ec);
+            return ec ? 0 : ret;
+        }
+        Server &m_server;
+        std::string const m_path;
+        std::string m_json;
+        ::osvr::util::log::LoggerPtr m_log;
+        ConfigureServer m_config;
+        std::time_t m_lastWrite;
+        util::time::TimeValue m_lastCheck;
+    };
+
     inline ServerPtr
     internalConfigureServerFromFile(std::string const &configName,
-                                    ::osvr::util::log::LoggerPtr log) {
+                                    ::osvr::util::log::LoggerPtr log,
+                                    bool watch = false) {
         for (auto const &candidateConfigFilePath :
              getCandidateConfigFilePaths(configName)) {
             log->trace() << "Trying path '" << candidateConfigFilePath << "'";
@@ -159,7 +260,16 @@ namespace server {
 
             std::stringstream sstr;
             sstr << config.rdbuf();
-            return configureServerFromString(sstr.str());
+            auto json = sstr.str();
+            auto ret = configureServerFromString(json);
+            if (ret && watch) {
+                log->info() << "Watching config file '"
+                            << candidateConfigFilePath << "' for changes.";
+                auto watcher = make_shared<ConfigFileWatcher>(
+                    *ret, candidateConfigFilePath, json, log);
+                ret->registerMainloopMethod([watcher] { (*watcher)(); });
+            }
+            return ret;
         }
         return nullptr;
     }
@@ -193,5 +303,20 @@ namespace server {
         return nullptr;
     }
 
+    ServerPtr configureServerFromFirstFileInListAndWatch(
+        std::vector<std::string> const &configNames) {
+        auto log =
+            ::osvr::util::log::make_logger(::osvr::util::log::OSVR_SERVER_LOG);
+        debugDumpSearchPath(log);
+        for (const auto &name : configNames) {
+            auto ret = internalConfigureServerFromFile(name, log, true);
+            if (ret) {
+                return ret;
+            }
+        }
+        log->error() << "Could not find a valid config file!";
+        return nullptr;
+    }
+
 } // namespace server
 } // namespace osvr
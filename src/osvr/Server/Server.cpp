@@ -132,6 +132,32 @@ namespace server {
     void Server::setSleepTime(int microseconds) {
         m_impl->setSleepTime(microseconds);
     }
+
+    void Server::setClientInterestFiltering(bool enabled) {
+        m_impl->setClientInterestFiltering(enabled);
+    }
+
+    void Server::setSharedMemoryReports(bool enabled) {
+        m_impl->setSharedMemoryReports(enabled);
+    }
+
+    void Server::setMulticastReports(std::string const &group, int port,
+                                     int ttl, std::string const &iface) {
+        m_impl->setMulticastReports(group, port, ttl, iface);
+    }
+
+    void Server::setDeviceUpdateThreads(int threads) {
+        m_impl->setDeviceUpdateThreads(threads);
+    }
+
+    std::vector<connection::DeviceUpdateStats>
+    Server::getDeviceUpdateStats() const {
+        return m_impl->getDeviceUpdateStats();
+    }
+
+    void Server::setReportRecording(std::string const &filename) {
+        m_impl->setReportRecording(filename);
+    }
 #if 0
     int Server::getSleepTime() const { return m_impl->getSleepTime(); }
 #endif
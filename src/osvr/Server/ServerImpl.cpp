@@ -26,14 +26,20 @@
 #include "ServerImpl.h"
 #include "../Connection/VrpnConnectionKind.h" /// @todo warning - cross-library internal header!
 #include <osvr/Common/AliasProcessor.h>
+#include <osvr/Common/ClientInterestFilter.h>
+#include <osvr/Common/ClockSync.h>
 #include <osvr/Common/CommonComponent.h>
 #include <osvr/Common/PathTreeFull.h>
+#include <osvr/Common/SharedMemoryReportPublisher.h>
+#include <osvr/Common/MulticastReports.h>
 #include <osvr/Common/ProcessDeviceDescriptor.h>
 #include <osvr/Common/SystemComponent.h>
 #include <osvr/Common/Tracing.h>
 #include <osvr/Connection/Connection.h>
 #include <osvr/Connection/ConnectionDevice.h>
+#include <osvr/Connection/DeviceUpdateScheduler.h>
 #include <osvr/Connection/MessageType.h>
+#include <osvr/Connection/ReportRecording.h>
 #include <osvr/PluginHost/RegistrationContext.h>
 #include <osvr/Util/LogNames.h>
 #include <osvr/Util/Logger.h>
@@ -95,6 +101,26 @@ namespace server {
         m_systemComponent->registerClientRouteUpdateHandler(
             &ServerImpl::m_handleUpdatedRoute, this);
 
+        // Devices created from here on consult the filter before sending, and
+        // clients tell it what they want.
+        m_interestFilter = make_shared<common::ClientInterestFilter>();
+        m_conn->setClientInterestFilter(m_interestFilter);
+        m_systemComponent->registerClientInterestHandler(
+            [&](std::string const &clientId,
+                common::ClientInterestFilter::Interest const &interest,
+                util::time::TimeValue const &) {
+                /// Using our own clock, since the client's may differ.
+                m_interestFilter->setClientInterest(clientId, interest,
+                                                    util::time::getNow());
+            });
+
+        // Answer clients estimating the offset between our clock and theirs.
+        m_systemComponent->registerClockSyncRequestHandler(
+            [&](common::ClockSyncRequest const &request,
+                util::time::TimeValue const &received) {
+                m_systemComponent->sendClockSyncResponse(request, received);
+            });
+
         // Things to do when we get a new incoming connection
         // No longer doing hardware detect unconditionally here - see
         // triggerHardwareDetect()
@@ -187,9 +213,8 @@ namespace server {
     void ServerImpl::instantiateDriver(std::string const &plugin,
                                        std::string const &driver,
                                        std::string const &params) {
-        BOOST_ASSERT_MSG(m_inServerThread(),
-                         "This method is only available in the server thread!");
-        m_ctx->instantiateDriver(plugin, driver, params);
+        m_callControlled(
+            [&] { m_ctx->instantiateDriver(plugin, driver, params); });
     }
 
     void ServerImpl::triggerHardwareDetect() {
@@ -214,6 +239,9 @@ namespace server {
         osvr::common::tracing::ServerUpdate trace;
         m_conn->process();
         m_systemDevice->update();
+        if (m_interestFilter->getNumClients() > 0) {
+            m_interestFilter->expireClients(util::time::getNow());
+        }
         for (auto &f : m_mainloopMethods) {
             f();
         }
@@ -364,6 +392,16 @@ namespace server {
     void ServerImpl::m_sendTree() {
 
         common::tracing::markPathTreeBroadcast();
+        if (m_reportPublisher) {
+            /// Ahead of the tree, so clients know about the rings by the time
+            /// they create handlers for the devices in it.
+            m_systemComponent->sendSharedMemoryReports(
+                m_reportPublisher->getDirectory());
+        }
+        if (m_multicastPublisher) {
+            m_systemComponent->sendMulticastReports(
+                m_multicastPublisher->getDirectory());
+        }
         m_systemComponent->sendReplacementTree(m_tree);
         m_log->info() << "Sent path tree to clients.";
     }
@@ -371,6 +409,107 @@ namespace server {
     void ServerImpl::setSleepTime(int microseconds) {
         m_sleepTime = microseconds;
     }
+
+    void ServerImpl::setClientInterestFiltering(bool enabled) {
+        m_callControlled([&] {
+            m_log->info() << "Client interest filtering "
+                          << (enabled ? "enabled" : "disabled");
+            m_interestFilter->setEnabled(enabled);
+        });
+    }
+
+    void ServerImpl::setSharedMemoryReports(bool enabled) {
+        m_callControlled([&] {
+            m_log->info() << "Shared memory reports "
+                          << (enabled ? "enabled" : "disabled");
+            if (enabled && !m_reportPublisher) {
+                m_reportPublisher =
+                    make_shared<common::SharedMemoryReportPublisher>();
+            } else if (!enabled) {
+                /// Devices already writing to rings keep doing so.
+                m_reportPublisher.reset();
+            }
+            m_conn->setSharedMemoryReportPublisher(m_reportPublisher);
+        });
+    }
+
+    void ServerImpl::setMulticastReports(std::string const &group, int port,
+                                         int ttl, std::string const &iface) {
+        using common::MulticastReportPublisher;
+        m_callControlled([&] {
+            /// Devices already sending to a group keep doing so.
+            m_multicastPublisher.reset();
+            if (!group.empty()) {
+                auto actualPort =
+                    port > 0 ? static_cast<uint16_t>(port)
+                             : MulticastReportPublisher::DEFAULT_PORT;
+                try {
+                    m_multicastPublisher = MulticastReportPublisher::create(
+                        group, actualPort, ttl, iface);
+                    m_log->info() << "Multicast reports enabled: " << group
+                                  << ":" << actualPort << ", TTL " << ttl;
+                } catch (std::exception &e) {
+                    m_log->error() << "Could not set up multicast reports: "
+                                   << e.what();
+                }
+            } else {
+                m_log->info() << "Multicast reports disabled";
+            }
+            m_conn->setMulticastReportPublisher(m_multicastPublisher);
+        });
+    }
+
+    void ServerImpl::setDeviceUpdateThreads(int threads) {
+        using connection::DeviceUpdateScheduler;
+        m_callControlled([&] {
+            connection::DeviceUpdateSchedulerPtr scheduler;
+            if (threads == Server::DEVICE_UPDATE_THREAD_PER_DEVICE) {
+                m_log->info() << "Sync device updates: one thread per device";
+                scheduler = DeviceUpdateScheduler::createPerDevice();
+            } else if (threads > 0) {
+                m_log->info() << "Sync device updates: pool of " << threads
+                              << " threads";
+                scheduler = DeviceUpdateScheduler::createPool(
+                    static_cast<std::size_t>(threads));
+            } else {
+                m_log->info() << "Sync device updates: server thread";
+                scheduler = DeviceUpdateScheduler::createInline();
+            }
+            m_conn->setDeviceUpdateScheduler(scheduler);
+        });
+    }
+
+    std::vector<connection::DeviceUpdateStats>
+    ServerImpl::getDeviceUpdateStats() const {
+        std::vector<connection::DeviceUpdateStats> ret;
+        m_callControlled([&] {
+            ret = m_conn->getDeviceUpdateScheduler()->getStats();
+        });
+        return ret;
+    }
+
+    void ServerImpl::setReportRecording(std::string const &filename) {
+        m_callControlled([&] {
+            if (m_reportRecorder) {
+                m_log->info() << "Recorded "
+                              << m_reportRecorder->getMessageCount()
+                              << " device messages";
+            }
+            m_reportRecorder.reset();
+            if (!filename.empty()) {
+                try {
+                    m_reportRecorder =
+                        connection::ReportRecorder::create(filename);
+                    m_log->info() << "Recording device messages to "
+                                  << filename;
+                } catch (std::exception &e) {
+                    m_log->error() << "Could not record device messages: "
+                                   << e.what();
+                }
+            }
+            m_conn->setReportRecorder(m_reportRecorder);
+        });
+    }
 #if 0
     int ServerImpl::getSleepTime() const { return m_sleepTime; }
 #endif
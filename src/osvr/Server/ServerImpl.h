@@ -26,7 +26,10 @@
 #define INCLUDED_ServerImpl_h_GUID_BA15589C_D1AD_4BBE_4F93_8AC87043A982
 
 // Internal Includes
+#include <osvr/Common/ClientInterestFilter_fwd.h>
 #include <osvr/Common/CommonComponent_fwd.h>
+#include <osvr/Common/SharedMemoryReportPublisher_fwd.h>
+#include <osvr/Common/MulticastReports_fwd.h>
 #include <osvr/Common/CreateDevice.h>
 #include <osvr/Common/LowLatency.h>
 #include <osvr/Common/PathTree.h>
@@ -34,6 +37,7 @@
 #include <osvr/Connection/ConnectionPtr.h>
 #include <osvr/Connection/DeviceToken.h>
 #include <osvr/Connection/MessageTypePtr.h>
+#include <osvr/Connection/ReportRecordingPtr.h>
 #include <osvr/PluginHost/RegistrationContext_fwd.h>
 #include <osvr/Server/Server.h>
 #include <osvr/Util/Flag.h>
@@ -121,6 +125,26 @@ namespace server {
 
         /// @copydoc Server::setSleepTime()
         void setSleepTime(int microseconds);
+
+        /// @copydoc Server::setClientInterestFiltering()
+        void setClientInterestFiltering(bool enabled);
+
+        /// @copydoc Server::setSharedMemoryReports()
+        void setSharedMemoryReports(bool enabled);
+
+        /// @copydoc Server::setMulticastReports()
+        void setMulticastReports(std::string const &group, int port, int ttl,
+                                 std::string const &iface);
+
+        /// @copydoc Server::setDeviceUpdateThreads()
+        void setDeviceUpdateThreads(int threads);
+
+        /// @copydoc Server::getDeviceUpdateStats()
+        std::vector<connection::DeviceUpdateStats>
+        getDeviceUpdateStats() const;
+
+        /// @copydoc Server::setReportRecording()
+        void setReportRecording(std::string const &filename);
 #if 0
         /// @copydoc Server::getSleepTime()
         int getSleepTime() const;
@@ -208,6 +232,20 @@ namespace server {
         /// @brief Common component for system device
         common::CommonComponent *m_commonComponent = nullptr;
 
+        /// @brief Filter deciding which device reports are sent, based on
+        /// interest advertised by clients.
+        common::ClientInterestFilterPtr m_interestFilter;
+
+        /// @brief Owner of the shared memory report rings, if enabled.
+        common::SharedMemoryReportPublisherPtr m_reportPublisher;
+
+        /// @brief Owner of the multicast report socket and streams, if
+        /// enabled.
+        common::MulticastReportPublisherPtr m_multicastPublisher;
+
+        /// @brief Recorder of device messages, if enabled.
+        connection::ReportRecorderPtr m_reportRecorder;
+
         /// @brief a flag to indicate whether we should run a hardware
         /// detection.
         bool m_triggeredDetect = false;
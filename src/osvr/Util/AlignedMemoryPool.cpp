@@ -0,0 +1,128 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Util/AlignedMemoryPool.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+// - none
+
+namespace osvr {
+namespace util {
+    /// @brief Smallest size class: no sense pooling at a finer grain than a
+    /// page.
+    static const std::size_t MIN_SIZE_CLASS = 4096;
+
+    shared_ptr<AlignedMemoryPool>
+    AlignedMemoryPool::create(std::size_t maxBytesRetained,
+                              std::size_t alignment) {
+        shared_ptr<AlignedMemoryPool> ret(
+            new AlignedMemoryPool(maxBytesRetained, alignment));
+        return ret;
+    }
+
+    shared_ptr<AlignedMemoryPool> const &
+    AlignedMemoryPool::getImageBufferPool() {
+        static const shared_ptr<AlignedMemoryPool> pool = create();
+        return pool;
+    }
+
+    AlignedMemoryPool::AlignedMemoryPool(std::size_t maxBytesRetained,
+                                         std::size_t alignment)
+        : m_maxBytesRetained(maxBytesRetained), m_alignment(alignment),
+          m_stats() {}
+
+    AlignedMemoryPool::~AlignedMemoryPool() { trim(); }
+
+    void *AlignedMemoryPool::acquire(std::size_t bytes) {
+        auto sizeClass = getSizeClass(bytes);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_free.find(sizeClass);
+            if (it != m_free.end() && !it->second.empty()) {
+                void *ret = it->second.back();
+                it->second.pop_back();
+                m_stats.bytesRetained -= sizeClass;
+                ++m_stats.hits;
+                return ret;
+            }
+            ++m_stats.misses;
+        }
+        return alignedAlloc(sizeClass, m_alignment);
+    }
+
+    void AlignedMemoryPool::release(void *p, std::size_t bytes) {
+        if (!p) {
+            return;
+        }
+        auto sizeClass = getSizeClass(bytes);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_stats.bytesRetained + sizeClass <= m_maxBytesRetained) {
+                m_free[sizeClass].push_back(p);
+                m_stats.bytesRetained += sizeClass;
+                return;
+            }
+            ++m_stats.discards;
+        }
+        alignedFree(p);
+    }
+
+    void AlignedMemoryPool::trim() {
+        decltype(m_free) buffers;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            buffers.swap(m_free);
+            m_stats.bytesRetained = 0;
+        }
+        for (auto &sizeClass : buffers) {
+            for (auto p : sizeClass.second) {
+                alignedFree(p);
+            }
+        }
+    }
+
+    AlignedMemoryPoolStats AlignedMemoryPool::getStats() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
+
+    std::size_t AlignedMemoryPool::getSizeClass(std::size_t bytes) {
+        if (bytes <= MIN_SIZE_CLASS) {
+            return MIN_SIZE_CLASS;
+        }
+        /// Find the power of two such that pow2 < bytes <= 2 * pow2, then
+        /// round up to a quarter of it.
+        std::size_t pow2 = MIN_SIZE_CLASS;
+        while (pow2 * 2 < bytes) {
+            pow2 *= 2;
+        }
+        auto step = pow2 / 4;
+        return (bytes + step - 1) / step * step;
+    }
+} // namespace util
+} // namespace osvr
@@ -0,0 +1,345 @@
+/** @file
+    @brief Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Util/DeferredLogger.h>
+#include <osvr/Util/Logger.h>
+#include <osvr/Util/TimeValue.h>
+
+// Library/third-party includes
+// - none
+
+// Standard includes
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace osvr {
+namespace util {
+    namespace log {
+        void DeferredLogArg::write(std::ostream &os) const {
+            switch (m_type) {
+            case Type::Signed:
+                os << m_signed;
+                break;
+            case Type::Unsigned:
+                os << m_unsigned;
+                break;
+            case Type::Floating:
+                os << m_floating;
+                break;
+            case Type::Boolean:
+                os << (m_unsigned ? "true" : "false");
+                break;
+            case Type::String:
+                os << (m_string ? m_string : "(null)");
+                break;
+            case Type::Pointer:
+                os << m_pointer;
+                break;
+            }
+        }
+
+        namespace {
+            /// @brief How long the background thread sleeps between draining
+            /// the queues, when not asked to flush.
+            static const std::chrono::milliseconds DRAIN_INTERVAL(10);
+
+            struct Record {
+                time::TimeValue time;
+                const char *format;
+                LogLevel level;
+                uint8_t argCount;
+                DeferredLogArg args[DeferredLogger::MAX_ARGS];
+            };
+
+            /// @brief A single-producer, single-consumer ring of records,
+            /// owned by one logging thread.
+            struct ProducerQueue {
+                std::atomic<bool> claimed{false};
+                /// @brief Set (with release semantics) once `owner` and
+                /// `records` are valid.
+                std::atomic<bool> ready{false};
+                std::thread::id owner;
+                std::vector<Record> records;
+                /// @brief Next slot to write: only stored by the producer.
+                std::atomic<std::size_t> head{0};
+                /// @brief Next slot to read: only stored by the consumer.
+                std::atomic<std::size_t> tail{0};
+            };
+
+            inline std::size_t roundUpToPowerOfTwo(std::size_t n) {
+                std::size_t ret = 1;
+                while (ret < n) {
+                    ret *= 2;
+                }
+                return ret;
+            }
+
+            inline bool earlierThan(Record const &a, Record const &b) {
+                return a.time < b.time;
+            }
+        } // namespace
+
+        class DeferredLogger::Impl {
+          public:
+            Impl(Handler &&handler, std::size_t queueSize)
+                : m_handler(std::move(handler)),
+                  m_queueSize(roundUpToPowerOfTwo((std::max)(
+                      queueSize, static_cast<std::size_t>(2)))),
+                  m_thread([&] { m_run(); }) {}
+
+            ~Impl() {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stopping = true;
+                }
+                m_wake.notify_all();
+                m_thread.join();
+            }
+
+            void submit(LogLevel level, const char *format,
+                        DeferredLogArg const *args, std::size_t argCount) {
+                auto queue = m_getQueue();
+                if (!queue) {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                auto head = queue->head.load(std::memory_order_relaxed);
+                auto tail = queue->tail.load(std::memory_order_acquire);
+                if (head - tail == m_queueSize) {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                auto &record = queue->records[head & (m_queueSize - 1)];
+                time::getNow(record.time);
+                record.format = format;
+                record.level = level;
+                record.argCount = static_cast<uint8_t>(argCount);
+                std::copy(args, args + argCount, record.args);
+                queue->head.store(head + 1, std::memory_order_release);
+            }
+
+            uint64_t getDroppedCount() const {
+                return m_dropped.load(std::memory_order_relaxed);
+            }
+
+            void flush() {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                /// The pass in progress (if any) may have started before our
+                /// caller's last message was recorded, so wait for the one
+                /// after it too.
+                auto target = m_passesCompleted + 2;
+                ++m_flushWaiters;
+                m_wake.notify_all();
+                m_passDone.wait(lock, [&] {
+                    return m_passesCompleted >= target || m_stopped;
+                });
+                --m_flushWaiters;
+            }
+
+          private:
+            /// @brief Finds the calling thread's queue, claiming one if it
+            /// doesn't have one yet. Lock-free.
+            ProducerQueue *m_getQueue() {
+                auto id = std::this_thread::get_id();
+                for (auto &queue : m_queues) {
+                    if (!queue.claimed.load(std::memory_order_acquire)) {
+                        break;
+                    }
+                    if (queue.ready.load(std::memory_order_acquire) &&
+                        queue.owner == id) {
+                        return &queue;
+                    }
+                }
+                for (auto &queue : m_queues) {
+                    bool expected = false;
+                    if (queue.claimed.compare_exchange_strong(expected, true)) {
+                        queue.owner = id;
+                        queue.records.resize(m_queueSize);
+                        queue.ready.store(true, std::memory_order_release);
+                        return &queue;
+                    }
+                }
+                return nullptr;
+            }
+
+            void m_run() {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                while (true) {
+                    m_wake.wait_for(lock, DRAIN_INTERVAL, [&] {
+                        return m_stopping || m_flushWaiters > 0;
+                    });
+                    auto stopping = m_stopping;
+                    lock.unlock();
+                    m_drain();
+                    lock.lock();
+                    ++m_passesCompleted;
+                    m_passDone.notify_all();
+                    if (stopping) {
+                        m_stopped = true;
+                        m_passDone.notify_all();
+                        return;
+                    }
+                }
+            }
+
+            /// @brief Takes everything currently in the queues, then formats
+            /// and emits it in timestamp order.
+            void m_drain() {
+                m_batch.clear();
+                for (auto &queue : m_queues) {
+                    if (!queue.claimed.load(std::memory_order_acquire)) {
+                        break;
+                    }
+                    if (!queue.ready.load(std::memory_order_acquire)) {
+                        continue;
+                    }
+                    auto tail = queue.tail.load(std::memory_order_relaxed);
+                    auto head = queue.head.load(std::memory_order_acquire);
+                    for (; tail != head; ++tail) {
+                        m_batch.push_back(
+                            queue.records[tail & (m_queueSize - 1)]);
+                    }
+                    queue.tail.store(tail, std::memory_order_release);
+                }
+                std::stable_sort(m_batch.begin(), m_batch.end(), earlierThan);
+                for (auto const &record : m_batch) {
+                    m_emit(record.level,
+                           DeferredLogger::format(record.format, record.args,
+                                                  record.argCount));
+                }
+
+                auto dropped = m_dropped.load(std::memory_order_relaxed);
+                if (dropped != m_droppedReported) {
+                    std::ostringstream os;
+                    os << "Dropped " << (dropped - m_droppedReported)
+                       << " deferred log messages (" << dropped
+                       << " total): queue full";
+                    m_droppedReported = dropped;
+                    m_emit(LogLevel::warn, os.str());
+                }
+            }
+
+            void m_emit(LogLevel level, std::string const &msg) {
+                try {
+                    m_handler(level, msg);
+                } catch (...) {
+                    // A misbehaving handler must not take down the thread.
+                }
+            }
+
+            Handler m_handler;
+            const std::size_t m_queueSize;
+            ProducerQueue m_queues[MAX_PRODUCER_THREADS];
+            std::atomic<uint64_t> m_dropped{0};
+
+            /// @name Used only by the background thread
+            /// @{
+            std::vector<Record> m_batch;
+            uint64_t m_droppedReported = 0;
+            /// @}
+
+            /// @name Protected by m_mutex
+            /// @{
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_passDone;
+            bool m_stopping = false;
+            bool m_stopped = false;
+            std::size_t m_flushWaiters = 0;
+            uint64_t m_passesCompleted = 0;
+            /// @}
+
+            /// @brief Declared last so everything it uses is constructed
+            /// before it starts.
+            std::thread m_thread;
+        };
+
+        DeferredLoggerPtr DeferredLogger::make(LoggerPtr target,
+                                               std::size_t queueSize) {
+            shared_ptr<Logger> logger(std::move(target));
+            auto initialLevel = logger->getLogLevel();
+            Handler handler = [logger](LogLevel level, std::string const &msg) {
+                logger->log(level, msg.c_str());
+            };
+            DeferredLoggerPtr ret(new DeferredLogger(std::move(handler),
+                                                     queueSize, initialLevel));
+            return ret;
+        }
+
+        DeferredLoggerPtr DeferredLogger::make(Handler handler,
+                                               std::size_t queueSize) {
+            DeferredLoggerPtr ret(new DeferredLogger(
+                std::move(handler), queueSize, LogLevel::trace));
+            return ret;
+        }
+
+        DeferredLogger::DeferredLogger(Handler &&handler,
+                                       std::size_t queueSize, LogLevel level)
+            : m_level(static_cast<int>(level)),
+              m_impl(new Impl(std::move(handler), queueSize)) {}
+
+        DeferredLogger::~DeferredLogger() {}
+
+        uint64_t DeferredLogger::getDroppedCount() const {
+            return m_impl->getDroppedCount();
+        }
+
+        void DeferredLogger::flush() { m_impl->flush(); }
+
+        std::string DeferredLogger::format(const char *format,
+                                           DeferredLogArg const *args,
+                                           std::size_t argCount) {
+            std::ostringstream os;
+            std::size_t arg = 0;
+            for (auto p = format; *p; ++p) {
+                if (p[0] == '{' && p[1] == '}' && arg < argCount) {
+                    args[arg].write(os);
+                    ++arg;
+                    ++p;
+                } else {
+                    os << *p;
+                }
+            }
+            /// Don't lose any arguments the format string forgot.
+            for (; arg < argCount; ++arg) {
+                os << " ";
+                args[arg].write(os);
+            }
+            return os.str();
+        }
+
+        void DeferredLogger::m_submit(LogLevel level, const char *format,
+                                      DeferredLogArg const *args,
+                                      std::size_t argCount) {
+            m_impl->submit(level, format, args, argCount);
+        }
+    } // namespace log
+} // namespace util
+} // namespace osvr
@@ -0,0 +1,134 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/ClientInterestFilter.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+// - none
+
+using osvr::common::ClientInterestFilter;
+using osvr::util::time::TimeValue;
+
+static TimeValue makeTime(double seconds) {
+    TimeValue ret;
+    ret.seconds = static_cast<OSVR_TimeValue_Seconds>(seconds);
+    ret.microseconds = static_cast<OSVR_TimeValue_Microseconds>(
+        (seconds - ret.seconds) * 1000000. + 0.5);
+    return ret;
+}
+
+TEST(ClientInterestFilter, DisabledSendsEverything) {
+    ClientInterestFilter filter;
+    auto dev = filter.getDevice("com_osvr_Test/Tracker");
+    ClientInterestFilter::Interest interest;
+    interest["com_osvr_Test/Other"] = 10;
+    filter.setClientInterest("app/1", interest, makeTime(0));
+    ASSERT_TRUE(dev->isWanted());
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(dev->shouldSend(0, makeTime(i * 0.001)));
+    }
+}
+
+TEST(ClientInterestFilter, FiltersByInterest) {
+    ClientInterestFilter filter;
+    filter.setEnabled(true);
+    auto wanted = filter.getDevice("com_osvr_Test/Tracker");
+    auto unwanted = filter.getDevice("com_osvr_Test/Other");
+    ASSERT_FALSE(wanted->isWanted()) << "No clients means no interest";
+
+    ClientInterestFilter::Interest interest;
+    interest["com_osvr_Test/Tracker"] = 0;
+    filter.setClientInterest("app/1", interest, makeTime(0));
+    ASSERT_TRUE(wanted->isWanted());
+    ASSERT_TRUE(wanted->shouldSend(0, makeTime(0)));
+    ASSERT_TRUE(wanted->shouldSend(0, makeTime(0.0001)));
+    ASSERT_FALSE(unwanted->isWanted());
+    ASSERT_FALSE(unwanted->shouldSend(0, makeTime(0)));
+
+    /// Devices created later pick up existing interest too.
+    ASSERT_TRUE(filter.getDevice("com_osvr_Test/Tracker")->isWanted());
+
+    filter.setEnabled(false);
+    ASSERT_TRUE(unwanted->isWanted());
+}
+
+TEST(ClientInterestFilter, RateLimitsPerStream) {
+    ClientInterestFilter filter;
+    filter.setEnabled(true);
+    auto dev = filter.getDevice("com_osvr_Test/Tracker");
+    ClientInterestFilter::Interest interest;
+    interest["com_osvr_Test/Tracker"] = 100;
+    filter.setClientInterest("app/1", interest, makeTime(0));
+
+    ASSERT_TRUE(dev->shouldSend(0, makeTime(1.000)));
+    ASSERT_TRUE(dev->shouldSend(1, makeTime(1.001)))
+        << "Streams are limited independently";
+    ASSERT_FALSE(dev->shouldSend(0, makeTime(1.005)));
+    ASSERT_TRUE(dev->shouldSend(0, makeTime(1.010)));
+    ASSERT_FALSE(dev->shouldSend(1, makeTime(1.010)));
+    ASSERT_TRUE(dev->shouldSend(0, makeTime(0.5)))
+        << "Timestamps going backwards should start over";
+    ASSERT_TRUE(dev->isWanted()) << "Events are never rate-limited";
+
+    /// Highest requested rate wins, and no limit beats any rate.
+    interest["com_osvr_Test/Tracker"] = 200;
+    filter.setClientInterest("app/2", interest, makeTime(0));
+    ASSERT_TRUE(dev->shouldSend(0, makeTime(0.505)));
+    interest["com_osvr_Test/Tracker"] = 0;
+    filter.setClientInterest("app/3", interest, makeTime(0));
+    ASSERT_TRUE(dev->shouldSend(0, makeTime(0.5051)));
+}
+
+TEST(ClientInterestFilter, ExpiresClients) {
+    ClientInterestFilter filter;
+    filter.setEnabled(true);
+    auto dev = filter.getDevice("com_osvr_Test/Tracker");
+    ClientInterestFilter::Interest interest;
+    interest["com_osvr_Test/Tracker"] = 0;
+    filter.setClientInterest("app/1", interest, makeTime(10));
+
+    filter.expireClients(makeTime(11));
+    ASSERT_EQ(filter.getNumClients(), 1u);
+    /// Refreshing keeps it alive.
+    filter.setClientInterest("app/1", interest, makeTime(12));
+    filter.expireClients(makeTime(14));
+    ASSERT_EQ(filter.getNumClients(), 1u);
+    ASSERT_TRUE(dev->isWanted());
+
+    filter.expireClients(makeTime(
+        12 + ClientInterestFilter::EXPIRY_MS / 1000. + 0.1));
+    ASSERT_EQ(filter.getNumClients(), 0u);
+    ASSERT_FALSE(dev->isWanted());
+}
+
+TEST(ClientInterestFilter, CombineMaxRates) {
+    ASSERT_EQ(ClientInterestFilter::combineMaxRates(30, 60), 60);
+    ASSERT_EQ(ClientInterestFilter::combineMaxRates(60, 0), 0);
+    ASSERT_EQ(ClientInterestFilter::combineMaxRates(0, 30), 0);
+}
@@ -0,0 +1,194 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/ClockSync.h>
+#include <osvr/Common/Buffer.h>
+#include <osvr/Common/Serialization.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <cstdlib>
+
+using osvr::common::ClockOffsetEstimator;
+using osvr::common::ClockSyncRequest;
+using osvr::common::ClockSyncResponse;
+using osvr::common::ClockSyncSample;
+using osvr::common::ReportAgeStatistics;
+
+/// @brief An exchange starting at client time @p clientSent (microseconds)
+/// with a server whose clock reads @p offset ahead, taking @p out to reach the
+/// server, @p processing there, and @p back to return.
+static ClockSyncSample makeSample(int64_t clientSent, int64_t offset,
+                                  int64_t out, int64_t back,
+                                  int64_t processing = 50) {
+    ClockSyncSample ret;
+    ret.clientSent = clientSent;
+    ret.serverReceived = clientSent + out + offset;
+    ret.serverSent = ret.serverReceived + processing;
+    ret.clientReceived = clientSent + out + processing + back;
+    return ret;
+}
+
+static const int64_t SECOND = 1000000;
+
+TEST(ClockSyncSample, SymmetricDelayGivesExactOffset) {
+    auto sample = makeSample(10 * SECOND, -3 * SECOND, 200, 200);
+    ASSERT_EQ(-3 * SECOND, sample.getOffset());
+    ASSERT_EQ(400, sample.getRoundTrip());
+}
+
+TEST(ClockSyncSample, AsymmetricDelayErrorBoundedByHalfRoundTrip) {
+    auto sample = makeSample(10 * SECOND, 5 * SECOND, 900, 100);
+    ASSERT_EQ(1000, sample.getRoundTrip());
+    ASSERT_LE(std::abs(sample.getOffset() - 5 * SECOND),
+              sample.getRoundTrip() / 2);
+}
+
+TEST(ClockOffsetEstimator, NoEstimateInitially) {
+    ClockOffsetEstimator est;
+    ASSERT_FALSE(est.hasEstimate());
+    ASSERT_EQ(0u, est.getSampleCount());
+    osvr::util::time::TimeValue tv = {1000, 500};
+    auto server = est.toServerTime(tv);
+    ASSERT_EQ(tv.seconds, server.seconds);
+    ASSERT_EQ(tv.microseconds, server.microseconds);
+}
+
+TEST(ClockOffsetEstimator, RejectsNegativeRoundTrip) {
+    ClockOffsetEstimator est;
+    auto sample = makeSample(10 * SECOND, SECOND, 200, 200);
+    sample.clientReceived = sample.clientSent - 1;
+    ASSERT_FALSE(est.addSample(sample));
+    ASSERT_FALSE(est.hasEstimate());
+}
+
+TEST(ClockOffsetEstimator, PicksShortestRoundTrip) {
+    ClockOffsetEstimator est;
+    static const int64_t offset = 2 * SECOND + 1234;
+    /// Mostly congested on the way out, except for one quick exchange.
+    for (int i = 0; i < 8; ++i) {
+        auto out = (i == 5) ? 100 : 5000 + 1000 * i;
+        ASSERT_TRUE(est.addSample(
+            makeSample(100 * SECOND + i * SECOND / 10, offset, out, 100)));
+    }
+    ASSERT_TRUE(est.hasEstimate());
+    ASSERT_EQ(8u, est.getSampleCount());
+    ASSERT_NEAR(offset / 1e6, est.getOffset(), 1e-9);
+    ASSERT_NEAR(200e-6, est.getRoundTrip(), 1e-9);
+    ASSERT_EQ(0., est.getDrift());
+}
+
+TEST(ClockOffsetEstimator, ForgetsShortRoundTripOutsideWindow) {
+    ClockOffsetEstimator est;
+    ASSERT_TRUE(est.addSample(makeSample(100 * SECOND, 0, 10, 10)));
+    for (std::size_t i = 1; i <= ClockOffsetEstimator::WINDOW_SIZE; ++i) {
+        ASSERT_TRUE(est.addSample(
+            makeSample(100 * SECOND + i * SECOND, 0, 300, 300)));
+    }
+    ASSERT_NEAR(600e-6, est.getRoundTrip(), 1e-9);
+}
+
+TEST(ClockOffsetEstimator, EstimatesDrift) {
+    ClockOffsetEstimator est;
+    /// Server clock runs 100ppm fast, and the round trips jitter.
+    static const double drift = 100e-6;
+    static const int64_t start = 1000 * SECOND;
+    for (int i = 0; i < 60; ++i) {
+        auto clientSent = start + i * SECOND;
+        auto offset = SECOND + static_cast<int64_t>(drift * i * SECOND);
+        auto delay = 200 + (i * 37) % 150;
+        ASSERT_TRUE(
+            est.addSample(makeSample(clientSent, offset, delay, delay)));
+    }
+    ASSERT_NEAR(drift, est.getDrift(), 1e-6);
+
+    /// Extrapolating ten seconds past the last exchange.
+    osvr::util::time::TimeValue later = {1069, 0};
+    auto expected = 1. + drift * 69;
+    ASSERT_NEAR(expected, est.getOffsetAt(later), 20e-6);
+    auto server = est.toServerTime(later);
+    ASSERT_NEAR(1069. + expected,
+                server.seconds + server.microseconds / 1e6, 20e-6);
+}
+
+TEST(ClockOffsetEstimator, NoDriftOverShortSpan) {
+    ClockOffsetEstimator est;
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(est.addSample(
+            makeSample(SECOND + i * SECOND / 10, i * 100, 200, 200)));
+    }
+    ASSERT_EQ(0., est.getDrift());
+}
+
+TEST(ClockOffsetEstimator, Reset) {
+    ClockOffsetEstimator est;
+    ASSERT_TRUE(est.addSample(makeSample(SECOND, SECOND, 200, 200)));
+    ASSERT_TRUE(est.hasEstimate());
+    est.reset();
+    ASSERT_FALSE(est.hasEstimate());
+    ASSERT_EQ(0u, est.getSampleCount());
+}
+
+TEST(ClockSync, ResponseRoundTripsThroughSerialization) {
+    ClockSyncRequest request;
+    request.client = 0x0123456789abcdefULL;
+    request.sequence = 42;
+    request.clientSent = -5;
+    ClockSyncResponse response(request);
+    response.serverReceived = 1234567890123LL;
+    response.serverSent = 1234567890456LL;
+
+    osvr::common::Buffer<> buf;
+    osvr::common::serialize(buf, response);
+    ClockSyncResponse result;
+    auto reader = buf.startReading();
+    osvr::common::deserialize(reader, result);
+    ASSERT_EQ(request.client, result.client);
+    ASSERT_EQ(request.sequence, result.sequence);
+    ASSERT_EQ(request.clientSent, result.clientSent);
+    ASSERT_EQ(response.serverReceived, result.serverReceived);
+    ASSERT_EQ(response.serverSent, result.serverSent);
+}
+
+TEST(ReportAgeStatistics, Basics) {
+    ReportAgeStatistics stats;
+    ASSERT_EQ(0u, stats.getCount());
+    stats.addSample(0.004);
+    stats.addSample(0.002);
+    stats.addSample(0.009);
+    ASSERT_EQ(3u, stats.getCount());
+    ASSERT_DOUBLE_EQ(0.009, stats.getLast());
+    ASSERT_DOUBLE_EQ(0.005, stats.getMean());
+    ASSERT_DOUBLE_EQ(0.002, stats.getMin());
+    ASSERT_DOUBLE_EQ(0.009, stats.getMax());
+    stats.reset();
+    ASSERT_EQ(0u, stats.getCount());
+    stats.addSample(0.001);
+    ASSERT_DOUBLE_EQ(0.001, stats.getMin());
+    ASSERT_DOUBLE_EQ(0.001, stats.getMax());
+}
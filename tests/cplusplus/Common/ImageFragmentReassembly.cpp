@@ -0,0 +1,298 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// Internal Includes
+#include "ImageFragmentReassembler.h"
+#include "ImageWireCodec.h"
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+using osvr::common::ImageFragmentHeader;
+using osvr::common::ImageFragmentReassembler;
+using osvr::common::ImageWireCodec;
+using osvr::util::time::TimeValue;
+
+typedef std::vector<OSVR_ImageBufferElement> Image;
+typedef std::pair<ImageFragmentHeader, std::vector<char>> Fragment;
+
+static OSVR_ImagingMetadata makeMetadata(OSVR_ImageDimension width,
+                                         OSVR_ImageDimension height,
+                                         OSVR_ImageDepth depth = 1) {
+    OSVR_ImagingMetadata ret = {};
+    ret.width = width;
+    ret.height = height;
+    ret.channels = 1;
+    ret.depth = depth;
+    ret.type = OSVR_IVT_UNSIGNED_INT;
+    return ret;
+}
+
+static Image makeImage(std::size_t size, int seed = 0) {
+    Image ret(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        ret[i] = static_cast<OSVR_ImageBufferElement>((i / 7) * 3 + seed);
+    }
+    return ret;
+}
+
+/// @brief Splits a frame's data into fragments the way the server does.
+static std::vector<Fragment>
+makeFragments(OSVR_ImagingMetadata const &metadata, Image const &img,
+              uint32_t frameSequence, std::size_t fragmentLength,
+              ImageWireCodec codec = ImageWireCodec::Raw,
+              OSVR_ChannelCount sensor = 0) {
+    std::vector<char> data;
+    if (codec == ImageWireCodec::RowDeltaRLE) {
+        auto rowBytes = metadata.width * metadata.depth * metadata.channels;
+        EXPECT_TRUE(osvr::common::encodeRowDeltaRLE(
+            img.data(), rowBytes, metadata.height, img.size(), data));
+    } else {
+        data.assign(img.begin(), img.end());
+    }
+    ImageFragmentHeader header;
+    header.metadata = metadata;
+    header.sensor = sensor;
+    header.frameSequence = frameSequence;
+    header.codec = codec;
+    header.bigEndian = osvr::common::HOST_IS_BIG_ENDIAN;
+    header.encodedSize = static_cast<uint32_t>(data.size());
+    std::vector<Fragment> ret;
+    for (std::size_t offset = 0; offset < data.size();
+         offset += fragmentLength) {
+        auto end = (std::min)(offset + fragmentLength, data.size());
+        header.fragmentOffset = static_cast<uint32_t>(offset);
+        header.fragmentLength = static_cast<uint32_t>(end - offset);
+        ret.emplace_back(header, std::vector<char>(data.begin() + offset,
+                                                   data.begin() + end));
+    }
+    return ret;
+}
+
+class ImageFragmentReassemblerTest : public ::testing::Test {
+  public:
+    /// @brief Adds a fragment, keeping the frame it completes, if any.
+    ///
+    /// @return whether it completed a frame.
+    bool add(Fragment const &fragment) {
+        frame = reassembler.addFragment(fragment.first,
+                                        fragment.second.data());
+        return frame != nullptr;
+    }
+
+    /// @brief Adds the fragments in order, expecting only the last to
+    /// complete a frame.
+    bool addAll(std::vector<Fragment> const &fragments) {
+        for (std::size_t i = 0; i < fragments.size(); ++i) {
+            if (add(fragments[i]) != (i + 1 == fragments.size())) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// @brief Contents of the last frame completed.
+    Image contents(std::size_t size) const {
+        return Image(frame.get(), frame.get() + size);
+    }
+
+    ImageFragmentReassembler reassembler;
+    ImageFragmentReassembler::BufferPtr frame;
+};
+
+TEST_F(ImageFragmentReassemblerTest, RawFrameInOrder) {
+    auto metadata = makeMetadata(40, 10);
+    auto img = makeImage(400);
+    auto fragments = makeFragments(metadata, img, 0, 150);
+    ASSERT_EQ(3u, fragments.size());
+    ASSERT_TRUE(addAll(fragments));
+    ASSERT_EQ(img, contents(img.size()));
+}
+
+TEST_F(ImageFragmentReassemblerTest, CompressedFrameInOrder) {
+    auto metadata = makeMetadata(40, 10);
+    auto img = makeImage(400);
+    auto fragments =
+        makeFragments(metadata, img, 0, 16, ImageWireCodec::RowDeltaRLE);
+    ASSERT_GT(fragments.size(), 1u);
+    ASSERT_TRUE(addAll(fragments));
+    ASSERT_EQ(img, contents(img.size()));
+}
+
+TEST_F(ImageFragmentReassemblerTest, MissingFragmentDropsFrame) {
+    auto metadata = makeMetadata(40, 10);
+    auto fragments = makeFragments(metadata, makeImage(400), 0, 100);
+    fragments.erase(fragments.begin() + 2);
+    for (auto const &fragment : fragments) {
+        ASSERT_FALSE(add(fragment));
+    }
+
+    /// The next frame still gets through.
+    auto img = makeImage(400, 1);
+    ASSERT_TRUE(addAll(makeFragments(metadata, img, 1, 100)));
+    ASSERT_EQ(img, contents(img.size()));
+}
+
+TEST_F(ImageFragmentReassemblerTest, MissingFirstFragmentDropsFrame) {
+    auto fragments =
+        makeFragments(makeMetadata(40, 10), makeImage(400), 0, 100);
+    fragments.erase(fragments.begin());
+    for (auto const &fragment : fragments) {
+        ASSERT_FALSE(add(fragment));
+    }
+}
+
+TEST_F(ImageFragmentReassemblerTest, MissingLastFragmentDropsFrame) {
+    auto metadata = makeMetadata(40, 10);
+    auto fragments = makeFragments(metadata, makeImage(400), 0, 100);
+    fragments.pop_back();
+    for (auto const &fragment : fragments) {
+        ASSERT_FALSE(add(fragment));
+    }
+    /// The start of the next frame abandons the incomplete one.
+    auto img = makeImage(400, 1);
+    ASSERT_TRUE(addAll(makeFragments(metadata, img, 1, 100)));
+    ASSERT_EQ(img, contents(img.size()));
+}
+
+TEST_F(ImageFragmentReassemblerTest, ReorderedFragmentsDropFrame) {
+    auto fragments =
+        makeFragments(makeMetadata(40, 10), makeImage(400), 0, 100);
+    std::swap(fragments[1], fragments[2]);
+    for (auto const &fragment : fragments) {
+        ASSERT_FALSE(add(fragment));
+    }
+}
+
+TEST_F(ImageFragmentReassemblerTest, RepeatedFragmentDropsFrame) {
+    auto fragments =
+        makeFragments(makeMetadata(40, 10), makeImage(400), 0, 100);
+    fragments.insert(fragments.begin() + 2, fragments[1]);
+    for (auto const &fragment : fragments) {
+        ASSERT_FALSE(add(fragment));
+    }
+}
+
+TEST_F(ImageFragmentReassemblerTest, FragmentOfAnotherFrameDropsFrame) {
+    auto metadata = makeMetadata(40, 10);
+    auto fragments = makeFragments(metadata, makeImage(400), 0, 100);
+    fragments[2] = makeFragments(metadata, makeImage(400, 1), 1, 100)[2];
+    for (auto const &fragment : fragments) {
+        ASSERT_FALSE(add(fragment));
+    }
+}
+
+TEST_F(ImageFragmentReassemblerTest, SensorsReassembledSeparately) {
+    auto metadata = makeMetadata(40, 10);
+    auto img0 = makeImage(400);
+    auto img1 = makeImage(400, 1);
+    auto fragments0 = makeFragments(metadata, img0, 0, 100,
+                                    ImageWireCodec::Raw, 0);
+    auto fragments1 = makeFragments(metadata, img1, 1, 100,
+                                    ImageWireCodec::Raw, 1);
+    ASSERT_EQ(fragments0.size(), fragments1.size());
+    for (std::size_t i = 0; i + 1 < fragments0.size(); ++i) {
+        ASSERT_FALSE(add(fragments0[i]));
+        ASSERT_FALSE(add(fragments1[i]));
+    }
+    ASSERT_TRUE(add(fragments1.back()));
+    ASSERT_EQ(img1, contents(img1.size()));
+    ASSERT_TRUE(add(fragments0.back()));
+    ASSERT_EQ(img0, contents(img0.size()));
+}
+
+TEST_F(ImageFragmentReassemblerTest, SamplesInOtherByteOrderSwapped) {
+    auto metadata = makeMetadata(10, 4, 2);
+    auto img = makeImage(80);
+    auto fragments = makeFragments(metadata, img, 0, 30);
+    for (auto &fragment : fragments) {
+        fragment.first.bigEndian = !osvr::common::HOST_IS_BIG_ENDIAN;
+    }
+    ASSERT_TRUE(addAll(fragments));
+    osvr::common::swapSampleByteOrder(img.data(), img.size(), 2);
+    ASSERT_EQ(img, contents(img.size()));
+}
+
+TEST_F(ImageFragmentReassemblerTest, RejectsImpossibleSizes) {
+    auto metadata = makeMetadata(40, 10);
+    auto fragments = makeFragments(metadata, makeImage(400), 0, 400);
+    ASSERT_EQ(1u, fragments.size());
+    auto fragment = fragments.front();
+
+    fragment.first.encodedSize = 399;
+    fragment.first.fragmentLength = 399;
+    ASSERT_FALSE(add(fragment)) << "Raw frame must be the image size";
+
+    fragment = fragments.front();
+    fragment.first.codec = ImageWireCodec::RowDeltaRLE;
+    fragment.first.encodedSize = 1000;
+    ASSERT_FALSE(add(fragment)) << "Larger than encoding could produce";
+
+    fragment = fragments.front();
+    fragment.first.fragmentLength = 401;
+    fragment.second.push_back(0);
+    ASSERT_FALSE(add(fragment)) << "Fragment runs past the frame";
+
+    fragment = fragments.front();
+    fragment.first.metadata = makeMetadata(0, 10);
+    ASSERT_FALSE(add(fragment)) << "Empty image";
+
+    ASSERT_TRUE(add(fragments.front()));
+}
+
+TEST_F(ImageFragmentReassemblerTest, RejectsUndecodableFrame) {
+    auto metadata = makeMetadata(40, 10);
+    auto fragments = makeFragments(metadata, makeImage(400), 0, 1000,
+                                   ImageWireCodec::RowDeltaRLE);
+    ASSERT_EQ(1u, fragments.size());
+    auto &fragment = fragments.front();
+    fragment.second.pop_back();
+    fragment.first.encodedSize -= 1;
+    fragment.first.fragmentLength -= 1;
+    ASSERT_FALSE(add(fragment));
+}
+
+TEST_F(ImageFragmentReassemblerTest, DuplicateFrameDropped) {
+    TimeValue first = {1, 500};
+    TimeValue second = {1, 600};
+    ASSERT_FALSE(reassembler.alreadyDelivered(0, first));
+    ASSERT_TRUE(reassembler.markDelivered(0, first));
+    ASSERT_TRUE(reassembler.alreadyDelivered(0, first));
+    ASSERT_FALSE(reassembler.markDelivered(0, first))
+        << "Same frame arriving by another message";
+
+    ASSERT_FALSE(reassembler.alreadyDelivered(1, first))
+        << "Sensors tracked separately";
+    ASSERT_TRUE(reassembler.markDelivered(1, first));
+
+    ASSERT_TRUE(reassembler.markDelivered(0, second));
+    ASSERT_FALSE(reassembler.alreadyDelivered(0, first));
+    ASSERT_FALSE(reassembler.markDelivered(0, second));
+}
@@ -0,0 +1,237 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// Internal Includes
+#include "ImageWireCodec.h"
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <cstddef>
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+using osvr::common::decodeRowDeltaRLE;
+using osvr::common::encodeRowDeltaRLE;
+using osvr::common::getMaxRowDeltaRLESize;
+using osvr::common::swapSampleByteOrder;
+
+typedef std::vector<OSVR_ImageBufferElement> Image;
+typedef std::vector<char> Encoded;
+
+static Encoded encode(Image const &img, std::size_t rowBytes) {
+    auto rows = img.size() / rowBytes;
+    Encoded ret;
+    EXPECT_TRUE(encodeRowDeltaRLE(img.data(), rowBytes, rows,
+                                  getMaxRowDeltaRLESize(rowBytes, rows), ret));
+    EXPECT_LE(ret.size(), getMaxRowDeltaRLESize(rowBytes, rows));
+    return ret;
+}
+
+static bool decode(Encoded const &data, std::size_t rowBytes,
+                   std::size_t rows, Image &img) {
+    img.assign(rowBytes * rows, 0);
+    return decodeRowDeltaRLE(data.data(), data.size(), rowBytes, rows,
+                             img.data());
+}
+
+static void expectRoundTrip(Image const &img, std::size_t rowBytes) {
+    auto rows = img.size() / rowBytes;
+    Image decoded;
+    ASSERT_TRUE(decode(encode(img, rowBytes), rowBytes, rows, decoded));
+    ASSERT_EQ(img, decoded);
+}
+
+static Encoded bytes(std::initializer_list<int> values) {
+    Encoded ret;
+    for (auto v : values) {
+        ret.push_back(static_cast<char>(v));
+    }
+    return ret;
+}
+
+TEST(ImageWireCodec, RunOfExactlyMaxLength) {
+    Image img(128, 7);
+    ASSERT_EQ(bytes({-127, 7}), encode(img, img.size()));
+    expectRoundTrip(img, img.size());
+}
+
+TEST(ImageWireCodec, RunOneLongerThanMaxLength) {
+    Image img(129, 7);
+    ASSERT_EQ(bytes({-127, 7, 0, 7}), encode(img, img.size()));
+    expectRoundTrip(img, img.size());
+}
+
+TEST(ImageWireCodec, RunTwoLongerThanMaxLength) {
+    Image img(130, 7);
+    ASSERT_EQ(bytes({-127, 7, -1, 7}), encode(img, img.size()));
+    expectRoundTrip(img, img.size());
+}
+
+TEST(ImageWireCodec, LiteralsOfMaxLength) {
+    Image img;
+    for (int i = 0; i < 129; ++i) {
+        img.push_back(static_cast<OSVR_ImageBufferElement>(i));
+    }
+    auto encoded = encode(img, img.size());
+    ASSERT_EQ(img.size() + 2, encoded.size()) << "Two literal packets";
+    ASSERT_EQ(127, encoded[0]);
+    ASSERT_EQ(0, encoded[129]);
+    expectRoundTrip(img, img.size());
+}
+
+TEST(ImageWireCodec, LiteralsNextToRuns) {
+    Image img = {1, 2, 3, 7, 7, 7, 7, 4, 5, 9, 9, 9};
+    ASSERT_EQ(bytes({2, 1, 2, 3, -3, 7, 1, 4, 5, -2, 9}),
+              encode(img, img.size()));
+    expectRoundTrip(img, img.size());
+    /// Runs of two are short enough to stay part of a literal sequence, but
+    /// not at its start.
+    expectRoundTrip({1, 1, 2, 3, 3, 4, 5, 5}, 8);
+    expectRoundTrip({1, 2, 2, 3, 3, 3}, 6);
+}
+
+TEST(ImageWireCodec, OnePixelRows) {
+    expectRoundTrip({42}, 1);
+    expectRoundTrip({0, 255, 255, 3, 250, 5}, 1);
+}
+
+TEST(ImageWireCodec, RowDeltaWrapsAround) {
+    Image img = {250, 251, 252, 5, 6, 7, 250, 251, 252};
+    auto encoded = encode(img, 3);
+    /// Second row differs from the first by 11 throughout, the third by -11.
+    ASSERT_EQ(bytes({2, -6, -5, -4, -2, 11, -2, -11}), encoded);
+    expectRoundTrip(img, 3);
+}
+
+TEST(ImageWireCodec, RandomImagesRoundTrip) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> value(0, 255);
+    std::uniform_int_distribution<int> runLength(1, 200);
+    for (std::size_t rowBytes : {1, 2, 3, 127, 128, 129, 257, 640}) {
+        for (std::size_t rows : {1, 2, 5}) {
+            /// Noise, and runs of random length.
+            Image noise(rowBytes * rows);
+            for (auto &px : noise) {
+                px = static_cast<OSVR_ImageBufferElement>(value(rng));
+            }
+            expectRoundTrip(noise, rowBytes);
+            Image runs;
+            while (runs.size() < rowBytes * rows) {
+                runs.insert(runs.end(), runLength(rng),
+                            static_cast<OSVR_ImageBufferElement>(value(rng)));
+            }
+            runs.resize(rowBytes * rows);
+            expectRoundTrip(runs, rowBytes);
+        }
+    }
+}
+
+TEST(ImageWireCodec, GivesUpAtMaxBytes) {
+    Image img = {1, 2, 3, 7, 7, 7, 7, 4, 5, 9, 9, 9};
+    auto size = encode(img, 6).size();
+    Encoded out;
+    ASSERT_TRUE(encodeRowDeltaRLE(img.data(), 6, 2, size, out));
+    ASSERT_EQ(size, out.size());
+    out.clear();
+    ASSERT_FALSE(encodeRowDeltaRLE(img.data(), 6, 2, size - 1, out));
+    out.clear();
+    ASSERT_FALSE(encodeRowDeltaRLE(img.data(), 6, 2, 0, out));
+}
+
+TEST(ImageWireCodec, GivingUpOnlyCountsWhatItAppended) {
+    Image img(128, 7);
+    Encoded out(1000, 'x');
+    ASSERT_TRUE(encodeRowDeltaRLE(img.data(), img.size(), 1, 2, out));
+    ASSERT_EQ(1002u, out.size());
+}
+
+TEST(ImageWireCodec, RejectsTruncatedData) {
+    Image img = {1, 2, 3, 7, 7, 7, 7, 4, 5, 9, 9, 9};
+    auto encoded = encode(img, 6);
+    Image decoded;
+    while (!encoded.empty()) {
+        encoded.pop_back();
+        ASSERT_FALSE(decode(encoded, 6, 2, decoded))
+            << "Truncated to " << encoded.size() << " bytes";
+    }
+}
+
+TEST(ImageWireCodec, RejectsTrailingData) {
+    Image img(6, 1);
+    auto encoded = encode(img, 3);
+    encoded.push_back(0);
+    Image decoded;
+    ASSERT_FALSE(decode(encoded, 3, 2, decoded));
+}
+
+TEST(ImageWireCodec, RejectsPacketsOverrunningRow) {
+    Image decoded;
+    /// Run of 4 in a 3-byte row
+    ASSERT_FALSE(decode(bytes({-3, 1, -2, 1}), 3, 2, decoded));
+    /// Literal of 4 in a 3-byte row
+    ASSERT_FALSE(decode(bytes({3, 1, 2, 3, 4, 1, 5, 6}), 3, 2, decoded));
+    /// Literal and run together longer than the row
+    ASSERT_FALSE(decode(bytes({1, 1, 2, -1, 3}), 3, 1, decoded));
+}
+
+TEST(ImageWireCodec, RejectsMissingPacketData) {
+    Image decoded;
+    /// Run header without its value
+    ASSERT_FALSE(decode(bytes({-2}), 3, 1, decoded));
+    /// Literal header with too few values
+    ASSERT_FALSE(decode(bytes({2, 1, 2}), 3, 1, decoded));
+    /// Nothing at all
+    ASSERT_FALSE(decode(Encoded(), 3, 1, decoded));
+}
+
+TEST(ImageWireCodec, SkipsNoOpHeader) {
+    Image decoded;
+    ASSERT_TRUE(decode(bytes({-128, -2, 5}), 3, 1, decoded));
+    ASSERT_EQ((Image{5, 5, 5}), decoded);
+}
+
+TEST(ImageWireCodec, SwapTwoByteSamples) {
+    Image img = {1, 2, 3, 4, 5, 6};
+    swapSampleByteOrder(img.data(), img.size(), 2);
+    ASSERT_EQ((Image{2, 1, 4, 3, 6, 5}), img);
+    swapSampleByteOrder(img.data(), img.size(), 2);
+    ASSERT_EQ((Image{1, 2, 3, 4, 5, 6}), img);
+}
+
+TEST(ImageWireCodec, SwapFourByteSamples) {
+    Image img = {1, 2, 3, 4, 5, 6, 7, 8};
+    swapSampleByteOrder(img.data(), img.size(), 4);
+    ASSERT_EQ((Image{4, 3, 2, 1, 8, 7, 6, 5}), img);
+}
+
+TEST(ImageWireCodec, SwapLeavesSingleBytesAndPartialSamples) {
+    Image img = {1, 2, 3, 4, 5};
+    swapSampleByteOrder(img.data(), img.size(), 1);
+    ASSERT_EQ((Image{1, 2, 3, 4, 5}), img);
+    swapSampleByteOrder(img.data(), img.size(), 2);
+    ASSERT_EQ((Image{2, 1, 4, 3, 5}), img);
+}
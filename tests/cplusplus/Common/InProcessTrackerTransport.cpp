@@ -0,0 +1,157 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Common/InProcessTrackerTransport.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <vector>
+
+using osvr::common::InProcessTrackerSubscriber;
+using osvr::common::InProcessTrackerSubscription;
+using osvr::common::InProcessTrackerTransport;
+
+static const char DEVICE[] = "com_osvr_Test/Tracker";
+
+/// @brief Records the sensor of each pose report received.
+struct PoseRecorder {
+    static void VRPN_CALLBACK handle(void *userdata,
+                                     const vrpn_TRACKERCB info) {
+        static_cast<PoseRecorder *>(userdata)->sensors.push_back(info.sensor);
+    }
+    std::vector<int> sensors;
+};
+
+static vrpn_TRACKERCB makePose(int sensor) {
+    vrpn_TRACKERCB ret = {};
+    ret.sensor = sensor;
+    return ret;
+}
+
+class InProcessTrackerTransportTest : public ::testing::Test {
+  public:
+    InProcessTrackerTransportTest()
+        : transport(osvr::make_shared<InProcessTrackerTransport>()),
+          device(transport->getDevice(DEVICE)) {}
+    osvr::common::InProcessTrackerTransportPtr transport;
+    InProcessTrackerTransport::DevicePtr device;
+};
+
+TEST_F(InProcessTrackerTransportTest, QueuedUntilDelivered) {
+    InProcessTrackerSubscriber subscriber(transport);
+    PoseRecorder recorder;
+    subscriber.subscribe(DEVICE)->registerHandler(&recorder,
+                                                  &PoseRecorder::handle);
+    device->send(makePose(0));
+    device->send(makePose(1));
+    ASSERT_TRUE(recorder.sensors.empty());
+    subscriber.deliverQueued();
+    ASSERT_EQ((std::vector<int>{0, 1}), recorder.sensors);
+    subscriber.deliverQueued();
+    ASSERT_EQ(2u, recorder.sensors.size()) << "Each report delivered once";
+}
+
+TEST_F(InProcessTrackerTransportTest, SensorFilter) {
+    InProcessTrackerSubscriber subscriber(transport);
+    PoseRecorder recorder;
+    subscriber.subscribe(DEVICE)->registerHandler(&recorder,
+                                                  &PoseRecorder::handle, 1);
+    device->send(makePose(0));
+    device->send(makePose(1));
+    subscriber.deliverQueued();
+    ASSERT_EQ((std::vector<int>{1}), recorder.sensors);
+}
+
+TEST_F(InProcessTrackerTransportTest, EachSubscriberDeliversOnlyItsOwn) {
+    InProcessTrackerSubscriber first(transport);
+    InProcessTrackerSubscriber second(transport);
+    PoseRecorder firstRecorder;
+    PoseRecorder secondRecorder;
+    first.subscribe(DEVICE)->registerHandler(&firstRecorder,
+                                             &PoseRecorder::handle);
+    second.subscribe(DEVICE)->registerHandler(&secondRecorder,
+                                              &PoseRecorder::handle);
+    device->send(makePose(0));
+
+    first.deliverQueued();
+    ASSERT_EQ(1u, firstRecorder.sensors.size());
+    ASSERT_TRUE(secondRecorder.sensors.empty())
+        << "Another context's handlers must wait for its own update";
+
+    second.deliverQueued();
+    ASSERT_EQ(1u, firstRecorder.sensors.size());
+    ASSERT_EQ(1u, secondRecorder.sensors.size());
+}
+
+TEST_F(InProcessTrackerTransportTest, SubscribeTwiceSharesQueue) {
+    InProcessTrackerSubscriber subscriber(transport);
+    ASSERT_EQ(subscriber.subscribe(DEVICE), subscriber.subscribe(DEVICE));
+    ASSERT_NE(subscriber.subscribe(DEVICE),
+              subscriber.subscribe("com_osvr_Test/Other"));
+}
+
+TEST_F(InProcessTrackerTransportTest, DropsOldestWhenFull) {
+    InProcessTrackerSubscriber subscriber(transport);
+    PoseRecorder recorder;
+    subscriber.subscribe(DEVICE)->registerHandler(&recorder,
+                                                  &PoseRecorder::handle);
+    const int maxQueued =
+        static_cast<int>(InProcessTrackerSubscription::MAX_QUEUED);
+    const int extra = 5;
+    for (int i = 0; i < maxQueued + extra; ++i) {
+        device->send(makePose(i));
+    }
+    ASSERT_EQ(uint64_t(extra), subscriber.getDroppedCount());
+    subscriber.deliverQueued();
+    ASSERT_EQ(std::size_t(maxQueued), recorder.sensors.size());
+    ASSERT_EQ(extra, recorder.sensors.front()) << "Oldest reports dropped";
+    ASSERT_EQ(maxQueued + extra - 1, recorder.sensors.back());
+
+    device->send(makePose(0));
+    subscriber.deliverQueued();
+    ASSERT_EQ(uint64_t(extra), subscriber.getDroppedCount())
+        << "Drops are counted, not reset, once there's room again";
+}
+
+TEST_F(InProcessTrackerTransportTest, UnsubscribedWhenReleased) {
+    PoseRecorder recorder;
+    {
+        InProcessTrackerSubscriber subscriber(transport);
+        subscriber.subscribe(DEVICE)->registerHandler(&recorder,
+                                                      &PoseRecorder::handle);
+    }
+    /// Nobody left to queue for.
+    device->send(makePose(0));
+
+    InProcessTrackerSubscriber later(transport);
+    later.subscribe(DEVICE)->registerHandler(&recorder,
+                                             &PoseRecorder::handle);
+    later.deliverQueued();
+    ASSERT_TRUE(recorder.sensors.empty())
+        << "Reports sent before subscribing are not delivered";
+}
@@ -0,0 +1,276 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// Internal Includes
+#include <osvr/Common/MulticastReports.h>
+#include <osvr/Common/Buffer.h>
+#include <osvr/Common/FixedLayoutSerialization.h>
+#include <osvr/Common/Serialization.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using osvr::common::FixedMessageBuffer;
+using osvr::common::FixedMessageSize;
+using osvr::common::MulticastReportDirectory;
+using osvr::common::MulticastReportPacket;
+using osvr::common::MulticastReportPublisher;
+using osvr::common::MulticastReportReceiver;
+using osvr::common::SharedMemoryReport;
+using osvr::common::SharedMemoryReportType;
+
+/// @brief Not the default group or port, so as not to pick up (or disturb) a
+/// running server.
+static const char TEST_GROUP[] = "239.255.0.84";
+static const uint16_t TEST_PORT = 3891;
+static const uint64_t TEST_SENDER = 0x1234;
+
+static MulticastReportDirectory makeDirectory() {
+    MulticastReportDirectory ret;
+    ret.group = TEST_GROUP;
+    ret.port = TEST_PORT;
+    ret.sender = TEST_SENDER;
+    ret.streams["com_osvr_Test/Tracker"] = 0;
+    ret.streams["com_osvr_Test/Other"] = 1;
+    return ret;
+}
+
+/// @brief A serialized packet whose report is marked with its sequence
+/// number.
+static FixedMessageBuffer<MulticastReportPacket>
+makeDatagram(uint32_t sequence, uint32_t stream = 0,
+             uint64_t sender = TEST_SENDER) {
+    MulticastReportPacket packet;
+    packet.sender = sender;
+    packet.stream = stream;
+    packet.sequence = sequence;
+    packet.report.type = SharedMemoryReportType::Button;
+    packet.report.sensor = static_cast<int32_t>(sequence);
+    FixedMessageBuffer<MulticastReportPacket> ret;
+    osvr::common::serialize(ret, packet);
+    return ret;
+}
+
+template <typename BufferType>
+static void deliver(MulticastReportReceiver &receiver, BufferType const &buf) {
+    receiver.handleDatagram(buf.data(), buf.size());
+}
+
+TEST(MulticastReports, PacketRoundTrip) {
+    MulticastReportPacket packet;
+    packet.sender = 0x0102030405060708ULL;
+    packet.stream = 3;
+    packet.sequence = 0xfffffffe;
+    packet.report.type = SharedMemoryReportType::Velocity;
+    packet.report.sensor = -2;
+    packet.report.seconds = 1234567890123LL;
+    packet.report.microseconds = 999999;
+    for (int i = 0; i < 8; ++i) {
+        packet.report.data[i] = i * 0.5 - 1;
+    }
+    FixedMessageBuffer<MulticastReportPacket> buf;
+    osvr::common::serialize(buf, packet);
+    ASSERT_EQ(FixedMessageSize<MulticastReportPacket>::value, buf.size());
+
+    MulticastReportPacket out;
+    auto reader = osvr::common::readExternalBuffer(buf.data(), buf.size());
+    osvr::common::deserialize(reader, out);
+    ASSERT_EQ(MulticastReportPacket::MAGIC, out.magic);
+    ASSERT_EQ(MulticastReportPacket::VERSION, out.version);
+    ASSERT_EQ(packet.sender, out.sender);
+    ASSERT_EQ(packet.stream, out.stream);
+    ASSERT_EQ(packet.sequence, out.sequence);
+    ASSERT_EQ(packet.report.type, out.report.type);
+    ASSERT_EQ(packet.report.sensor, out.report.sensor);
+    ASSERT_EQ(packet.report.seconds, out.report.seconds);
+    ASSERT_EQ(packet.report.microseconds, out.report.microseconds);
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_EQ(packet.report.data[i], out.report.data[i]);
+    }
+}
+
+class MulticastReceiver : public ::testing::Test {
+  public:
+    void SetUp() override {
+        receiver = MulticastReportReceiver::create(makeDirectory());
+    }
+    osvr::common::MulticastReportReceiverPtr receiver;
+};
+
+/// Sockets may be unavailable in some build environments: nothing else to
+/// test then.
+#define SKIP_WITHOUT_RECEIVER()                                                \
+    if (!receiver) {                                                           \
+        std::cout << "Could not open a multicast receiver: skipping."          \
+                  << std::endl;                                                \
+        return;                                                                \
+    }
+
+TEST_F(MulticastReceiver, SubscribeUnlisted) {
+    SKIP_WITHOUT_RECEIVER();
+    ASSERT_EQ(nullptr, receiver->subscribe("com_osvr_Test/Missing"));
+    auto source = receiver->subscribe("com_osvr_Test/Tracker");
+    ASSERT_NE(nullptr, source);
+    ASSERT_FALSE(source->requiresInterest());
+}
+
+TEST_F(MulticastReceiver, LossAccounting) {
+    SKIP_WITHOUT_RECEIVER();
+    auto source = receiver->subscribe("com_osvr_Test/Tracker");
+    for (uint32_t seq : {1, 2, 5, 3, 6}) {
+        deliver(*receiver, makeDatagram(seq));
+    }
+    auto stats = receiver->getStats("com_osvr_Test/Tracker");
+    ASSERT_EQ(4, stats.received);
+    ASSERT_EQ(2, stats.lost);
+    ASSERT_EQ(1, stats.late);
+    ASSERT_EQ(0, stats.overflowed);
+
+    SharedMemoryReport report;
+    for (int32_t expected : {1, 2, 5, 6}) {
+        ASSERT_TRUE(source->read(report));
+        ASSERT_EQ(expected, report.sensor);
+    }
+    ASSERT_FALSE(source->read(report));
+}
+
+TEST_F(MulticastReceiver, SequenceWrapAround) {
+    SKIP_WITHOUT_RECEIVER();
+    auto source = receiver->subscribe("com_osvr_Test/Tracker");
+    for (uint32_t seq : {0xfffffffeu, 0xffffffffu, 1u}) {
+        deliver(*receiver, makeDatagram(seq));
+    }
+    auto stats = receiver->getStats();
+    ASSERT_EQ(3, stats.received);
+    ASSERT_EQ(1, stats.lost);
+    ASSERT_EQ(0, stats.late);
+}
+
+TEST_F(MulticastReceiver, IgnoresOthers) {
+    SKIP_WITHOUT_RECEIVER();
+    auto source = receiver->subscribe("com_osvr_Test/Tracker");
+    deliver(*receiver, makeDatagram(1, 0, TEST_SENDER + 1));
+    auto truncated = makeDatagram(1);
+    receiver->handleDatagram(truncated.data(), truncated.size() - 1);
+    auto valid = makeDatagram(1);
+    std::vector<char> corrupt(valid.data(), valid.data() + valid.size());
+    corrupt[0] ^= 0x7f;
+    deliver(*receiver, corrupt);
+    ASSERT_EQ(3, receiver->getIgnoredCount());
+
+    /// Valid, but for a stream nobody subscribed to.
+    deliver(*receiver, makeDatagram(1, 1));
+    ASSERT_EQ(3, receiver->getIgnoredCount());
+
+    SharedMemoryReport report;
+    ASSERT_FALSE(source->read(report));
+    ASSERT_EQ(0, receiver->getStats().received);
+}
+
+TEST_F(MulticastReceiver, Overflow) {
+    SKIP_WITHOUT_RECEIVER();
+    auto source = receiver->subscribe("com_osvr_Test/Tracker");
+    auto extra = 5;
+    for (uint32_t seq = 1; seq <= MulticastReportReceiver::MAX_QUEUED + extra;
+         ++seq) {
+        deliver(*receiver, makeDatagram(seq));
+    }
+    ASSERT_EQ(extra, receiver->getStats().overflowed);
+    SharedMemoryReport report;
+    ASSERT_TRUE(source->read(report));
+    ASSERT_EQ(1 + extra, report.sensor);
+}
+
+TEST_F(MulticastReceiver, EverySubscriberGetsEachReport) {
+    SKIP_WITHOUT_RECEIVER();
+    auto a = receiver->subscribe("com_osvr_Test/Tracker");
+    auto b = receiver->subscribe("com_osvr_Test/Tracker");
+    deliver(*receiver, makeDatagram(1));
+    SharedMemoryReport report;
+    ASSERT_TRUE(a->read(report));
+    ASSERT_TRUE(b->read(report));
+    b.reset();
+    deliver(*receiver, makeDatagram(2));
+    ASSERT_TRUE(a->read(report));
+    ASSERT_EQ(2, report.sensor);
+}
+
+TEST(MulticastReports, Loopback) {
+    osvr::common::MulticastReportPublisherPtr publisher;
+    /// A TTL of 0 keeps the datagrams on this machine.
+    try {
+        publisher = MulticastReportPublisher::create(TEST_GROUP, TEST_PORT, 0,
+                                                     "127.0.0.1");
+    } catch (std::runtime_error &e) {
+        std::cout << "Could not open a multicast publisher, skipping: "
+                  << e.what() << std::endl;
+        return;
+    }
+    auto stream = publisher->getStream("com_osvr_Test/Tracker");
+    auto receiver = MulticastReportReceiver::create(publisher->getDirectory(),
+                                                    "127.0.0.1");
+    if (!receiver) {
+        std::cout << "Could not open a multicast receiver: skipping."
+                  << std::endl;
+        return;
+    }
+    auto source = receiver->subscribe("com_osvr_Test/Tracker");
+    ASSERT_NE(nullptr, source);
+
+    static const int COUNT = 10;
+    for (int i = 0; i < COUNT; ++i) {
+        SharedMemoryReport report = {};
+        report.type = SharedMemoryReportType::Pose;
+        report.sensor = i;
+        report.data[6] = 1;
+        stream->send(report);
+    }
+
+    int received = 0;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    SharedMemoryReport report;
+    while (received < COUNT && std::chrono::steady_clock::now() < deadline) {
+        if (source->read(report)) {
+            ASSERT_EQ(received, report.sensor);
+            ASSERT_EQ(SharedMemoryReportType::Pose, report.type);
+            ++received;
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    if (received == 0 && publisher->getSendFailures() == COUNT) {
+        std::cout << "Multicast not routable over loopback here: skipping."
+                  << std::endl;
+        return;
+    }
+    ASSERT_EQ(COUNT, received);
+    ASSERT_EQ(0, receiver->getStats().lost);
+}
@@ -91,4 +91,57 @@ TEST_F(PathTreeResolution, BackCompatRoute) {
 
     setAlias(val.toStyledString());
     checkResolution();
-}
\ No newline at end of file
+}
+
+TEST_F(PathTreeResolution, CachedMatchesUncached) {
+    dummy::setupRawAlias(tree);
+    common::PathResolutionCache cache;
+    auto cached = common::resolveTreeNode(tree, dummy::getAlias(), cache);
+    ASSERT_TRUE(cached.is_initialized());
+    ASSERT_EQ(2u, cache.size()) << "Should hold the alias and its target";
+    checkResolution();
+    ASSERT_EQ(cached->getDevicePath(), source.getDevicePath());
+    ASSERT_EQ(cached->getInterfaceName(), source.getInterfaceName());
+    ASSERT_EQ(*cached->getSensorNumber(), *source.getSensorNumber());
+
+    auto again = common::resolveTreeNode(tree, dummy::getAlias(), cache);
+    ASSERT_TRUE(again.is_initialized());
+    ASSERT_EQ(2u, cache.size());
+}
+
+TEST_F(PathTreeResolution, CachedAliasChainTransform) {
+    Json::Value transform(Json::objectValue);
+    transform["rotate"]["axis"] = "x";
+    transform["rotate"]["degrees"] = 90;
+    transform["child"] = getFullSourcePath();
+    tree.getNodeByPath("/me/inner",
+                       common::elements::AliasElement(
+                           transform.toStyledString()));
+    setAlias("/me/inner");
+
+    auto expected = common::resolveTreeNode(tree, dummy::getAlias());
+    ASSERT_TRUE(expected.is_initialized());
+    ASSERT_TRUE(expected->hasTransform());
+
+    common::PathResolutionCache cache;
+    auto cached = common::resolveTreeNode(tree, dummy::getAlias(), cache);
+    ASSERT_TRUE(cached.is_initialized());
+    ASSERT_EQ(expected->getTransformJson(), cached->getTransformJson());
+    ASSERT_EQ(expected->getInterfaceName(), cached->getInterfaceName());
+}
+
+TEST_F(PathTreeResolution, CacheInvalidatedByReset) {
+    dummy::setupRawAlias(tree);
+    common::PathResolutionCache cache;
+    auto version = tree.getVersion();
+    ASSERT_TRUE(
+        common::resolveTreeNode(tree, dummy::getAlias(), cache)
+            .is_initialized());
+
+    tree.reset();
+    ASSERT_NE(version, tree.getVersion());
+    ASSERT_FALSE(
+        common::resolveTreeNode(tree, dummy::getAlias(), cache)
+            .is_initialized());
+    ASSERT_EQ(1u, cache.size()) << "Old results should have been dropped";
+}
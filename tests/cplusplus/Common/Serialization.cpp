@@ -27,12 +27,14 @@
 #include <osvr/Common/Serialization.h>
 #include <osvr/Common/Buffer.h>
 #include <osvr/Common/BufferTraits.h>
+#include <osvr/Common/FixedLayoutSerialization.h>
 #include <osvr/Util/StdInt.h>
 
 // Library/third-party includes
 #include "gtest/gtest.h"
 
 // Standard includes
+#include <algorithm>
 #include <string>
 #include <type_traits>
 
@@ -364,3 +366,97 @@ TEST(Serialization, SelfDescriptive) {
         ASSERT_EQ(data.c, 3);
     }
 }
+
+class MyFixedClass {
+  public:
+    MyFixedClass() : a(0), c(0) { v.data[0] = v.data[1] = 0; }
+    typedef osvr::common::serialization::FixedLayout<int8_t, OSVR_Vec2,
+                                                     uint16_t> fixed_layout;
+    template <typename T> void processMessage(T &process) {
+        process(a);
+        process(v);
+        process(c);
+    }
+    int8_t a;
+    OSVR_Vec2 v;
+    uint16_t c;
+};
+
+TEST(FixedLayoutSerialization, CompileTimeLayout) {
+    using namespace osvr::common::serialization;
+    typedef MyFixedClass::fixed_layout Layout;
+    ASSERT_EQ((FixedLayoutField<Layout, 0>::offset), 0);
+    ASSERT_EQ((FixedLayoutField<Layout, 1>::offset), 1)
+        << "Offsets are recorded before alignment padding";
+    ASSERT_EQ((FixedLayoutField<Layout, 2>::offset), 24);
+    ASSERT_EQ(osvr::common::FixedMessageSize<MyFixedClass>::value, 26);
+
+    MyFixedClass data;
+    Buffer<> buf;
+    osvr::common::serialize(buf, data);
+    ASSERT_EQ(buf.size(), osvr::common::FixedMessageSize<MyFixedClass>::value)
+        << "Compile-time size should match the runtime serialization";
+}
+
+TEST(FixedLayoutSerialization, FixedBufferRoundTrip) {
+    osvr::common::FixedMessageBuffer<MyFixedClass> buf;
+    {
+        MyFixedClass data;
+        data.a = -1;
+        data.v.data[0] = 1.5;
+        data.v.data[1] = -2.5;
+        data.c = 3;
+        osvr::common::serialize(buf, data);
+    }
+    ASSERT_EQ(buf.size(), 26);
+
+    Buffer<> vecBuf;
+    {
+        MyFixedClass data;
+        data.a = -1;
+        data.v.data[0] = 1.5;
+        data.v.data[1] = -2.5;
+        data.c = 3;
+        osvr::common::serialize(vecBuf, data);
+    }
+    ASSERT_TRUE(std::equal(vecBuf.data(), vecBuf.data() + vecBuf.size(),
+                           buf.data()))
+        << "Fixed buffer should contain the same bytes as a regular buffer";
+
+    {
+        MyFixedClass data;
+        auto reader = buf.startReading();
+        osvr::common::deserialize(reader, data);
+        ASSERT_EQ(data.a, -1);
+        ASSERT_EQ(data.v.data[0], 1.5);
+        ASSERT_EQ(data.v.data[1], -2.5);
+        ASSERT_EQ(data.c, 3);
+    }
+
+    ASSERT_THROW(osvr::common::serialization::serializeRaw(buf, int8_t(0)),
+                 std::runtime_error)
+        << "Fixed buffer should not grow past its capacity";
+}
+
+TEST(FixedLayoutSerialization, View) {
+    Buffer<> buf;
+    {
+        MyFixedClass data;
+        data.a = 5;
+        data.v.data[0] = 1.5;
+        data.v.data[1] = -2.5;
+        data.c = 300;
+        osvr::common::serialize(buf, data);
+    }
+    auto view =
+        osvr::common::viewFixedMessage<MyFixedClass>(buf.data(), buf.size());
+    ASSERT_EQ(view.get<0>(), 5);
+    auto v = view.get<1>();
+    ASSERT_EQ(v.data[0], 1.5);
+    ASSERT_EQ(v.data[1], -2.5);
+    ASSERT_EQ(view.get<2>(), 300);
+
+    ASSERT_THROW(osvr::common::viewFixedMessage<MyFixedClass>(
+                     buf.data(), buf.size() - 1),
+                 std::runtime_error);
+}
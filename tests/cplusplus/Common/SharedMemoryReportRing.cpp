@@ -0,0 +1,166 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// Internal Includes
+#include <osvr/Common/SharedMemoryReportRing.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <sstream>
+#include <thread>
+
+using osvr::common::SharedMemoryReport;
+using osvr::common::SharedMemoryReportRing;
+using osvr::common::SharedMemoryReportType;
+
+static std::string getRingName(const char *test) {
+    std::ostringstream os;
+    os << "OSVRTestReportRing_" << test << "_"
+       << std::hash<std::thread::id>()(std::this_thread::get_id());
+    return os.str();
+}
+
+/// @brief A report whose every field is derived from n, so a torn read would
+/// show.
+static SharedMemoryReport makeReport(int n) {
+    SharedMemoryReport ret = {};
+    ret.type = SharedMemoryReportType::Analog;
+    ret.sensor = n;
+    ret.seconds = n;
+    ret.microseconds = n % 1000000;
+    for (auto &d : ret.data) {
+        d = n;
+    }
+    return ret;
+}
+
+static bool isConsistent(SharedMemoryReport const &report) {
+    auto n = report.sensor;
+    for (auto d : report.data) {
+        if (d != n) {
+            return false;
+        }
+    }
+    return report.type == SharedMemoryReportType::Analog &&
+           report.seconds == n && report.microseconds == n % 1000000;
+}
+
+TEST(SharedMemoryReportRing, OpenMissing) {
+    ASSERT_EQ(nullptr, SharedMemoryReportRing::open(getRingName("Missing")));
+}
+
+TEST(SharedMemoryReportRing, RoundTrip) {
+    auto name = getRingName("RoundTrip");
+    auto writer = SharedMemoryReportRing::create(name, 8);
+    ASSERT_NE(nullptr, writer);
+    writer->put(makeReport(100));
+
+    auto ring = SharedMemoryReportRing::open(name);
+    ASSERT_NE(nullptr, ring);
+    ASSERT_EQ(8u, ring->getCapacity());
+    SharedMemoryReportRing::Reader reader(ring);
+    SharedMemoryReport report;
+    ASSERT_FALSE(reader.read(report))
+        << "Readers should start at the next record written";
+
+    for (int i = 0; i < 5; ++i) {
+        writer->put(makeReport(i));
+    }
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(reader.read(report));
+        ASSERT_EQ(i, report.sensor);
+        ASSERT_TRUE(isConsistent(report));
+    }
+    ASSERT_FALSE(reader.read(report));
+    ASSERT_EQ(0u, reader.getDroppedCount());
+}
+
+TEST(SharedMemoryReportRing, Overrun) {
+    auto name = getRingName("Overrun");
+    auto writer = SharedMemoryReportRing::create(name, 4);
+    ASSERT_NE(nullptr, writer);
+    SharedMemoryReportRing::Reader reader(SharedMemoryReportRing::open(name));
+    for (int i = 0; i < 10; ++i) {
+        writer->put(makeReport(i));
+    }
+    SharedMemoryReport report;
+    for (int i = 6; i < 10; ++i) {
+        ASSERT_TRUE(reader.read(report));
+        ASSERT_EQ(i, report.sensor);
+    }
+    ASSERT_FALSE(reader.read(report));
+    ASSERT_EQ(6u, reader.getDroppedCount());
+}
+
+TEST(SharedMemoryReportRing, ConcurrentReadersNeverSeeTornRecords) {
+    auto name = getRingName("Concurrent");
+    auto writer = SharedMemoryReportRing::create(name, 16);
+    ASSERT_NE(nullptr, writer);
+    static const int RECORDS = 200000;
+    std::atomic<bool> done(false);
+    std::atomic<int> problems(0);
+
+    auto readLoop = [&] {
+        SharedMemoryReportRing::Reader reader(
+            SharedMemoryReportRing::open(name));
+        SharedMemoryReport report;
+        int last = -1;
+        int received = 0;
+        auto check = [&] {
+            if (!isConsistent(report) || report.sensor <= last) {
+                ++problems;
+            }
+            last = report.sensor;
+            ++received;
+        };
+        while (!done) {
+            while (reader.read(report)) {
+                check();
+            }
+        }
+        while (reader.read(report)) {
+            check();
+        }
+        if (uint64_t(received) + reader.getDroppedCount() !=
+            uint64_t(RECORDS)) {
+            ++problems;
+        }
+    };
+    std::thread readers[] = {std::thread(readLoop), std::thread(readLoop)};
+    /// Let the readers get their start position before writing anything.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    for (int i = 0; i < RECORDS; ++i) {
+        writer->put(makeReport(i));
+    }
+    done = true;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    ASSERT_EQ(0, problems);
+}
@@ -0,0 +1,136 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// Internal Includes
+#include <osvr/Connection/DeviceUpdateScheduler.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using osvr::connection::DeviceUpdateScheduler;
+using osvr::connection::DeviceUpdateTaskPtr;
+
+inline void pleaseSleep(int milliseconds) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(milliseconds));
+}
+
+TEST(DeviceUpdateScheduler, InlineRunsOnCallingThread) {
+    auto scheduler = DeviceUpdateScheduler::createInline();
+    ASSERT_FALSE(scheduler->isThreaded());
+    std::thread::id ranOn;
+    auto task = scheduler->addDevice(
+        "inline", [&] { ranOn = std::this_thread::get_id(); });
+    ASSERT_FALSE(task->isThreaded());
+    ASSERT_TRUE(task->requestUpdate());
+    ASSERT_EQ(std::this_thread::get_id(), ranOn);
+
+    auto stats = scheduler->getStats();
+    ASSERT_EQ(1, stats.size());
+    ASSERT_EQ("inline", stats[0].name);
+    ASSERT_EQ(1, stats[0].updates);
+    ASSERT_EQ(0, stats[0].skipped);
+}
+
+TEST(DeviceUpdateScheduler, SlowDeviceDoesNotDelayOthers) {
+    auto scheduler = DeviceUpdateScheduler::createPerDevice();
+    ASSERT_TRUE(scheduler->isThreaded());
+    std::atomic<int> fastUpdates(0);
+    std::atomic<bool> releaseSlow(false);
+    auto slow = scheduler->addDevice("slow", [&] {
+        while (!releaseSlow) {
+            pleaseSleep(1);
+        }
+    });
+    auto fast = scheduler->addDevice("fast", [&] { ++fastUpdates; });
+
+    ASSERT_TRUE(slow->requestUpdate());
+    for (int i = 0; i < 100; ++i) {
+        fast->requestUpdate();
+        pleaseSleep(1);
+    }
+    ASSERT_FALSE(slow->requestUpdate()) << "Previous update still running";
+    ASSERT_GT(fastUpdates, 0);
+
+    releaseSlow = true;
+    slow->cancel();
+    fast->cancel();
+    ASSERT_FALSE(fast->requestUpdate()) << "Cancelled";
+
+    auto slowStats = slow->getStats();
+    ASSERT_EQ(1, slowStats.updates);
+    ASSERT_EQ(1, slowStats.skipped);
+    ASSERT_GT(slowStats.maxMicroseconds, 0);
+    ASSERT_EQ(fastUpdates, fast->getStats().updates);
+}
+
+TEST(DeviceUpdateScheduler, PoolNeverRunsOneDeviceConcurrently) {
+    auto scheduler = DeviceUpdateScheduler::createPool(4);
+    std::atomic<int> running(0);
+    std::atomic<bool> overlapped(false);
+    std::atomic<int> updates(0);
+    auto task = scheduler->addDevice("device", [&] {
+        if (++running > 1) {
+            overlapped = true;
+        }
+        std::this_thread::yield();
+        --running;
+        ++updates;
+    });
+    for (int i = 0; i < 10000; ++i) {
+        task->requestUpdate();
+    }
+    task->cancel();
+    ASSERT_FALSE(overlapped);
+    auto stats = task->getStats();
+    ASSERT_EQ(updates, stats.updates);
+    /// The last request may still have been queued when cancelled.
+    ASSERT_LE(stats.updates + stats.skipped, 10000);
+    ASSERT_GE(stats.updates + stats.skipped, 9999);
+}
+
+TEST(DeviceUpdateScheduler, DestroyWithPendingUpdates) {
+    DeviceUpdateTaskPtr task;
+    {
+        auto scheduler = DeviceUpdateScheduler::createPool(1);
+        std::atomic<bool> release(false);
+        auto blocker = scheduler->addDevice("blocker", [&] {
+            while (!release) {
+                pleaseSleep(1);
+            }
+        });
+        task = scheduler->addDevice("pending", [] {});
+        blocker->requestUpdate();
+        task->requestUpdate();
+        release = true;
+    }
+    /// Scheduler is gone: the task can be cancelled, and asking for updates
+    /// just fails.
+    task->cancel();
+    ASSERT_FALSE(task->requestUpdate());
+}
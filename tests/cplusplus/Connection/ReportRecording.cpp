@@ -0,0 +1,369 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Connection/Connection.h>
+#include <osvr/Connection/DeviceInitObject.h>
+#include <osvr/Connection/DeviceToken.h>
+#include <osvr/Connection/ReportRecording.h>
+#include <osvr/Connection/ReportReplayer.h>
+#include <osvr/Connection/TrackerServerInterface.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+#include <vrpn_Connection.h>
+#include <vrpn_Tracker.h>
+
+// Standard includes
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+using osvr::connection::Connection;
+using osvr::connection::DeviceInitObject;
+using osvr::connection::DeviceToken;
+using osvr::connection::RecordedEntry;
+using osvr::connection::ReportRecorder;
+using osvr::connection::ReportRecordingReader;
+using osvr::connection::ReportReplayer;
+using osvr::connection::TrackerServerInterface;
+using osvr::util::time::TimeValue;
+
+static const char FILENAME[] = "ReportRecordingTest.osvrrec";
+
+inline TimeValue makeTime(int64_t seconds, int32_t microseconds) {
+    TimeValue ret;
+    ret.seconds = seconds;
+    ret.microseconds = microseconds;
+    return ret;
+}
+
+inline int64_t toMicroseconds(TimeValue const &tv) {
+    return tv.seconds * 1000000 + tv.microseconds;
+}
+
+inline TimeValue fromMicroseconds(int64_t us) {
+    return makeTime(us / 1000000, static_cast<int32_t>(us % 1000000));
+}
+
+class ReportRecording : public ::testing::Test {
+  public:
+    ReportRecording()
+        : devA("com_osvr_Test/A"), devB("com_osvr_Test/B"),
+          typeX("com.osvr.X"), typeY("com.osvr.Y") {}
+    ~ReportRecording() { std::remove(FILENAME); }
+
+    /// @brief Records `count` single-byte messages, spaced out if
+    /// `sleepMilliseconds` is nonzero.
+    void recordMessages(int count, int sleepMilliseconds = 0) {
+        auto recorder = ReportRecorder::create(FILENAME);
+        recorder->recordDescriptor(devA, "{}");
+        for (int i = 0; i < count; ++i) {
+            if (i > 0 && sleepMilliseconds > 0) {
+                std::this_thread::sleep_for(
+                    std::chrono::milliseconds(sleepMilliseconds));
+            }
+            char data = static_cast<char>(i);
+            recorder->recordMessage(devA, typeX, makeTime(100, i), &data, 1);
+        }
+    }
+
+    /// @brief Reads back the times the descriptor and messages were
+    /// recorded as sent.
+    std::vector<int64_t> readSentTimes() {
+        ReportRecordingReader reader(FILENAME);
+        std::vector<int64_t> ret;
+        RecordedEntry entry;
+        while (reader.read(entry)) {
+            if (entry.kind != RecordedEntry::Kind::Stream) {
+                ret.push_back(toMicroseconds(entry.sent));
+            }
+        }
+        return ret;
+    }
+
+    std::string devA;
+    std::string devB;
+    std::string typeX;
+    std::string typeY;
+};
+
+TEST_F(ReportRecording, RoundTrip) {
+    {
+        auto recorder = ReportRecorder::create(FILENAME);
+        recorder->recordDescriptor(devA, "{\"interfaces\":{}}");
+        std::string payload("\x01\x00\x02", 3);
+        recorder->recordMessage(devA, typeX, makeTime(10, 20), payload.data(),
+                                payload.size());
+        recorder->recordMessage(devA, typeX, makeTime(11, 21), nullptr, 0);
+        recorder->recordMessage(devB, typeY, makeTime(12, 22), "b", 1);
+        recorder->recordMessage(devA, typeY, makeTime(13, 23), "c", 1);
+        ASSERT_EQ(4, recorder->getMessageCount());
+        ASSERT_FALSE(recorder->hasFailed());
+    }
+
+    ReportRecordingReader reader(FILENAME);
+    RecordedEntry entry;
+    ASSERT_TRUE(reader.read(entry));
+    ASSERT_EQ(RecordedEntry::Kind::Descriptor, entry.kind);
+    ASSERT_EQ("com_osvr_Test/A", entry.device);
+    ASSERT_EQ("{\"interfaces\":{}}", entry.data);
+
+    ASSERT_TRUE(reader.read(entry));
+    ASSERT_EQ(RecordedEntry::Kind::Stream, entry.kind);
+    ASSERT_EQ(0, entry.stream);
+    ASSERT_EQ("com_osvr_Test/A", entry.device);
+    ASSERT_EQ("com.osvr.X", entry.messageType);
+
+    ASSERT_TRUE(reader.read(entry));
+    ASSERT_EQ(RecordedEntry::Kind::Message, entry.kind);
+    ASSERT_EQ(0, entry.stream);
+    ASSERT_EQ(10, entry.timestamp.seconds);
+    ASSERT_EQ(20, entry.timestamp.microseconds);
+    ASSERT_EQ(std::string("\x01\x00\x02", 3), entry.data);
+    auto firstSent = toMicroseconds(entry.sent);
+
+    ASSERT_TRUE(reader.read(entry));
+    ASSERT_EQ(RecordedEntry::Kind::Message, entry.kind);
+    ASSERT_EQ(0, entry.stream);
+    ASSERT_EQ(11, entry.timestamp.seconds);
+    ASSERT_TRUE(entry.data.empty());
+    ASSERT_GE(toMicroseconds(entry.sent), firstSent);
+
+    ASSERT_TRUE(reader.read(entry));
+    ASSERT_EQ(RecordedEntry::Kind::Stream, entry.kind);
+    ASSERT_EQ(1, entry.stream);
+    ASSERT_EQ("com_osvr_Test/B", entry.device);
+    ASSERT_EQ("com.osvr.Y", entry.messageType);
+    ASSERT_TRUE(reader.read(entry));
+    ASSERT_EQ(1, entry.stream);
+    ASSERT_EQ("b", entry.data);
+
+    ASSERT_TRUE(reader.read(entry));
+    ASSERT_EQ(RecordedEntry::Kind::Stream, entry.kind);
+    ASSERT_EQ(2, entry.stream);
+    ASSERT_TRUE(reader.read(entry));
+    ASSERT_EQ(2, entry.stream);
+    ASSERT_EQ("c", entry.data);
+
+    ASSERT_FALSE(reader.read(entry));
+
+    reader.rewind();
+    ASSERT_TRUE(reader.read(entry));
+    ASSERT_EQ(RecordedEntry::Kind::Descriptor, entry.kind);
+}
+
+TEST_F(ReportRecording, RejectsOtherFiles) {
+    {
+        std::ofstream file(FILENAME, std::ios::binary);
+        file << "This is not a recording";
+    }
+    ASSERT_THROW(ReportRecordingReader reader(FILENAME), std::runtime_error);
+    ASSERT_THROW(ReportRecordingReader reader("no/such/file.osvrrec"),
+                 std::runtime_error);
+}
+
+TEST_F(ReportRecording, TruncatedEntryEndsRecording) {
+    recordMessages(3);
+    std::string contents;
+    {
+        std::ifstream file(FILENAME, std::ios::binary);
+        contents.assign(std::istreambuf_iterator<char>(file),
+                        std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream file(FILENAME, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), contents.size() - 2);
+    }
+    ReportRecordingReader reader(FILENAME);
+    RecordedEntry entry;
+    int messages = 0;
+    while (reader.read(entry)) {
+        if (entry.kind == RecordedEntry::Kind::Message) {
+            ++messages;
+        }
+    }
+    ASSERT_EQ(2, messages);
+}
+
+TEST_F(ReportRecording, PacedReplay) {
+    recordMessages(3, 20);
+    auto sent = readSentTimes();
+    ASSERT_EQ(4, sent.size());
+
+    std::vector<RecordedEntry> replayed;
+    std::vector<TimeValue> timestamps;
+    auto replayer = ReportReplayer::create(
+        [&](RecordedEntry const &entry, TimeValue const &timestamp) {
+            if (entry.kind == RecordedEntry::Kind::Message) {
+                replayed.push_back(entry);
+                timestamps.push_back(timestamp);
+            }
+        },
+        FILENAME, 2.);
+
+    /// At twice the speed, each message is due at half its original offset
+    /// from the first entry, the descriptor.
+    int64_t start = 5000000;
+    auto firstDue = start + (sent[1] - sent[0]) / 2;
+    auto secondDue = start + (sent[2] - sent[0]) / 2;
+    auto thirdDue = start + (sent[3] - sent[0]) / 2;
+    ASSERT_TRUE(replayer->update(fromMicroseconds(start)));
+    ASSERT_TRUE(replayer->update(fromMicroseconds(firstDue)));
+    ASSERT_EQ(1, replayed.size());
+    ASSERT_TRUE(replayer->update(fromMicroseconds(secondDue - 1)));
+    ASSERT_EQ(1, replayed.size());
+    ASSERT_TRUE(replayer->update(fromMicroseconds(secondDue)));
+    ASSERT_EQ(2, replayed.size());
+    ASSERT_EQ(0, replayer->getStats().maxLagMicroseconds);
+
+    /// Late by 1ms.
+    ASSERT_FALSE(replayer->update(fromMicroseconds(thirdDue + 1000)));
+    ASSERT_EQ(3, replayed.size());
+    auto const &stats = replayer->getStats();
+    ASSERT_TRUE(stats.finished);
+    ASSERT_EQ(3, stats.messages);
+    ASSERT_EQ(3, stats.bytes);
+    ASSERT_EQ(1, stats.passes);
+    ASSERT_NEAR(1000, stats.maxLagMicroseconds, 1);
+
+    /// Timestamps keep their original offset from the time sent.
+    int64_t const replayedAt[] = {firstDue, secondDue, thirdDue + 1000};
+    for (std::size_t i = 0; i < replayed.size(); ++i) {
+        ASSERT_EQ(static_cast<char>(i), replayed[i].data[0]);
+        ASSERT_EQ(toMicroseconds(replayed[i].sent) -
+                      toMicroseconds(replayed[i].timestamp),
+                  replayedAt[i] - toMicroseconds(timestamps[i]));
+    }
+}
+
+TEST_F(ReportRecording, UnpacedReplayIsBatched) {
+    recordMessages(300);
+    std::size_t messages = 0;
+    auto replayer = ReportReplayer::create(
+        [&](RecordedEntry const &entry, TimeValue const &) {
+            if (entry.kind == RecordedEntry::Kind::Message) {
+                ++messages;
+            }
+        },
+        FILENAME, ReportReplayer::AS_FAST_AS_POSSIBLE);
+    auto now = fromMicroseconds(1000000);
+    /// The descriptor counts towards the batch.
+    ASSERT_TRUE(replayer->update(now));
+    ASSERT_EQ(ReportReplayer::UNPACED_BATCH_SIZE - 1, messages);
+    ASSERT_FALSE(replayer->update(now));
+    ASSERT_EQ(300, messages);
+    ASSERT_EQ(0, replayer->getStats().maxLagMicroseconds);
+}
+
+TEST_F(ReportRecording, LoopingReplay) {
+    recordMessages(2);
+    std::size_t descriptors = 0;
+    std::size_t messages = 0;
+    auto replayer = ReportReplayer::create(
+        [&](RecordedEntry const &entry, TimeValue const &) {
+            if (entry.kind == RecordedEntry::Kind::Message) {
+                ++messages;
+            } else if (entry.kind == RecordedEntry::Kind::Descriptor) {
+                ++descriptors;
+            }
+        },
+        FILENAME, ReportReplayer::AS_FAST_AS_POSSIBLE, true);
+    auto now = fromMicroseconds(1000000);
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(replayer->update(now));
+    }
+    ASSERT_EQ(3, replayer->getStats().passes);
+    ASSERT_EQ(6, messages);
+    ASSERT_EQ(3, descriptors);
+    ASSERT_FALSE(replayer->getStats().finished);
+}
+
+static void VRPN_CALLBACK handleTracker(void *userdata,
+                                       const vrpn_TRACKERCB info) {
+    static_cast<std::vector<vrpn_TRACKERCB> *>(userdata)->push_back(info);
+}
+
+TEST_F(ReportRecording, TrackerReportReplayed) {
+    {
+        auto conn = std::get<1>(Connection::createLoopbackConnection());
+        conn->setReportRecorder(ReportRecorder::create(FILENAME));
+        DeviceInitObject init(conn);
+        init.setName("Tracker");
+        TrackerServerInterface *tracker = nullptr;
+        init.setTracker(&tracker);
+        auto token = DeviceToken::createSyncDevice(init);
+        ASSERT_NE(nullptr, tracker);
+        OSVR_PoseState pose = {{{1., 2., 3.}}, {{1., 0., 0., 0.}}};
+        tracker->sendReport(pose, 2, makeTime(10, 20));
+        /// Lets go of the recorder, which flushes the file.
+        conn->setReportRecorder(osvr::connection::ReportRecorderPtr());
+    }
+
+    /// Recorded by name, as it left the VRPN tracker server.
+    {
+        ReportRecordingReader reader(FILENAME);
+        RecordedEntry entry;
+        std::string messageType;
+        int messages = 0;
+        while (reader.read(entry)) {
+            if (entry.kind == RecordedEntry::Kind::Stream) {
+                ASSERT_EQ("Tracker", entry.device);
+                messageType = entry.messageType;
+            } else if (entry.kind == RecordedEntry::Kind::Message) {
+                ASSERT_EQ(10, entry.timestamp.seconds);
+                ASSERT_EQ(20, entry.timestamp.microseconds);
+                ++messages;
+            }
+        }
+        ASSERT_EQ("vrpn_Tracker Pos_Quat", messageType);
+        ASSERT_EQ(1, messages);
+    }
+
+    /// Replayed on another connection, it's a tracker report again.
+    auto loopback = Connection::createLoopbackConnection();
+    auto conn = std::get<1>(loopback);
+    std::vector<vrpn_TRACKERCB> received;
+    vrpn_Tracker_Remote remote(
+        "Tracker", static_cast<vrpn_Connection *>(std::get<0>(loopback)));
+    remote.register_change_handler(&received, &handleTracker);
+    auto replayer = ReportReplayer::create(
+        conn, FILENAME, ReportReplayer::AS_FAST_AS_POSSIBLE);
+    while (replayer->update()) {
+    }
+    conn->process();
+    remote.mainloop();
+
+    ASSERT_EQ(1, received.size());
+    ASSERT_EQ(2, received[0].sensor);
+    ASSERT_EQ(1., received[0].pos[0]);
+    ASSERT_EQ(2., received[0].pos[1]);
+    ASSERT_EQ(3., received[0].pos[2]);
+}
@@ -0,0 +1,199 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include "../../../src/osvr/Server/ConfigReload.h"
+#include "../../../src/osvr/Server/ConfigReload.cpp"
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+#include <json/reader.h>
+
+// Standard includes
+#include <string>
+
+using osvr::server::ConfigReload;
+
+inline Json::Value parse(std::string const &json) {
+    Json::Value ret;
+    Json::Reader reader;
+    EXPECT_TRUE(reader.parse(json, ret)) << json;
+    return ret;
+}
+
+inline bool restartRequiredFor(ConfigReload const &reload,
+                               std::string const &what) {
+    for (auto const &change : reload.getRestartRequired()) {
+        if (change.first == what) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static const char BASE_CONFIG[] = R"({
+    "server": {"sleep": 1000},
+    "plugins": ["com_osvr_Example"],
+    "drivers": [
+        {"plugin": "com_osvr_Example", "driver": "A", "params": {"x": 1}}
+    ],
+    "routes": [
+        {"destination": "/me/head", "source": "/a/tracker/0"}
+    ],
+    "aliases": {"/me/hands/left": "/a/tracker/1"}
+})";
+
+TEST(ConfigReload, Unchanged) {
+    auto config = parse(BASE_CONFIG);
+    ConfigReload reload(config, config);
+    ASSERT_TRUE(reload.getRestartRequired().empty());
+    ASSERT_TRUE(reload.getDelta().empty());
+    ASSERT_EQ(config, reload.getApplied({}, {}));
+}
+
+TEST(ConfigReload, AddedRoute) {
+    auto oldConfig = parse(BASE_CONFIG);
+    auto newConfig = oldConfig;
+    newConfig["routes"].append(
+        parse(R"({"destination": "/me/feet", "source": "/a/tracker/2"})"));
+    ConfigReload reload(oldConfig, newConfig);
+    ASSERT_TRUE(reload.getRestartRequired().empty());
+    auto const &routes = reload.getDelta()["routes"];
+    ASSERT_EQ(1u, routes.size());
+    ASSERT_EQ("/me/feet", routes[0]["destination"].asString());
+    ASSERT_EQ(newConfig, reload.getApplied({}, {}));
+}
+
+TEST(ConfigReload, ChangedRoute) {
+    auto oldConfig = parse(BASE_CONFIG);
+    auto newConfig = oldConfig;
+    newConfig["routes"][0]["source"] = "/a/tracker/2";
+    ConfigReload reload(oldConfig, newConfig);
+    ASSERT_TRUE(reload.getRestartRequired().empty());
+    auto const &routes = reload.getDelta()["routes"];
+    ASSERT_EQ(1u, routes.size());
+    ASSERT_EQ("/a/tracker/2", routes[0]["source"].asString());
+    /// The new route replaced the old one.
+    ASSERT_EQ(newConfig, reload.getApplied({}, {}));
+}
+
+TEST(ConfigReload, RemovedRouteKept) {
+    auto oldConfig = parse(BASE_CONFIG);
+    auto newConfig = oldConfig;
+    newConfig["routes"] = Json::Value(Json::arrayValue);
+    ConfigReload reload(oldConfig, newConfig);
+    ASSERT_TRUE(restartRequiredFor(reload, "/me/head"));
+    ASSERT_FALSE(reload.getDelta().isMember("routes"));
+    auto applied = reload.getApplied({}, {});
+    ASSERT_EQ(oldConfig["routes"], applied["routes"]);
+
+    /// Still reported next time.
+    ConfigReload again(applied, newConfig);
+    ASSERT_TRUE(restartRequiredFor(again, "/me/head"));
+}
+
+TEST(ConfigReload, AddedAndChangedAliases) {
+    auto oldConfig = parse(BASE_CONFIG);
+    auto newConfig = oldConfig;
+    newConfig["aliases"]["/me/hands/left"] = "/a/tracker/3";
+    newConfig["aliases"]["/me/hands/right"] = "/a/tracker/4";
+    ConfigReload reload(oldConfig, newConfig);
+    ASSERT_TRUE(reload.getRestartRequired().empty());
+    auto const &aliases = reload.getDelta()["aliases"];
+    ASSERT_EQ(2u, aliases.size());
+    ASSERT_EQ("/a/tracker/3", aliases["/me/hands/left"].asString());
+    ASSERT_EQ("/a/tracker/4", aliases["/me/hands/right"].asString());
+    ASSERT_EQ(newConfig, reload.getApplied({}, {}));
+}
+
+TEST(ConfigReload, RemovedAliasKept) {
+    auto oldConfig = parse(BASE_CONFIG);
+    auto newConfig = oldConfig;
+    newConfig["aliases"] = parse(R"({"/me/hands/right": "/a/tracker/4"})");
+    ConfigReload reload(oldConfig, newConfig);
+    ASSERT_TRUE(restartRequiredFor(reload, "/me/hands/left"));
+    auto applied = reload.getApplied({}, {});
+    ASSERT_EQ(2u, applied["aliases"].size());
+    ASSERT_EQ("/a/tracker/1", applied["aliases"]["/me/hands/left"].asString());
+
+    ConfigReload again(applied, newConfig);
+    ASSERT_TRUE(restartRequiredFor(again, "/me/hands/left"));
+    ASSERT_FALSE(again.getDelta().isMember("aliases"));
+}
+
+TEST(ConfigReload, AddedDriver) {
+    auto oldConfig = parse(BASE_CONFIG);
+    auto newConfig = oldConfig;
+    newConfig["drivers"].append(
+        parse(R"({"plugin": "com_osvr_Example", "driver": "B"})"));
+    ConfigReload reload(oldConfig, newConfig);
+    ASSERT_TRUE(reload.getRestartRequired().empty());
+    auto const &drivers = reload.getDelta()["drivers"];
+    ASSERT_EQ(1u, drivers.size());
+    ASSERT_EQ("B", drivers[0]["driver"].asString());
+    ASSERT_EQ(newConfig, reload.getApplied({}, {"com_osvr_Example/B"}));
+}
+
+TEST(ConfigReload, FailedDriverRetried) {
+    auto oldConfig = parse(BASE_CONFIG);
+    auto newConfig = oldConfig;
+    newConfig["plugins"].append("com_osvr_Missing");
+    newConfig["drivers"].append(
+        parse(R"({"plugin": "com_osvr_Missing", "driver": "B"})"));
+    ConfigReload reload(oldConfig, newConfig);
+    ASSERT_EQ(1u, reload.getDelta()["plugins"].size());
+    ASSERT_EQ(1u, reload.getDelta()["drivers"].size());
+
+    /// Neither the plugin nor the driver loaded.
+    auto applied = reload.getApplied({}, {});
+    ASSERT_EQ(oldConfig, applied);
+
+    ConfigReload again(applied, newConfig);
+    ASSERT_TRUE(again.getRestartRequired().empty());
+    ASSERT_EQ(reload.getDelta(), again.getDelta());
+}
+
+TEST(ConfigReload, ChangedDriverKept) {
+    auto oldConfig = parse(BASE_CONFIG);
+    auto newConfig = oldConfig;
+    newConfig["drivers"][0]["params"]["x"] = 2;
+    ConfigReload reload(oldConfig, newConfig);
+    ASSERT_TRUE(restartRequiredFor(reload, "com_osvr_Example/A"));
+    ASSERT_FALSE(reload.getDelta().isMember("drivers"));
+    auto applied = reload.getApplied({}, {});
+    ASSERT_EQ(oldConfig["drivers"], applied["drivers"]);
+
+    ConfigReload again(applied, newConfig);
+    ASSERT_TRUE(restartRequiredFor(again, "com_osvr_Example/A"));
+    ASSERT_FALSE(again.getDelta().isMember("drivers"));
+}
+
+TEST(ConfigReload, ServerSettingsKept) {
+    auto oldConfig = parse(BASE_CONFIG);
+    auto newConfig = oldConfig;
+    newConfig["server"]["sleep"] = 0;
+    ConfigReload reload(oldConfig, newConfig);
+    ASSERT_TRUE(restartRequiredFor(reload, "server"));
+    ASSERT_EQ(oldConfig, reload.getApplied({}, {}));
+}
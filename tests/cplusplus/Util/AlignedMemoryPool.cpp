@@ -0,0 +1,132 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Util/AlignedMemoryPool.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using osvr::util::AlignedMemoryPool;
+using osvr::util::makePooledImageBuffer;
+
+static bool isAligned(void *p, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+TEST(AlignedMemoryPool, SizeClasses) {
+    ASSERT_EQ(AlignedMemoryPool::getSizeClass(1), 4096);
+    ASSERT_EQ(AlignedMemoryPool::getSizeClass(4096), 4096);
+    ASSERT_EQ(AlignedMemoryPool::getSizeClass(4097), 5120);
+    ASSERT_EQ(AlignedMemoryPool::getSizeClass(8192), 8192);
+    /// 640x480 8-bit
+    ASSERT_EQ(AlignedMemoryPool::getSizeClass(307200), 327680);
+    for (std::size_t bytes = 1; bytes < 10000000; bytes = bytes * 3 + 1) {
+        auto sizeClass = AlignedMemoryPool::getSizeClass(bytes);
+        ASSERT_GE(sizeClass, bytes);
+        ASSERT_LT(sizeClass, bytes + bytes / 4 + 4096);
+    }
+}
+
+TEST(AlignedMemoryPool, ReusesBuffers) {
+    auto pool = AlignedMemoryPool::create();
+    void *first = pool->acquire(100000);
+    ASSERT_TRUE(isAligned(first, pool->getAlignment()));
+    pool->release(first, 100000);
+    ASSERT_EQ(pool->getStats().bytesRetained,
+              AlignedMemoryPool::getSizeClass(100000));
+
+    void *second = pool->acquire(100001);
+    ASSERT_EQ(first, second) << "Same size class should reuse the buffer";
+    void *third = pool->acquire(100000);
+    ASSERT_NE(second, third);
+
+    auto stats = pool->getStats();
+    ASSERT_EQ(stats.hits, 1);
+    ASSERT_EQ(stats.misses, 2);
+    ASSERT_EQ(stats.bytesRetained, 0);
+    pool->release(second, 100001);
+    pool->release(third, 100000);
+}
+
+TEST(AlignedMemoryPool, RetentionLimit) {
+    auto pool = AlignedMemoryPool::create(8192);
+    void *a = pool->acquire(8192);
+    void *b = pool->acquire(8192);
+    pool->release(a, 8192);
+    pool->release(b, 8192);
+    auto stats = pool->getStats();
+    ASSERT_EQ(stats.bytesRetained, 8192);
+    ASSERT_EQ(stats.discards, 1);
+    pool->trim();
+    ASSERT_EQ(pool->getStats().bytesRetained, 0);
+}
+
+TEST(AlignedMemoryPool, SmartPointerReturnsToPool) {
+    auto pool = AlignedMemoryPool::create();
+    OSVR_ImageBufferElement *raw = nullptr;
+    {
+        auto buf = makePooledImageBuffer(640 * 480, pool);
+        raw = buf.get();
+        /// Also works once it's made its way into a shared_ptr.
+        osvr::shared_ptr<OSVR_ImageBufferElement> shared(std::move(buf));
+    }
+    ASSERT_EQ(pool->getStats().bytesRetained,
+              AlignedMemoryPool::getSizeClass(640 * 480));
+    auto buf = makePooledImageBuffer(640 * 480, pool);
+    ASSERT_EQ(raw, buf.get());
+}
+
+TEST(AlignedMemoryPool, BuffersKeepPoolAlive) {
+    auto pool = AlignedMemoryPool::create();
+    auto buf = makePooledImageBuffer(1000, pool);
+    pool.reset();
+    buf.reset();
+}
+
+TEST(AlignedMemoryPool, ThreadSafety) {
+    auto pool = AlignedMemoryPool::create();
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&pool, t] {
+            for (int i = 0; i < 1000; ++i) {
+                auto bytes = std::size_t(4096 * (1 + (i + t) % 5));
+                auto buf = makePooledImageBuffer(bytes, pool);
+                buf.get()[bytes - 1] = 0;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto stats = pool->getStats();
+    ASSERT_EQ(stats.hits + stats.misses, 4000);
+    ASSERT_GT(stats.hits, stats.misses);
+}
@@ -0,0 +1,162 @@
+/** @file
+    @brief Test Implementation
+
+    @date 2026
+
+    @author
+    Sensics, Inc.
+    <http://sensics.com/osvr>
+
+*/
+
+// Copyright 2026 Sensics, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Internal Includes
+#include <osvr/Util/DeferredLogger.h>
+
+// Library/third-party includes
+#include "gtest/gtest.h"
+
+// Standard includes
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using osvr::util::log::DeferredLogger;
+using osvr::util::log::DeferredLogArg;
+using osvr::util::log::LogLevel;
+
+/// Collects messages handed to it by a DeferredLogger.
+class Collector {
+  public:
+    DeferredLogger::Handler getHandler() {
+        return [&](LogLevel level, std::string const &msg) {
+            std::lock_guard<std::mutex> lock(mutex);
+            messages.emplace_back(level, msg);
+        };
+    }
+    std::vector<std::pair<LogLevel, std::string>> get() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return messages;
+    }
+    std::mutex mutex;
+    std::vector<std::pair<LogLevel, std::string>> messages;
+};
+
+TEST(DeferredLogger, Format) {
+    DeferredLogArg args[] = {DeferredLogArg::makeSigned(-3),
+                             DeferredLogArg::makeFloating(1.5),
+                             DeferredLogArg::makeString("str"),
+                             DeferredLogArg::makeBoolean(true)};
+    ASSERT_EQ(DeferredLogger::format("a {} b {} c {} d {}", args, 4),
+              "a -3 b 1.5 c str d true");
+    ASSERT_EQ(DeferredLogger::format("no args {}", args, 0), "no args {}");
+    ASSERT_EQ(DeferredLogger::format("{} and", args, 3), "-3 and 1.5 str");
+}
+
+TEST(DeferredLogger, DeliversMessages) {
+    Collector collector;
+    {
+        auto logger = DeferredLogger::make(collector.getHandler());
+        unsigned char small = 200;
+        logger->info("sequence {} of {} bytes", 42u, std::size_t(1024));
+        logger->debug("small {} ratio {}", small, 0.25f);
+        logger->flush();
+        auto messages = collector.get();
+        ASSERT_EQ(messages.size(), 2);
+        ASSERT_EQ(messages[0].first, LogLevel::info);
+        ASSERT_EQ(messages[0].second, "sequence 42 of 1024 bytes");
+        ASSERT_EQ(messages[1].first, LogLevel::debug);
+        ASSERT_EQ(messages[1].second, "small 200 ratio 0.25");
+
+        logger->warn("written out at destruction");
+    }
+    ASSERT_EQ(collector.get().size(), 3);
+}
+
+TEST(DeferredLogger, LevelFiltering) {
+    Collector collector;
+    auto logger = DeferredLogger::make(collector.getHandler());
+    logger->setLogLevel(LogLevel::info);
+    ASSERT_FALSE(logger->shouldLog(LogLevel::debug));
+    logger->debug("filtered {}", 1);
+    logger->error("kept {}", 2);
+    logger->flush();
+    auto messages = collector.get();
+    ASSERT_EQ(messages.size(), 1);
+    ASSERT_EQ(messages[0].second, "kept 2");
+}
+
+TEST(DeferredLogger, CountsDrops) {
+    Collector collector;
+    std::mutex blocker;
+    auto handler = collector.getHandler();
+    std::unique_lock<std::mutex> blocked(blocker);
+    auto logger = DeferredLogger::make(
+        [&](LogLevel level, std::string const &msg) {
+            std::lock_guard<std::mutex> lock(blocker);
+            handler(level, msg);
+        },
+        4);
+    /// The background thread can take at most one queue's worth of messages
+    /// before blocking in the handler, and the queue holds four more.
+    const int count = 100;
+    for (int i = 0; i < count; ++i) {
+        logger->info("message {}", i);
+    }
+    auto dropped = logger->getDroppedCount();
+    ASSERT_GE(dropped, count - 8);
+    blocked.unlock();
+    logger->flush();
+
+    auto messages = collector.get();
+    ASSERT_EQ(messages.size(), count - dropped + 1);
+    ASSERT_EQ(messages.back().first, LogLevel::warn);
+    ASSERT_NE(messages.back().second.find("Dropped"), std::string::npos);
+}
+
+TEST(DeferredLogger, MultipleThreads) {
+    Collector collector;
+    auto logger = DeferredLogger::make(collector.getHandler());
+    const int threadCount = 4;
+    const int perThread = 200;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&logger, t] {
+            for (int i = 0; i < perThread; ++i) {
+                logger->trace("{} {}", t, i);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    logger->flush();
+    ASSERT_EQ(logger->getDroppedCount(), 0);
+    auto messages = collector.get();
+    ASSERT_EQ(messages.size(), threadCount * perThread);
+
+    /// Each thread's messages arrive in the order they were logged.
+    std::vector<int> next(threadCount, 0);
+    for (auto const &msg : messages) {
+        auto space = msg.second.find(' ');
+        auto t = std::stoi(msg.second.substr(0, space));
+        auto i = std::stoi(msg.second.substr(space + 1));
+        ASSERT_EQ(next[t], i);
+        ++next[t];
+    }
+}